@@ -262,7 +262,19 @@ namespace Plugin {
                 Core::JSON::DecUInt32 newElement;
                 newElement = snapshot.Slot[teller];
                 data.ThreadPoolRuns.Add(newElement);
+                newElement = snapshot.Local[teller];
+                data.ThreadPoolLocal.Add(newElement);
+                newElement = snapshot.Stolen[teller];
+                data.ThreadPoolStolen.Add(newElement);
             }
+
+            const PluginHost::Server::ServiceMap::TokenCache::Statistics tokens(_pluginServer->Services().TokenCacheCounters());
+
+            data.Tokens.Hits = tokens.Hits;
+            data.Tokens.Misses = tokens.Misses;
+            data.Tokens.Expired = tokens.Expired;
+            data.Tokens.Evicted = tokens.Evicted;
+            data.Tokens.Entries = tokens.Entries;
 		}
         void SubSystems();
         void SubSystems(Core::JSON::ArrayType<Core::JSON::EnumType<PluginHost::ISubSystem::subsystem>>::ConstIterator& index);
@@ -280,10 +292,12 @@ namespace Plugin {
         uint32_t endpoint_storeconfig();
         uint32_t endpoint_delete(const JsonData::Controller::DeleteParamsData& params);
         uint32_t endpoint_harakiri();
+        uint32_t endpoint_resetlatencies();
         uint32_t get_status(const string& index, Core::JSON::ArrayType<PluginHost::MetaData::Service>& response) const;
         uint32_t get_links(Core::JSON::ArrayType<PluginHost::MetaData::Channel>& response) const;
         uint32_t get_processinfo(PluginHost::MetaData::Server& response) const;
         uint32_t get_subsystems(Core::JSON::ArrayType<JsonData::Controller::SubsystemsParamsData>& response) const;
+        uint32_t get_latencies(Core::JSON::ArrayType<JsonData::Controller::LatenciesParamsData>& response) const;
         uint32_t get_discoveryresults(Core::JSON::ArrayType<PluginHost::MetaData::Bridge>& response) const;
         uint32_t get_environment(const string& index, Core::JSON::String& response) const;
         uint32_t get_configuration(const string& index, Core::JSON::String& response) const;
@@ -39,10 +39,12 @@ namespace Plugin {
         Register<void,void>(_T("storeconfig"), &Controller::endpoint_storeconfig, this);
         Register<DeleteParamsData,void>(_T("delete"), &Controller::endpoint_delete, this);
         Register<void,void>(_T("harakiri"), &Controller::endpoint_harakiri, this);
+        Register<void,void>(_T("resetlatencies"), &Controller::endpoint_resetlatencies, this);
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Service>>(_T("status"), &Controller::get_status, nullptr, this);
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Channel>>(_T("links"), &Controller::get_links, nullptr, this);
         Property<PluginHost::MetaData::Server>(_T("processinfo"), &Controller::get_processinfo, nullptr, this);
         Property<Core::JSON::ArrayType<SubsystemsParamsData>>(_T("subsystems"), &Controller::get_subsystems, nullptr, this);
+        Property<Core::JSON::ArrayType<LatenciesParamsData>>(_T("latencies"), &Controller::get_latencies, nullptr, this);
         Property<Core::JSON::ArrayType<PluginHost::MetaData::Bridge>>(_T("discoveryresults"), &Controller::get_discoveryresults, nullptr, this);
         Property<Core::JSON::String>(_T("environment"), &Controller::get_environment, nullptr, this);
         Property<Core::JSON::String>(_T("configuration"), &Controller::get_configuration, &Controller::set_configuration, this);
@@ -51,6 +53,7 @@ namespace Plugin {
 
     void Controller::UnregisterAll()
     {
+        Unregister(_T("resetlatencies"));
         Unregister(_T("harakiri"));
         Unregister(_T("delete"));
         Unregister(_T("storeconfig"));
@@ -60,6 +63,7 @@ namespace Plugin {
         Unregister(_T("configuration"));
         Unregister(_T("environment"));
         Unregister(_T("discoveryresults"));
+        Unregister(_T("latencies"));
         Unregister(_T("subsystems"));
         Unregister(_T("processinfo"));
         Unregister(_T("links"));
@@ -220,6 +224,16 @@ namespace Plugin {
         return result;
     }
 
+    // Method: resetlatencies - Clears the call latency histograms
+    // Return codes:
+    //  - ERROR_NONE: Success
+    uint32_t Controller::endpoint_resetlatencies()
+    {
+        Core::CallLatencies::Instance().Reset();
+
+        return Core::ERROR_NONE;
+    }
+
 
     // Method: clone - Clone a plugin
     // Return codes:
@@ -337,6 +351,42 @@ namespace Plugin {
         return Core::ERROR_NONE;
     }
 
+    // Property: latencies - Call latencies, per COM-RPC interface method and per JSON-RPC method
+    // Return codes:
+    //  - ERROR_NONE: Success
+    uint32_t Controller::get_latencies(Core::JSON::ArrayType<LatenciesParamsData>& response) const
+    {
+        Core::CallLatencies::Instance().Visit([&response](const Core::CallLatencies::Entry& entry) {
+            const Core::Histogram& histogram(entry.Histogram());
+
+            if (histogram.Count() > 0) {
+                LatenciesParamsData latency;
+
+                if (entry.Origin() == Core::CallLatencies::JSONRPC) {
+                    latency.Type = _T("jsonrpc");
+                    latency.Callsign = entry.Callsign();
+                    latency.Method = entry.Method();
+                } else {
+                    latency.Type = (entry.Origin() == Core::CallLatencies::COMRPC_INBOUND ? _T("comrpc-inbound") : _T("comrpc-outbound"));
+                    latency.Interface = entry.InterfaceId();
+                    latency.Methodid = entry.MethodId();
+                }
+
+                latency.Count = histogram.Count();
+                latency.Min = histogram.Min();
+                latency.Max = histogram.Max();
+                latency.Average = histogram.Average();
+                latency.P50 = histogram.Percentile(50);
+                latency.P90 = histogram.Percentile(90);
+                latency.P99 = histogram.Percentile(99);
+
+                response.Add(latency);
+            }
+        });
+
+        return Core::ERROR_NONE;
+    }
+
     // Property: discoveryresults - SSDP network discovery results
     // Return codes:
     //  - ERROR_NONE: Success
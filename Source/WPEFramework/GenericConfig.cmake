@@ -33,6 +33,13 @@ set(PRIORITY 0 CACHE STRING "Change the nice level [-20 - 20]")
 set(POLICY "OTHER" CACHE STRING "NA")
 set(OOMADJUST 0 CACHE STRING "Adapt the OOM score [-15 - 15]")
 set(STACKSIZE 0 CACHE STRING "Default stack size per thread")
+set(REACTORS 1 CACHE STRING "Number of resource monitor (socket I/O) threads")
+set(WORKSTEALING false CACHE STRING "Keep jobs submitted from a worker thread local, idle threads steal them")
+set(COMPRESSION "disabled" CACHE STRING "permessage-deflate on the WebSocket connections: disabled, enabled or nocontexttakeover")
+set(COMPRESSION_THRESHOLD 256 CACHE STRING "Messages smaller than this (in bytes) are not compressed")
+set(COMPRESSION_WINDOWBITS 15 CACHE STRING "Window bits of the compressor [9 - 15]")
+set(TOKEN_CACHE_ENTRIES 32 CACHE STRING "Number of tokens for which the security officer is remembered, 0 turns it off")
+set(TOKEN_CACHE_LIFETIME 10 CACHE STRING "Seconds a token stays in the token cache")
 set(KEY_OUTPUT_DISABLED false CACHE STRING "New outputs on the VirtualInput will be disabled by default")
 
 map()
@@ -63,6 +70,28 @@ end()
 ans(PROCESS_CONFIG)
 map_append(${CONFIG} process ${PROCESS_CONFIG})
 
+map()
+    kv(reactors ${REACTORS})
+    kv(workstealing ${WORKSTEALING})
+end()
+ans(WORKERPOOL_CONFIG)
+map_append(${CONFIG} workerpool ${WORKERPOOL_CONFIG})
+
+map()
+    kv(mode ${COMPRESSION})
+    kv(threshold ${COMPRESSION_THRESHOLD})
+    kv(windowbits ${COMPRESSION_WINDOWBITS})
+end()
+ans(COMPRESSION_CONFIG)
+map_append(${CONFIG} compression ${COMPRESSION_CONFIG})
+
+map()
+    kv(entries ${TOKEN_CACHE_ENTRIES})
+    kv(lifetime ${TOKEN_CACHE_LIFETIME})
+end()
+ans(TOKEN_CACHE_CONFIG)
+map_append(${CONFIG} tokencache ${TOKEN_CACHE_CONFIG})
+
 map()
     kv(callsign Controller)
     key(configuration)
@@ -398,6 +398,12 @@ namespace PluginHost {
             }
         }
 
+        if ((serviceConfig.WorkerPool.Reactors.IsSet() == true) && (serviceConfig.WorkerPool.Reactors.Value() > 0)) {
+            if (Core::ResourceMonitor::Instance().Reactors(serviceConfig.WorkerPool.Reactors.Value()) != Core::ERROR_NONE) {
+                SYSLOG(Logging::Startup, (_T("Could not start %d reactors, resources are already being monitored."), serviceConfig.WorkerPool.Reactors.Value()));
+            }
+        }
+
 #ifndef __WINDOWS__
         ::umask(serviceConfig.Process.Umask.Value());
 #endif
@@ -630,7 +636,7 @@ namespace PluginHost {
                     printf("Occupation:  %d\n", metaData.Occupation);
                     printf("Poolruns:\n");
                     for (uint8_t index = 0; index < metaData.Slots; index++) {
-                        printf("  Thread%02d:  %d\n", (index + 1), metaData.Slot[index]);
+                        printf("  Thread%02d:  %d (local: %d, stolen: %d)\n", (index + 1), metaData.Slot[index], metaData.Local[index], metaData.Stolen[index]);
                     }
                     status->Release();
                     break;
@@ -644,7 +650,7 @@ namespace PluginHost {
                     printf("\nResource Monitor Entry states:\n");
                     printf("============================================================\n");
                     Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
-                    printf("Currently monitoring: %d resources\n", monitor.Count());
+                    printf("Currently monitoring: %d resources on %d reactors\n", monitor.Count(), monitor.Reactors());
                     uint32_t index = 0;
                     Core::ResourceMonitor::Metadata info;
 
@@ -692,7 +698,10 @@ namespace PluginHost {
                 case 'R': {
                     printf("\nMonitor callstack:\n");
                     printf("============================================================\n");
-                    PublishCallstack(Core::ResourceMonitor::Instance().Id());
+                    Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
+                    for (uint8_t index = 0; index < monitor.Reactors(); index++) {
+                        PublishCallstack(monitor.Id(index));
+                    }
                     break;
                 }
                 case '0':
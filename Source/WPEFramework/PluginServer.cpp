@@ -241,6 +241,9 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
     {
         _adminLock.Lock();
 
+        // Let go of the officers while the plugin that handed them out is still there.
+        _officers.Clear();
+
         std::map<const string, Core::ProxyType<Service>>::iterator index(_services.end());
 
         TRACE_L1("Deactivating %d plugins.", static_cast<uint32_t>(_services.size()));
@@ -588,6 +591,12 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
         , _security(_parent.Officer())
         , _service()
     {
+        const ChannelMap& connections(static_cast<const ChannelMap&>(*parent));
+
+        if (connections.CompressionMode() != Web::WebSocket::Deflate::DISABLED) {
+            Compression(connections.CompressionMode(), connections.CompressionThreshold(), connections.CompressionWindowBits());
+        }
+
         TRACE(Activity, (_T("Construct a link with ID: [%d] to [%s]"), Id(), remoteId.QualifiedName().c_str()));
     }
 
@@ -627,7 +636,8 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
 
     Server::Server(Server::Config & configuration, const bool background)
         : _accessor()
-        , _dispatcher(configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0)
+        , _dispatcher(configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0,
+              configuration.WorkerPool.WorkStealing.Value())
         , _connections(*this, DetermineAccessor(configuration, _accessor), configuration.IdleTime)
         , _config(configuration.Version.Value(),
               DetermineProperModel(configuration.Model),
@@ -643,7 +653,8 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
               _accessor,
               Core::NodeId(configuration.Communicator.Value().c_str()),
               configuration.Redirect.Value())
-        , _services(*this, _config, configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0)
+        , _services(*this, _config, configuration.Process.IsSet() ? configuration.Process.StackSize.Value() : 0,
+              configuration.TokenCache.Entries.Value(), configuration.TokenCache.Lifetime.Value() * 1000)
         , _controller()
         , _factoriesImplementation()
     {
@@ -660,6 +671,17 @@ ENUM_CONVERSION_BEGIN(Core::ProcessInfo::scheduler)
             _environment.Set(_config, configuration.Environments);
         }
 
+        if (configuration.Compression.Mode.Value() != Web::WebSocket::Deflate::DISABLED) {
+            uint8_t windowBits = configuration.Compression.WindowBits.Value();
+
+            if ((windowBits < 9) || (windowBits > 15)) {
+                SYSLOG(Logging::Startup, (_T("Compression window bits [%d] not in [9..15], using 15."), windowBits));
+                windowBits = 15;
+            }
+
+            _connections.Compression(configuration.Compression.Mode.Value(), configuration.Compression.Threshold.Value(), windowBits);
+        }
+
         // Lets assign a workerpool, we created it...
         Core::WorkerPool::Assign(&_dispatcher);
 
@@ -211,6 +211,109 @@ namespace PluginHost {
                 Core::JSON::Boolean OutputEnabled;
             };
 
+            // The number of reactors (socket I/O threads) next to the worker pool, and whether jobs
+            // submitted from a worker stay local to it for idle workers to steal.
+            class WorkerPoolConfig : public Core::JSON::Container {
+            public:
+                WorkerPoolConfig()
+                    : Reactors(1)
+                    , WorkStealing(false)
+                {
+                    Add(_T("reactors"), &Reactors);
+                    Add(_T("workstealing"), &WorkStealing);
+                }
+                WorkerPoolConfig(const WorkerPoolConfig& copy)
+                    : Reactors(copy.Reactors)
+                    , WorkStealing(copy.WorkStealing)
+                {
+                    Add(_T("reactors"), &Reactors);
+                    Add(_T("workstealing"), &WorkStealing);
+                }
+                ~WorkerPoolConfig()
+                {
+                }
+                WorkerPoolConfig& operator=(const WorkerPoolConfig& RHS)
+                {
+                    Reactors = RHS.Reactors;
+                    WorkStealing = RHS.WorkStealing;
+                    return (*this);
+                }
+
+                Core::JSON::DecUInt8 Reactors;
+                Core::JSON::Boolean WorkStealing;
+            };
+
+            // permessage-deflate on the WebSocket connections, offered by the clients. Messages
+            // smaller than the threshold go out as they are.
+            class CompressionConfig : public Core::JSON::Container {
+            public:
+                CompressionConfig()
+                    : Mode(Web::WebSocket::Deflate::DISABLED)
+                    , Threshold(256)
+                    , WindowBits(15)
+                {
+                    Add(_T("mode"), &Mode);
+                    Add(_T("threshold"), &Threshold);
+                    Add(_T("windowbits"), &WindowBits);
+                }
+                CompressionConfig(const CompressionConfig& copy)
+                    : Mode(copy.Mode)
+                    , Threshold(copy.Threshold)
+                    , WindowBits(copy.WindowBits)
+                {
+                    Add(_T("mode"), &Mode);
+                    Add(_T("threshold"), &Threshold);
+                    Add(_T("windowbits"), &WindowBits);
+                }
+                ~CompressionConfig()
+                {
+                }
+                CompressionConfig& operator=(const CompressionConfig& RHS)
+                {
+                    Mode = RHS.Mode;
+                    Threshold = RHS.Threshold;
+                    WindowBits = RHS.WindowBits;
+                    return (*this);
+                }
+
+                Core::JSON::EnumType<Web::WebSocket::Deflate::mode> Mode;
+                Core::JSON::DecUInt16 Threshold;
+                Core::JSON::DecUInt8 WindowBits;
+            };
+
+            // The security officers handed out for a token are remembered for a while (lifetime in
+            // seconds, never beyond the "exp" claim of the token), so a token presented on every request
+            // is validated once. 0 entries turns it off.
+            class TokenCacheConfig : public Core::JSON::Container {
+            public:
+                TokenCacheConfig()
+                    : Entries(32)
+                    , Lifetime(10)
+                {
+                    Add(_T("entries"), &Entries);
+                    Add(_T("lifetime"), &Lifetime);
+                }
+                TokenCacheConfig(const TokenCacheConfig& copy)
+                    : Entries(copy.Entries)
+                    , Lifetime(copy.Lifetime)
+                {
+                    Add(_T("entries"), &Entries);
+                    Add(_T("lifetime"), &Lifetime);
+                }
+                ~TokenCacheConfig()
+                {
+                }
+                TokenCacheConfig& operator=(const TokenCacheConfig& RHS)
+                {
+                    Entries = RHS.Entries;
+                    Lifetime = RHS.Lifetime;
+                    return (*this);
+                }
+
+                Core::JSON::DecUInt16 Entries;
+                Core::JSON::DecUInt16 Lifetime;
+            };
+
 #ifdef PROCESSCONTAINERS_ENABLED
 
             class ProcessContainerConfig : public Core::JSON::Container {
@@ -269,7 +372,10 @@ namespace PluginHost {
                 , IPV6(false)
                 , DefaultTraceCategories(false)
                 , Process()
+                , WorkerPool()
+                , Compression()
                 , Input()
+                , TokenCache()
                 , Configs()
                 , Environments()
 #ifdef PROCESSCONTAINERS_ENABLED
@@ -295,7 +401,10 @@ namespace PluginHost {
                 Add(_T("tracing"), &DefaultTraceCategories);
                 Add(_T("redirect"), &Redirect);
                 Add(_T("process"), &Process);
+                Add(_T("workerpool"), &WorkerPool);
+                Add(_T("compression"), &Compression);
                 Add(_T("input"), &Input);
+                Add(_T("tokencache"), &TokenCache);
                 Add(_T("plugins"), &Plugins);
                 Add(_T("configs"), &Configs);
                 Add(_T("environments"), &Environments);
@@ -327,7 +436,10 @@ namespace PluginHost {
             Core::JSON::Boolean IPV6;
             Core::JSON::String DefaultTraceCategories;
             ProcessSet Process;
+            WorkerPoolConfig WorkerPool;
+            CompressionConfig Compression;
             InputConfig Input;
+            TokenCacheConfig TokenCache;
             Core::JSON::String Configs;
             Core::JSON::ArrayType<Plugin::Config> Plugins;
             Core::JSON::ArrayType<Environment::Config> Environments;
@@ -343,8 +455,8 @@ namespace PluginHost {
             WorkerPoolImplementation(const WorkerPoolImplementation&) = delete;
             WorkerPoolImplementation& operator=(const WorkerPoolImplementation&) = delete;
 
-            WorkerPoolImplementation(const uint32_t stackSize)
-                : Core::WorkerPool(THREADPOOL_COUNT, stackSize, 16)
+            WorkerPoolImplementation(const uint32_t stackSize, const bool stealing)
+                : Core::WorkerPool(THREADPOOL_COUNT, stackSize, 16, stealing)
             {
             }
             virtual ~WorkerPoolImplementation()
@@ -822,7 +934,7 @@ namespace PluginHost {
                     result = _unavailableHandler;
                 } else if (IsWebServerRequest(request.Path) == true) {
                     result = IFactories::Instance().Response();
-                    FileToServe(request.Path, *result);
+                    FileToServe(request, *result);
                 } else if (request.Verb == Web::Request::HTTP_OPTIONS) {
 
                     result = IFactories::Instance().Response();
@@ -1633,6 +1745,65 @@ namespace PluginHost {
                 Core::string _fileName;
                 std::map<string, Plugin> _callsigns;
             };
+            // Holds a reference on an officer as long as it is in the token cache.
+            class OfficerReference {
+            public:
+                OfficerReference()
+                    : _officer(nullptr)
+                {
+                }
+                explicit OfficerReference(ISecurity* officer)
+                    : _officer(officer)
+                {
+                    if (_officer != nullptr) {
+                        _officer->AddRef();
+                    }
+                }
+                OfficerReference(const OfficerReference& copy)
+                    : _officer(copy._officer)
+                {
+                    if (_officer != nullptr) {
+                        _officer->AddRef();
+                    }
+                }
+                ~OfficerReference()
+                {
+                    if (_officer != nullptr) {
+                        _officer->Release();
+                    }
+                }
+
+                OfficerReference& operator=(const OfficerReference& RHS)
+                {
+                    if (RHS._officer != nullptr) {
+                        RHS._officer->AddRef();
+                    }
+                    if (_officer != nullptr) {
+                        _officer->Release();
+                    }
+                    _officer = RHS._officer;
+
+                    return (*this);
+                }
+
+            public:
+                // Like the IAuthenticate::Officer, the caller gets a reference it should release.
+                inline ISecurity* Officer() const
+                {
+                    if (_officer != nullptr) {
+                        _officer->AddRef();
+                    }
+                    return (_officer);
+                }
+
+            private:
+                ISecurity* _officer;
+            };
+
+        public:
+            typedef Core::ValidationCacheType<OfficerReference> TokenCache;
+
+        private:
             class SubSystems : public Core::IDispatch, public SystemInfo {
             private:
                 SubSystems() = delete;
@@ -1717,7 +1888,7 @@ namespace PluginHost {
 #ifdef __WINDOWS__
 #pragma warning(disable : 4355)
 #endif
-            ServiceMap(Server& server, PluginHost::Config& config, const uint32_t stackSize)
+            ServiceMap(Server& server, PluginHost::Config& config, const uint32_t stackSize, const uint16_t tokenCacheEntries, const uint32_t tokenLifetime)
                 : _webbridgeConfig(config)
                 , _adminLock()
                 , _notificationLock()
@@ -1728,6 +1899,7 @@ namespace PluginHost {
                 , _server(server)
                 , _subSystems(this)
                 , _authenticationHandler(nullptr)
+                , _officers(tokenCacheEntries, tokenLifetime)
             {
             }
 #ifdef __WINDOWS__
@@ -1744,7 +1916,12 @@ namespace PluginHost {
             {
                 _adminLock.Lock();
 
+                // The security subsystem is (re)announced, or withdrawn, by the security officer when
+                // it revokes what it handed out, whatever the officers said about a token is void.
+                _officers.Clear();
+
                 if ((_authenticationHandler == nullptr) ^ (enabled == false)) {
+
                     if (_authenticationHandler == nullptr) {
                         // Let get the AuthentcationHandler.
                         _authenticationHandler = reinterpret_cast<IAuthenticate*>(QueryInterfaceByCallsign(IAuthenticate::ID, _subSystems.SecurityCallsign()));
@@ -1763,7 +1940,17 @@ namespace PluginHost {
                 _adminLock.Lock();
 
                 if (_authenticationHandler != nullptr) {
-                    result = _authenticationHandler->Officer(token);
+                    OfficerReference cached;
+
+                    if ((_officers.IsEnabled() == true) && (_officers.Find(token, cached) == true)) {
+                        result = cached.Officer();
+                    } else {
+                        result = _authenticationHandler->Officer(token);
+
+                        if (result != nullptr) {
+                            _officers.Add(token, OfficerReference(result), Web::JSONWebToken::Lifetime(token));
+                        }
+                    }
                 } else {
                     result = _webbridgeConfig.Security();
                 }
@@ -1771,6 +1958,10 @@ namespace PluginHost {
                 _adminLock.Unlock();
                 return (result);
             }
+            inline TokenCache::Statistics TokenCacheCounters() const
+            {
+                return (_officers.Counters());
+            }
             inline uint32_t Submit(const uint32_t id, const Core::ProxyType<Core::JSON::IElement>& response)
             {
                 return (_server.Dispatcher().Submit(id, response));
@@ -1785,6 +1976,11 @@ namespace PluginHost {
             }
             void StateChange(PluginHost::IShell* entry)
             {
+                // Whatever the security officer said about a token, it might think different now.
+                if (entry->Callsign() == _subSystems.SecurityCallsign()) {
+                    _officers.Clear();
+                }
+
                 _notificationLock.Lock();
 
                 std::list<PluginHost::IPlugin::INotification*> currentlist(_notifiers);
@@ -2104,6 +2300,7 @@ namespace PluginHost {
             Server& _server;
             Core::Sink<SubSystems> _subSystems;
             IAuthenticate* _authenticationHandler;
+            TokenCache _officers;
         };
 
         // Connection handler is the listening socket and keeps track of all open
@@ -2751,6 +2948,8 @@ namespace PluginHost {
                             State(TEXT, false);
                         } else if (Protocol() == _T("jsonrpc")) {
                             State(JSONRPC, false);
+                        } else if (Protocol() == Core::JSONRPC::Message::PackedProtocol) {
+                            State(JSONRPC, false, true);
                         } else {
                             // Channel is a raw communication channel.
                             // This channel allows for passing binary data back and forth
@@ -2769,7 +2968,7 @@ namespace PluginHost {
                         if (Name().length() > (JSONRPCHeader.length() + 1)) {
                             Properties(static_cast<uint32_t>(JSONRPCHeader.length()) + 1);
                         }
-                        State(JSONRPC, false);
+                        State(JSONRPC, false, (Protocol() == Core::JSONRPC::Message::PackedProtocol));
 
                         // The state needs to be correct before we c
                         if (_service->Subscribe(*this) == false) {
@@ -2853,6 +3052,9 @@ namespace PluginHost {
                 , _parent(parent)
                 , _connectionCheckTimer(connectionCheckTimer * 1000)
                 , _job(Core::ProxyType<Job>::Create(this))
+                , _compressionMode(Web::WebSocket::Deflate::DISABLED)
+                , _compressionThreshold(0)
+                , _compressionWindowBits(15)
             {
                 if (connectionCheckTimer != 0) {
                     Core::Time NextTick = Core::Time::Now();
@@ -2907,6 +3109,25 @@ namespace PluginHost {
             {
                 return (Core::SocketServerType<Channel>::Count());
             }
+            // Applies to the connections accepted from now on.
+            inline void Compression(const uint8_t mode, const uint16_t threshold, const uint8_t windowBits)
+            {
+                _compressionMode = mode;
+                _compressionThreshold = threshold;
+                _compressionWindowBits = windowBits;
+            }
+            inline uint8_t CompressionMode() const
+            {
+                return (_compressionMode);
+            }
+            inline uint16_t CompressionThreshold() const
+            {
+                return (_compressionThreshold);
+            }
+            inline uint8_t CompressionWindowBits() const
+            {
+                return (_compressionWindowBits);
+            }
             void GetMetaData(Core::JSON::ArrayType<MetaData::Channel>& metaData) const;
 
         private:
@@ -2944,6 +3165,9 @@ namespace PluginHost {
             Server& _parent;
             const uint32_t _connectionCheckTimer;
             Core::ProxyType<Core::IDispatchType<void>> _job;
+            uint8_t _compressionMode;
+            uint16_t _compressionThreshold;
+            uint8_t _compressionWindowBits;
         };
 
     public:
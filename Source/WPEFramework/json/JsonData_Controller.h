@@ -142,6 +142,81 @@ namespace JsonData {
             Core::JSON::String Destination; // Path to the downloaded file in the persistent storage
         }; // class DownloadcompletedParamsData
 
+        class LatenciesParamsData : public Core::JSON::Container {
+        public:
+            LatenciesParamsData()
+                : Core::JSON::Container()
+            {
+                Init();
+            }
+
+            LatenciesParamsData(const LatenciesParamsData& other)
+                : Core::JSON::Container()
+                , Type(other.Type)
+                , Callsign(other.Callsign)
+                , Method(other.Method)
+                , Interface(other.Interface)
+                , Methodid(other.Methodid)
+                , Count(other.Count)
+                , Min(other.Min)
+                , Max(other.Max)
+                , Average(other.Average)
+                , P50(other.P50)
+                , P90(other.P90)
+                , P99(other.P99)
+            {
+                Init();
+            }
+
+            LatenciesParamsData& operator=(const LatenciesParamsData& rhs)
+            {
+                Type = rhs.Type;
+                Callsign = rhs.Callsign;
+                Method = rhs.Method;
+                Interface = rhs.Interface;
+                Methodid = rhs.Methodid;
+                Count = rhs.Count;
+                Min = rhs.Min;
+                Max = rhs.Max;
+                Average = rhs.Average;
+                P50 = rhs.P50;
+                P90 = rhs.P90;
+                P99 = rhs.P99;
+                return (*this);
+            }
+
+        private:
+            void Init()
+            {
+                Add(_T("type"), &Type);
+                Add(_T("callsign"), &Callsign);
+                Add(_T("method"), &Method);
+                Add(_T("interface"), &Interface);
+                Add(_T("methodid"), &Methodid);
+                Add(_T("count"), &Count);
+                Add(_T("min"), &Min);
+                Add(_T("max"), &Max);
+                Add(_T("average"), &Average);
+                Add(_T("p50"), &P50);
+                Add(_T("p90"), &P90);
+                Add(_T("p99"), &P99);
+            }
+
+        public:
+            Core::JSON::String Type; // Kind of calls measured
+            Core::JSON::String Callsign; // Callsign of the plugin (JSON-RPC only)
+            Core::JSON::String Method; // Name of the method (JSON-RPC only)
+            Core::JSON::HexUInt32 Interface; // Interface ID (COM-RPC only)
+            Core::JSON::DecUInt32 Methodid; // Index of the method in the interface (COM-RPC only)
+            Core::JSON::DecUInt64 Count; // Number of calls measured
+            Core::JSON::DecUInt64 Min; // Shortest call (in microseconds)
+            Core::JSON::DecUInt64 Max; // Longest call (in microseconds)
+            Core::JSON::DecUInt64 Average; // Average call (in microseconds)
+            Core::JSON::DecUInt64 P50; // Median call (in microseconds)
+            Core::JSON::DecUInt64 P90; // 90th percentile (in microseconds)
+            Core::JSON::DecUInt64 P99; // 99th percentile (in microseconds)
+        }; // class LatenciesParamsData
+
         class StartdiscoveryParamsData : public Core::JSON::Container {
         public:
             StartdiscoveryParamsData()
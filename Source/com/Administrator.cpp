@@ -28,7 +28,7 @@ namespace RPC {
         , _stubs()
         , _proxy()
         , _factory(8)
-        , _channelProxyMap()
+        , _proxyShards()
     {
     }
 
@@ -98,28 +98,23 @@ namespace RPC {
 
     void Administrator::UnregisterProxy(const ProxyStub::UnknownProxy& proxy)
     {
-        _adminLock.Lock();
+        const ProxyKey key(proxy.Channel().operator->(), proxy.Implementation(), proxy.InterfaceId());
+        ProxyShard& shard(Shard(key));
 
-        ChannelMap::iterator index(_channelProxyMap.find(proxy.Channel().operator->()));
+        shard._lock.Lock();
 
-        if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && ((*entry) != &proxy)) {
-                entry++;
-            }
-            if (entry != index->second.end()) {
-                index->second.erase(entry);
-                if (index->second.size() == 0) {
-                    _channelProxyMap.erase(index);
-                }
-            } else {
-                TRACE_L1("Could not find the Proxy entry to be unregistered in the channel list.");
-            }
+        std::pair<ProxyMap::iterator, ProxyMap::iterator> range(shard._proxies.equal_range(key));
+
+        while ((range.first != range.second) && (range.first->second != &proxy)) {
+            range.first++;
+        }
+        if (range.first != range.second) {
+            shard._proxies.erase(range.first);
         } else {
-            TRACE_L1("Could not find the Proxy entry to be unregistered from a channel perspective.");
+            TRACE_L1("Could not find the Proxy entry to be unregistered.");
         }
 
-        _adminLock.Unlock();
+        shard._lock.Unlock();
     }
 
     void Administrator::Invoke(Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<InvokeMessage>& message)
@@ -131,6 +126,8 @@ namespace RPC {
 
         if (index != _stubs.end()) {
             uint32_t methodId(message->Parameters().MethodId());
+            Core::CallLatencies::Measurement measurement(Core::CallLatencies::Instance().Histogram(Core::CallLatencies::COMRPC_INBOUND, interfaceId, methodId));
+
             index->second->Handle(methodId, channel, message);
         } else {
             // Oops this is an unknown interface, Do not think this could happen.
@@ -140,25 +137,21 @@ namespace RPC {
     ProxyStub::UnknownProxy* Administrator::ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, const instance_id& impl, const uint32_t id, void*& interface)
     {
         ProxyStub::UnknownProxy* result = nullptr;
+        const ProxyKey key(channel.operator->(), impl, id);
+        ProxyShard& shard(Shard(key));
 
-        _adminLock.Lock();
+        shard._lock.Lock();
 
-        ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
+        ProxyMap::iterator entry(shard._proxies.find(key));
 
-        if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                entry++;
-            }
-            if (entry != index->second.end()) {
-                interface = (*entry)->QueryInterface(id);
-                if (interface != nullptr) {
-                    result = (*entry);
-                }
+        if (entry != shard._proxies.end()) {
+            interface = entry->second->QueryInterface(id);
+            if (interface != nullptr) {
+                result = entry->second;
             }
         }
 
-        _adminLock.Unlock();
+        shard._lock.Unlock();
 
         return (result);
     }
@@ -170,28 +163,30 @@ namespace RPC {
         interface = nullptr;
 
         if (impl) {
+            const ProxyKey key(channel.operator->(), impl, id);
+            ProxyShard& shard(Shard(key));
 
-            _adminLock.Lock();
-
-            ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
+            // Holding the shard lock keeps its proxies from being unregistered, and so deleted,
+            // while we work on them. Other shards stay available to other calls.
+            shard._lock.Lock();
 
-            if (index != _channelProxyMap.end()) {
-                ProxyList::iterator entry(index->second.begin());
-                while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                    entry++;
-                }
-                if (entry != index->second.end()) {
-                    interface = (*entry)->Aquire(outbound, id);
+            std::pair<ProxyMap::iterator, ProxyMap::iterator> range(shard._proxies.equal_range(key));
 
-                    ASSERT(interface != nullptr);
+            // A proxy that is being released is still listed till it is unregistered, it no
+            // longer hands out interfaces, skip it.
+            while ((range.first != range.second) && (interface == nullptr)) {
+                interface = range.first->second->Aquire(outbound, id);
 
-                    if (interface != nullptr) {
-                        result = (*entry);
-                    }
+                if (interface != nullptr) {
+                    result = range.first->second;
+                } else {
+                    range.first++;
                 }
             }
 
             if (result == nullptr) {
+                _adminLock.Lock();
+
                 std::map<uint32_t, IMetadata*>::iterator factory(_proxy.find(id));
 
                 if (factory != _proxy.end()) {
@@ -201,7 +196,7 @@ namespace RPC {
                     ASSERT(result != nullptr);
 
                     // Register it as it is remotely registered :-)
-                    _channelProxyMap[channel.operator->()].push_back(result);
+                    shard._proxies.emplace(key, result);
 
                     // This will increment the reference count to 1.
                     interface = result->QueryInterface(id);
@@ -209,9 +204,11 @@ namespace RPC {
                 } else {
                     TRACE_L1("Failed to find a Proxy for %d.", id);
                 }
+
+                _adminLock.Unlock();
             }
-		
-            _adminLock.Unlock();
+
+            shard._lock.Unlock();
         }
 
         return (result);
@@ -253,37 +250,46 @@ namespace RPC {
 
     void Administrator::DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies)
     {
+        std::list<std::pair<uint32_t, Core::IUnknown*>> references;
+
         _adminLock.Lock();
 
         ReferenceMap::iterator remotes(_channelReferenceMap.find(channel.operator->()));
 
         if (remotes != _channelReferenceMap.end()) {
-            std::list<std::pair<uint32_t, Core::IUnknown*>>::iterator loop(remotes->second.begin());
-            while (loop != remotes->second.end()) {
-                // We will release on behalf of the other side :-)
-                loop->second->Release();
-                loop++;
-            }
+            references.swap(remotes->second);
             _channelReferenceMap.erase(remotes);
         }
 
-        ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
+        _adminLock.Unlock();
 
-        if (index != _channelProxyMap.end()) {
-            ProxyList::iterator loop(index->second.begin());
-            while (loop != index->second.end()) {
-                // There is a small possibility that the last reference to this proxy
-                // interface is released in the same time before we report this interface
-                // to be dead. So lets keep a refernce so we can work on a real object
-                // still. This race condition, was observed by customer testing.
-                (*loop)->AddRef();
-                pendingProxies.push_back(*loop);
+        // Released without the _adminLock. A release may destroy a proxy, which unregisters from its
+        // shard, and ProxyInstance takes a shard lock before the _adminLock.
+        std::list<std::pair<uint32_t, Core::IUnknown*>>::iterator loop(references.begin());
+        while (loop != references.end()) {
+            // We will release on behalf of the other side :-)
+            loop->second->Release();
+            loop++;
+        }
 
-                loop++;
+        // The proxies of a channel are spread over all shards, this is not on any call path so
+        // just visit them all.
+        for (ProxyShard& shard : _proxyShards) {
+            shard._lock.Lock();
+
+            for (std::pair<const ProxyKey, ProxyStub::UnknownProxy*>& entry : shard._proxies) {
+                if (entry.first.Channel() == channel.operator->()) {
+                    // There is a small possibility that the last reference to this proxy
+                    // interface is released in the same time before we report this interface
+                    // to be dead. So lets keep a refernce so we can work on a real object
+                    // still. This race condition, was observed by customer testing.
+                    entry.second->AddRef();
+                    pendingProxies.push_back(entry.second);
+                }
             }
-        }
 
-        _adminLock.Unlock();
+            shard._lock.Unlock();
+        }
     }
 
     /* static */ Administrator& Job::_administrator= Administrator::Instance();
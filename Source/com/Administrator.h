@@ -39,6 +39,8 @@ namespace RPC {
     enum { CommunicationTimeOut = 10000 }; // Time in ms. 10 Seconden
 #endif
     enum { CommunicationBufferSize = 8120 }; // 8K :-)
+    enum { SharedMemorySize = 0x100000 }; // 1M per direction, if the channel has shared memory.
+    enum { SharedMemoryThreshold = 2048 }; // Parameters from 2K on go through that memory.
 
     class EXTERNAL Administrator {
     private:
@@ -46,8 +48,75 @@ namespace RPC {
         Administrator(const Administrator&) = delete;
         Administrator& operator=(const Administrator&) = delete;
 
-        typedef std::list<ProxyStub::UnknownProxy*> ProxyList;
-        typedef std::map<const Core::IPCChannel*, ProxyList> ChannelMap;
+        // A proxy stands for an interface (id) of an implementation on the other side of a channel.
+        class ProxyKey {
+        public:
+            ProxyKey() = delete;
+            ProxyKey& operator=(const ProxyKey&) = delete;
+
+            ProxyKey(const Core::IPCChannel* channel, const instance_id& implementation, const uint32_t id)
+                : _channel(channel)
+                , _implementation(implementation)
+                , _id(id)
+            {
+            }
+            ProxyKey(const ProxyKey& copy)
+                : _channel(copy._channel)
+                , _implementation(copy._implementation)
+                , _id(copy._id)
+            {
+            }
+            ~ProxyKey()
+            {
+            }
+
+        public:
+            inline bool operator==(const ProxyKey& rhs) const
+            {
+                return ((_implementation == rhs._implementation) && (_id == rhs._id) && (_channel == rhs._channel));
+            }
+            inline const Core::IPCChannel* Channel() const
+            {
+                return (_channel);
+            }
+            uint64_t Hash() const
+            {
+                // Mix all bits of the three in, the top bits select the shard, the low bits the bucket.
+                uint64_t value = static_cast<uint64_t>(_implementation) ^ (static_cast<uint64_t>(_id) << 32);
+                value ^= static_cast<uint64_t>(reinterpret_cast<uintptr_t>(_channel)) * 0x9E3779B97F4A7C15ULL;
+                value ^= (value >> 33);
+                value *= 0xFF51AFD7ED558CCDULL;
+                value ^= (value >> 33);
+                value *= 0xC4CEB9FE1A85EC53ULL;
+                value ^= (value >> 33);
+
+                return (value);
+            }
+
+        private:
+            const Core::IPCChannel* _channel;
+            const instance_id _implementation;
+            const uint32_t _id;
+        };
+        struct ProxyKeyHash {
+            inline size_t operator()(const ProxyKey& key) const
+            {
+                return (static_cast<size_t>(key.Hash()));
+            }
+        };
+
+        // The proxies are looked up on every call that passes or returns an interface, so they are
+        // spread over shards with a lock of their own. The same key can be in there twice for a
+        // moment: a proxy that is on its way out, and the one that replaces it.
+        typedef std::unordered_multimap<ProxyKey, ProxyStub::UnknownProxy*, ProxyKeyHash> ProxyMap;
+
+        struct ProxyShard {
+            Core::CriticalSection _lock;
+            ProxyMap _proxies;
+        };
+
+        enum { ProxyShards = 16 };
+
         typedef std::map<const Core::IPCChannel*, std::list< std::pair<uint32_t, Core::IUnknown*> > > ReferenceMap;
 
         struct EXTERNAL IMetadata {
@@ -203,13 +272,18 @@ namespace RPC {
         Core::IUnknown* Convert(void* rawImplementation, const uint32_t id);
        void RegisterUnknownInterface(Core::ProxyType<Core::IPCChannel>& channel, Core::IUnknown* source, const uint32_t id);
 
+        inline ProxyShard& Shard(const ProxyKey& key)
+        {
+            return (_proxyShards[(key.Hash() >> 56) % ProxyShards]);
+        }
+
     private:
         // Seems like we have enough information, open up the Process communcication Channel.
         Core::CriticalSection _adminLock;
         std::map<uint32_t, ProxyStub::UnknownStub*> _stubs;
         std::map<uint32_t, IMetadata*> _proxy;
         Core::ProxyPoolType<InvokeMessage> _factory;
-        ChannelMap _channelProxyMap;
+        ProxyShard _proxyShards[ProxyShards];
         ReferenceMap _channelReferenceMap;
     };
 
@@ -354,6 +354,7 @@ namespace RPC {
         , _announceEvent(false, true)
         , _handler(this)
         , _connectionId(~0)
+        , _sharedMemory()
     {
         CreateFactory<RPC::AnnounceMessage>(1);
         CreateFactory<RPC::InvokeMessage>(2);
@@ -370,6 +371,7 @@ namespace RPC {
         , _announceEvent(false, true)
         , _handler(this)
         , _connectionId(~0)
+        , _sharedMemory()
     {
         CreateFactory<RPC::AnnounceMessage>(1);
         CreateFactory<RPC::InvokeMessage>(2);
@@ -402,7 +404,7 @@ namespace RPC {
 
         uint32_t result = BaseClass::Open(waitTime);
 
-        if ((result == Core::ERROR_NONE) && (_announceEvent.Lock(waitTime) != Core::ERROR_NONE)) {
+        if ((result == Core::ERROR_NONE) && ((_announceEvent.Lock(waitTime) != Core::ERROR_NONE) || (_announceMessage->Response().IsSet() == false))) {
             result = Core::ERROR_OPENING_FAILED;
         }
 
@@ -418,7 +420,7 @@ namespace RPC {
 
         uint32_t result = BaseClass::Open(waitTime);
 
-        if ((result == Core::ERROR_NONE) && (_announceEvent.Lock(waitTime) != Core::ERROR_NONE)) {
+        if ((result == Core::ERROR_NONE) && ((_announceEvent.Lock(waitTime) != Core::ERROR_NONE) || (_announceMessage->Response().IsSet() == false))) {
             result = Core::ERROR_OPENING_FAILED;
         }
 
@@ -436,7 +438,7 @@ namespace RPC {
 
         uint32_t result = BaseClass::Open(waitTime);
 
-        if ((result == Core::ERROR_NONE) && (_announceEvent.Lock(waitTime) != Core::ERROR_NONE)) {
+        if ((result == Core::ERROR_NONE) && ((_announceEvent.Lock(waitTime) != Core::ERROR_NONE) || (_announceMessage->Response().IsSet() == false))) {
             result = Core::ERROR_OPENING_FAILED;
         }
 
@@ -453,6 +455,10 @@ namespace RPC {
         BaseClass::StateChange();
 
         if (BaseClass::Source().IsOpen()) {
+#ifdef COMRPC_SHARED_MEMORY
+            OfferSharedMemory();
+#endif
+
             TRACE_L1("Invoking the Announce message to the server. %d", __LINE__);
             uint32_t result = Invoke<RPC::AnnounceMessage>(_announceMessage, this);
 
@@ -472,6 +478,36 @@ namespace RPC {
             }
         } else {
             TRACE_L1("Connection to the server is down");
+
+            if (_sharedMemory.IsValid() == true) {
+                _sharedMemory.Release();
+            }
+        }
+    }
+
+    void CommunicatorClient::OfferSharedMemory()
+    {
+        static std::atomic<uint32_t> sequence(0);
+
+        const Core::NodeId& remoteNode(BaseClass::Source().RemoteNode());
+
+        if (_sharedMemory.IsValid() == true) {
+            _sharedMemory.Release();
+        }
+
+        // Only worth it if the server is on this side of a domain socket, the memory is created next to it.
+        if (remoteNode.Type() == Core::NodeId::TYPE_DOMAIN) {
+            const string fileName(remoteNode.HostName() + '.' + Core::NumberType<uint32_t>(Core::ProcessInfo().Id()).Text() + '.' + Core::NumberType<uint32_t>(++sequence).Text());
+
+            Core::ProxyType<Core::IPCSharedMemory> memory(Core::ProxyType<Core::IPCSharedMemory>::Create(fileName, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::GROUP_READ | Core::File::GROUP_WRITE, SharedMemorySize));
+
+            if (memory->IsValid() == true) {
+                // Receive through it right away, sending waits till the server attached to it.
+                BaseClass::Shared(memory, 0);
+
+                _announceMessage->Parameters().SharedMemory(fileName);
+                _sharedMemory = memory;
+            }
         }
     }
 
@@ -482,6 +518,12 @@ namespace RPC {
 
         ASSERT(dynamic_cast<RPC::AnnounceMessage*>(&element) != nullptr);
 
+        if ((announceMessage->Response().IsSet() == true) && (announceMessage->Response().IsCompatible() == false)) {
+            // A server of another protocol would misread every frame, do not use anything it offers.
+            TRACE_L1("Server speaks an incompatible COMRPC protocol.");
+            announceMessage->Response().Clear();
+        }
+
         if (announceMessage->Response().IsSet() == true) {
             // Is result of an announce message, contains default trace categories in JSON format.
             string jsonDefaultCategories(announceMessage->Response().TraceCategories());
@@ -497,6 +539,16 @@ namespace RPC {
                 // Also load the ProxyStubs before we do anything else
                 RPC::LoadProxyStubs(proxyStubPath);
             }
+
+            if (_sharedMemory.IsValid() == true) {
+                if (announceMessage->Response().SharedMemory() == true) {
+                    BaseClass::Shared(_sharedMemory, SharedMemoryThreshold);
+                } else {
+                    // The server does not know it, or could not open it, stick to the socket.
+                    BaseClass::Shared(Core::ProxyType<Core::IPCSharedMemory>(), 0);
+                    _sharedMemory.Release();
+                }
+            }
         }
 
         // Set event so WaitForCompletion() can continue.
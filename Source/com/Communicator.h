@@ -1118,11 +1118,18 @@ namespace RPC {
 
                     Core::ProxyType<Client> proxyChannel(static_cast<Client&>(channel));
 
-                    // Anounce the interface as completed
-                    string jsonDefaultCategories(Trace::TraceUnit::Instance().Defaults());
-                    void* result = _parent.Announce(proxyChannel, message->Parameters());
+                    if (message->Parameters().IsCompatible() == false) {
+                        // A peer of another protocol would misread every frame, an empty setup tells it nothing is offered.
+                        TRACE_L1("Announce of an incompatible COMRPC protocol refused.");
+                        message->Response().Clear();
+                    } else {
+                        // Anounce the interface as completed
+                        string jsonDefaultCategories(Trace::TraceUnit::Instance().Defaults());
+                        void* result = _parent.Announce(proxyChannel, message->Parameters());
+                        bool sharedMemory = _parent.SharedMemory(channel, message->Parameters().SharedMemory());
 
-                    message->Response().Set(instance_cast<void*>(result), proxyChannel->Extension().Id(), _parent.ProxyStubPath(), jsonDefaultCategories);
+                        message->Response().Set(instance_cast<void*>(result), proxyChannel->Extension().Id(), _parent.ProxyStubPath(), jsonDefaultCategories, sharedMemory);
+                    }
 
                     // We are done, report completion
                     channel.ReportResponse(data);
@@ -1163,6 +1170,7 @@ namespace RPC {
                 : BaseClass(remoteNode, CommunicationBufferSize)
                 , _proxyStubPath(proxyStubPath)
                 , _connections(processes)
+                , _sharedMemory(remoteNode.Type() == Core::NodeId::TYPE_DOMAIN ? remoteNode.HostName() + '.' : string())
                 , _announceHandler(this)
             {
                 BaseClass::Register(InvokeMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<InvokeHandlerImplementation>::Create()));
@@ -1176,6 +1184,7 @@ namespace RPC {
                 : BaseClass(remoteNode, CommunicationBufferSize)
                 , _proxyStubPath(proxyStubPath)
                 , _connections(processes)
+                , _sharedMemory(remoteNode.Type() == Core::NodeId::TYPE_DOMAIN ? remoteNode.HostName() + '.' : string())
                 , _announceHandler(this)
             {
                 BaseClass::Register(InvokeMessage::Id(), handler);
@@ -1207,10 +1216,27 @@ namespace RPC {
                 // We are in business, register the process with this channel.
                 return (_connections.Announce(channel, info));
             }
+            inline bool SharedMemory(Core::IPCChannel& channel, const string& fileName)
+            {
+                bool result = false;
+
+                // Only what a client can create next to our own socket, not any file it likes.
+                if ((_sharedMemory.empty() == false) && (fileName.length() > _sharedMemory.length()) && (fileName.compare(0, _sharedMemory.length(), _sharedMemory) == 0) && (fileName.find('/', _sharedMemory.length()) == string::npos)) {
+                    Core::ProxyType<Core::IPCSharedMemory> memory(Core::ProxyType<Core::IPCSharedMemory>::Create(fileName));
+
+                    if (memory->IsValid() == true) {
+                        channel.Shared(memory, SharedMemoryThreshold);
+                        result = true;
+                    }
+                }
+
+                return (result);
+            }
 
         private:
             const string _proxyStubPath;
             RemoteConnectionMap& _connections;
+            const string _sharedMemory;
             AnnounceHandlerImplementation _announceHandler;
         };
 
@@ -1335,11 +1361,18 @@ namespace RPC {
 
                 ASSERT(refChannel.IsValid());
 
-                const string className(message->Parameters().ClassName());
-                const uint32_t interfaceId(message->Parameters().InterfaceId());
-                const uint32_t versionId(message->Parameters().VersionId());
+                instance_id implementation = 0;
+
+                if (message->Parameters().IsCompatible() == true) {
+                    const string className(message->Parameters().ClassName());
+                    const uint32_t interfaceId(message->Parameters().InterfaceId());
+                    const uint32_t versionId(message->Parameters().VersionId());
+
+                    implementation = instance_cast<void*>(_parent.Aquire(className, interfaceId, versionId));
+                } else {
+                    TRACE_L1("Aquire of an incompatible COMRPC protocol refused.");
+                }
 
-                instance_id implementation = instance_cast<void*>(_parent.Aquire(className, interfaceId, versionId));
                 message->Response().Implementation(implementation);
 
                 channel.ReportResponse(data);
@@ -1540,6 +1573,7 @@ namespace RPC {
             return (_announceEvent.Lock(waitTime) == Core::ERROR_NONE);
         }
         virtual void Dispatch(Core::IIPC& element);
+        void OfferSharedMemory();
 
     protected:
         virtual void StateChange();
@@ -1549,6 +1583,7 @@ namespace RPC {
         Core::Event _announceEvent;
         AnnounceHandlerImplementation _handler;
         uint32_t _connectionId;
+        Core::ProxyType<Core::IPCSharedMemory> _sharedMemory;
     };
 }
 }
@@ -264,7 +264,12 @@ namespace ProxyStub {
         {
             ASSERT(_channel.IsValid() == true);
 
-            uint32_t result = _channel->Invoke(message, waitTime);
+            uint32_t result;
+            {
+                Core::CallLatencies::Measurement measurement(Core::CallLatencies::Instance().Histogram(Core::CallLatencies::COMRPC_OUTBOUND, _interfaceId, message->Parameters().MethodId()));
+
+                result = _channel->Invoke(message, waitTime);
+            }
 
             if (result != Core::ERROR_NONE) {
                 // Oops something failed on the communication. Report it.
@@ -40,17 +40,146 @@ namespace RPC {
     namespace Data {
         static const uint16_t IPC_BLOCK_SIZE = 512;
 
+        // Bumped whenever the frames change on the line, peers of another protocol are refused during the
+        // announce. A peer from before the call ids on the IPC channel does not get that far, it misreads the
+        // framing of the announce itself. This catches peers that both frame with call ids, but disagree on
+        // what is in the frames.
+        static const uint32_t PROTOCOL_VERSION = 0x434F4D02;
+
+        // The larger buffers (streams) are not copied into the frame, that would grow it in blocks and
+        // limit it to 64K. Each is held in a block of its own, only its length goes in the frame. On the
+        // line the streams follow the frame, segment by segment, and they are received in a single
+        // block of the announced size.
         class Frame : public Core::FrameType<IPC_BLOCK_SIZE> {
         private:
             Frame(Frame&) = delete;
             Frame& operator=(const Frame&) = delete;
 
+            typedef Core::FrameType<IPC_BLOCK_SIZE> BaseClass;
+
+            struct Segment {
+                uint8_t* _buffer;
+                uint32_t _length;
+            };
+
+            // The size of the frame and the total length of the streams lead the way on the line.
+            static constexpr uint8_t HeaderSize = sizeof(uint16_t) + sizeof(uint32_t);
+            // The streams are received in one block, a header announcing more than this is not believed.
+            static constexpr uint32_t MaxStreamed = 64 * 1024 * 1024;
+
+        public:
+            class Reader : public BaseClass::Reader {
+            private:
+                Reader& operator=(const Reader&) = delete;
+
+            public:
+                Reader()
+                    : BaseClass::Reader()
+                    , _frame(nullptr)
+                    , _streamed(0)
+                {
+                }
+                Reader(const Frame& data, const uint16_t offset)
+                    : BaseClass::Reader(data, offset)
+                    , _frame(&data)
+                    , _streamed(0)
+                {
+                }
+                Reader(const Reader& copy)
+                    : BaseClass::Reader(copy)
+                    , _frame(copy._frame)
+                    , _streamed(copy._streamed)
+                {
+                }
+                ~Reader()
+                {
+                }
+
+            public:
+                // The stream is not copied, the buffer is valid as long as the frame is.
+                uint32_t Stream(const uint8_t*& buffer) const
+                {
+                    ASSERT(_frame != nullptr);
+
+                    uint32_t length = Number<uint32_t>();
+
+                    buffer = _frame->Stream(_streamed, length);
+
+                    if ((buffer == nullptr) && (length != 0)) {
+                        TRACE_L1("Stream of %d bytes is not in the frame.", length);
+                        length = 0;
+                    }
+
+                    _streamed += length;
+
+                    return (length);
+                }
+                uint32_t Stream(const uint32_t maxLength, uint8_t buffer[]) const
+                {
+                    const uint8_t* source = nullptr;
+                    const uint32_t length = std::min(Stream(source), maxLength);
+
+                    if (length != 0) {
+                        ::memcpy(buffer, source, length);
+                    }
+
+                    return (length);
+                }
+
+            private:
+                const Frame* _frame;
+                mutable uint32_t _streamed;
+            };
+            class Writer : public BaseClass::Writer {
+            private:
+                Writer& operator=(const Writer&) = delete;
+
+            public:
+                Writer()
+                    : BaseClass::Writer()
+                    , _frame(nullptr)
+                {
+                }
+                Writer(Frame& data, const uint16_t offset)
+                    : BaseClass::Writer(data, offset)
+                    , _frame(&data)
+                {
+                }
+                Writer(const Writer& copy)
+                    : BaseClass::Writer(copy)
+                    , _frame(copy._frame)
+                {
+                }
+                ~Writer()
+                {
+                }
+
+            public:
+                // A buffer handed out by Allocate is taken as is, any other buffer is copied once.
+                void Stream(const uint32_t length, const uint8_t buffer[])
+                {
+                    ASSERT(_frame != nullptr);
+
+                    Number<uint32_t>(length);
+
+                    _frame->Append(length, buffer);
+                }
+
+            private:
+                Frame* _frame;
+            };
+
         public:
             Frame()
+                : _segments()
+                , _spare()
+                , _streamed(0)
+                , _expected(~0)
             {
             }
             ~Frame()
             {
+                Release();
             }
 
         public:
@@ -58,6 +187,145 @@ namespace RPC {
             friend class Output;
             friend class ObjectInterface;
 
+            inline void Clear()
+            {
+                Release();
+                BaseClass::Clear();
+            }
+            // A block for a stream that is yet to be filled, e.g. by the implementation of a call. It
+            // lives as long as the frame, and goes out without a copy if it is written to this frame.
+            uint8_t* Allocate(const uint32_t length)
+            {
+                Segment segment;
+
+                segment._buffer = new uint8_t[length];
+                segment._length = length;
+                _spare.push_back(segment);
+
+                return (segment._buffer);
+            }
+            const uint8_t* Stream(const uint32_t offset, const uint32_t length) const
+            {
+                const uint8_t* result = nullptr;
+                uint32_t position = 0;
+
+                for (const Segment& segment : _segments) {
+                    if (offset < (position + segment._length)) {
+                        if ((length != 0) && (length <= (segment._length - (offset - position)))) {
+                            result = &(segment._buffer[offset - position]);
+                        }
+                        break;
+                    }
+                    position += segment._length;
+                }
+
+                return (result);
+            }
+
+            // The length announced for the frame on the line, what the header says is checked against it.
+            void Expect(const uint32_t length)
+            {
+                _expected = length;
+            }
+            // The frame and its streams, the way they go over the line.
+            uint32_t Length() const
+            {
+                return (HeaderSize + Size() + _streamed);
+            }
+            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            {
+                uint16_t result = 0;
+
+                while (((offset + result) < HeaderSize) && (result < maxLength)) {
+                    const uint8_t index = static_cast<uint8_t>(offset + result);
+                    stream[result++] = static_cast<uint8_t>(((index < 2 ? Size() : _streamed) >> (8 * (index < 2 ? index : index - 2))) & 0xFF);
+                }
+
+                if ((result < maxLength) && ((offset + result) < (HeaderSize + Size()))) {
+                    result += Serialize(static_cast<uint16_t>(offset + result - HeaderSize), &stream[result], maxLength - result);
+                }
+
+                uint32_t position = HeaderSize + Size();
+
+                for (std::vector<Segment>::const_iterator index = _segments.begin(); (index != _segments.end()) && (result < maxLength); index++) {
+                    if ((offset + result) < (position + index->_length)) {
+                        const uint32_t start = offset + result - position;
+                        const uint16_t copied = static_cast<uint16_t>(std::min(index->_length - start, static_cast<uint32_t>(maxLength - result)));
+
+                        ::memcpy(&(stream[result]), &(index->_buffer[start]), copied);
+                        result += copied;
+                    }
+                    position += index->_length;
+                }
+
+                return (result);
+            }
+            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+            {
+                uint16_t result = 0;
+
+                while (((offset + result) < HeaderSize) && (result < maxLength)) {
+                    _header[offset + result] = stream[result];
+                    result++;
+
+                    if ((offset + result) == HeaderSize) {
+                        const uint16_t size = static_cast<uint16_t>(_header[0] | (_header[1] << 8));
+                        const uint32_t streamed = (_header[2] | (_header[3] << 8) | (_header[4] << 16) | (static_cast<uint32_t>(_header[5]) << 24));
+                        uint32_t room = MaxStreamed;
+
+                        if (_expected != static_cast<uint32_t>(~0)) {
+                            const uint32_t left = (_expected >= static_cast<uint32_t>(HeaderSize + size) ? _expected - HeaderSize - size : 0);
+                            room = (left < room ? left : room);
+                        }
+
+                        // Now the sizes are known, allocate what is needed, once.
+                        Release();
+                        _expected = ~0;
+
+                        if (streamed > room) {
+                            // More than the message can hold, the header is corrupt (or made up). Drop it all,
+                            // the frame stays empty.
+                            TRACE_L1("Dropped a frame announcing %u bytes of streams, there is room for %u", streamed, room);
+                            Size(0);
+                            result = maxLength;
+                        } else {
+                            Size(size);
+
+                            if (streamed != 0) {
+                                Segment segment;
+
+                                segment._buffer = new uint8_t[streamed];
+                                segment._length = streamed;
+                                _segments.push_back(segment);
+                                _streamed = streamed;
+                            }
+                        }
+                    }
+                }
+
+                if ((result < maxLength) && ((offset + result) < (HeaderSize + Size()))) {
+                    const uint16_t position = static_cast<uint16_t>(offset + result - HeaderSize);
+                    const uint16_t copied = std::min(static_cast<uint16_t>(Size() - position), static_cast<uint16_t>(maxLength - result));
+
+                    ::memcpy(&(operator[](position)), &(stream[result]), copied);
+                    result += copied;
+                }
+
+                if ((result < maxLength) && (_streamed != 0)) {
+                    const uint32_t position = offset + result - HeaderSize - Size();
+
+                    if (position < _streamed) {
+                        const uint16_t copied = static_cast<uint16_t>(std::min(_streamed - position, static_cast<uint32_t>(maxLength - result)));
+
+                        ::memcpy(&(_segments[0]._buffer[position]), &(stream[result]), copied);
+                        result += copied;
+                    }
+                }
+
+                // Whatever comes after what was announced is not for us, drop it.
+                return (maxLength);
+            }
+
             uint16_t Serialize(const uint16_t offset, uint8_t stream[], const uint16_t maxLength) const
             {
                 uint16_t copiedBytes((Size() - offset) > maxLength ? maxLength : (Size() - offset));
@@ -74,6 +342,53 @@ namespace RPC {
 
                 return (maxLength);
             }
+
+        private:
+            void Append(const uint32_t length, const uint8_t buffer[])
+            {
+                if (length != 0) {
+                    std::vector<Segment>::iterator index(_spare.begin());
+
+                    while ((index != _spare.end()) && (index->_buffer != buffer)) {
+                        index++;
+                    }
+
+                    Segment segment;
+
+                    if (index != _spare.end()) {
+                        ASSERT(length <= index->_length);
+
+                        segment._buffer = index->_buffer;
+                        _spare.erase(index);
+                    } else {
+                        segment._buffer = new uint8_t[length];
+                        ::memcpy(segment._buffer, buffer, length);
+                    }
+
+                    segment._length = length;
+                    _segments.push_back(segment);
+                    _streamed += length;
+                }
+            }
+            void Release()
+            {
+                for (Segment& segment : _segments) {
+                    delete[] segment._buffer;
+                }
+                for (Segment& segment : _spare) {
+                    delete[] segment._buffer;
+                }
+                _segments.clear();
+                _spare.clear();
+                _streamed = 0;
+            }
+
+        private:
+            std::vector<Segment> _segments;
+            std::vector<Segment> _spare;
+            uint32_t _streamed;
+            uint32_t _expected;
+            uint8_t _header[HeaderSize];
         };
 
         class Input {
@@ -127,7 +442,7 @@ namespace RPC {
             }
             uint32_t Length() const
             {
-                return (_data.Size());
+                return (_data.Length());
             }
             inline Frame::Writer Writer()
             {
@@ -139,11 +454,15 @@ namespace RPC {
             }
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Serialize(stream, maxLength, offset));
             }
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Deserialize(stream, maxLength, offset));
+            }
+            void Expect(const uint32_t length)
+            {
+                _data.Expect(length);
             }
 
         private:
@@ -182,17 +501,26 @@ namespace RPC {
                 _data.SetNumber<instance_id>(_data.Size(), implementation);
                 _data.SetNumber<uint32_t>(_data.Size(), id);
             }
+            // Room for a stream the implementation fills in, before it is written to the response.
+            inline uint8_t* Allocate(const uint32_t length)
+            {
+                return (_data.Allocate(length));
+            }
             inline uint32_t Length() const
             {
-                return (static_cast<uint32_t>(_data.Size()));
+                return (_data.Length());
             }
             inline uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Serialize(stream, maxLength, offset));
             }
             inline uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Deserialize(stream, maxLength, offset));
+            }
+            inline void Expect(const uint32_t length)
+            {
+                _data.Expect(length);
             }
 
         private:
@@ -224,18 +552,24 @@ namespace RPC {
 
         public:
             Init()
-                : _id(0)
+                : _protocol(PROTOCOL_VERSION)
+                , _id(0)
                 , _implementation(0)
                 , _interfaceId(~0)
                 , _exchangeId(~0)
                 , _versionId(0)
             {
+                _sharedMemory[0] = '\0';
             }
             ~Init()
             {
             }
 
         public:
+            bool IsCompatible() const
+            {
+                return (_protocol == PROTOCOL_VERSION);
+            }
             bool IsOffer() const
             {
                 return (_className[0] == '\0') && (_className[1] == OFFER);
@@ -258,7 +592,9 @@ namespace RPC {
                 _implementation = 0;
                 _interfaceId = ~0;
                 _versionId = ~0;
+                _protocol = PROTOCOL_VERSION;
                 _id = myId;
+                _sharedMemory[0] = '\0';
                 _className[0] = '\0';
                 _className[1] = AQUIRE;
             }
@@ -268,7 +604,9 @@ namespace RPC {
                 _implementation = implementation;
                 _interfaceId = interfaceId;
                 _versionId = 0;
+                _protocol = PROTOCOL_VERSION;
                 _id = myId;
+                _sharedMemory[0] = '\0';
                 _className[0] = '\0';
                 _className[1] = REQUEST;
             }
@@ -280,7 +618,9 @@ namespace RPC {
                 _implementation = implementation;
                 _interfaceId = interfaceId;
                 _versionId = 0;
+                _protocol = PROTOCOL_VERSION;
                 _id = myId;
+                _sharedMemory[0] = '\0';
                 _className[0] = '\0';
                 _className[1] = whatKind;
             }
@@ -290,7 +630,9 @@ namespace RPC {
                 _implementation = 0;
                 _interfaceId = interfaceId;
                 _versionId = versionId;
+                _protocol = PROTOCOL_VERSION;
                 _id = myId;
+                _sharedMemory[0] = '\0';
                 const std::string converted(Core::ToString(className));
                 ::strncpy(_className, converted.c_str(), sizeof(_className));
             }
@@ -318,14 +660,31 @@ namespace RPC {
             {
                 return (Core::ToString(std::string(_className)));
             }
+            // The memory the announcing side created for this channel, if any.
+            void SharedMemory(const string& fileName)
+            {
+                const std::string converted(Core::ToString(fileName));
+
+                if (converted.length() < sizeof(_sharedMemory)) {
+                    ::strncpy(_sharedMemory, converted.c_str(), sizeof(_sharedMemory));
+                } else {
+                    _sharedMemory[0] = '\0';
+                }
+            }
+            const string SharedMemory() const
+            {
+                return (Core::ToString(std::string(_sharedMemory)));
+            }
 
         private:
+            uint32_t _protocol;
             uint32_t _id;
             instance_id _implementation;
             uint32_t _interfaceId;
             uint32_t _exchangeId;
             uint32_t _versionId;
             char _className[64];
+            char _sharedMemory[128];
         };
 
         class Setup {
@@ -347,12 +706,14 @@ namespace RPC {
             {
                 _data.Clear();
             }
-            void Set(instance_id implementation, const uint32_t sequenceNumber, const string& proxyStubPath, const string& traceCategories)
+            void Set(instance_id implementation, const uint32_t sequenceNumber, const string& proxyStubPath, const string& traceCategories, const bool sharedMemory = false)
             {
                 _data.SetNumber<instance_id>(0, implementation);
                 _data.SetNumber<uint32_t>(sizeof(instance_id), sequenceNumber);
                 uint16_t length = _data.SetText(sizeof(instance_id) + sizeof(uint32_t), proxyStubPath);
-                _data.SetText(sizeof(instance_id)+ sizeof(uint32_t) + length, traceCategories);
+                length += _data.SetText(sizeof(instance_id)+ sizeof(uint32_t) + length, traceCategories);
+                length += _data.SetBoolean(sizeof(instance_id) + sizeof(uint32_t) + length, sharedMemory);
+                _data.SetNumber<uint32_t>(sizeof(instance_id) + sizeof(uint32_t) + length, PROTOCOL_VERSION);
             }
             inline bool IsSet() const {
                 return (_data.Size() > 0);
@@ -384,6 +745,39 @@ namespace RPC {
 
                 return (value);
             }
+            // Did the other side attach to the shared memory that was announced.
+            bool SharedMemory() const
+            {
+                bool result = false;
+                string value;
+
+                uint16_t length = sizeof(instance_id) + sizeof(uint32_t) ;   // skip implentation and sequencenumber
+                length += _data.GetText(length, value);  // skip proxyStub path
+                length += _data.GetText(length, value);  // skip trace categories
+
+                if (length < _data.Size()) {
+                    _data.GetBoolean(length, result);
+                }
+
+                return (result);
+            }
+            // A server that frames with call ids but predates this word does not send it, it reads as 0 then.
+            bool IsCompatible() const
+            {
+                uint32_t result = 0;
+                string value;
+
+                uint16_t length = sizeof(instance_id) + sizeof(uint32_t) ;   // skip implentation and sequencenumber
+                length += _data.GetText(length, value);  // skip proxyStub path
+                length += _data.GetText(length, value);  // skip trace categories
+
+                if (length < _data.Size()) {
+                    length++;  // skip shared memory
+                    _data.GetNumber<uint32_t>(length, result);
+                }
+
+                return (result == PROTOCOL_VERSION);
+            }
             instance_id Implementation() const
             {
                 instance_id result = 0;
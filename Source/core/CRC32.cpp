@@ -0,0 +1,345 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CRC32.h"
+#include "Trace.h"
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#if defined(__x86_64__) || defined(__i386__)
+#define __CRC_CLMUL_X86__
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__linux__)
+#define __CRC_CLMUL_ARMV8__
+#include <arm_neon.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace WPEFramework {
+namespace Core {
+
+    // CRC32 lookup table for polynomial 0x04c11db7 
+    // Copyright (c) Freescale Semiconductor, Inc. All rights reserved.
+    // Licensed under the BSD-3 license
+    static const uint32_t g_CRCtable[256] = {
+        0x00000000, 0x04c11db7, 0x09823b6e, 0x0d4326d9, 0x130476dc, 0x17c56b6b,
+        0x1a864db2, 0x1e475005, 0x2608edb8, 0x22c9f00f, 0x2f8ad6d6, 0x2b4bcb61,
+        0x350c9b64, 0x31cd86d3, 0x3c8ea00a, 0x384fbdbd, 0x4c11db70, 0x48d0c6c7,
+        0x4593e01e, 0x4152fda9, 0x5f15adac, 0x5bd4b01b, 0x569796c2, 0x52568b75,
+        0x6a1936c8, 0x6ed82b7f, 0x639b0da6, 0x675a1011, 0x791d4014, 0x7ddc5da3,
+        0x709f7b7a, 0x745e66cd, 0x9823b6e0, 0x9ce2ab57, 0x91a18d8e, 0x95609039,
+        0x8b27c03c, 0x8fe6dd8b, 0x82a5fb52, 0x8664e6e5, 0xbe2b5b58, 0xbaea46ef,
+        0xb7a96036, 0xb3687d81, 0xad2f2d84, 0xa9ee3033, 0xa4ad16ea, 0xa06c0b5d,
+        0xd4326d90, 0xd0f37027, 0xddb056fe, 0xd9714b49, 0xc7361b4c, 0xc3f706fb,
+        0xceb42022, 0xca753d95, 0xf23a8028, 0xf6fb9d9f, 0xfbb8bb46, 0xff79a6f1,
+        0xe13ef6f4, 0xe5ffeb43, 0xe8bccd9a, 0xec7dd02d, 0x34867077, 0x30476dc0,
+        0x3d044b19, 0x39c556ae, 0x278206ab, 0x23431b1c, 0x2e003dc5, 0x2ac12072,
+        0x128e9dcf, 0x164f8078, 0x1b0ca6a1, 0x1fcdbb16, 0x018aeb13, 0x054bf6a4,
+        0x0808d07d, 0x0cc9cdca, 0x7897ab07, 0x7c56b6b0, 0x71159069, 0x75d48dde,
+        0x6b93dddb, 0x6f52c06c, 0x6211e6b5, 0x66d0fb02, 0x5e9f46bf, 0x5a5e5b08,
+        0x571d7dd1, 0x53dc6066, 0x4d9b3063, 0x495a2dd4, 0x44190b0d, 0x40d816ba,
+        0xaca5c697, 0xa864db20, 0xa527fdf9, 0xa1e6e04e, 0xbfa1b04b, 0xbb60adfc,
+        0xb6238b25, 0xb2e29692, 0x8aad2b2f, 0x8e6c3698, 0x832f1041, 0x87ee0df6,
+        0x99a95df3, 0x9d684044, 0x902b669d, 0x94ea7b2a, 0xe0b41de7, 0xe4750050,
+        0xe9362689, 0xedf73b3e, 0xf3b06b3b, 0xf771768c, 0xfa325055, 0xfef34de2,
+        0xc6bcf05f, 0xc27dede8, 0xcf3ecb31, 0xcbffd686, 0xd5b88683, 0xd1799b34,
+        0xdc3abded, 0xd8fba05a, 0x690ce0ee, 0x6dcdfd59, 0x608edb80, 0x644fc637,
+        0x7a089632, 0x7ec98b85, 0x738aad5c, 0x774bb0eb, 0x4f040d56, 0x4bc510e1,
+        0x46863638, 0x42472b8f, 0x5c007b8a, 0x58c1663d, 0x558240e4, 0x51435d53,
+        0x251d3b9e, 0x21dc2629, 0x2c9f00f0, 0x285e1d47, 0x36194d42, 0x32d850f5,
+        0x3f9b762c, 0x3b5a6b9b, 0x0315d626, 0x07d4cb91, 0x0a97ed48, 0x0e56f0ff,
+        0x1011a0fa, 0x14d0bd4d, 0x19939b94, 0x1d528623, 0xf12f560e, 0xf5ee4bb9,
+        0xf8ad6d60, 0xfc6c70d7, 0xe22b20d2, 0xe6ea3d65, 0xeba91bbc, 0xef68060b,
+        0xd727bbb6, 0xd3e6a601, 0xdea580d8, 0xda649d6f, 0xc423cd6a, 0xc0e2d0dd,
+        0xcda1f604, 0xc960ebb3, 0xbd3e8d7e, 0xb9ff90c9, 0xb4bcb610, 0xb07daba7,
+        0xae3afba2, 0xaafbe615, 0xa7b8c0cc, 0xa379dd7b, 0x9b3660c6, 0x9ff77d71,
+        0x92b45ba8, 0x9675461f, 0x8832161a, 0x8cf30bad, 0x81b02d74, 0x857130c3,
+        0x5d8a9099, 0x594b8d2e, 0x5408abf7, 0x50c9b640, 0x4e8ee645, 0x4a4ffbf2,
+        0x470cdd2b, 0x43cdc09c, 0x7b827d21, 0x7f436096, 0x7200464f, 0x76c15bf8,
+        0x68860bfd, 0x6c47164a, 0x61043093, 0x65c52d24, 0x119b4be9, 0x155a565e,
+        0x18197087, 0x1cd86d30, 0x029f3d35, 0x065e2082, 0x0b1d065b, 0x0fdc1bec,
+        0x3793a651, 0x3352bbe6, 0x3e119d3f, 0x3ad08088, 0x2497d08d, 0x2056cd3a,
+        0x2d15ebe3, 0x29d4f654, 0xc5a92679, 0xc1683bce, 0xcc2b1d17, 0xc8ea00a0,
+        0xd6ad50a5, 0xd26c4d12, 0xdf2f6bcb, 0xdbee767c, 0xe3a1cbc1, 0xe760d676,
+        0xea23f0af, 0xeee2ed18, 0xf0a5bd1d, 0xf464a0aa, 0xf9278673, 0xfde69bc4,
+        0x89b8fd09, 0x8d79e0be, 0x803ac667, 0x84fbdbd0, 0x9abc8bd5, 0x9e7d9662,
+        0x933eb0bb, 0x97ffad0c, 0xafb010b1, 0xab710d06, 0xa6322bdf, 0xa2f33668,
+        0xbcb4666d, 0xb8757bda, 0xb5365d03, 0xb1f740b4
+    };
+
+    // Slicing by 8: table[n][byte] is the CRC of byte followed by n zero bytes, so 8 bytes are
+    // done with 8 independent lookups.
+    struct SlicingTables {
+        SlicingTables()
+        {
+            ::memcpy(table[0], g_CRCtable, sizeof(table[0]));
+
+            for (uint8_t slice = 1; slice < 8; slice++) {
+                for (uint16_t index = 0; index < 256; index++) {
+                    const uint32_t previous = table[slice - 1][index];
+                    table[slice][index] = (previous << 8) ^ g_CRCtable[previous >> 24];
+                }
+            }
+        }
+
+        uint32_t table[8][256];
+    };
+
+    static const SlicingTables Slicing;
+
+    static inline uint32_t BigEndian(const uint8_t data[])
+    {
+        return ((static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]));
+    }
+
+    static uint32_t Table(uint32_t crc, const uint8_t data[], uint64_t length)
+    {
+        while (length-- > 0) {
+            crc = (crc << 8) ^ g_CRCtable[((crc >> 24) ^ *data++) & 0xFF];
+        }
+
+        return (crc);
+    }
+
+    static uint32_t Slice(uint32_t crc, const uint8_t data[], uint64_t length)
+    {
+        const uint32_t (&table)[8][256] = Slicing.table;
+
+        while (length >= 8) {
+            const uint32_t one = crc ^ BigEndian(data);
+            const uint32_t two = BigEndian(&data[4]);
+
+            crc = table[7][one >> 24] ^ table[6][(one >> 16) & 0xFF] ^ table[5][(one >> 8) & 0xFF] ^ table[4][one & 0xFF]
+                ^ table[3][two >> 24] ^ table[2][(two >> 16) & 0xFF] ^ table[1][(two >> 8) & 0xFF] ^ table[0][two & 0xFF];
+
+            data += 8;
+            length -= 8;
+        }
+
+        return (Table(crc, data, length));
+    }
+
+    // Carry-less multiply: the data is folded, 4 x 128 bits at a time, onto 4 accumulators, by
+    // multiplying with x^n mod P. What is left is reduced to 32 bits with a Barrett reduction.
+    // Every 128 bits are taken as one polynomial, the first byte holding the highest powers.
+    static constexpr uint64_t X64 = 0x490d678d; // x^64 mod P
+    static constexpr uint64_t X96 = 0xf200aa66; // x^96 mod P
+    static constexpr uint64_t X128 = 0xe8a45605; // x^128 mod P
+    static constexpr uint64_t X192 = 0xc5b9cd4c; // x^192 mod P
+    static constexpr uint64_t X512 = 0xe6228b11; // x^512 mod P
+    static constexpr uint64_t X576 = 0x8833794c; // x^576 mod P
+    static constexpr uint64_t Mu = 0x104d101df; // x^64 / P
+    static constexpr uint64_t Polynomial = 0x104c11db7;
+
+    // Below this, the setting up costs more than it gains.
+    static constexpr uint64_t CLMULMinimum = 64;
+
+#ifdef __CRC_CLMUL_X86__
+
+#define CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+
+    CLMUL_TARGET static inline __m128i Load(const uint8_t data[])
+    {
+        return (_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+    }
+
+    // x^distance * value, with constants x^(distance + 64) and x^distance (mod P).
+    CLMUL_TARGET static inline __m128i Fold(const __m128i value, const __m128i constants)
+    {
+        return (_mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x11), _mm_clmulepi64_si128(value, constants, 0x00)));
+    }
+
+    CLMUL_TARGET static uint32_t CLMUL(uint32_t crc, const uint8_t data[], uint64_t length)
+    {
+        ASSERT(length >= CLMULMinimum);
+
+        const __m128i by512 = _mm_set_epi64x(X576, X512);
+        const __m128i by128 = _mm_set_epi64x(X192, X128);
+        __m128i accumulator[4];
+
+        accumulator[0] = _mm_xor_si128(Load(&data[0]), _mm_set_epi32(static_cast<int>(crc), 0, 0, 0));
+        accumulator[1] = Load(&data[16]);
+        accumulator[2] = Load(&data[32]);
+        accumulator[3] = Load(&data[48]);
+        data += 64;
+        length -= 64;
+
+        while (length >= 64) {
+            accumulator[0] = _mm_xor_si128(Fold(accumulator[0], by512), Load(&data[0]));
+            accumulator[1] = _mm_xor_si128(Fold(accumulator[1], by512), Load(&data[16]));
+            accumulator[2] = _mm_xor_si128(Fold(accumulator[2], by512), Load(&data[32]));
+            accumulator[3] = _mm_xor_si128(Fold(accumulator[3], by512), Load(&data[48]));
+            data += 64;
+            length -= 64;
+        }
+
+        __m128i value = _mm_xor_si128(Fold(accumulator[0], by128), accumulator[1]);
+        value = _mm_xor_si128(Fold(value, by128), accumulator[2]);
+        value = _mm_xor_si128(Fold(value, by128), accumulator[3]);
+
+        while (length >= 16) {
+            value = _mm_xor_si128(Fold(value, by128), Load(data));
+            data += 16;
+            length -= 16;
+        }
+
+        // value * x^32 mod P: first to 96 bits, then to 64 bits, then Barrett.
+        __m128i reduced = _mm_xor_si128(_mm_clmulepi64_si128(value, _mm_set_epi64x(0, X96), 0x01), _mm_slli_si128(_mm_move_epi64(value), 4));
+        reduced = _mm_xor_si128(_mm_clmulepi64_si128(_mm_srli_si128(reduced, 8), _mm_set_epi64x(0, X64), 0x00), _mm_move_epi64(reduced));
+
+        const __m128i quotient = _mm_srli_si128(_mm_clmulepi64_si128(_mm_srli_epi64(reduced, 32), _mm_set_epi64x(0, Mu), 0x00), 4);
+        crc = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_xor_si128(reduced, _mm_clmulepi64_si128(quotient, _mm_set_epi64x(0, Polynomial), 0x00))));
+
+        return (Slice(crc, data, length));
+    }
+
+    static bool Detect()
+    {
+        unsigned int eax, ebx, ecx, edx;
+
+        // PCLMULQDQ (ecx 1) and SSSE3 (ecx 9).
+        return ((__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & ((1u << 1) | (1u << 9))) == ((1u << 1) | (1u << 9))));
+    }
+
+#endif // __CRC_CLMUL_X86__
+
+#ifdef __CRC_CLMUL_ARMV8__
+
+#ifdef __clang__
+#define CLMUL_TARGET __attribute__((target("crypto")))
+#else
+#define CLMUL_TARGET __attribute__((target("+crypto")))
+#endif
+
+    CLMUL_TARGET static inline uint64x2_t Load(const uint8_t data[])
+    {
+        const uint8x16_t value = vrev64q_u8(vld1q_u8(data));
+
+        return (vreinterpretq_u64_u8(vextq_u8(value, value, 8)));
+    }
+
+    CLMUL_TARGET static inline uint64x2_t Multiply(const uint64_t left, const uint64_t right)
+    {
+        return (vreinterpretq_u64_p128(vmull_p64(static_cast<poly64_t>(left), static_cast<poly64_t>(right))));
+    }
+
+    CLMUL_TARGET static inline uint64x2_t Fold(const uint64x2_t value, const uint64_t high, const uint64_t low)
+    {
+        return (veorq_u64(Multiply(vgetq_lane_u64(value, 1), high), Multiply(vgetq_lane_u64(value, 0), low)));
+    }
+
+    CLMUL_TARGET static uint32_t CLMUL(uint32_t crc, const uint8_t data[], uint64_t length)
+    {
+        ASSERT(length >= CLMULMinimum);
+
+        uint64x2_t accumulator[4];
+
+        accumulator[0] = veorq_u64(Load(&data[0]), vcombine_u64(vcreate_u64(0), vcreate_u64(static_cast<uint64_t>(crc) << 32)));
+        accumulator[1] = Load(&data[16]);
+        accumulator[2] = Load(&data[32]);
+        accumulator[3] = Load(&data[48]);
+        data += 64;
+        length -= 64;
+
+        while (length >= 64) {
+            accumulator[0] = veorq_u64(Fold(accumulator[0], X576, X512), Load(&data[0]));
+            accumulator[1] = veorq_u64(Fold(accumulator[1], X576, X512), Load(&data[16]));
+            accumulator[2] = veorq_u64(Fold(accumulator[2], X576, X512), Load(&data[32]));
+            accumulator[3] = veorq_u64(Fold(accumulator[3], X576, X512), Load(&data[48]));
+            data += 64;
+            length -= 64;
+        }
+
+        uint64x2_t value = veorq_u64(Fold(accumulator[0], X192, X128), accumulator[1]);
+        value = veorq_u64(Fold(value, X192, X128), accumulator[2]);
+        value = veorq_u64(Fold(value, X192, X128), accumulator[3]);
+
+        while (length >= 16) {
+            value = veorq_u64(Fold(value, X192, X128), Load(data));
+            data += 16;
+            length -= 16;
+        }
+
+        // value * x^32 mod P: first to 96 bits, then to 64 bits, then Barrett.
+        const uint64_t low = vgetq_lane_u64(value, 0);
+        const uint64x2_t wide = Multiply(vgetq_lane_u64(value, 1), X96);
+        const uint64_t reduced = vgetq_lane_u64(Multiply(vgetq_lane_u64(wide, 1) ^ (low >> 32), X64), 0) ^ vgetq_lane_u64(wide, 0) ^ (low << 32);
+        const uint64x2_t product = Multiply(reduced >> 32, Mu);
+        const uint64_t quotient = (vgetq_lane_u64(product, 0) >> 32) | (vgetq_lane_u64(product, 1) << 32);
+
+        crc = static_cast<uint32_t>(reduced ^ vgetq_lane_u64(Multiply(quotient, Polynomial), 0));
+
+        return (Slice(crc, data, length));
+    }
+
+    static bool Detect()
+    {
+        return ((::getauxval(AT_HWCAP) & HWCAP_PMULL) != 0);
+    }
+
+#endif // __CRC_CLMUL_ARMV8__
+
+#if defined(__CRC_CLMUL_X86__) || defined(__CRC_CLMUL_ARMV8__)
+    static const bool Supported = Detect();
+#else
+    static constexpr bool Supported = false;
+
+    static uint32_t CLMUL(uint32_t crc, const uint8_t data[], uint64_t length)
+    {
+        return (Slice(crc, data, length));
+    }
+#endif
+
+    static std::atomic<uint8_t> Highest(CRC_ENGINE_CLMUL);
+
+    crcEngine CRCEngine()
+    {
+        const uint8_t highest = Highest.load(std::memory_order_relaxed);
+
+        return ((highest == CRC_ENGINE_CLMUL) && (Supported == false) ? CRC_ENGINE_SLICING : static_cast<crcEngine>(highest));
+    }
+
+    crcEngine CRCEngine(const crcEngine highest)
+    {
+        Highest.store(highest, std::memory_order_relaxed);
+
+        return (CRCEngine());
+    }
+
+    /* static */ constexpr uint32_t CRC32Calculator::Initial;
+
+    /* static */ uint32_t CRC32Calculator::Calculate(const uint32_t crc, const uint8_t data[], const uint64_t length)
+    {
+        uint32_t result;
+        const uint8_t engine = Highest.load(std::memory_order_relaxed);
+
+        if ((engine == CRC_ENGINE_CLMUL) && (Supported == true) && (length >= CLMULMinimum)) {
+            result = CLMUL(crc, data, length);
+        } else if (engine != CRC_ENGINE_TABLE) {
+            result = Slice(crc, data, length);
+        } else {
+            result = Table(crc, data, length);
+        }
+
+        return (result);
+    }
+}
+} // namespace WPEFramework::Core
@@ -0,0 +1,83 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CRC32_H
+#define __CRC32_H
+
+#include "Module.h"
+#include "Portability.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    enum crcEngine : uint8_t {
+        CRC_ENGINE_TABLE, // A byte at a time
+        CRC_ENGINE_SLICING, // 8 bytes at a time, 8 tables
+        CRC_ENGINE_CLMUL // Carry-less multiply: PCLMULQDQ (x86) or PMULL (AArch64)
+    };
+
+    // What calculates the CRC, the best the CPU allows is used. Limiting it is for testing and
+    // measuring, it returns the engine that is used from then on.
+    EXTERNAL crcEngine CRCEngine();
+    EXTERNAL crcEngine CRCEngine(const crcEngine highest);
+
+    // The CRC-32 of MPEG-2 (ISO/IEC 13818-1 annex A): polynomial 0x04C11DB7, most significant bit
+    // first, starting at 0xFFFFFFFF and not inverted at the end. The CRC over a section, its CRC
+    // field included, is 0. Data can be fed in pieces, the result is the same as in one go.
+    class EXTERNAL CRC32Calculator {
+    public:
+        static constexpr uint32_t Initial = 0xFFFFFFFF;
+
+    public:
+        CRC32Calculator()
+            : _crc(Initial)
+        {
+        }
+        explicit CRC32Calculator(const uint32_t crc)
+            : _crc(crc)
+        {
+        }
+        CRC32Calculator(const CRC32Calculator&) = default;
+        CRC32Calculator& operator=(const CRC32Calculator&) = default;
+        ~CRC32Calculator() = default;
+
+    public:
+        inline void Reset()
+        {
+            _crc = Initial;
+        }
+        inline void Input(const uint8_t data[], const uint64_t length)
+        {
+            _crc = Calculate(_crc, data, length);
+        }
+        inline uint32_t Result() const
+        {
+            return (_crc);
+        }
+
+        // Continues the CRC crc (Initial for a new one) over the data.
+        static uint32_t Calculate(const uint32_t crc, const uint8_t data[], const uint64_t length);
+
+    private:
+        uint32_t _crc;
+    };
+}
+} // namespace WPEFramework::Core
+
+#endif // __CRC32_H
@@ -20,6 +20,8 @@
 #include "CyclicBuffer.h"
 #include "ProcessInfo.h"
 
+#include <thread>
+
 namespace WPEFramework {
 namespace Core {
 
@@ -55,6 +57,7 @@ namespace Core {
 
             std::atomic_init(&(_administration->_head), static_cast<uint32_t>(0));
             std::atomic_init(&(_administration->_tail), static_cast<uint32_t>(0));
+            std::atomic_init(&(_administration->_claimed), static_cast<uint32_t>(0));
             std::atomic_init(&(_administration->_agents), static_cast<uint32_t>(0));
             std::atomic_init(&(_administration->_state), static_cast<uint16_t>(state::UNLOCKED /* state::EMPTY */ | (overwrite ? state::OVERWRITE : 0)));
             _administration->_lockPID = 0;
@@ -326,6 +329,7 @@ namespace Core {
         }
 
         if (shouldMoveHead) {
+            _administration->_claimed = writeEnd;
             _administration->_head = writeEnd;
 
             if (startingEmpty) {
@@ -401,6 +405,146 @@ namespace Core {
         return actualLength;
     }
 
+    uint32_t CyclicBuffer::Publish(const uint8_t buffer[], const uint32_t length)
+    {
+        Span record;
+
+        uint32_t result = Claim(length, record);
+
+        if (result != 0) {
+            record.Write(0, buffer, length);
+
+            Commit(record);
+        }
+
+        return (result);
+    }
+
+    uint32_t CyclicBuffer::Claim(const uint32_t length, Span& record)
+    {
+        ASSERT(IsValid() == true);
+
+        // Maximum write size is _administration->_size-1, to differentiate from empty situation.
+        if ((length == 0) || (length >= _administration->_size)) {
+            return 0;
+        }
+
+        uint32_t claimed = _administration->_claimed;
+        uint32_t writeEnd;
+
+        do {
+            uint32_t oldTail = _administration->_tail;
+            uint32_t tail = oldTail & _administration->_tailIndexMask;
+            uint32_t free = Free(claimed, tail);
+
+            if (free > length) {
+                writeEnd = (claimed + length) % _administration->_size;
+
+                if (_administration->_claimed.compare_exchange_weak(claimed, writeEnd) == true) {
+                    break;
+                }
+            } else {
+                uint32_t head = _administration->_head;
+
+                // Only what is published can be dropped, the room claimed by others is still
+                // being written to.
+                if (((_administration->_state.load() & state::OVERWRITE) == 0) || ((Used(head, tail) + free) <= length)) {
+                    return 0;
+                }
+
+                Cursor cursor(*this, oldTail, length - free + 1);
+                uint32_t offset = GetOverwriteSize(cursor);
+
+                if (offset > Used(head, tail)) {
+                    return 0;
+                }
+
+                // If this fails, someone else moved the tail, just reevaluate.
+                _administration->_tail.compare_exchange_weak(oldTail, cursor.GetCompleteTail(offset));
+                claimed = _administration->_claimed;
+            }
+        } while (true);
+
+        record._first = _realBuffer + claimed;
+        record._second = _realBuffer;
+        record._firstLength = (writeEnd > claimed ? length : _administration->_size - claimed);
+        record._length = length;
+        record._start = claimed;
+        record._end = writeEnd;
+
+        return (length);
+    }
+
+    void CyclicBuffer::Commit(const Span& record)
+    {
+        ASSERT(record._length != 0);
+
+        // Records become visible in the order they were claimed, wait for the ones before us.
+        for (uint32_t spin = 0; _administration->_head.load(std::memory_order_acquire) != record._start; spin++) {
+            if (spin >= 64) {
+                std::this_thread::yield();
+            }
+        }
+
+        bool startingEmpty = (record._start == (_administration->_tail & _administration->_tailIndexMask));
+
+        _administration->_head.store(record._end, std::memory_order_release);
+
+        // Only the first record in an empty buffer rings, the reader will take the rest with it.
+        if (startingEmpty == true) {
+            if (_administration->_agents.load() > 0) {
+                AdminLock();
+                Reevaluate();
+                AdminUnlock();
+            }
+            DataAvailable();
+        }
+    }
+
+    uint32_t CyclicBuffer::Records(Span& records, const uint32_t maxLength)
+    {
+        ASSERT(IsValid() == true);
+
+        uint32_t oldTail = _administration->_tail;
+        uint32_t head = _administration->_head.load(std::memory_order_acquire);
+        uint32_t offset = oldTail & _administration->_tailIndexMask;
+        uint32_t available = std::min(Used(head, offset), maxLength);
+        uint32_t length = 0;
+
+        Cursor cursor(*this, oldTail, available);
+
+        while (length < available) {
+            uint32_t size = GetReadSize(cursor);
+
+            if ((size == 0) || (size > (available - length))) {
+                // Not complete (yet), or broken.
+                break;
+            }
+
+            length += size;
+            cursor.Forward(size);
+        }
+
+        records._first = _realBuffer + offset;
+        records._second = _realBuffer;
+        records._firstLength = std::min(length, _administration->_size - offset);
+        records._length = length;
+        records._start = oldTail;
+        records._end = 0;
+
+        return (length);
+    }
+
+    bool CyclicBuffer::Consume(const Span& records)
+    {
+        ASSERT(IsValid() == true);
+
+        uint32_t oldTail = records._start;
+        Cursor cursor(*this, oldTail, records._length);
+
+        return (_administration->_tail.compare_exchange_strong(oldTail, cursor.GetCompleteTail(records._length)));
+    }
+
     uint32_t CyclicBuffer::Lock(const bool dataPresent, const uint32_t waitTime)
     {
         uint32_t result = Core::ERROR_TIMEDOUT;
@@ -484,7 +628,7 @@ namespace Core {
         while (!foundData) {
             uint32_t oldTail = _administration->_tail;
             uint32_t tail = oldTail & _administration->_tailIndexMask;
-            result = Used(_administration->_head, oldTail);
+            result = Used(_administration->_head, tail);
 
             if (result == 0) {
                 // No data.
@@ -504,7 +648,7 @@ namespace Core {
             } else {
                 // Needs to be done in two passes.
                 uint32_t firstLength = _administration->_size - tail;
-                uint32_t secondLength = length - firstLength;
+                uint32_t secondLength = result - firstLength;
 
                 memcpy(buffer, _realBuffer + tail, firstLength);
                 memcpy(buffer + firstLength, _realBuffer, secondLength);
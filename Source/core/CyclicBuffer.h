@@ -66,15 +66,17 @@ namespace Core {
             template <typename ArgType>
             void Peek(ArgType& buffer) const
             {
-                uint32_t startIndex = _Tail & _Parent._administration->_tailIndexMask;
-                startIndex += _Offset;
-                startIndex %= _Parent._administration->_size;
+                const uint32_t size = _Parent._administration->_size;
+                const uint32_t startIndex = ((_Tail & _Parent._administration->_tailIndexMask) + _Offset) % size;
+                const uint32_t firstLength = std::min(static_cast<uint32_t>(sizeof(buffer)), size - startIndex);
 
                 uint8_t* bytePtr = reinterpret_cast<uint8_t*>(&buffer);
 
-                for (uint32_t i = 0; i < sizeof(buffer); i++) {
-                    uint32_t index = (startIndex + i) % _Parent._administration->_size;
-                    bytePtr[i] = _Parent._realBuffer[index];
+                memcpy(bytePtr, &(_Parent._realBuffer[startIndex]), firstLength);
+
+                if (firstLength < sizeof(buffer)) {
+                    // Wrapped around the end of the buffer.
+                    memcpy(&(bytePtr[firstLength]), _Parent._realBuffer, sizeof(buffer) - firstLength);
                 }
             }
 
@@ -140,6 +142,84 @@ namespace Core {
             return result;
         }
 
+    public:
+        // A stretch of the buffer, in two parts if it wraps around the end of it. Handed out by
+        // Claim, to write a record in place, and by Records, to read them in place.
+        class Span {
+        public:
+            Span()
+                : _first(nullptr)
+                , _second(nullptr)
+                , _firstLength(0)
+                , _length(0)
+                , _start(0)
+                , _end(0)
+            {
+            }
+
+        public:
+            inline const uint8_t* First() const
+            {
+                return (_first);
+            }
+            inline uint32_t FirstLength() const
+            {
+                return (_firstLength);
+            }
+            inline const uint8_t* Second() const
+            {
+                return (_second);
+            }
+            inline uint32_t SecondLength() const
+            {
+                return (_length - _firstLength);
+            }
+            inline uint32_t Length() const
+            {
+                return (_length);
+            }
+            inline void Write(const uint32_t offset, const void* data, const uint32_t length)
+            {
+                ASSERT((offset + length) <= _length);
+
+                if ((offset + length) <= _firstLength) {
+                    memcpy(&(_first[offset]), data, length);
+                } else if (offset >= _firstLength) {
+                    memcpy(&(_second[offset - _firstLength]), data, length);
+                } else {
+                    const uint32_t part = _firstLength - offset;
+
+                    memcpy(&(_first[offset]), data, part);
+                    memcpy(_second, &(static_cast<const uint8_t*>(data)[part]), length - part);
+                }
+            }
+            inline void Read(const uint32_t offset, void* data, const uint32_t length) const
+            {
+                ASSERT((offset + length) <= _length);
+
+                if ((offset + length) <= _firstLength) {
+                    memcpy(data, &(_first[offset]), length);
+                } else if (offset >= _firstLength) {
+                    memcpy(data, &(_second[offset - _firstLength]), length);
+                } else {
+                    const uint32_t part = _firstLength - offset;
+
+                    memcpy(data, &(_first[offset]), part);
+                    memcpy(&(static_cast<uint8_t*>(data)[part]), _second, length - part);
+                }
+            }
+
+        private:
+            friend class CyclicBuffer;
+
+            uint8_t* _first;
+            uint8_t* _second;
+            uint32_t _firstLength;
+            uint32_t _length;
+            uint32_t _start; // Claim: where the record starts, Records: the tail it was taken at.
+            uint32_t _end; // Claim: where the record ends.
+        };
+
     public:
         inline void Flush()
         {
@@ -232,6 +312,29 @@ namespace Core {
         //    readers seeing incomplete data.
         uint32_t Reserve(const uint32_t length);
 
+        // THREAD SAFE
+        // Insert a complete record, while other threads might do the same. Room is claimed
+        // with a compare and swap, the copies are done in parallel, and the records are made
+        // visible in the order in which their room was claimed. A writer only ever waits for
+        // the copy of a writer that claimed before it. In overwrite mode only published
+        // records are dropped to make room. If that is not enough, or the record is too large,
+        // nothing is written and 0 is returned. Do not use next to Reserve on the same buffer.
+        uint32_t Publish(const uint8_t buffer[], const uint32_t length);
+
+        // THREAD SAFE
+        // Publish, without the copy: claims room for a record of length bytes, which is filled in
+        // through the span, in place, and made visible with Commit. Every record claimed must be
+        // committed, the records claimed after it wait for it. Returns 0 if there is no room.
+        uint32_t Claim(const uint32_t length, Span& record);
+        void Commit(const Span& record);
+
+        // Reads in place, and in batches: the span covers all complete records (as GetReadSize
+        // reports them) that are in the buffer, up to maxLength bytes. They stay in the buffer
+        // until they are consumed. In overwrite mode, writers might have dropped them in the mean
+        // time, then Consume returns false and what was read from the span can not be trusted.
+        uint32_t Records(Span& records, const uint32_t maxLength = ~0);
+        bool Consume(const Span& records);
+
         virtual void DataAvailable();
 
     private:
@@ -280,6 +383,7 @@ namespace Core {
 
             std::atomic<uint32_t> _head;
             std::atomic<uint32_t> _tail;
+            std::atomic<uint32_t> _claimed; // Up to where writers claimed room, _head trails it.
             uint32_t _tailIndexMask; // Bitmask of index in buffer, rest is round count.
             uint32_t _roundCountModulo; // Value with which to mod round count to prevent overflow.
             std::atomic<uint32_t> _agents;
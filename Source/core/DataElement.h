@@ -24,6 +24,7 @@
 #include <memory>
 
 // ---- Include local include files ----
+#include "CRC32.h"
 #include "Portability.h"
 #include "Proxy.h"
 #include "Serialization.h"
@@ -670,7 +671,7 @@ namespace Core {
         }
 
         uint64_t Copy(const uint64_t offset, const DataElementContainer& copy);
-        uint32_t CRC32(const uint64_t offset, const uint64_t size) const;
+        uint32_t CRC32(const uint64_t offset, const uint64_t size, const uint32_t crc = CRC32Calculator::Initial) const;
 
     protected:
         virtual void Reallocation(const uint64_t size)
@@ -0,0 +1,125 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+#include "Singleton.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    CallLatencies::CallLatencies()
+        : _adminLock()
+        , _enabled(true)
+        , _used(0)
+    {
+        for (uint32_t index = 0; index < Capacity; index++) {
+            std::atomic_init(&(_entries[index]), static_cast<Entry*>(nullptr));
+        }
+    }
+
+    CallLatencies::~CallLatencies()
+    {
+        for (uint32_t index = 0; index < Capacity; index++) {
+            Entry* entry = _entries[index].exchange(nullptr);
+
+            if (entry != nullptr) {
+                delete entry;
+            }
+        }
+    }
+
+    /* static */ CallLatencies& CallLatencies::Instance()
+    {
+        return (Core::SingletonType<CallLatencies>::Instance());
+    }
+
+    CallLatencies::Entry* CallLatencies::Add(Entry* entry)
+    {
+        Entry* result = nullptr;
+
+        _adminLock.Lock();
+
+        // Someone else might have been first.
+        result = Find(entry->_key, (entry->_origin == JSONRPC ? &(entry->_callsign) : nullptr), &(entry->_method));
+
+        if (result == nullptr) {
+            // Never completely full, so a lookup always ends on an empty slot.
+            if (IsFull() == false) {
+                uint32_t index = static_cast<uint32_t>((entry->_key ^ (entry->_key >> 29)) * 0x9E3779B1) % Capacity;
+
+                while (_entries[index].load() != nullptr) {
+                    index = (index + 1) % Capacity;
+                }
+
+                _used++;
+                _entries[index].store(entry, std::memory_order_release);
+
+                result = entry;
+                entry = nullptr;
+            }
+        }
+
+        _adminLock.Unlock();
+
+        if (entry != nullptr) {
+            delete entry;
+        }
+
+        return (result);
+    }
+
+    void CallLatencies::Visit(const std::function<void(const Entry&)>& visitor) const
+    {
+        for (uint32_t index = 0; index < Capacity; index++) {
+            const Entry* entry = _entries[index].load(std::memory_order_acquire);
+
+            if (entry != nullptr) {
+                visitor(*entry);
+            }
+        }
+    }
+
+    void CallLatencies::Reset()
+    {
+        for (uint32_t index = 0; index < Capacity; index++) {
+            Entry* entry = _entries[index].load(std::memory_order_acquire);
+
+            if (entry != nullptr) {
+                entry->_histogram.Reset();
+            }
+        }
+    }
+
+    /* static */ uint64_t CallLatencies::Hash(const string& callsign, const string& method)
+    {
+        // FNV-1a, with the JSONRPC origin in the top byte, like the COMRPC keys have theirs.
+        uint64_t result = 0xcbf29ce484222325ULL;
+
+        for (const char c : callsign) {
+            result = (result ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+        }
+        result = (result ^ '.') * 0x100000001b3ULL;
+        for (const char c : method) {
+            result = (result ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+        }
+
+        return ((result & 0x00FFFFFFFFFFFFFFULL) | (static_cast<uint64_t>(JSONRPC) << 56));
+    }
+}
+} // namespace WPEFramework::Core
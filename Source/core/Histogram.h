@@ -0,0 +1,372 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __HISTOGRAM_H
+#define __HISTOGRAM_H
+
+#include <chrono>
+#include <functional>
+
+#include "Module.h"
+#include "Portability.h"
+#include "Sync.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    // HDR style: each power of two is split in 16 linear steps, so a value ends up in a bucket that
+    // is at most 1/16th (6.25%) of the value wide. Values are expected in microseconds, up to 2^32
+    // (71 minutes), anything larger is counted in the last bucket. Recording is lock free, so it
+    // can be done from any thread, reading while recording gives a close, not an exact, picture.
+    class Histogram {
+    public:
+        static constexpr uint8_t SubBucketBits = 4;
+        static constexpr uint32_t SubBuckets = (1 << SubBucketBits);
+        static constexpr uint32_t Buckets = ((32 - SubBucketBits + 1) * SubBuckets);
+
+    public:
+        Histogram(const Histogram&) = delete;
+        Histogram& operator=(const Histogram&) = delete;
+
+        Histogram()
+        {
+            Reset();
+        }
+        ~Histogram()
+        {
+        }
+
+    public:
+        void Record(const uint64_t value)
+        {
+            _buckets[Index(value)].fetch_add(1, std::memory_order_relaxed);
+            _count.fetch_add(1, std::memory_order_relaxed);
+            _sum.fetch_add(value, std::memory_order_relaxed);
+
+            uint64_t current = _max.load(std::memory_order_relaxed);
+            while ((value > current) && (_max.compare_exchange_weak(current, value, std::memory_order_relaxed) == false)) {
+            }
+            current = _min.load(std::memory_order_relaxed);
+            while ((value < current) && (_min.compare_exchange_weak(current, value, std::memory_order_relaxed) == false)) {
+            }
+        }
+        void Reset()
+        {
+            for (uint32_t index = 0; index < Buckets; index++) {
+                _buckets[index].store(0, std::memory_order_relaxed);
+            }
+            _count.store(0, std::memory_order_relaxed);
+            _sum.store(0, std::memory_order_relaxed);
+            _min.store(~static_cast<uint64_t>(0), std::memory_order_relaxed);
+            _max.store(0, std::memory_order_relaxed);
+        }
+        inline uint64_t Count() const
+        {
+            return (_count.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Min() const
+        {
+            return (Count() == 0 ? 0 : _min.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Max() const
+        {
+            return (_max.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Average() const
+        {
+            const uint64_t count = Count();
+
+            return (count == 0 ? 0 : (_sum.load(std::memory_order_relaxed) / count));
+        }
+        // The value below which the given percentage (0-100) of the recorded values are, rounded
+        // up to the end of the bucket it is in.
+        uint64_t Percentile(const double percentage) const
+        {
+            uint64_t result = 0;
+            const uint64_t count = Count();
+
+            if (count > 0) {
+                uint64_t target = static_cast<uint64_t>((percentage * count) / 100.0);
+                uint64_t seen = 0;
+                uint32_t index = 0;
+
+                target = std::max(static_cast<uint64_t>(1), std::min(target, count));
+
+                while ((index < (Buckets - 1)) && ((seen += _buckets[index].load(std::memory_order_relaxed)) < target)) {
+                    index++;
+                }
+
+                result = std::min(Highest(index), Max());
+            }
+
+            return (result);
+        }
+
+        static uint32_t Index(const uint64_t value)
+        {
+            uint32_t result;
+
+            if (value < SubBuckets) {
+                result = static_cast<uint32_t>(value);
+            } else if (value >= (static_cast<uint64_t>(1) << 32)) {
+                result = Buckets - 1;
+            } else {
+#ifdef __GNUC__
+                const uint8_t highest = static_cast<uint8_t>(63 - __builtin_clzll(value));
+#else
+                uint8_t highest = 31;
+                while ((value & (static_cast<uint64_t>(1) << highest)) == 0) {
+                    highest--;
+                }
+#endif
+
+                const uint8_t shift = highest - SubBucketBits;
+                result = ((shift + 1) << SubBucketBits) + static_cast<uint32_t>((value >> shift) & (SubBuckets - 1));
+            }
+
+            return (result);
+        }
+        static uint64_t Highest(const uint32_t index)
+        {
+            uint64_t result = index;
+
+            if (index >= SubBuckets) {
+                const uint8_t shift = static_cast<uint8_t>((index >> SubBucketBits) - 1);
+                const uint64_t lowest = static_cast<uint64_t>(SubBuckets + (index & (SubBuckets - 1))) << shift;
+
+                result = lowest + (static_cast<uint64_t>(1) << shift) - 1;
+            }
+
+            return (result);
+        }
+
+    private:
+        std::atomic<uint32_t> _buckets[Buckets];
+        std::atomic<uint64_t> _count;
+        std::atomic<uint64_t> _sum;
+        std::atomic<uint64_t> _min;
+        std::atomic<uint64_t> _max;
+    };
+
+    // A histogram of the time the calls take, per interface and method for COMRPC, per callsign and
+    // method for JSON-RPC. Entries are added on the first call, and stay, so looking one up is lock
+    // free. Once the table is full, new methods are not recorded.
+    class EXTERNAL CallLatencies {
+    public:
+        enum origin : uint8_t {
+            COMRPC_INBOUND = 0x01, // Handled by a stub in this process.
+            COMRPC_OUTBOUND = 0x02, // Called through a proxy, so the round trip.
+            JSONRPC = 0x03
+        };
+
+        class Entry {
+        public:
+            Entry() = delete;
+            Entry(const Entry&) = delete;
+            Entry& operator=(const Entry&) = delete;
+
+            Entry(const uint64_t key, const origin source, const uint32_t interfaceId, const uint32_t methodId)
+                : _key(key)
+                , _origin(source)
+                , _interfaceId(interfaceId)
+                , _methodId(methodId)
+                , _callsign()
+                , _method()
+                , _histogram()
+            {
+            }
+            Entry(const uint64_t key, const string& callsign, const string& method)
+                : _key(key)
+                , _origin(JSONRPC)
+                , _interfaceId(0)
+                , _methodId(0)
+                , _callsign(callsign)
+                , _method(method)
+                , _histogram()
+            {
+            }
+            ~Entry()
+            {
+            }
+
+        public:
+            inline origin Origin() const
+            {
+                return (_origin);
+            }
+            inline uint32_t InterfaceId() const
+            {
+                return (_interfaceId);
+            }
+            inline uint32_t MethodId() const
+            {
+                return (_methodId);
+            }
+            inline const string& Callsign() const
+            {
+                return (_callsign);
+            }
+            inline const string& Method() const
+            {
+                return (_method);
+            }
+            inline const Core::Histogram& Histogram() const
+            {
+                return (_histogram);
+            }
+
+        private:
+            friend class CallLatencies;
+
+            const uint64_t _key;
+            const origin _origin;
+            const uint32_t _interfaceId;
+            const uint32_t _methodId;
+            const string _callsign;
+            const string _method;
+            Core::Histogram _histogram;
+        };
+
+        // Times what happens during its lifetime, into the given histogram, if any.
+        class Measurement {
+        public:
+            Measurement() = delete;
+            Measurement(const Measurement&) = delete;
+            Measurement& operator=(const Measurement&) = delete;
+
+            Measurement(Core::Histogram* histogram)
+                : _histogram(histogram)
+                , _start(histogram != nullptr ? Now() : 0)
+            {
+            }
+            ~Measurement()
+            {
+                if (_histogram != nullptr) {
+                    _histogram->Record(Now() - _start);
+                }
+            }
+
+        private:
+            Core::Histogram* _histogram;
+            uint64_t _start;
+        };
+
+        static constexpr uint32_t Capacity = 1024;
+
+    protected:
+        CallLatencies();
+
+    public:
+        CallLatencies(const CallLatencies&) = delete;
+        CallLatencies& operator=(const CallLatencies&) = delete;
+
+        ~CallLatencies();
+
+        static CallLatencies& Instance();
+
+    public:
+        inline bool IsEnabled() const
+        {
+            return (_enabled.load(std::memory_order_relaxed));
+        }
+        inline void Enable(const bool enabled)
+        {
+            _enabled.store(enabled, std::memory_order_relaxed);
+        }
+
+        // The histogram to record in, nullptr if recording is disabled or the table is full.
+        Core::Histogram* Histogram(const origin source, const uint32_t interfaceId, const uint32_t methodId)
+        {
+            Core::Histogram* result = nullptr;
+
+            if (IsEnabled() == true) {
+                const uint64_t key = (static_cast<uint64_t>(source) << 56) | (static_cast<uint64_t>(methodId & 0xFFFFFF) << 32) | interfaceId;
+                Entry* entry = Find(key, nullptr, nullptr);
+
+                // A full table stays full, do not build an entry (and take the lock) for nothing.
+                if ((entry == nullptr) && (IsFull() == false)) {
+                    entry = Add(new Entry(key, source, interfaceId, methodId));
+                }
+                if (entry != nullptr) {
+                    result = &(entry->_histogram);
+                }
+            }
+
+            return (result);
+        }
+        Core::Histogram* Histogram(const string& callsign, const string& method)
+        {
+            Core::Histogram* result = nullptr;
+
+            if (IsEnabled() == true) {
+                const uint64_t key = Hash(callsign, method);
+                Entry* entry = Find(key, &callsign, &method);
+
+                if ((entry == nullptr) && (IsFull() == false)) {
+                    entry = Add(new Entry(key, callsign, method));
+                }
+                if (entry != nullptr) {
+                    result = &(entry->_histogram);
+                }
+            }
+
+            return (result);
+        }
+
+        void Visit(const std::function<void(const Entry&)>& visitor) const;
+        void Reset();
+
+        static uint64_t Now()
+        {
+            return (static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()));
+        }
+
+    private:
+        Entry* Find(const uint64_t key, const string* callsign, const string* method) const
+        {
+            uint32_t index = static_cast<uint32_t>((key ^ (key >> 29)) * 0x9E3779B1) % Capacity;
+            Entry* entry;
+
+            while ((entry = _entries[index].load(std::memory_order_acquire)) != nullptr) {
+                if ((entry->_key == key) && ((callsign == nullptr) || ((entry->_callsign == *callsign) && (entry->_method == *method)))) {
+                    break;
+                }
+                index = (index + 1) % Capacity;
+            }
+
+            return (entry);
+        }
+        // Entries are never removed, once full, the table stays that way.
+        inline bool IsFull() const
+        {
+            return (_used.load(std::memory_order_relaxed) >= ((Capacity * 3) / 4));
+        }
+        Entry* Add(Entry* entry);
+        static uint64_t Hash(const string& callsign, const string& method);
+
+    private:
+        Core::CriticalSection _adminLock;
+        std::atomic<bool> _enabled;
+        std::atomic<uint32_t> _used;
+        std::atomic<Entry*> _entries[Capacity];
+    };
+}
+} // namespace WPEFramework::Core
+
+#endif // __HISTOGRAM_H
@@ -22,6 +22,7 @@
 
 #include "Factory.h"
 #include "IAction.h"
+#include "IPCSharedMemory.h"
 #include "Link.h"
 #include "Module.h"
 #include "Portability.h"
@@ -197,6 +198,10 @@ namespace Core {
                         if (_offset == 8) {
                             _current = Element(_label);
                             _label = 0;
+
+                            if (_current != nullptr) {
+                                _current->Expect(_length);
+                            }
                         }
                     }
 
@@ -205,7 +210,9 @@ namespace Core {
                     if ((_offset - 8) < _length) {
 
                         // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
-                        uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 8)) ? static_cast<uint16_t>(_length - (_offset - 8)) : (maxLength - result));
+                        // The message can be larger than 64K, so the remainder is compared as it is, not truncated.
+                        const uint32_t remaining = _length - (_offset - 8);
+                        uint16_t handled(static_cast<uint32_t>(maxLength - result) > remaining ? static_cast<uint16_t>(remaining) : (maxLength - result));
 
                         if (_current != nullptr) {
                             handled = _current->Deserialize(&stream[result], handled, _offset - 8);
@@ -244,6 +251,12 @@ namespace Core {
         virtual uint32_t Length() const = 0;
         virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) const = 0;
         virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) = 0;
+
+        // Told before the first Deserialize, the length announced for this message on the line. Lengths
+        // read from the message itself can be checked against it.
+        virtual void Expect(const uint32_t /* length */)
+        {
+        }
     };
 
     struct EXTERNAL IIPC {
@@ -316,6 +329,10 @@ namespace Core {
             {
                 return (_Deserialize<PACKAGE, REALIDENTIFIER>(stream, maxLength, offset));
             }
+            virtual void Expect(const uint32_t length)
+            {
+                _Expect<PACKAGE, REALIDENTIFIER>(length);
+            }
             virtual void AddRef() const
             {
                 _parent.AddRef();
@@ -416,6 +433,23 @@ namespace Core {
                 return (result);
             }
 
+            HAS_MEMBER(Expect, hasExpect);
+
+            typedef hasExpect<PACKAGE, void (PACKAGE::*)(const uint32_t)> TraitExpect;
+
+            template <typename SUBJECT, const uint32_t ID>
+            inline typename Core::TypeTraits::enable_if<RawSerializedType<SUBJECT, ID>::TraitExpect::value, void>::type
+            _Expect(const uint32_t length)
+            {
+                _package.Expect(length);
+            }
+
+            template <typename SUBJECT, const uint32_t ID>
+            inline typename Core::TypeTraits::enable_if<!RawSerializedType<SUBJECT, ID>::TraitExpect::value, void>::type
+            _Expect(const uint32_t)
+            {
+            }
+
         private:
             PACKAGE _package;
             IPCMessageType<IDENTIFIER, PARAMETERS, RESPONSE>& _parent;
@@ -501,16 +535,277 @@ namespace Core {
         private:
             friend IPCChannel;
 
+            // Every message on the channel carries the id of the call it belongs to, written just
+            // like the length and label in front of it. That allows more calls to be outstanding
+            // on the same channel, with their responses coming back in any order.
+            // The lowest bit of that id tells if the payload follows inline, or is waiting in the
+            // shared memory of the channel, in which case only its offset and length follow.
+            class Frame : public IMessage {
+            public:
+                Frame(const Frame&) = delete;
+                Frame& operator=(const Frame&) = delete;
+
+                Frame()
+                    : _parent(nullptr)
+                    , _label(0)
+                    , _id(0)
+                    , _size(0)
+                    , _offset(0)
+                    , _length(0)
+                    , _expected(0)
+                    , _corrupt(false)
+                    , _message()
+                    , _call()
+                    , _shared()
+                {
+                }
+                ~Frame() override
+                {
+                }
+
+            public:
+                inline void Outbound(const uint32_t id, const ProxyType<IMessage>& message)
+                {
+                    ASSERT(message.IsValid() == true);
+
+                    _label = message->Label();
+                    _id = id;
+                    _size = IdSize(id << 1);
+                    _message = message;
+                }
+                inline void Outbound(const uint32_t id, const ProxyType<IMessage>& message, const ProxyType<IPCSharedMemory>& shared)
+                {
+                    Outbound(id, message);
+
+                    _shared = shared;
+                }
+                inline void Inbound(IPCFactory& parent, const uint32_t label)
+                {
+                    _parent = &parent;
+                    _label = label;
+                }
+                inline void Inbound(IPCFactory& parent, const uint32_t label, const ProxyType<IIPC>& call)
+                {
+                    _parent = &parent;
+                    _label = label;
+                    _call = call;
+                    _message = call->IParameters();
+                }
+                inline uint32_t Id() const
+                {
+                    return (_id);
+                }
+                inline bool IsResponse() const
+                {
+                    return ((_label & 0x01) != 0);
+                }
+                // The id that came in did not fit in 32 bits, nothing about this frame can be trusted.
+                inline bool IsCorrupt() const
+                {
+                    return (_corrupt);
+                }
+                inline ProxyType<IIPC>& Call()
+                {
+                    return (_call);
+                }
+
+                uint32_t Label() const override
+                {
+                    return (_label);
+                }
+                uint32_t Length() const override
+                {
+                    const uint32_t length = (_message.IsValid() == true ? _message->Length() : 0);
+
+                    // The frames are asked for their length in the order they go out, so this is the
+                    // moment to claim the room in the ring, to keep it in that same order.
+                    if ((_shared.IsValid() == true) && (_length == 0)) {
+                        if (_shared->Reserve(length, _offset) == true) {
+                            _length = length;
+                            _size = IdSize((_id << 1) | 0x01) + Descriptor;
+                        } else {
+                            _shared.Release();
+                        }
+                    }
+
+                    return (_size + (_length != 0 ? 0 : length));
+                }
+                uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const override
+                {
+                    uint16_t result = 0;
+                    const uint32_t tag = ((_id << 1) | (_length != 0 ? 0x01 : 0x00));
+                    const uint8_t tagSize = IdSize(tag);
+
+                    while (((offset + result) < tagSize) && (result < maxLength)) {
+                        uint32_t value = tag >> (7 * (offset + result));
+                        stream[result] = ((value & 0x7F) | (value >= 0x80 ? 0x80 : 0x00));
+                        result++;
+                    }
+
+                    if (_length != 0) {
+                        if (((offset + result) == tagSize) && (result < maxLength)) {
+                            Store();
+                        }
+
+                        while (((offset + result) < _size) && (result < maxLength)) {
+                            const uint8_t index = static_cast<uint8_t>(offset + result - tagSize);
+                            stream[result++] = static_cast<uint8_t>(((index < 4 ? _offset : _length) >> (8 * (index & 0x03))) & 0xFF);
+                        }
+                    } else if (result < maxLength) {
+                        result += _message->Serialize(&stream[result], maxLength - result, offset + result - _size);
+                    }
+
+                    return (result);
+                }
+                void Expect(const uint32_t length) override
+                {
+                    _expected = length;
+                }
+                uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset) override
+                {
+                    uint16_t result = 0;
+
+                    while ((_size == 0) && (result < maxLength)) {
+                        const uint32_t index = offset + result;
+
+                        // The tag is 32 bits, at most 5 bytes of 7 bits of which the last one only holds 4.
+                        if ((index > 4) || ((index == 4) && ((stream[result] & 0xF0) != 0))) {
+                            TRACE_L1("The id of an IPC frame is too long, the frame is dropped");
+                            _corrupt = true;
+                            _size = index;
+                            _message.Release();
+                            _call.Release();
+                            break;
+                        }
+
+                        _id |= (static_cast<uint32_t>(stream[result] & 0x7F) << (7 * index));
+
+                        if ((stream[result++] & 0x80) == 0) {
+                            const bool inlined = ((_id & 0x01) == 0);
+
+                            _size = offset + result;
+
+                            if (inlined == false) {
+                                _size += Descriptor;
+                                _shared = _parent->Shared();
+                            }
+
+                            _id >>= 1;
+
+                            // Now we know the call, a response can go into the message that was sent for it.
+                            if (IsResponse() == true) {
+                                _message = _parent->Response(_label, _id);
+                            }
+
+                            // Inline, the payload is what is left of the frame. Otherwise Load tells.
+                            if ((inlined == true) && (_message.IsValid() == true)) {
+                                _message->Expect(_expected > _size ? _expected - _size : 0);
+                            }
+                        }
+                    }
+
+                    if ((_size != 0) && ((offset + result) < _size)) {
+                        const uint32_t start = _size - Descriptor;
+
+                        while (((offset + result) < _size) && (result < maxLength)) {
+                            const uint8_t index = static_cast<uint8_t>(offset + result - start);
+                            (index < 4 ? _offset : _length) |= (static_cast<uint32_t>(stream[result++]) << (8 * (index & 0x03)));
+                        }
+
+                        if ((offset + result) == _size) {
+                            Load();
+                        }
+                    } else if (result < maxLength) {
+                        if (_message.IsValid() == true) {
+                            result += _message->Deserialize(&stream[result], maxLength - result, offset + result - _size);
+                        } else {
+                            // Nobody is waiting for this (anymore), skip it.
+                            result = maxLength;
+                        }
+                    }
+
+                    return (result);
+                }
+
+            private:
+                inline static uint8_t IdSize(const uint32_t id)
+                {
+                    return (id > 0x0FFFFFFF ? 5 : (id > 0x1FFFFF ? 4 : (id > 0x3FFF ? 3 : (id > 0x7F ? 2 : 1))));
+                }
+                void Store() const
+                {
+                    uint8_t* buffer = _shared->Outbound(_offset);
+                    uint32_t loaded = 0;
+
+                    while (loaded < _length) {
+                        uint16_t handled = _message->Serialize(&buffer[loaded], static_cast<uint16_t>(std::min(_length - loaded, static_cast<uint32_t>(0xFFFF))), loaded);
+
+                        ASSERT(handled != 0);
+
+                        if (handled == 0) {
+                            break;
+                        }
+                        loaded += handled;
+                    }
+                }
+                void Load()
+                {
+                    if (_shared.IsValid() == false) {
+                        TRACE_L1("Payload of call [%d] is in shared memory that is not there.\n", _id);
+                    } else {
+                        const uint8_t* buffer = _shared->Inbound(_offset, _length);
+
+                        if ((buffer != nullptr) && (_message.IsValid() == true)) {
+                            uint32_t loaded = 0;
+
+                            _message->Expect(_length);
+
+                            while (loaded < _length) {
+                                uint16_t handled = _message->Deserialize(&buffer[loaded], static_cast<uint16_t>(std::min(_length - loaded, static_cast<uint32_t>(0xFFFF))), loaded);
+
+                                if (handled == 0) {
+                                    break;
+                                }
+                                loaded += handled;
+                            }
+                        }
+
+                        // Whether we wanted it or not, the producer may have the room back.
+                        _shared->Release(_offset, _length);
+                        _shared.Release();
+                    }
+                }
+
+            private:
+                static constexpr uint8_t Descriptor = 8;
+
+                IPCFactory* _parent;
+                uint32_t _label;
+                uint32_t _id;
+                mutable uint32_t _size;
+                mutable uint32_t _offset;
+                mutable uint32_t _length;
+                uint32_t _expected;
+                bool _corrupt;
+                ProxyType<IMessage> _message;
+                ProxyType<IIPC> _call;
+                mutable ProxyType<IPCSharedMemory> _shared;
+            };
+
+            typedef std::pair<ProxyType<IIPC>, IDispatchType<IIPC>*> Outbound;
+
             IPCFactory(const IPCFactory& copy) = delete;
             IPCFactory& operator=(const IPCFactory&) = delete;
 
             IPCFactory()
                 : _lock()
+                , _sequence(0)
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
                 , _factory()
                 , _handlers()
+                , _shared()
+                , _threshold(0)
             {
             }
             inline void Factory(Core::ProxyType<FactoryType<IIPC, uint32_t>>& factory)
@@ -523,11 +818,13 @@ namespace Core {
         public:
             IPCFactory(Core::ProxyType<FactoryType<IIPC, uint32_t>>& factory)
                 : _lock()
+                , _sequence(0)
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
                 , _factory(factory)
                 , _handlers()
+                , _shared()
+                , _threshold(0)
             {
                 // Only creat the IPCFactory with a valid base factory
                 ASSERT(factory.IsValid());
@@ -578,37 +875,52 @@ namespace Core {
 
             inline bool InProgress() const
             {
-                return (_outbound.IsValid());
+                _lock.Lock();
+
+                bool result = (_outbound.empty() == false);
+
+                _lock.Unlock();
+
+                return (result);
             }
 
-            inline ProxyType<IMessage> Element(const uint32_t& identifier)
+            // Payloads of at least threshold bytes are sent through the shared memory, with a threshold
+            // of 0 it is only used for what comes in. Pass an invalid memory to stop using it.
+            inline void Shared(const ProxyType<IPCSharedMemory>& memory, const uint32_t threshold)
             {
-                ProxyType<IMessage> result;
-                uint32_t searchIdentifier(identifier >> 1);
+                ASSERT((memory.IsValid() == false) || (memory->IsValid() == true));
 
                 _lock.Lock();
 
+                _shared = memory;
+                _threshold = (memory.IsValid() == true ? threshold : 0);
+
+                _lock.Unlock();
+            }
+
+            inline ProxyType<IMessage> Element(const uint32_t& identifier)
+            {
+                ProxyType<IMessage> result;
+
                 if (identifier & 0x01) {
-                    if ((_outbound.IsValid() == true) && (_outbound->Label() == searchIdentifier)) {
-                        result = _outbound->IResponse();
-                    } else {
-                        TRACE_L1("Unexpected response message for ID [%d].\n", searchIdentifier);
-                    }
-                } else {
-                    ASSERT(_inbound.IsValid() == false);
+                    // Which call this response belongs to, follows in the frame.
+                    ProxyType<Frame> frame(ProxyType<Frame>::Create());
 
-                    ProxyType<IIPC> rpcCall(_factory->Element(searchIdentifier));
+                    frame->Inbound(*this, identifier);
+                    result = ProxyType<IMessage>(frame);
+                } else {
+                    ProxyType<IIPC> rpcCall(_factory->Element(identifier >> 1));
 
                     if (rpcCall.IsValid() == true) {
-                        _inbound = rpcCall;
-                        result = rpcCall->IParameters();
+                        ProxyType<Frame> frame(ProxyType<Frame>::Create());
+
+                        frame->Inbound(*this, identifier, rpcCall);
+                        result = ProxyType<IMessage>(frame);
                     } else {
-                        TRACE_L1("No RPC method definition for ID [%d].\n", searchIdentifier);
+                        TRACE_L1("No RPC method definition for ID [%d].\n", (identifier >> 1));
                     }
                 }
 
-                _lock.Unlock();
-
                 return (result);
             }
 
@@ -618,13 +930,12 @@ namespace Core {
 
                 TRACE_L1("Flushing the IPC mechanims. %d", __LINE__);
 
-                _callback = nullptr;
+                _outbound.clear();
+                _inbound.clear();
+                _threshold = 0;
 
-                if (_outbound.IsValid() == true) {
-                    _outbound.Release();
-                }
-                if (_inbound.IsValid() == true) {
-                    _inbound.Release();
+                if (_shared.IsValid() == true) {
+                    _shared.Release();
                 }
 
                 _lock.Unlock();
@@ -633,74 +944,162 @@ namespace Core {
             inline ProxyType<IIPCServer> ReceivedMessage(const Core::ProxyType<IMessage>& rhs, Core::ProxyType<IIPC>& inbound)
             {
                 ProxyType<IIPCServer> procedure;
+                ProxyType<Frame> frame(rhs);
+                Outbound handled(ProxyType<IIPC>(), nullptr);
 
-                _lock.Lock();
-
-                if ((_outbound.IsValid() == true) && (_outbound->IResponse() == rhs)) {
+                ASSERT(frame.IsValid() == true);
 
-                    ASSERT(_callback != nullptr);
+                _lock.Lock();
 
-                    ProxyType<IIPC> handledObject(_outbound);
+                if (frame->IsCorrupt() == true) {
+                    // Its id can not be matched to a call, let it go.
+                } else if (frame->IsResponse() == true) {
+                    std::map<uint32_t, Outbound>::iterator index(_outbound.find(frame->Id()));
 
-                    _outbound.Release();
-                    _callback->Dispatch(*handledObject);
-                    _callback = nullptr;
+                    if (index != _outbound.end()) {
+                        handled = index->second;
+                        _outbound.erase(index);
+                    } else {
+                        TRACE_L1("Unexpected response message for call [%d].\n", frame->Id());
+                    }
                 }
-                // If this is *NOT* the outbound call, it is inbound and thus it must have been registered
-                else if (_inbound.IsValid() == true) {
-
-                    std::map<uint32_t, ProxyType<IIPCServer>>::iterator index(_handlers.find(_inbound->Label()));
+                // If this is *NOT* a response to an outbound call, it is inbound and thus it must have been registered
+                else {
+                    std::map<uint32_t, ProxyType<IIPCServer>>::iterator index(_handlers.find(frame->Call()->Label()));
 
 					ASSERT(index != _handlers.end());
 
                     if (index != _handlers.end()) {
                         procedure = (*index).second;
-                        inbound = _inbound;
+                        inbound = frame->Call();
+
+                        // Remember what call this is, the response should go out with the same id.
+                        _inbound[&(*inbound)] = frame->Id();
                     } else {
-                        TRACE_L1("No handler defined to handle the incoming frames. [%d]", _inbound->Label());
+                        TRACE_L1("No handler defined to handle the incoming frames. [%d]", frame->Call()->Label());
                     }
+                }
+
+                _lock.Unlock();
+
+                // Report outside the lock, the callback is free to start a new call.
+                if (handled.second != nullptr) {
+                    handled.second->Dispatch(*(handled.first));
+                }
+
+                return (procedure);
+            }
+
+            inline ProxyType<IMessage> Request(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback, uint32_t& id)
+            {
+                ProxyType<Frame> frame(ProxyType<Frame>::Create());
+                ProxyType<IMessage> parameters(outbound->IParameters());
+                const uint32_t length = parameters->Length();
+
+                ASSERT((outbound.IsValid() == true) && (callback != nullptr));
+
+                _lock.Lock();
+
+                // Skip ids that are still in use, after a wrap around. One bit of it goes on the wire
+                // to tell where the payload is.
+                do {
+                    id = (++_sequence & 0x7FFFFFFF);
+                } while (_outbound.find(id) != _outbound.end());
 
-                    _inbound.Release();
+                _outbound.insert(std::pair<const uint32_t, Outbound>(id, Outbound(outbound, callback)));
+
+                if ((_threshold != 0) && (length >= _threshold)) {
+                    frame->Outbound(id, parameters, _shared);
                 } else {
-                    ASSERT(false && "Received something that is neither an inbound nor on outbound!!!");
+                    frame->Outbound(id, parameters);
                 }
 
                 _lock.Unlock();
 
-                return (procedure);
+                return (ProxyType<IMessage>(frame));
             }
 
-            inline void SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback)
+            inline ProxyType<IMessage> Response(const Core::ProxyType<IIPC>& inbound)
             {
+                ProxyType<IMessage> result;
+
                 _lock.Lock();
 
-                ASSERT((outbound.IsValid() == true) && (callback != nullptr));
-                ASSERT((_outbound.IsValid() == false) && (_callback == nullptr));
+                std::map<const IIPC*, uint32_t>::iterator index(_inbound.find(&(*inbound)));
+
+                if (index != _inbound.end()) {
+                    ProxyType<Frame> frame(ProxyType<Frame>::Create());
+                    ProxyType<IMessage> response(inbound->IResponse());
 
-                _outbound = outbound;
-                _callback = callback;
+                    if ((_threshold != 0) && (response->Length() >= _threshold)) {
+                        frame->Outbound(index->second, response, _shared);
+                    } else {
+                        frame->Outbound(index->second, response);
+                    }
+                    result = ProxyType<IMessage>(frame);
+
+                    _inbound.erase(index);
+                } else {
+                    TRACE_L1("Response for a call that is not pending [%d].\n", inbound->Label());
+                }
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            // Returns true if the call was still outstanding, i.e. the response will not be reported anymore.
+            inline bool AbortOutbound(const uint32_t id)
+            {
+                _lock.Lock();
+
+                bool result = (_outbound.erase(id) != 0);
 
                 _lock.Unlock();
+
+                return (result);
             }
 
             inline bool AbortOutbound()
             {
-                bool result = false;
+                std::map<uint32_t, Outbound> aborted;
 
                 _lock.Lock();
 
-                if (_outbound.IsValid() == true) {
+                aborted.swap(_outbound);
 
-                    result = true;
+                _lock.Unlock();
 
-                    if (_callback != nullptr) {
-                        _callback->Dispatch(*_outbound);
-                        _callback = nullptr;
-                    }
+                for (std::pair<const uint32_t, Outbound>& entry : aborted) {
+                    entry.second.second->Dispatch(*(entry.second.first));
+                }
+
+                return (aborted.empty() == false);
+            }
+
+        private:
+            inline ProxyType<IPCSharedMemory> Shared() const
+            {
+                _lock.Lock();
+
+                ProxyType<IPCSharedMemory> result(_shared);
+
+                _lock.Unlock();
+
+                return (result);
+            }
+            inline ProxyType<IMessage> Response(const uint32_t label, const uint32_t id)
+            {
+                ProxyType<IMessage> result;
+
+                _lock.Lock();
+
+                std::map<uint32_t, Outbound>::iterator index(_outbound.find(id));
 
-                    _outbound.Release();
+                if ((index != _outbound.end()) && (index->second.first->Label() == (label >> 1))) {
+                    result = index->second.first->IResponse();
                 } else {
-                    ASSERT(_callback == nullptr);
+                    TRACE_L1("Unexpected response message for ID [%d].\n", (label >> 1));
                 }
 
                 _lock.Unlock();
@@ -710,11 +1109,13 @@ namespace Core {
 
         private:
             mutable CriticalSection _lock;
-            Core::ProxyType<IIPC> _inbound;
-            mutable Core::ProxyType<IIPC> _outbound;
-            IDispatchType<IIPC>* _callback;
+            uint32_t _sequence;
+            std::map<const IIPC*, uint32_t> _inbound;
+            std::map<uint32_t, Outbound> _outbound;
             Core::ProxyType<FactoryType<IIPC, uint32_t>> _factory;
             std::map<uint32_t, ProxyType<IIPCServer>> _handlers;
+            ProxyType<IPCSharedMemory> _shared;
+            uint32_t _threshold;
         };
 
     protected:
@@ -749,6 +1150,10 @@ namespace Core {
         {
             _administration.AbortOutbound();
         }
+        inline void Shared(const ProxyType<IPCSharedMemory>& memory, const uint32_t threshold)
+        {
+            _administration.Shared(memory, threshold);
+        }
         template <typename ACTUALELEMENT>
         inline uint32_t Invoke(ProxyType<ACTUALELEMENT>& command, IDispatchType<IIPC>* completed)
         {
@@ -846,7 +1251,9 @@ namespace Core {
                 ASSERT(inbound.IsValid() == true);
 
                 // This is an inbound call, Report what we have processed !!!
-                return (BaseClass::Submit(inbound->IResponse()));
+                Core::ProxyType<IMessage> response(_factory.Response(inbound));
+
+                return ((response.IsValid() == true) && (BaseClass::Submit(response)));
             }
 
             // Notification of a INBOUND element received.
@@ -901,17 +1308,18 @@ namespace Core {
             }
 
         public:
-            uint32_t Wait(const uint32_t waitTime)
+            uint32_t Wait(const uint32_t id, const uint32_t waitTime)
             {
                 uint32_t result = Core::ERROR_NONE;
 
                 // Now we wait for ever, to get a signal that we are done :-)
                 if (_signal.Lock(waitTime) != Core::ERROR_NONE) {
-                    _administration.AbortOutbound();
-
-                    result = Core::ERROR_TIMEDOUT;
-                } else if (_administration.AbortOutbound() == true) {
-                    result = Core::ERROR_ASYNC_FAILED;
+                    if (_administration.AbortOutbound(id) == true) {
+                        result = Core::ERROR_TIMEDOUT;
+                    } else {
+                        // The response came in just now, it is being reported to us, wait for it.
+                        _signal.Lock(Core::infinite);
+                    }
                 }
 
                 return (result);
@@ -1060,50 +1468,35 @@ namespace Core {
         {
         }
 
+        // Calls are tagged with an id, so any number of them can be in flight on the channel, from
+        // any thread. The responses are matched on that id, in whatever order they come back.
         virtual uint32_t Execute(ProxyType<IIPC>& command, IDispatchType<IIPC>* completed)
         {
             uint32_t success = Core::ERROR_UNAVAILABLE;
 
-            _serialize.Lock();
-
-            if (_administration.InProgress() == true) {
-                success = Core::ERROR_INPROGRESS;
-            } else if (_link.IsOpen() == true) {
-                // We need to accept a CONST object to avoid an additional object creation
-                // proxy casted objects.
-                _administration.SetOutbound(command, completed);
+            if (_link.IsOpen() == true) {
+                uint32_t id;
 
-                // Send out the
-                _link.Submit(command->IParameters());
+                _link.Submit(_administration.Request(command, completed, id));
 
                 success = Core::ERROR_NONE;
             }
 
-            _serialize.Unlock();
-
             return (success);
         }
         virtual uint32_t Execute(ProxyType<IIPC>& command, const uint32_t waitTime)
         {
             uint32_t success = Core::ERROR_CONNECTION_CLOSED;
 
-            _serialize.Lock();
-
             if (_link.IsOpen() == true) {
                 IPCTrigger sink(_administration);
+                uint32_t id;
 
-                // We need to accept a CONST object to avoid an additional object creation
-                // proxy casted objects.
-                _administration.SetOutbound(command, &sink);
-
-                // Send out the
-                _link.Submit(command->IParameters());
+                _link.Submit(_administration.Request(command, &sink, id));
 
-                success = sink.Wait(waitTime);
+                success = sink.Wait(id, waitTime);
             }
 
-            _serialize.Unlock();
-
             return (success);
         }
         inline void CallProcedure(ProxyType<IIPCServer>& procedure, ProxyType<IIPC>& message)
@@ -1112,7 +1505,6 @@ namespace Core {
         }
 
     private:
-        CriticalSection _serialize;
         IPCLink _link;
         EXTENSION _extension;
     };
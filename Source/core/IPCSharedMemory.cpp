@@ -0,0 +1,127 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IPCSharedMemory.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    static uint32_t RingSize(const uint32_t requested)
+    {
+        uint32_t result = 64;
+
+        while ((result < requested) && (result < 0x40000000)) {
+            result <<= 1;
+        }
+
+        return (result);
+    }
+
+    IPCSharedMemory::IPCSharedMemory(const string& fileName, const uint32_t mode, const uint32_t ringSize)
+        : _creator(true)
+        , _buffer(fileName, mode | File::SHAREABLE | File::CREATE, sizeof(control) + (2 * RingSize(ringSize)))
+        , _administration(nullptr)
+        , _size(RingSize(ringSize))
+        , _head(0)
+        , _producer(nullptr)
+        , _consumer(nullptr)
+        , _outbound(nullptr)
+        , _inbound(nullptr)
+    {
+        if (_buffer.IsValid() == true) {
+            _administration = reinterpret_cast<control*>(_buffer.Buffer());
+            _administration->_size = _size;
+            std::atomic_init(&(_administration->_rings[0]._tail), static_cast<uint32_t>(0));
+            std::atomic_init(&(_administration->_rings[1]._tail), static_cast<uint32_t>(0));
+
+            _producer = &(_administration->_rings[0]);
+            _consumer = &(_administration->_rings[1]);
+            _outbound = &(_buffer.Buffer()[sizeof(control)]);
+            _inbound = &(_buffer.Buffer()[sizeof(control) + _size]);
+        }
+    }
+
+    IPCSharedMemory::IPCSharedMemory(const string& fileName)
+        : _creator(false)
+        , _buffer(fileName, File::USER_READ | File::USER_WRITE | File::SHAREABLE, 0)
+        , _administration(nullptr)
+        , _size(0)
+        , _head(0)
+        , _producer(nullptr)
+        , _consumer(nullptr)
+        , _outbound(nullptr)
+        , _inbound(nullptr)
+    {
+        if ((_buffer.IsValid() == true) && (_buffer.Size() >= sizeof(control))) {
+            const uint32_t size = reinterpret_cast<const control*>(_buffer.Buffer())->_size;
+
+            // Do not trust what we find, the rings must be what the creator would have made.
+            if ((size == RingSize(size)) && ((sizeof(control) + (2 * static_cast<uint64_t>(size))) <= _buffer.Size())) {
+                _administration = reinterpret_cast<control*>(_buffer.Buffer());
+                _size = size;
+                _head = _administration->_rings[1]._tail.load(std::memory_order_acquire);
+
+                _producer = &(_administration->_rings[1]);
+                _consumer = &(_administration->_rings[0]);
+                _outbound = &(_buffer.Buffer()[sizeof(control) + _size]);
+                _inbound = &(_buffer.Buffer()[sizeof(control)]);
+            } else {
+                TRACE_L1("Shared memory [%s] is not set up for IPC.", fileName.c_str());
+            }
+        }
+    }
+
+    IPCSharedMemory::~IPCSharedMemory()
+    {
+        // The other side keeps its mapping, the name is not needed anymore.
+        if (_creator == true) {
+            File(_buffer.Name()).Destroy();
+        }
+    }
+
+    bool IPCSharedMemory::Reserve(const uint32_t length, uint32_t& offset)
+    {
+        bool result = false;
+
+        if ((_administration != nullptr) && (length != 0) && (length <= _size)) {
+            const uint32_t tail = _producer->_tail.load(std::memory_order_acquire);
+            const uint32_t position = (_head & (_size - 1));
+
+            // A block is never split, if it does not fit in before the end, it starts at the beginning.
+            const uint32_t skip = (length > (_size - position) ? (_size - position) : 0);
+
+            if (((_head - tail) + skip + length) <= _size) {
+                offset = _head + skip;
+                _head = offset + length;
+                result = true;
+            }
+        }
+
+        return (result);
+    }
+
+    void IPCSharedMemory::Release(const uint32_t offset, const uint32_t length)
+    {
+        ASSERT(IsValid() == true);
+
+        // Everything before this block was handed over before, the producer can reuse it all.
+        _consumer->_tail.store(offset + length, std::memory_order_release);
+    }
+}
+} // Core
@@ -0,0 +1,117 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __IPCSHAREDMEMORY_H
+#define __IPCSHAREDMEMORY_H
+
+// ---- Include system wide include files ----
+#include <atomic>
+
+// ---- Include local include files ----
+#include "DataElementFile.h"
+#include "Module.h"
+
+// ---- Referenced classes and types ----
+
+// ---- Helper types and constants ----
+
+namespace WPEFramework {
+
+namespace Core {
+    // Rationale:
+    // The memory shared by the two ends of an IPCChannel, to carry the larger payloads without copying
+    // them through the socket. It holds a ring per direction, each with a single producer (the side
+    // that serializes into it) and a single consumer (the other side). The channel still sends a frame
+    // for every message, saying where the payload is, so it also wakes up the other side and keeps
+    // the order of the messages. Nothing here blocks: if there is no room, the payload goes inline.
+    class EXTERNAL IPCSharedMemory {
+    private:
+        IPCSharedMemory() = delete;
+        IPCSharedMemory(const IPCSharedMemory&) = delete;
+        IPCSharedMemory& operator=(const IPCSharedMemory&) = delete;
+
+        // Positions run freely and wrap with the 32 bits, the ring size is a power of 2. Only the
+        // tail is shared, the head is known to the producer and handed out with every block.
+        struct ring {
+            std::atomic<uint32_t> _tail;
+            uint32_t _padding[15];
+        };
+        struct control {
+            uint32_t _size;
+            uint32_t _padding[15];
+            ring _rings[2];
+        };
+
+    public:
+        // Creates the file, with rings of at least the given size. The creator produces in the first ring.
+        IPCSharedMemory(const string& fileName, const uint32_t mode, const uint32_t ringSize);
+        // Opens the file created by the other side, and produces in the second ring.
+        IPCSharedMemory(const string& fileName);
+        ~IPCSharedMemory();
+
+    public:
+        inline bool IsValid() const
+        {
+            return (_administration != nullptr);
+        }
+        inline const string& Name() const
+        {
+            return (_buffer.Name());
+        }
+        inline uint32_t Size() const
+        {
+            return (_size);
+        }
+
+        // Producer side. Claims a contiguous block of length bytes, returns false if there is no room.
+        bool Reserve(const uint32_t length, uint32_t& offset);
+        inline uint8_t* Outbound(const uint32_t offset)
+        {
+            ASSERT(IsValid() == true);
+
+            return (&(_outbound[offset & (_size - 1)]));
+        }
+
+        // Consumer side. Returns nullptr if the block is not within the ring.
+        inline const uint8_t* Inbound(const uint32_t offset, const uint32_t length) const
+        {
+            ASSERT(IsValid() == true);
+
+            const uint32_t position = (offset & (_size - 1));
+
+            return ((length <= (_size - position)) ? &(_inbound[position]) : nullptr);
+        }
+        // Hands everything up to and including this block back to the producer.
+        void Release(const uint32_t offset, const uint32_t length);
+
+    private:
+        bool _creator;
+        DataElementFile _buffer;
+        control* _administration;
+        uint32_t _size;
+        uint32_t _head;
+        ring* _producer;
+        ring* _consumer;
+        uint8_t* _outbound;
+        const uint8_t* _inbound;
+    };
+}
+} // Core
+
+#endif // __IPCSHAREDMEMORY_H
@@ -92,22 +92,37 @@ namespace Core {
             template <typename INSTANCEOBJECT>
             static bool ToString(const INSTANCEOBJECT& realObject, string& text)
             {
-                char buffer[1024];
-                uint16_t loaded;
-                uint16_t offset = 0;
+                static constexpr uint32_t Chunk = 1024;
 
+                uint32_t chunk = Chunk;
+                uint32_t loaded;
+                uint32_t offset = 0;
+                bool full;
+                size_t length = 0;
+
+                // Serialize straight into the text. It keeps its capacity between calls, so
+                // re-serializing into the same string does not allocate at all, and otherwise
+                // it grows geometrically in stead of through a temporary per chunk.
                 text.clear();
 
                 // Serialize object
                 do {
-                    loaded = static_cast<const IElement&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                    text.resize(length + chunk);
 
-                    ASSERT(loaded <= sizeof(buffer));
-                    DEBUG_VARIABLE(loaded);
+                    loaded = static_cast<const IElement&>(realObject).Serialize(&(text[length]), chunk, offset);
 
-                    text += string(buffer, loaded);
+                    ASSERT(loaded <= chunk);
 
-                } while ((offset != 0) && (loaded == sizeof(buffer)));
+                    length += loaded;
+                    full = (loaded == chunk);
+
+                    // Large documents take chunks the size of what we have so far, so it
+                    // only takes a handful of resumes to get them out.
+                    chunk = static_cast<uint32_t>(std::max(length, static_cast<size_t>(Chunk)));
+
+                } while ((offset != 0) && (full == true));
+
+                text.resize(length);
 
                 return (offset == 0);
             }
@@ -122,13 +137,13 @@ namespace Core {
             template <typename INSTANCEOBJECT>
             static bool FromString(const string& text, INSTANCEOBJECT& realObject, Core::OptionalType<Error>& error)
             {
-                uint16_t offset = 0;
+                uint32_t offset = 0;
 
                 realObject.Clear();
 
                 if (text.empty() == false) {
                     // Deserialize object
-                    uint16_t loaded = static_cast<IElement&>(realObject).Deserialize(text.c_str(), static_cast<uint16_t>(text.length() + 1), offset, error);
+                    uint32_t loaded = static_cast<IElement&>(realObject).Deserialize(text.c_str(), static_cast<uint32_t>(text.length() + 1), offset, error);
 
                     ASSERT(loaded <= (text.length() + 1));
                     DEBUG_VARIABLE(loaded);
@@ -170,8 +185,8 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     char buffer[1024];
-                    uint16_t loaded;
-                    uint16_t offset = 0;
+                    uint32_t loaded;
+                    uint32_t offset = 0;
 
                     // Serialize object
                     do {
@@ -200,15 +215,15 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     char buffer[1024];
-                    uint16_t readBytes;
-                    uint16_t loaded;
-                    uint16_t offset = 0;
+                    uint32_t readBytes;
+                    uint32_t loaded;
+                    uint32_t offset = 0;
 
                     realObject.Clear();
 
                     // Serialize object
                     do {
-                        readBytes = static_cast<uint16_t>(fileObject.Read(reinterpret_cast<uint8_t*>(buffer), sizeof(buffer)));
+                        readBytes = static_cast<uint32_t>(fileObject.Read(reinterpret_cast<uint8_t*>(buffer), sizeof(buffer)));
 
                         if (readBytes == 0) {
                             loaded = ~0;
@@ -258,11 +273,11 @@ namespace Core {
             virtual void Clear() = 0;
             virtual bool IsSet() const = 0;
             virtual bool IsNull() const = 0;
-            virtual uint16_t Serialize(char Stream[], const uint16_t MaxLength, uint16_t& offset) const = 0;
-            uint16_t Deserialize(const char Stream[], const uint16_t MaxLength, uint16_t& offset)
+            virtual uint32_t Serialize(char Stream[], const uint32_t MaxLength, uint32_t& offset) const = 0;
+            uint32_t Deserialize(const char Stream[], const uint32_t MaxLength, uint32_t& offset)
             {
                 Core::OptionalType<Error> error;
-                uint16_t loaded = Deserialize(Stream, MaxLength, offset, error);
+                uint32_t loaded = Deserialize(Stream, MaxLength, offset, error);
 
                 if (error.IsSet() == true) {
                     Clear();
@@ -272,7 +287,7 @@ namespace Core {
 
                 return loaded;
             }
-            virtual uint16_t Deserialize(const char Stream[], const uint16_t MaxLength, uint16_t& offset, Core::OptionalType<Error>& error) = 0;
+            virtual uint32_t Deserialize(const char Stream[], const uint32_t MaxLength, uint32_t& offset, Core::OptionalType<Error>& error) = 0;
         };
 
         struct EXTERNAL IMessagePack {
@@ -426,7 +441,7 @@ namespace Core {
             VALID
         };
 
-        static ValueValidity IsNullValue(const char stream[], const uint16_t maxLength, uint16_t& offset, uint16_t& loaded)
+        static ValueValidity IsNullValue(const char stream[], const uint32_t maxLength, uint32_t& offset, uint32_t& loaded)
         {
             ValueValidity validity = ValueValidity::INVALID;
             const size_t nullTagLen = strlen(IElement::NullTag);
@@ -547,9 +562,9 @@ namespace Core {
         private:
             // IElement iface:
             // If this should be serialized/deserialized, it is indicated by a MinSize > 0)
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 ASSERT(maxLength > 0);
 
@@ -610,9 +625,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     // We are starting, see what the current char is
@@ -751,7 +766,7 @@ namespace Core {
 
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
             {
-                uint8_t loaded = 0;
+                uint16_t loaded = 0;
                 if (offset == 0) {
                     // First byte depicts a lot. Find out what we need to read
                     _value = 0;
@@ -759,38 +774,43 @@ namespace Core {
 
                     if (header == IMessagePack::NullValue) {
                         _set = UNDEFINED;
+                    } else if ((header & 0x80) == 0) {
+                        // Positive fixint
+                        _value = static_cast<TYPE>(header);
+                        _set = SET;
+                    } else if ((header & 0xE0) == 0xE0) {
+                        // Negative fixint
+                        _value = static_cast<TYPE>(static_cast<int8_t>(header));
+                        _set = SET;
                     } else if ((header >= 0xCC) && (header <= 0xCF)) {
                         _set = (1 << (header - 0xCC)) << 12;
                         offset = 1;
                     } else if ((header >= 0xD0) && (header <= 0xD3)) {
-                        _set = (1 << (header - 0xD0)) << 12;
+                        _set = ((1 << (header - 0xD0)) << 12) | NEGATIVE;
                         offset = 1;
-                    } else if ((header & 0x80) == 0) {
-                        _value = (header & 0x7F);
-                    } else if ((header & 0xE0) == 0xE0) {
-                        _value = (header & 0x0F);
-                        _set = NEGATIVE;
                     } else {
                         _set = ERROR;
                     }
                 }
 
                 while ((loaded < maxLength) && (offset != 0)) {
-                    _value = _value << 8;
-                    _value += stream[loaded++];
+                    // The signed formats are two's complement, extend the sign of the first byte.
+                    uint64_t value = (((offset == 1) && ((_set & NEGATIVE) != 0) && ((stream[loaded] & 0x80) != 0)) ? ~static_cast<uint64_t>(0) : static_cast<uint64_t>(_value));
+                    _value = static_cast<TYPE>((value << 8) | stream[loaded++]);
                     offset = (offset == ((_set >> 12) & 0xF) ? 0 : offset + 1);
-                }
 
-                if (_value != 0) {
-                    _set |= SET;
+                    if (offset == 0) {
+                        _set = SET;
+                    }
                 }
+
                 return (loaded);
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint16_t& offset, const TYPE serialize) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TYPE serialize) const
             {
                 uint8_t parsed = 4;
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 TYPE divider = 1;
                 TYPE value = (serialize / BASETYPE);
 
@@ -822,92 +842,49 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
                 return (Convert(stream, maxLength, offset, _value));
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
             {
                 return (Convert(stream, maxLength, offset, ::abs(_value)));
             }
 
             uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
-                uint8_t loaded = 0;
-                uint8_t bytes = (_value <= 0x7F ? 0 : _value < 0xFF ? 1 : _value < 0xFFFF ? 2 : _value < 0xFFFFFFFF ? 4 : 8);
+                const uint64_t value = static_cast<uint64_t>(_value);
 
-                if (offset == 0) {
-                    if (bytes == 0) {
-                        if (_value != 0) {
-                            stream[loaded++] = static_cast<uint8_t>(_value);
-                        } else {
-                            stream[loaded++] = IMessagePack::NullValue;
-                        }
-                    } else {
-                        switch (bytes) {
-                        case 1:
-                            stream[loaded++] = 0xCC;
-                            break;
-                        case 2:
-                            stream[loaded++] = 0xCD;
-                            break;
-                        case 4:
-                            stream[loaded++] = 0xCE;
-                            break;
-                        case 8:
-                            stream[loaded++] = 0xCF;
-                            break;
-                        default:
-                            ASSERT(false);
-                        }
-                        offset = 1;
-                    }
-                }
-
-                while ((loaded < maxLength) && (offset != 0)) {
-                    TYPE value = _value >> (8 * (bytes - offset));
-
-                    stream[loaded++] = static_cast<uint8_t>(value & 0xFF);
-                    offset = (offset == bytes ? 0 : offset + 1);
-                }
-
-                return (loaded);
+                return (value <= 0x7F ? Convert(stream, maxLength, offset, static_cast<uint8_t>(value), 0) :
+                        value <= 0xFF ? Convert(stream, maxLength, offset, 0xCC, 1) :
+                        value <= 0xFFFF ? Convert(stream, maxLength, offset, 0xCD, 2) :
+                        value <= 0xFFFFFFFF ? Convert(stream, maxLength, offset, 0xCE, 4) :
+                                              Convert(stream, maxLength, offset, 0xCF, 8));
             }
 
             uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint16_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
             {
-                uint8_t loaded = 0;
-                uint8_t bytes = (((_value < 16) && (_value > -15)) ? 0 : ((_value < 128) && (_value > -127)) ? 1 : ((_value < 32767) && (_value > -32766)) ? 2 : ((_value < 2147483647) && (_value > -2147483646)) ? 4 : 8);
+                // Positive values use the unsigned formats, like any other MessagePack encoder does.
+                return (_value >= 0 ? Convert(stream, maxLength, offset, TemplateIntToType<false>()) :
+                        _value >= -32 ? Convert(stream, maxLength, offset, static_cast<uint8_t>(_value), 0) :
+                        _value >= -128 ? Convert(stream, maxLength, offset, 0xD0, 1) :
+                        _value >= -32768 ? Convert(stream, maxLength, offset, 0xD1, 2) :
+                        _value >= -2147483647 - 1 ? Convert(stream, maxLength, offset, 0xD2, 4) :
+                                                    Convert(stream, maxLength, offset, 0xD3, 8));
+            }
+
+            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint16_t& offset, const uint8_t header, const uint8_t bytes) const
+            {
+                uint16_t loaded = 0;
 
                 if (offset == 0) {
-                    if (bytes == 0) {
-                        stream[loaded++] = (_value & 0x1F) | 0xE0;
-                    } else {
-                        switch (bytes) {
-                        case 1:
-                            stream[loaded++] = 0xD0;
-                            break;
-                        case 2:
-                            stream[loaded++] = 0xD1;
-                            break;
-                        case 4:
-                            stream[loaded++] = 0xD2;
-                            break;
-                        case 8:
-                            stream[loaded++] = 0xD3;
-                            break;
-                        default:
-                            ASSERT(false);
-                        }
-                        offset = 1;
-                    }
+                    stream[loaded++] = header;
+                    offset = (bytes != 0 ? 1 : 0);
                 }
 
                 while ((loaded < maxLength) && (offset != 0)) {
-                    TYPE value = _value >> (8 * (bytes - offset));
-
-                    stream[loaded++] = static_cast<uint8_t>(value & 0xFF);
+                    stream[loaded++] = static_cast<uint8_t>((static_cast<uint64_t>(_value) >> (8 * (bytes - offset))) & 0xFF);
                     offset = (offset == bytes ? 0 : offset + 1);
                 }
 
@@ -1041,9 +1018,9 @@ namespace Core {
         private:
             // IElement iface:
             // If this should be serialized/deserialized, it is indicated by a MinSize > 0)
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 ASSERT(maxLength > 0);
 
@@ -1067,9 +1044,9 @@ namespace Core {
                 return loaded;
             }
             
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _value = 0;
@@ -1295,12 +1272,12 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 static constexpr char trueBuffer[] = "true";
                 static constexpr char falseBuffer[] = "false";
 
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if ((_value & NullBit) != 0) {
                     while ((loaded < maxLength) && (offset < 4)) {
                         stream[loaded++] = NullTag[offset++];
@@ -1326,9 +1303,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 static constexpr char trueBuffer[] = "true";
                 static constexpr char falseBuffer[] = "false";
 
@@ -1478,7 +1455,7 @@ namespace Core {
 
             String& operator=(const string& RHS)
             {
-                Core::ToString(RHS.c_str(), _value);
+                _value = Core::ToString(RHS);
                 _scopeCount |= SetBit;
 
                 return (*this);
@@ -1568,9 +1545,9 @@ namespace Core {
             inline const string Value() const
             {
                 if ((_scopeCount & (SetBit | QuoteFoundBit | QuotedSerializeBit)) == (SetBit | QuoteFoundBit)) {
-                    return ('\"' + Core::ToString(_value.c_str()) + '\"');
+                    return ('\"' + Text(_value) + '\"');
                 }
-                return (((_scopeCount & (SetBit | NullBit)) == SetBit) ? Core::ToString(_value.c_str()) : Core::ToString(_default.c_str()));
+                return (((_scopeCount & (SetBit | NullBit)) == SetBit) ? Text(_value) : Text(_default));
             }
 
             inline const string& Default() const
@@ -1623,16 +1600,16 @@ namespace Core {
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 bool quoted = IsQuoted();
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 ASSERT(maxLength > 0);
 
                 if ((quoted == false) || ((_scopeCount & NullBit) != 0)) {
                     std::string source((_value.empty() || (_scopeCount & NullBit)) ? NullTag : _value);
-                    result = static_cast<uint16_t>(source.copy(stream, maxLength - result, offset));
+                    result = static_cast<uint32_t>(source.copy(stream, maxLength - result, offset));
                     offset = (result < maxLength ? 0 : offset + result);
                 } else {
                     if (offset == 0) {
@@ -1642,7 +1619,7 @@ namespace Core {
                         _unaccountedCount = 0;
                     }
 
-                    uint16_t length = static_cast<uint16_t>(_value.length()) - (offset - 1);
+                    uint32_t length = static_cast<uint32_t>(_value.length()) - (offset - 1);
                     if (length > 0) {
                         const TCHAR* source = &(_value[offset - 1]);
                         offset += length;
@@ -1682,10 +1659,10 @@ namespace Core {
                 return (result);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
                 bool finished = false;
-                uint16_t result = 0;
+                uint32_t result = 0;
                 ASSERT(maxLength > 0);
 
                 if (offset == 0) {
@@ -1793,7 +1770,7 @@ namespace Core {
                 }
 
                 if (finished == false) {
-                    offset = static_cast<uint16_t>(_value.length()) + _unaccountedCount;
+                    offset = static_cast<uint32_t>(_value.length()) + _unaccountedCount;
                 } else {
                     offset = 0;
                     _scopeCount |= ((_scopeCount & QuoteFoundBit) ? SetBit : (_value == NullTag ? NullBit : SetBit));
@@ -1897,6 +1874,15 @@ namespace Core {
             }
 
         private:
+            // Keeps the full length, the value may hold binary (e.g. MessagePack) data.
+            static string Text(const std::string& value)
+            {
+#ifdef _UNICODE
+                return (Core::ToString(value.c_str()));
+#else
+                return (value);
+#endif
+            }
             bool IsValidEscapeSequence(char current) const
             {
                 ASSERT(MatchLastCharacter(_value, '\\') == true);
@@ -2024,13 +2010,13 @@ namespace Core {
 
         protected:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 static const TCHAR base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                                                     "abcdefghijklmnopqrstuvwxyz"
                                                     "0123456789+/";
 
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _state = 0;
@@ -2084,9 +2070,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _state = 0xFF;
@@ -2270,9 +2256,9 @@ namespace Core {
         private:
             mutable uint8_t _state;
             mutable uint8_t _lastStuff;
-            mutable uint16_t _index;
-            uint16_t _length;
-            uint16_t _maxLength;
+            mutable uint32_t _index;
+            uint32_t _length;
+            uint32_t _maxLength;
             uint8_t* _buffer;
         };
 
@@ -2371,7 +2357,7 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 if (offset == 0) {
                     if ((_state & UNDEFINED) != 0) {
@@ -2383,9 +2369,9 @@ namespace Core {
                 return (static_cast<const IElement&>(_parser).Serialize(stream, maxLength, offset));
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t result = static_cast<IElement&>(_parser).Deserialize(stream, maxLength, offset, error);
+                uint32_t result = static_cast<IElement&>(_parser).Deserialize(stream, maxLength, offset, error);
 
                 if (offset == 0) {
 
@@ -2809,9 +2795,9 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == FIND_MARKER) {
                     _iterator.Reset();
@@ -2820,7 +2806,7 @@ namespace Core {
                 } else if (offset == END_MARKER) {
                     offset = ~0;
                 }
-                while ((loaded < maxLength) && (offset != static_cast<uint16_t>(~0))) {
+                while ((loaded < maxLength) && (offset != static_cast<uint32_t>(~0))) {
                     if (offset >= PARSE) {
                         offset -= PARSE;
                         loaded += static_cast<const IElement&>(_iterator.Current()).Serialize(&(stream[loaded]), maxLength - loaded, offset);
@@ -2830,7 +2816,7 @@ namespace Core {
                         offset = PARSE;
                     }
                 }
-                if (offset == static_cast<uint16_t>(~0)) {
+                if (offset == static_cast<uint32_t>(~0)) {
                     if (loaded < maxLength) {
                         stream[loaded++] = ']';
                         offset = FIND_MARKER;
@@ -2842,9 +2828,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
                     while ((loaded < maxLength) && ::isspace(stream[loaded])) {
@@ -2969,40 +2955,40 @@ namespace Core {
                 uint16_t loaded = 0;
 
                 if (offset == 0) {
-                    if (stream[0] == IMessagePack::NullValue) {
+                    const uint8_t header = stream[loaded++];
+
+                    if (header == IMessagePack::NullValue) {
                         _state = UNDEFINED;
-                        loaded = 1;
-                    } else if ((stream[0] & 0xF0) == 0x90) {
-                        _count = (stream[0] & 0x0F);
-                        offset = PARSE;
-                    } else if (stream[0] & 0xDC) {
+                    } else if ((header & 0xF0) == 0x90) {
+                        _count = (header & 0x0F);
+                        offset = (_count > 0 ? PARSE : 0);
+                    } else if (header == 0xDC) {
+                        _count = 0;
                         offset = 1;
                     }
                 }
 
                 while ((loaded < maxLength) && (offset > 0) && (offset < PARSE)) {
                     if (offset == 1) {
-                        _count = (_count << 8) | stream[loaded++];
+                        _count = stream[loaded++];
                         offset = 2;
                     } else if (offset == 2) {
                         _count = (_count << 8) | stream[loaded++];
-                        offset = PARSE;
+                        offset = (_count > 0 ? PARSE : 0);
                     }
                 }
 
                 while ((loaded < maxLength) && (offset >= PARSE)) {
-
+                    // Right on PARSE, the next element is about to start.
                     if (offset == PARSE) {
-                        if (_count > 0) {
-                            _count--;
-                            _data.emplace_back(ELEMENT());
-                        } else {
-                            offset = 0;
-                        }
+                        _count--;
+                        _data.emplace_back(ELEMENT());
                     }
-                    if (offset >= PARSE) {
-                        offset -= PARSE;
-                        loaded += static_cast<IMessagePack&>(_data.back()).Deserialize(stream, maxLength, offset);
+
+                    offset -= PARSE;
+                    loaded += static_cast<IMessagePack&>(_data.back()).Deserialize(&(stream[loaded]), maxLength - loaded, offset);
+
+                    if ((offset != 0) || (_count != 0)) {
                         offset += PARSE;
                     }
                 }
@@ -3181,9 +3167,9 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint16_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == FIND_MARKER) {
                     _iterator = _data.begin();
@@ -3199,7 +3185,7 @@ namespace Core {
                     offset = ~0;
                 }
 
-                while ((loaded < maxLength) && (offset != static_cast<uint16_t>(~0))) {
+                while ((loaded < maxLength) && (offset != static_cast<uint32_t>(~0))) {
                     if (offset >= PARSE) {
                         offset -= PARSE;
                         loaded += _current.json->Serialize(&(stream[loaded]), maxLength - loaded, offset);
@@ -3221,7 +3207,7 @@ namespace Core {
                         }
                     }
                 }
-                if (offset == static_cast<uint16_t>(~0)) {
+                if (offset == static_cast<uint32_t>(~0)) {
                     if (loaded < maxLength) {
                         stream[loaded++] = '}';
                         offset = FIND_MARKER;
@@ -3234,9 +3220,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
                     while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
@@ -3357,7 +3343,7 @@ namespace Core {
 
                     if (offset >= PARSE) {
                         offset = (offset - PARSE);
-                        uint16_t skip = SKIP_AFTER;
+                        uint32_t skip = SKIP_AFTER;
                         if (_current.json == nullptr) {
                             loaded += static_cast<IElement&>(_fieldName).Deserialize(&(stream[loaded]), maxLength - loaded, offset, error);
                             if (_fieldName.IsQuoted() == false) {
@@ -3459,10 +3445,11 @@ namespace Core {
                 if (offset == 0) {
                     if (stream[0] == IMessagePack::NullValue) {
                         _state = UNDEFINED;
-                    } else if ((stream[0] & 0x80) == 0x80) {
+                    } else if ((stream[0] & 0xF0) == 0x80) {
                         _count = (stream[0] & 0x0F);
                         offset = (_count > 0 ? PARSE : 0);
-                    } else if (stream[0] & 0xDE) {
+                    } else if (stream[0] == 0xDE) {
+                        _count = 0;
                         offset = 1;
                     }
                     loaded = 1;
@@ -3788,17 +3775,17 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error) override;
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override;
 
-            static uint16_t FindEndOfScope(const char stream[], uint16_t maxLength)
+            static uint32_t FindEndOfScope(const char stream[], uint32_t maxLength)
             {
                 ASSERT(maxLength > 0 && (stream[0] == '{' || stream[0] == '['));
                 char charOpen = stream[0];
                 char charClose = charOpen == '{' ? '}' : ']';
-                uint16_t stack = 1;
-                uint16_t endIndex = 0;
+                uint32_t stack = 1;
+                uint32_t endIndex = 0;
                 bool insideQuotes = false;
-                for (uint16_t i = 1; i < maxLength; ++i) {
+                for (uint32_t i = 1; i < maxLength; ++i) {
                     if ((stream[i] == '\"') && (stream[i - 1] != '\\')) {
                         insideQuotes = !insideQuotes;
                     }
@@ -4122,11 +4109,11 @@ namespace Core {
             return (result);
         }
 
-        inline uint16_t Variant::Deserialize(const char stream[], const uint16_t maxLength, uint16_t& offset, Core::OptionalType<Error>& error)
+        inline uint32_t Variant::Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error)
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
             if (stream[0] == '{' || stream[0] == '[') {
-                uint16_t endIndex = FindEndOfScope(stream, maxLength);
+                uint32_t endIndex = FindEndOfScope(stream, maxLength);
                 if (endIndex > 0 && endIndex < maxLength) {
                     result = endIndex + 1;
                     SetQuoted(false);
@@ -4181,15 +4168,15 @@ namespace Core {
 
             bool FromString(const string& value, Core::ProxyType<INSTANCEOBJECT>& receptor)
             {
-                uint16_t fillCount = 0;
-                uint16_t offset = 0;
-                uint16_t size, loaded;
+                uint32_t fillCount = 0;
+                uint32_t offset = 0;
+                uint32_t size, loaded;
 
                 receptor->Clear();
                 Core::OptionalType<Error> error;
 
                 do {
-                    size = static_cast<uint16_t>((value.size() - fillCount) < SIZE ? (value.size() - fillCount) : SIZE);
+                    size = static_cast<uint32_t>((value.size() - fillCount) < SIZE ? (value.size() - fillCount) : SIZE);
 
                     // Prepare the deserialize buffer
                     memcpy(_buffer, &(value.data()[fillCount]), size);
@@ -4207,8 +4194,8 @@ namespace Core {
 
             bool ToString(const Core::ProxyType<INSTANCEOBJECT>& receptor, string& value)
             {
-                uint16_t offset = 0;
-                uint16_t loaded;
+                uint32_t offset = 0;
+                uint32_t loaded;
 
                 // Serialize object
                 do {
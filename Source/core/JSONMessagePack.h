@@ -0,0 +1,626 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __JSONMESSAGEPACK_H
+#define __JSONMESSAGEPACK_H
+
+#include "JSON.h"
+#include "JSONReader.h"
+#include "Module.h"
+#include "Serialization.h"
+
+namespace WPEFramework {
+namespace Core {
+    namespace JSON {
+
+        // -------------------------------------------------------------------
+        // Converts a complete JSON text into the equivalent MessagePack value
+        // and back. Used where a JSON text is carried opaque (e.g. the params
+        // and result of a JSON-RPC message) and has to cross a MessagePack
+        // link without building an element tree for it. The packed value is
+        // kept in a string, like the opaque JSON::String does.
+        // Integers map onto the smallest (u)int format, other numbers onto a
+        // float 64. On the way back, bin values become base64 strings and
+        // ext values are not supported.
+        // -------------------------------------------------------------------
+        class EXTERNAL MessagePack {
+        private:
+            static constexpr uint8_t MaxDepth = 64;
+
+            class Encoder : public Reader::IHandler {
+            private:
+                struct Scope {
+                    uint32_t Position;
+                    uint32_t Count;
+                    bool Array;
+                };
+
+            public:
+                Encoder() = delete;
+                Encoder(const Encoder&) = delete;
+                Encoder& operator=(const Encoder&) = delete;
+
+                Encoder(string& packed)
+                    : _packed(packed)
+                    , _scopes()
+                {
+                }
+                ~Encoder() override = default;
+
+            public:
+                bool BeginObject() override
+                {
+                    return (Begin(false));
+                }
+                bool EndObject() override
+                {
+                    return (End(0x80, 0xDE));
+                }
+                bool BeginArray() override
+                {
+                    return (Begin(true));
+                }
+                bool EndArray() override
+                {
+                    return (End(0x90, 0xDC));
+                }
+                bool Key(const char text[], const uint32_t length) override
+                {
+                    ASSERT((_scopes.empty() == false) && (_scopes.back().Array == false));
+
+                    _scopes.back().Count++;
+                    Characters(text, length);
+                    return (true);
+                }
+                bool Text(const char text[], const uint32_t length) override
+                {
+                    Counted();
+                    Characters(text, length);
+                    return (true);
+                }
+                bool Number(const char text[], const uint32_t length) override
+                {
+                    char buffer[64];
+                    bool result = (length < sizeof(buffer));
+
+                    Counted();
+
+                    if (result == true) {
+                        bool integer = true;
+
+                        ::memcpy(buffer, text, length);
+                        buffer[length] = '\0';
+
+                        for (uint32_t index = 0; (index < length) && (integer == true); index++) {
+                            integer = ((buffer[index] != '.') && (buffer[index] != 'e') && (buffer[index] != 'E'));
+                        }
+
+                        char* end = nullptr;
+                        errno = 0;
+
+                        if ((integer == true) && (buffer[0] == '-')) {
+                            const int64_t value = ::strtoll(buffer, &end, 10);
+                            integer = ((errno == 0) && (*end == '\0'));
+                            if (integer == true) {
+                                Signed(value);
+                            }
+                        } else if (integer == true) {
+                            const uint64_t value = ::strtoull(buffer, &end, 10);
+                            integer = ((errno == 0) && (*end == '\0'));
+                            if (integer == true) {
+                                Unsigned(value);
+                            }
+                        }
+
+                        if (integer == false) {
+                            const double value = ::strtod(buffer, &end);
+                            result = (*end == '\0');
+                            if (result == true) {
+                                uint64_t bits;
+                                ::memcpy(&bits, &value, sizeof(bits));
+                                _packed += static_cast<char>(0xCB);
+                                BigEndian(bits, 8);
+                            }
+                        }
+                    }
+
+                    return (result);
+                }
+                bool Boolean(const bool value) override
+                {
+                    Counted();
+                    _packed += static_cast<char>(value == true ? 0xC3 : 0xC2);
+                    return (true);
+                }
+                bool Null() override
+                {
+                    Counted();
+                    _packed += static_cast<char>(IMessagePack::NullValue);
+                    return (true);
+                }
+
+            private:
+                // Values in an array count as an entry, in an object the key does.
+                void Counted()
+                {
+                    if ((_scopes.empty() == false) && (_scopes.back().Array == true)) {
+                        _scopes.back().Count++;
+                    }
+                }
+                bool Begin(const bool array)
+                {
+                    Counted();
+                    _scopes.push_back({ static_cast<uint32_t>(_packed.length()), 0, array });
+
+                    // Assume a fix map/array, the header is widened if it turns out to be bigger.
+                    _packed += static_cast<char>(array == true ? 0x90 : 0x80);
+                    return (true);
+                }
+                bool End(const uint8_t fixed, const uint8_t sized)
+                {
+                    ASSERT(_scopes.empty() == false);
+
+                    const Scope scope(_scopes.back());
+                    _scopes.pop_back();
+
+                    if (scope.Count <= 0x0F) {
+                        _packed[scope.Position] = static_cast<char>(fixed | scope.Count);
+                    } else {
+                        const uint8_t bytes = (scope.Count <= 0xFFFF ? 2 : 4);
+                        char length[4];
+
+                        for (uint8_t index = 0; index < bytes; index++) {
+                            length[index] = static_cast<char>((scope.Count >> (8 * (bytes - index - 1))) & 0xFF);
+                        }
+
+                        _packed[scope.Position] = static_cast<char>(bytes == 2 ? sized : sized + 1);
+                        _packed.insert(scope.Position + 1, length, bytes);
+                    }
+                    return (true);
+                }
+                void BigEndian(const uint64_t value, const uint8_t bytes)
+                {
+                    for (uint8_t index = bytes; index > 0; index--) {
+                        _packed += static_cast<char>((value >> (8 * (index - 1))) & 0xFF);
+                    }
+                }
+                void Unsigned(const uint64_t value)
+                {
+                    if (value <= 0x7F) {
+                        _packed += static_cast<char>(value);
+                    } else if (value <= 0xFF) {
+                        _packed += static_cast<char>(0xCC);
+                        BigEndian(value, 1);
+                    } else if (value <= 0xFFFF) {
+                        _packed += static_cast<char>(0xCD);
+                        BigEndian(value, 2);
+                    } else if (value <= 0xFFFFFFFF) {
+                        _packed += static_cast<char>(0xCE);
+                        BigEndian(value, 4);
+                    } else {
+                        _packed += static_cast<char>(0xCF);
+                        BigEndian(value, 8);
+                    }
+                }
+                void Signed(const int64_t value)
+                {
+                    if (value >= 0) {
+                        Unsigned(static_cast<uint64_t>(value));
+                    } else if (value >= -32) {
+                        _packed += static_cast<char>(value);
+                    } else if (value >= -128) {
+                        _packed += static_cast<char>(0xD0);
+                        BigEndian(static_cast<uint64_t>(value), 1);
+                    } else if (value >= -32768) {
+                        _packed += static_cast<char>(0xD1);
+                        BigEndian(static_cast<uint64_t>(value), 2);
+                    } else if (value >= (-2147483647 - 1)) {
+                        _packed += static_cast<char>(0xD2);
+                        BigEndian(static_cast<uint64_t>(value), 4);
+                    } else {
+                        _packed += static_cast<char>(0xD3);
+                        BigEndian(static_cast<uint64_t>(value), 8);
+                    }
+                }
+                // The reader leaves \uXXXX sequences as is, those are turned into UTF-8 here.
+                void Characters(const char text[], const uint32_t length)
+                {
+                    const uint32_t position = static_cast<uint32_t>(_packed.length());
+
+                    _packed += static_cast<char>(0xDB);
+                    _packed.append(4, '\0');
+
+                    uint32_t index = 0;
+                    while (index < length) {
+                        uint32_t code;
+                        if ((text[index] == '\\') && ((length - index) >= 6) && (text[index + 1] == 'u') && (Hex(&(text[index + 2]), code) == true)) {
+                            index += 6;
+                            uint32_t low;
+                            if ((code >= 0xD800) && (code <= 0xDBFF) && ((length - index) >= 6) && (text[index] == '\\') && (text[index + 1] == 'u') && (Hex(&(text[index + 2]), low) == true) && (low >= 0xDC00) && (low <= 0xDFFF)) {
+                                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                                index += 6;
+                            }
+                            UTF8(code);
+                        } else {
+                            _packed += text[index++];
+                        }
+                    }
+
+                    // Write the final length, in the smallest header that fits.
+                    const uint32_t size = static_cast<uint32_t>(_packed.length()) - position - 5;
+                    uint8_t header[5];
+                    uint8_t bytes;
+
+                    if (size <= 31) {
+                        header[0] = static_cast<uint8_t>(0xA0 | size);
+                        bytes = 1;
+                    } else if (size <= 0xFF) {
+                        header[0] = 0xD9;
+                        header[1] = static_cast<uint8_t>(size);
+                        bytes = 2;
+                    } else if (size <= 0xFFFF) {
+                        header[0] = 0xDA;
+                        header[1] = static_cast<uint8_t>(size >> 8);
+                        header[2] = static_cast<uint8_t>(size);
+                        bytes = 3;
+                    } else {
+                        header[0] = 0xDB;
+                        header[1] = static_cast<uint8_t>(size >> 24);
+                        header[2] = static_cast<uint8_t>(size >> 16);
+                        header[3] = static_cast<uint8_t>(size >> 8);
+                        header[4] = static_cast<uint8_t>(size);
+                        bytes = 5;
+                    }
+
+                    _packed.replace(position, 5, reinterpret_cast<const char*>(header), bytes);
+                }
+                static bool Hex(const char text[], uint32_t& code)
+                {
+                    bool result = true;
+                    code = 0;
+                    for (uint8_t index = 0; (index < 4) && (result == true); index++) {
+                        const char current = text[index];
+                        code <<= 4;
+                        if ((current >= '0') && (current <= '9')) {
+                            code |= (current - '0');
+                        } else if ((current >= 'a') && (current <= 'f')) {
+                            code |= (current - 'a' + 10);
+                        } else if ((current >= 'A') && (current <= 'F')) {
+                            code |= (current - 'A' + 10);
+                        } else {
+                            result = false;
+                        }
+                    }
+                    return (result);
+                }
+                void UTF8(const uint32_t code)
+                {
+                    if (code <= 0x7F) {
+                        _packed += static_cast<char>(code);
+                    } else if (code <= 0x7FF) {
+                        _packed += static_cast<char>(0xC0 | (code >> 6));
+                        _packed += static_cast<char>(0x80 | (code & 0x3F));
+                    } else if (code <= 0xFFFF) {
+                        _packed += static_cast<char>(0xE0 | (code >> 12));
+                        _packed += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        _packed += static_cast<char>(0x80 | (code & 0x3F));
+                    } else {
+                        _packed += static_cast<char>(0xF0 | (code >> 18));
+                        _packed += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                        _packed += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        _packed += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                }
+
+            private:
+                string& _packed;
+                std::vector<Scope> _scopes;
+            };
+
+        public:
+            MessagePack() = delete;
+            MessagePack(const MessagePack&) = delete;
+            MessagePack& operator=(const MessagePack&) = delete;
+
+        public:
+            static bool FromText(const string& text, string& packed)
+            {
+                Core::OptionalType<Error> error;
+                return (FromText(text.c_str(), static_cast<uint32_t>(text.length()), packed, error));
+            }
+            static bool FromText(const char text[], const uint32_t length, string& packed, Core::OptionalType<Error>& error)
+            {
+                Reader reader;
+                Encoder encoder(packed);
+
+                packed.clear();
+                reader.Parse(text, length, encoder, error);
+
+                if ((error.IsSet() == false) && (packed.empty() == true)) {
+                    error = Error{ "Nothing to convert" };
+                }
+                if (error.IsSet() == true) {
+                    packed.clear();
+                }
+
+                return (error.IsSet() == false);
+            }
+            static bool ToText(const string& packed, string& text)
+            {
+                return (ToText(reinterpret_cast<const uint8_t*>(packed.c_str()), static_cast<uint32_t>(packed.length()), text));
+            }
+            // The packed data should hold exactly one complete value.
+            static bool ToText(const uint8_t packed[], const uint32_t length, string& text)
+            {
+                uint32_t index = 0;
+
+                text.clear();
+
+                bool result = ((Value(packed, length, index, text, 0) == true) && (index == length));
+
+                if (result == false) {
+                    text.clear();
+                }
+
+                return (result);
+            }
+
+        private:
+            static bool Read(const uint8_t packed[], const uint32_t length, uint32_t& index, const uint8_t bytes, uint64_t& value)
+            {
+                bool result = ((length - index) >= bytes);
+
+                if (result == true) {
+                    value = 0;
+                    for (uint8_t count = 0; count < bytes; count++) {
+                        value = (value << 8) | packed[index++];
+                    }
+                }
+
+                return (result);
+            }
+            static void Quote(const char text[], const uint32_t length, string& result)
+            {
+                static const char hex[] = "0123456789ABCDEF";
+
+                result += '\"';
+                for (uint32_t index = 0; index < length; index++) {
+                    const uint8_t current = static_cast<uint8_t>(text[index]);
+
+                    switch (current) {
+                    case '\"':
+                        result += "\\\"";
+                        break;
+                    case '\\':
+                        result += "\\\\";
+                        break;
+                    case '\n':
+                        result += "\\n";
+                        break;
+                    case '\r':
+                        result += "\\r";
+                        break;
+                    case '\t':
+                        result += "\\t";
+                        break;
+                    case '\f':
+                        result += "\\f";
+                        break;
+                    case '\b':
+                        result += "\\b";
+                        break;
+                    default:
+                        if (current < 0x20) {
+                            result += "\\u00";
+                            result += hex[current >> 4];
+                            result += hex[current & 0x0F];
+                        } else {
+                            result += static_cast<char>(current);
+                        }
+                        break;
+                    }
+                }
+                result += '\"';
+            }
+            static void Floating(const double value, const bool single, string& text)
+            {
+                if ((std::isnan(value) == true) || (std::isinf(value) == true)) {
+                    text += IElement::NullTag;
+                } else {
+                    char buffer[32];
+                    const int size = ::snprintf(buffer, sizeof(buffer), (single == true ? "%.9g" : "%.17g"), value);
+                    text.append(buffer, size);
+                }
+            }
+            static bool Value(const uint8_t packed[], const uint32_t length, uint32_t& index, string& text, const uint8_t depth)
+            {
+                bool result = (index < length);
+
+                if (result == true) {
+                    const uint8_t header = packed[index++];
+                    uint64_t value = 0;
+
+                    if (header <= 0x7F) {
+                        text += Core::NumberType<uint64_t>(header).Text();
+                    } else if (header >= 0xE0) {
+                        text += Core::NumberType<int64_t>(static_cast<int8_t>(header)).Text();
+                    } else if ((header & 0xF0) == 0x80) {
+                        result = Map(packed, length, index, header & 0x0F, text, depth);
+                    } else if ((header & 0xF0) == 0x90) {
+                        result = Array(packed, length, index, header & 0x0F, text, depth);
+                    } else if ((header & 0xE0) == 0xA0) {
+                        result = Characters(packed, length, index, header & 0x1F, text);
+                    } else {
+                        switch (header) {
+                        case 0xC0:
+                            text += IElement::NullTag;
+                            break;
+                        case 0xC2:
+                            text += _T("false");
+                            break;
+                        case 0xC3:
+                            text += _T("true");
+                            break;
+                        case 0xC4:
+                        case 0xC5:
+                        case 0xC6:
+                            result = ((Read(packed, length, index, (1 << (header - 0xC4)), value) == true) && (value <= 0xFFFF) && ((length - index) >= value));
+                            if (result == true) {
+                                string encoded;
+                                Core::ToString(&(packed[index]), static_cast<uint16_t>(value), true, encoded);
+                                index += static_cast<uint32_t>(value);
+                                Quote(encoded.c_str(), static_cast<uint32_t>(encoded.length()), text);
+                            }
+                            break;
+                        case 0xCA:
+                            result = Read(packed, length, index, 4, value);
+                            if (result == true) {
+                                const uint32_t bits = static_cast<uint32_t>(value);
+                                float number;
+                                ::memcpy(&number, &bits, sizeof(number));
+                                Floating(number, true, text);
+                            }
+                            break;
+                        case 0xCB:
+                            result = Read(packed, length, index, 8, value);
+                            if (result == true) {
+                                double number;
+                                ::memcpy(&number, &value, sizeof(number));
+                                Floating(number, false, text);
+                            }
+                            break;
+                        case 0xCC:
+                        case 0xCD:
+                        case 0xCE:
+                        case 0xCF:
+                            result = Read(packed, length, index, (1 << (header - 0xCC)), value);
+                            if (result == true) {
+                                text += Core::NumberType<uint64_t>(value).Text();
+                            }
+                            break;
+                        case 0xD0:
+                        case 0xD1:
+                        case 0xD2:
+                        case 0xD3: {
+                            const uint8_t bytes = (1 << (header - 0xD0));
+                            result = Read(packed, length, index, bytes, value);
+                            if (result == true) {
+                                // Extend the sign of the smaller formats.
+                                if ((bytes < 8) && ((value & (static_cast<uint64_t>(1) << ((8 * bytes) - 1))) != 0)) {
+                                    value |= (~static_cast<uint64_t>(0) << (8 * bytes));
+                                }
+                                text += Core::NumberType<int64_t>(static_cast<int64_t>(value)).Text();
+                            }
+                            break;
+                        }
+                        case 0xD9:
+                        case 0xDA:
+                        case 0xDB:
+                            result = ((Read(packed, length, index, (1 << (header - 0xD9)), value) == true) && (value <= 0xFFFFFFFF));
+                            if (result == true) {
+                                result = Characters(packed, length, index, static_cast<uint32_t>(value), text);
+                            }
+                            break;
+                        case 0xDC:
+                        case 0xDD:
+                            result = Read(packed, length, index, (header == 0xDC ? 2 : 4), value);
+                            if (result == true) {
+                                result = Array(packed, length, index, static_cast<uint32_t>(value), text, depth);
+                            }
+                            break;
+                        case 0xDE:
+                        case 0xDF:
+                            result = Read(packed, length, index, (header == 0xDE ? 2 : 4), value);
+                            if (result == true) {
+                                result = Map(packed, length, index, static_cast<uint32_t>(value), text, depth);
+                            }
+                            break;
+                        default:
+                            // Ext types and the reserved 0xC1 have no JSON equivalent.
+                            result = false;
+                            break;
+                        }
+                    }
+                }
+
+                return (result);
+            }
+            static bool Characters(const uint8_t packed[], const uint32_t length, uint32_t& index, const uint32_t size, string& text)
+            {
+                bool result = ((length - index) >= size);
+
+                if (result == true) {
+                    Quote(reinterpret_cast<const char*>(&(packed[index])), size, text);
+                    index += size;
+                }
+
+                return (result);
+            }
+            static bool Array(const uint8_t packed[], const uint32_t length, uint32_t& index, const uint32_t count, string& text, const uint8_t depth)
+            {
+                bool result = (depth < MaxDepth);
+
+                text += '[';
+                for (uint32_t entry = 0; (entry < count) && (result == true); entry++) {
+                    if (entry != 0) {
+                        text += ',';
+                    }
+                    result = Value(packed, length, index, text, depth + 1);
+                }
+                text += ']';
+
+                return (result);
+            }
+            static bool Map(const uint8_t packed[], const uint32_t length, uint32_t& index, const uint32_t count, string& text, const uint8_t depth)
+            {
+                bool result = (depth < MaxDepth);
+
+                text += '{';
+                for (uint32_t entry = 0; (entry < count) && (result == true); entry++) {
+                    if (entry != 0) {
+                        text += ',';
+                    }
+
+                    // JSON only knows string keys, anything else is quoted.
+                    const uint32_t key = static_cast<uint32_t>(text.length());
+                    result = Value(packed, length, index, text, depth + 1);
+
+                    if ((result == true) && (text[key] != '\"')) {
+                        if ((text[key] == '{') || (text[key] == '[')) {
+                            result = false;
+                        } else {
+                            text.insert(key, 1, '\"');
+                            text += '\"';
+                        }
+                    }
+                    if (result == true) {
+                        text += ':';
+                        result = Value(packed, length, index, text, depth + 1);
+                    }
+                }
+                text += '}';
+
+                return (result);
+            }
+        };
+    }
+}
+} // namespace Core::JSON
+
+#endif // __JSONMESSAGEPACK_H
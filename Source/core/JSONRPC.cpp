@@ -26,6 +26,7 @@ namespace Core {
     namespace JSONRPC {
 
         /* static */ constexpr TCHAR Message::DefaultVersion[];
+        /* static */ constexpr TCHAR Message::PackedProtocol[];
     }
 }
 } // namespace WPEramework::Core::JSONRPC
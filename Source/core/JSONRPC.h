@@ -111,16 +111,228 @@ namespace Core {
                 Core::JSON::String Data;
             };
 
+            // The params and result are passed on as is. As JSON that is the JSON text, as
+            // MessagePack it is the packed value, which goes over the line as a value of its
+            // own (not wrapped in a string). Use JSON::MessagePack to convert between the two.
+            class Payload : public Core::JSON::String {
+            private:
+                // The offset holds the phase. The length phases encode what the length is
+                // for and how many bytes it takes, as (kind << 3) | bytes.
+                static constexpr uint16_t HEADER = 1;
+                static constexpr uint16_t PAYLOAD = 2;
+                static constexpr uint16_t BYTES = 1;
+                static constexpr uint16_t EXTENSION = 2;
+                static constexpr uint16_t ITEMS = 3;
+                static constexpr uint16_t PAIRS = 4;
+
+            public:
+                Payload(const Payload&) = delete;
+
+                Payload()
+                    : Core::JSON::String(false)
+                    , _packed()
+                    , _position(0)
+                    , _pending(0)
+                    , _values(0)
+                {
+                }
+                ~Payload() override = default;
+
+                using Core::JSON::String::operator=;
+
+                Payload& operator=(const Payload& RHS)
+                {
+                    Core::JSON::String::operator=(RHS);
+
+                    return (*this);
+                }
+
+            public:
+                // IMessagePack iface:
+                uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint16_t& offset) const override
+                {
+                    uint16_t loaded = 0;
+
+                    if (offset == 0) {
+                        _packed = Value();
+
+                        if ((IsNull() == true) || (_packed.empty() == true)) {
+                            stream[loaded++] = Core::JSON::IMessagePack::NullValue;
+                        } else {
+                            // Keep the position ourselves, the value may well exceed the 16 bits offset.
+                            _position = 0;
+                            offset = 1;
+                        }
+                    }
+
+                    if (offset != 0) {
+                        const uint32_t copied = std::min(static_cast<uint32_t>(maxLength - loaded), static_cast<uint32_t>(_packed.length()) - _position);
+
+                        ::memcpy(&(stream[loaded]), &(_packed[_position]), copied);
+                        loaded += static_cast<uint16_t>(copied);
+                        _position += copied;
+
+                        if (_position == _packed.length()) {
+                            _packed.clear();
+                            offset = 0;
+                        }
+                    }
+
+                    return (loaded);
+                }
+
+                // Takes in exactly one value, whatever its type, without interpreting it.
+                uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint16_t& offset) override
+                {
+                    uint16_t loaded = 0;
+
+                    if (offset == 0) {
+                        _packed.clear();
+                        _pending = 0;
+
+                        if (stream[loaded] == Core::JSON::IMessagePack::NullValue) {
+                            Null(true);
+                            loaded++;
+                        } else {
+                            _values = 1;
+                            offset = HEADER;
+                        }
+                    }
+
+                    while ((loaded < maxLength) && (offset != 0)) {
+                        if (offset == HEADER) {
+                            offset = Header(stream[loaded++]);
+                        } else {
+                            const uint32_t copied = std::min(_pending, static_cast<uint32_t>(maxLength - loaded));
+
+                            _packed.append(reinterpret_cast<const char*>(&(stream[loaded])), copied);
+                            loaded += static_cast<uint16_t>(copied);
+                            _pending -= copied;
+
+                            if (_pending == 0) {
+                                offset = (offset == PAYLOAD ? HEADER : Length(offset));
+                            }
+                        }
+
+                        if ((offset == HEADER) && (_values == 0)) {
+                            Core::JSON::String::operator=(_packed);
+                            _packed.clear();
+                            offset = 0;
+                        } else if (offset == 0) {
+                            // Not a valid value, skip what we have got.
+                            Clear();
+                            loaded = maxLength;
+                        }
+                    }
+
+                    return (loaded);
+                }
+
+            private:
+                // Returns the next phase, 0 if the header is invalid.
+                uint16_t Header(const uint8_t header)
+                {
+                    uint16_t result = HEADER;
+                    uint32_t items = 0;
+
+                    _packed += static_cast<char>(header);
+                    _values--;
+
+                    if ((header <= 0x7F) || (header >= 0xE0) || (header == 0xC0) || (header == 0xC2) || (header == 0xC3)) {
+                        // Self contained
+                    } else if ((header & 0xF0) == 0x80) {
+                        items = 2 * (header & 0x0F);
+                    } else if ((header & 0xF0) == 0x90) {
+                        items = (header & 0x0F);
+                    } else if ((header & 0xE0) == 0xA0) {
+                        _pending = (header & 0x1F);
+                    } else if ((header >= 0xC4) && (header <= 0xC6)) {
+                        _pending = (1 << (header - 0xC4));
+                        result = (BYTES << 3) | _pending;
+                    } else if ((header >= 0xC7) && (header <= 0xC9)) {
+                        _pending = (1 << (header - 0xC7));
+                        result = (EXTENSION << 3) | _pending;
+                    } else if ((header == 0xCA) || (header == 0xCB)) {
+                        _pending = (header == 0xCA ? 4 : 8);
+                    } else if ((header >= 0xCC) && (header <= 0xCF)) {
+                        _pending = (1 << (header - 0xCC));
+                    } else if ((header >= 0xD0) && (header <= 0xD3)) {
+                        _pending = (1 << (header - 0xD0));
+                    } else if ((header >= 0xD4) && (header <= 0xD8)) {
+                        _pending = 1 + (1 << (header - 0xD4));
+                    } else if ((header >= 0xD9) && (header <= 0xDB)) {
+                        _pending = (1 << (header - 0xD9));
+                        result = (BYTES << 3) | _pending;
+                    } else if ((header == 0xDC) || (header == 0xDD)) {
+                        _pending = (header == 0xDC ? 2 : 4);
+                        result = (ITEMS << 3) | _pending;
+                    } else if ((header == 0xDE) || (header == 0xDF)) {
+                        _pending = (header == 0xDE ? 2 : 4);
+                        result = (PAIRS << 3) | _pending;
+                    } else {
+                        // 0xC1 is never used.
+                        result = 0;
+                    }
+
+                    if (items > (~static_cast<uint32_t>(0) - _values)) {
+                        result = 0;
+                    } else {
+                        _values += items;
+                    }
+
+                    return (((result == HEADER) && (_pending != 0)) ? PAYLOAD : result);
+                }
+                // A length came in, it is at the end of what we have, in network order.
+                uint16_t Length(const uint16_t phase)
+                {
+                    const uint8_t bytes = (phase & 0x07);
+                    uint16_t result = HEADER;
+                    uint32_t length = 0;
+
+                    for (uint32_t index = static_cast<uint32_t>(_packed.length()) - bytes; index < _packed.length(); index++) {
+                        length = (length << 8) | static_cast<uint8_t>(_packed[index]);
+                    }
+
+                    switch (phase >> 3) {
+                    case BYTES:
+                        _pending = length;
+                        break;
+                    case EXTENSION:
+                        _pending = length + 1;
+                        break;
+                    default: {
+                        const uint64_t items = static_cast<uint64_t>(length) * ((phase >> 3) == PAIRS ? 2 : 1);
+                        if (items > (~static_cast<uint32_t>(0) - _values)) {
+                            result = 0;
+                        } else {
+                            _values += static_cast<uint32_t>(items);
+                        }
+                        break;
+                    }
+                    }
+
+                    return (((result == HEADER) && (_pending != 0)) ? PAYLOAD : result);
+                }
+
+            private:
+                mutable string _packed;
+                mutable uint32_t _position;
+                uint32_t _pending;
+                uint32_t _values;
+            };
+
         public:
             static constexpr TCHAR DefaultVersion[] = _T("2.0");
+            // WebSocket subprotocol carrying the messages as MessagePack, instead of JSON text.
+            static constexpr TCHAR PackedProtocol[] = _T("jsonrpc.msgpack");
 
             Message()
                 : Core::JSON::Container()
                 , JSONRPC(DefaultVersion)
                 , Id(~0)
                 , Designator()
-                , Parameters(false)
-                , Result(false)
+                , Parameters()
+                , Result()
                 , Error()
             {
                 Add(_T("jsonrpc"), &JSONRPC);
@@ -135,7 +347,8 @@ namespace Core {
             }
 
         public:
-            static string Callsign(const string& designator)
+            // Length of the callsign at the start of the designator, 0 if there is none.
+            static size_t CallsignLength(const string& designator)
             {
                 size_t pos = designator.find_last_of('.', designator.find_last_of('@'));
                 if ((pos != string::npos) && (pos > 0)) {
@@ -149,19 +362,35 @@ namespace Core {
                         pos = string::npos;
                     }
                 }
-                return (pos == string::npos ? EMPTY_STRING : designator.substr(0, pos));
+                return (pos == string::npos ? 0 : pos);
+            }
+            static string Callsign(const string& designator)
+            {
+                size_t length = CallsignLength(designator);
+                return (length == 0 ? EMPTY_STRING : designator.substr(0, length));
             }
             static string FullCallsign(const string& designator)
             {
                 size_t pos = designator.find_last_of('.', designator.find_last_of('@'));
                 return (pos == string::npos ? EMPTY_STRING : designator.substr(0, pos));
             }
-            static string Method(const string& designator)
+            // Locates the method in the designator, without copying it out. Returns the offset.
+            static size_t MethodPosition(const string& designator, size_t& length)
             {
                 size_t end = designator.find_last_of('@');
                 size_t begin = designator.find_last_of('.', end);
 
-                return (designator.substr((begin == string::npos) ? 0 : begin + 1, (end == string::npos ? string::npos : (begin == string::npos) ? end : end - begin - 1)));
+                begin = (begin == string::npos ? 0 : begin + 1);
+                length = (end == string::npos ? designator.length() : end) - begin;
+
+                return (begin);
+            }
+            static string Method(const string& designator)
+            {
+                size_t length;
+                size_t begin = MethodPosition(designator, length);
+
+                return (designator.substr(begin, length));
             }
             static string FullMethod(const string& designator)
             {
@@ -201,7 +430,8 @@ namespace Core {
                     }
 
                     if (index < pos) {
-                        result = static_cast<uint8_t>(atoi(designator.substr(index, pos - index).c_str()));
+                        // The '.' at pos terminates the number, no need to copy it out.
+                        result = static_cast<uint8_t>(atoi(&(designator.c_str()[index])));
                     }
                 }
                 return (result);
@@ -252,8 +482,8 @@ namespace Core {
             Core::JSON::String JSONRPC;
             Core::JSON::DecUInt32 Id;
             Core::JSON::String Designator;
-            Core::JSON::String Parameters;
-            Core::JSON::String Result;
+            Payload Parameters;
+            Payload Result;
             Info Error;
         };
 
@@ -442,6 +672,105 @@ namespace Core {
             };
 
             typedef std::map<const string, Entry> HandlerMap;
+
+            // Flat, open addressed, index on top of the HandlerMap. It is (re)build at Register()
+            // time, so a lookup of a method that lives somewhere in an inbound designator can be
+            // done in place, without copying it out or walking the tree.
+            class Lookup {
+            private:
+                Lookup(const Lookup&) = delete;
+                Lookup& operator=(const Lookup&) = delete;
+
+                struct Slot {
+                    uint32_t Hash;
+                    const string* Name;
+                    Entry* Info;
+                };
+
+            public:
+                Lookup()
+                    : _slots(8, Slot { 0, nullptr, nullptr })
+                    , _count(0)
+                {
+                }
+                ~Lookup()
+                {
+                }
+
+            public:
+                void Build(HandlerMap& handlers)
+                {
+                    uint32_t size = 8;
+                    while (size < (handlers.size() * 2)) {
+                        size <<= 1;
+                    }
+
+                    _slots.assign(size, Slot { 0, nullptr, nullptr });
+                    _count = 0;
+
+                    for (auto& entry : handlers) {
+                        Place(Hash(entry.first.c_str(), entry.first.length()), entry.first, entry.second);
+                    }
+                }
+                // Returns false if the table is too crowded to take it, it needs a Build() in that case.
+                bool Insert(const string& name, Entry& info)
+                {
+                    bool result = (((_count + 1) * 2) <= _slots.size());
+
+                    if (result == true) {
+                        Place(Hash(name.c_str(), name.length()), name, info);
+                    }
+
+                    return (result);
+                }
+                Entry* Find(const TCHAR* name, const size_t length) const
+                {
+                    Entry* result = nullptr;
+                    const uint32_t hash = Hash(name, length);
+                    const uint32_t mask = static_cast<uint32_t>(_slots.size() - 1);
+                    uint32_t index = hash & mask;
+
+                    while ((result == nullptr) && (_slots[index].Name != nullptr)) {
+                        const Slot& slot(_slots[index]);
+
+                        if ((slot.Hash == hash) && (slot.Name->length() == length) && (slot.Name->compare(0, length, name, length) == 0)) {
+                            result = slot.Info;
+                        } else {
+                            index = (index + 1) & mask;
+                        }
+                    }
+
+                    return (result);
+                }
+
+            private:
+                // FNV-1a
+                static uint32_t Hash(const TCHAR* name, const size_t length)
+                {
+                    uint32_t hash = 2166136261u;
+                    for (size_t index = 0; index < length; index++) {
+                        hash = (hash ^ static_cast<uint32_t>(name[index])) * 16777619u;
+                    }
+                    return (hash);
+                }
+                void Place(const uint32_t hash, const string& name, Entry& info)
+                {
+                    const uint32_t mask = static_cast<uint32_t>(_slots.size() - 1);
+                    uint32_t index = hash & mask;
+
+                    while (_slots[index].Name != nullptr) {
+                        index = (index + 1) & mask;
+                    }
+
+                    _slots[index] = Slot { hash, &name, &info };
+                    _count++;
+                }
+
+            private:
+                std::vector<Slot> _slots;
+                uint32_t _count;
+            };
+
             typedef std::list<Observer> ObserverList;
             typedef std::map<string, ObserverList> ObserverMap;
 
@@ -523,6 +852,7 @@ namespace Core {
             Handler(const NotificationFunction& notificationFunction, const std::vector<uint8_t>& versions)
                 : _adminLock()
                 , _handlers()
+                , _lookup()
                 , _observers()
                 , _notificationFunction(notificationFunction)
                 , _versions(versions)
@@ -531,10 +861,12 @@ namespace Core {
             Handler(const NotificationFunction& notificationFunction, const std::vector<uint8_t>& versions, const Handler& copy)
                 : _adminLock()
                 , _handlers(copy._handlers)
+                , _lookup()
                 , _observers()
                 , _notificationFunction(notificationFunction)
                 , _versions(versions)
             {
+                _lookup.Build(_handlers);
             }
             ~Handler()
             {
@@ -555,9 +887,13 @@ namespace Core {
                     copied = true;
                     const Entry& info(index->second);
 
-                    _handlers.emplace(std::piecewise_construct,
+                    auto retval = _handlers.emplace(std::piecewise_construct,
                         std::forward_as_tuple(method),
                         std::forward_as_tuple(info));
+
+                    if (retval.second == true) {
+                        Indexed(retval.first);
+                    }
                 }
 
                 return (copied);
@@ -566,7 +902,11 @@ namespace Core {
             // The interface is prepared.
             inline uint32_t Exists(const string& methodName) const
             {
-                return ((_handlers.find(methodName) != _handlers.end()) ? Core::ERROR_NONE : Core::ERROR_UNKNOWN_KEY);
+                return (Exists(methodName.c_str(), methodName.length()));
+            }
+            inline uint32_t Exists(const TCHAR* methodName, const size_t length) const
+            {
+                return ((Find(methodName, length) != nullptr) ? Core::ERROR_NONE : Core::ERROR_UNKNOWN_KEY);
             }
             bool HasVersionSupport(const uint8_t number) const
             {
@@ -651,6 +991,8 @@ namespace Core {
                     
                 if ( retval.second == false ) {
                     retval.first->second = lambda;
+                } else {
+                    Indexed(retval.first);
                 }
             }
             void Register(const string& methodName, const CallbackFunction& lambda)
@@ -664,6 +1006,8 @@ namespace Core {
 
                 if ( retval.second == false ) {
                     retval.first->second = lambda;
+                } else {
+                    Indexed(retval.first);
                 }
             }
             void Unregister(const string& methodName)
@@ -674,17 +1018,20 @@ namespace Core {
 
                 if (index != _handlers.end()) {
                     _handlers.erase(index);
+                    _lookup.Build(_handlers);
                 }
             }
             uint32_t Invoke(const Connection connection, const string& method, const string& parameters, string& response)
             {
                 uint32_t result = Core::ERROR_UNKNOWN_KEY;
+                size_t length;
+                size_t offset = Message::MethodPosition(method, length);
 
                 response.clear();
 
-                HandlerMap::iterator index = _handlers.find(Message::Method(method));
-                if (index != _handlers.end()) {
-                    result = index->second.Invoke(connection, method, parameters, response);
+                Entry* entry = Find(&(method.c_str()[offset]), length);
+                if (entry != nullptr) {
+                    result = entry->Invoke(connection, method, parameters, response);
                 }
                 return (result);
             }
@@ -792,6 +1139,16 @@ namespace Core {
             }
 
         private:
+            void Indexed(HandlerMap::iterator& index)
+            {
+                if (_lookup.Insert(index->first, index->second) == false) {
+                    _lookup.Build(_handlers);
+                }
+            }
+            Entry* Find(const TCHAR* methodName, const size_t length) const
+            {
+                return (_lookup.Find(methodName, length));
+            }
             template <typename PARAMETER, typename GET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<1>&, const string& methodName, const GET_METHOD& getMethod, REALOBJECT* objectPtr)
             {
@@ -1089,6 +1446,7 @@ namespace Core {
         private:
             Core::CriticalSection _adminLock;
             HandlerMap _handlers;
+            Lookup _lookup;
             ObserverMap _observers;
             NotificationFunction _notificationFunction;
             const std::vector<uint8_t> _versions;
@@ -0,0 +1,313 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __JSONREADER_H
+#define __JSONREADER_H
+
+#include "JSON.h"
+#include "Module.h"
+
+namespace WPEFramework {
+namespace Core {
+    namespace JSON {
+
+        // -------------------------------------------------------------------
+        // Event (SAX) style reader for a complete, in memory, JSON document.
+        // The document is walked in one pass and reported to an IHandler as
+        // it goes, without building an element tree. Keys, strings and
+        // numbers are handed out as (pointer, length) views into the
+        // document. Only strings with escape sequences are decoded, into a
+        // scratch buffer owned by the reader, so views are only valid for
+        // the duration of the callback. Escapes are handled like the
+        // JSON::String does (\n, \r, \t, \f, \b replaced, \uXXXX untouched).
+        // -------------------------------------------------------------------
+        class EXTERNAL Reader {
+        private:
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+            static constexpr uint8_t MaxDepth = 64;
+
+            enum class expect : uint8_t {
+                VALUE,
+                VALUE_OR_END,
+                KEY,
+                KEY_OR_END,
+                COLON,
+                NEXT_OR_END,
+                DONE
+            };
+
+        public:
+            // Return false from any of the events to stop reading, e.g. once
+            // everything of interest has been seen.
+            struct IHandler {
+                virtual ~IHandler() = default;
+
+                virtual bool BeginObject() = 0;
+                virtual bool EndObject() = 0;
+                virtual bool BeginArray() = 0;
+                virtual bool EndArray() = 0;
+                virtual bool Key(const char text[], const uint32_t length) = 0;
+                virtual bool Text(const char text[], const uint32_t length) = 0;
+                virtual bool Number(const char text[], const uint32_t length) = 0;
+                virtual bool Boolean(const bool value) = 0;
+                virtual bool Null() = 0;
+            };
+
+        public:
+            Reader()
+                : _scratch()
+                , _scopes(0)
+                , _depth(0)
+            {
+            }
+            ~Reader() = default;
+
+        public:
+            bool Parse(const string& text, IHandler& handler)
+            {
+                Core::OptionalType<Error> error;
+                Parse(text.c_str(), static_cast<uint32_t>(text.length()), handler, error);
+                return (error.IsSet() == false);
+            }
+            bool Parse(const string& text, IHandler& handler, Core::OptionalType<Error>& error)
+            {
+                Parse(text.c_str(), static_cast<uint32_t>(text.length()), handler, error);
+                return (error.IsSet() == false);
+            }
+
+            // Returns the number of characters consumed. Reading ends after the
+            // first complete value, on a '\0', or if the handler asks for it.
+            uint32_t Parse(const char text[], const uint32_t length, IHandler& handler, Core::OptionalType<Error>& error)
+            {
+                expect state = expect::VALUE;
+                uint32_t index = 0;
+                bool proceed = true;
+
+                _scopes = 0;
+                _depth = 0;
+
+                while ((proceed == true) && (state != expect::DONE) && (error.IsSet() == false) && (index < length) && (text[index] != '\0')) {
+                    const char current = text[index];
+
+                    if ((current == ' ') || (current == '\t') || (current == '\n') || (current == '\r')) {
+                        index++;
+                    } else if ((current == '{') || (current == '[')) {
+                        if ((state != expect::VALUE) && (state != expect::VALUE_OR_END)) {
+                            error = Error{ "Unexpected \"" + std::string(1, current) + "\"" };
+                        } else if (_depth == MaxDepth) {
+                            error = Error{ "Nesting too deep" };
+                        } else {
+                            _scopes = (_scopes << 1) | (current == '[' ? 1 : 0);
+                            _depth++;
+                            index++;
+                            if (current == '{') {
+                                proceed = handler.BeginObject();
+                                state = expect::KEY_OR_END;
+                            } else {
+                                proceed = handler.BeginArray();
+                                state = expect::VALUE_OR_END;
+                            }
+                        }
+                    } else if ((current == '}') || (current == ']')) {
+                        const bool array = (current == ']');
+
+                        if ((_depth == 0) || (IsArray() != array) || ((state != expect::NEXT_OR_END) && (state != (array ? expect::VALUE_OR_END : expect::KEY_OR_END)))) {
+                            error = Error{ "Unexpected \"" + std::string(1, current) + "\"" };
+                        } else {
+                            _scopes >>= 1;
+                            _depth--;
+                            index++;
+                            proceed = (array ? handler.EndArray() : handler.EndObject());
+                            state = Completed();
+                        }
+                    } else if (current == ':') {
+                        if (state != expect::COLON) {
+                            error = Error{ "Unexpected \":\"" };
+                        } else {
+                            index++;
+                            state = expect::VALUE;
+                        }
+                    } else if (current == ',') {
+                        if (state != expect::NEXT_OR_END) {
+                            error = Error{ "Unexpected \",\"" };
+                        } else {
+                            index++;
+                            state = (IsArray() == true ? expect::VALUE : expect::KEY);
+                        }
+                    } else if (current == '\"') {
+                        const char* begin;
+                        uint32_t size;
+                        uint32_t loaded = Quoted(&(text[index]), length - index, begin, size, error);
+
+                        if (error.IsSet() == false) {
+                            index += loaded;
+
+                            if ((state == expect::KEY) || (state == expect::KEY_OR_END)) {
+                                proceed = handler.Key(begin, size);
+                                state = expect::COLON;
+                            } else if ((state == expect::VALUE) || (state == expect::VALUE_OR_END)) {
+                                proceed = handler.Text(begin, size);
+                                state = Completed();
+                            } else {
+                                error = Error{ "Unexpected string" };
+                            }
+                        }
+                    } else if ((state != expect::VALUE) && (state != expect::VALUE_OR_END)) {
+                        error = Error{ "Unexpected \"" + std::string(1, current) + "\"" };
+                    } else if ((current == '-') || ((current >= '0') && (current <= '9'))) {
+                        uint32_t end = index + 1;
+
+                        while ((end < length) && (IsNumeric(text[end]) == true)) {
+                            end++;
+                        }
+
+                        proceed = handler.Number(&(text[index]), end - index);
+                        index = end;
+                        state = Completed();
+                    } else if (Literal(text, length, index, "true") == true) {
+                        proceed = handler.Boolean(true);
+                        state = Completed();
+                    } else if (Literal(text, length, index, "false") == true) {
+                        proceed = handler.Boolean(false);
+                        state = Completed();
+                    } else if (Literal(text, length, index, IElement::NullTag) == true) {
+                        proceed = handler.Null();
+                        state = Completed();
+                    } else {
+                        error = Error{ "Unexpected \"" + std::string(1, current) + "\"" };
+                    }
+                }
+
+                if ((error.IsSet() == false) && (proceed == true) && (state != expect::DONE)) {
+                    error = Error{ "Malformed JSON. Missing closing quotes or brackets" };
+                }
+
+                if (error.IsSet() == true) {
+                    error.Value().Context(text, length, index);
+                }
+
+                return (index);
+            }
+
+        private:
+            inline bool IsArray() const
+            {
+                return ((_scopes & 1) != 0);
+            }
+            inline expect Completed() const
+            {
+                return (_depth == 0 ? expect::DONE : expect::NEXT_OR_END);
+            }
+            static inline bool IsNumeric(const char current)
+            {
+                return (((current >= '0') && (current <= '9')) || (current == '.') || (current == 'e') || (current == 'E') || (current == '+') || (current == '-'));
+            }
+            static bool Literal(const char text[], const uint32_t length, uint32_t& index, const char literal[])
+            {
+                uint32_t size = static_cast<uint32_t>(strlen(literal));
+                bool result = (((length - index) >= size) && (strncmp(&(text[index]), literal, size) == 0));
+
+                if (result == true) {
+                    index += size;
+                }
+
+                return (result);
+            }
+            // Text points to the opening quote. Hands out a view in the text
+            // if there is nothing to unescape, in the scratch buffer otherwise.
+            uint32_t Quoted(const char text[], const uint32_t length, const char*& begin, uint32_t& size, Core::OptionalType<Error>& error)
+            {
+                uint32_t index = 1;
+                bool escaped = false;
+
+                while ((index < length) && (text[index] != '\"') && (text[index] != '\0')) {
+                    if (text[index] == '\\') {
+                        escaped = true;
+                        index++;
+                    }
+                    index++;
+                }
+
+                if ((index >= length) || (text[index] != '\"')) {
+                    error = Error{ "Missing closing quote" };
+                } else if (escaped == false) {
+                    begin = &(text[1]);
+                    size = index - 1;
+                } else {
+                    _scratch.clear();
+
+                    for (uint32_t position = 1; (position < index) && (error.IsSet() == false); position++) {
+                        char current = text[position];
+
+                        if (current == '\\') {
+                            current = text[++position];
+
+                            switch (current) {
+                            case 'n':
+                                _scratch += '\n';
+                                break;
+                            case 'r':
+                                _scratch += '\r';
+                                break;
+                            case 't':
+                                _scratch += '\t';
+                                break;
+                            case 'f':
+                                _scratch += '\f';
+                                break;
+                            case 'b':
+                                _scratch += '\b';
+                                break;
+                            case 'u':
+                                _scratch += '\\';
+                                _scratch += current;
+                                break;
+                            case '\"':
+                            case '\\':
+                            case '/':
+                                _scratch += current;
+                                break;
+                            default:
+                                error = Error{ "Invalid escape sequence \"\\" + std::string(1, current) + "\"." };
+                                break;
+                            }
+                        } else {
+                            _scratch += current;
+                        }
+                    }
+
+                    begin = _scratch.c_str();
+                    size = static_cast<uint32_t>(_scratch.length());
+                }
+
+                return (index + 1);
+            }
+
+        private:
+            string _scratch;
+            uint64_t _scopes;
+            uint8_t _depth;
+        };
+    }
+}
+} // namespace Core::JSON
+
+#endif // __JSONREADER_H
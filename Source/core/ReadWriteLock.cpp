@@ -0,0 +1,147 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReadWriteLock.h"
+
+#include <chrono>
+
+#ifdef __LINUX__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <climits>
+#endif
+
+namespace WPEFramework {
+
+namespace Core {
+
+    AdaptiveReadWriteLock::AdaptiveReadWriteLock(const uint16_t maxSpins)
+        : _state(0)
+        , _maxSpins(AdaptiveCriticalSection::SpinLimit(maxSpins))
+        , _spins(_maxSpins / 10)
+        , _readAcquired(0)
+        , _writeAcquired(0)
+        , _contended(0)
+        , _parked(0)
+    {
+    }
+
+    AdaptiveReadWriteLock::~AdaptiveReadWriteLock()
+    {
+        ASSERT((_state.load() & (WRITER | READERS)) == 0);
+    }
+
+    bool AdaptiveReadWriteLock::Wait(const bool writer, const uint32_t waitTime)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        const uint16_t average = _spins.load(std::memory_order_relaxed);
+        const uint32_t limit = (_maxSpins == 0 ? 0 : std::min(static_cast<uint32_t>(_maxSpins), (static_cast<uint32_t>(average) * 2) + 10));
+        uint32_t state = _state.load(std::memory_order_relaxed);
+        uint32_t spin = 0;
+        bool acquired = false;
+        bool timedOut = false;
+        bool slept = false;
+
+        _contended.fetch_add(1, std::memory_order_relaxed);
+
+        while ((acquired == false) && (timedOut == false)) {
+            const bool available = (writer == true ? ((state & (WRITER | READERS)) == 0) : ((state & WRITER) == 0));
+
+            if (available == true) {
+                // Whoever sleeps, keeps sleeping, so the sleepers flag stays.
+                acquired = _state.compare_exchange_weak(state, (writer == true ? (state | WRITER) : (state + 1)), std::memory_order_acquire, std::memory_order_relaxed);
+            } else if (spin < limit) {
+                AdaptiveCriticalSection::Pause();
+                spin++;
+                state = _state.load(std::memory_order_relaxed);
+            } else {
+                uint32_t timeLeft = Core::infinite;
+
+                if (waitTime != Core::infinite) {
+                    const uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+                    timeLeft = (elapsed >= waitTime ? 0 : static_cast<uint32_t>(waitTime - elapsed));
+                }
+
+                if (timeLeft == 0) {
+                    timedOut = true;
+                } else {
+                    slept = true;
+                    Sleep(state, timeLeft);
+                    state = _state.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        if (slept == true) {
+            _parked.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Like the AdaptiveCriticalSection, having to sleep moves it towards the limit. Several
+        // threads might do this at the same time, the last one wins, close enough for a guess.
+        if (_maxSpins > 0) {
+            const int32_t delta = static_cast<int32_t>(((acquired == true) && (slept == false)) ? spin : limit) - average;
+            _spins.store(static_cast<uint16_t>(average + (delta / 8)), std::memory_order_relaxed);
+        }
+
+        return (acquired);
+    }
+
+    void AdaptiveReadWriteLock::Sleep(const uint32_t state, const uint32_t waitTime)
+    {
+#ifdef __LINUX__
+        uint32_t expected = state;
+        bool result = true;
+
+        // The sleepers flag makes the one unlocking wake us, it has to be up before we sleep.
+        if ((expected & SLEEPERS) == 0) {
+            result = _state.compare_exchange_strong(expected, expected | SLEEPERS, std::memory_order_relaxed);
+            expected |= SLEEPERS;
+        }
+
+        if (result == true) {
+            struct timespec* timeout = nullptr;
+            struct timespec left;
+
+            if (waitTime != Core::infinite) {
+                left.tv_sec = waitTime / 1000;
+                left.tv_nsec = (waitTime % 1000) * 1000 * 1000;
+                timeout = &left;
+            }
+
+            // If it changed in the mean time, this returns right away.
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_state), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+        }
+#else
+        DEBUG_VARIABLE(state);
+
+        ::SleepMs(std::min(waitTime, static_cast<uint32_t>(1)));
+#endif
+    }
+
+    void AdaptiveReadWriteLock::Wake()
+    {
+#ifdef __LINUX__
+        _state.fetch_and(~SLEEPERS, std::memory_order_relaxed);
+
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_state), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+}
+} // namespace WPEFramework::Core
@@ -122,6 +122,117 @@ namespace Core {
         StateTrigger<LockState> m_State;
         uint32_t m_Readers;
     };
+
+    // The same rules as the ReadWriteLock: any number of readers or one writer, readers go first,
+    // not recursive. Taking it, if it is free, is a single atomic operation on a word that holds
+    // the state, instead of a mutex and a condition around it. If it is not free, it spins like
+    // the AdaptiveCriticalSection and then sleeps on that word (a futex, on Linux).
+    class EXTERNAL AdaptiveReadWriteLock {
+    private:
+        AdaptiveReadWriteLock(const AdaptiveReadWriteLock&) = delete;
+        AdaptiveReadWriteLock& operator=(const AdaptiveReadWriteLock&) = delete;
+
+        static constexpr uint32_t WRITER = 0x80000000;
+        static constexpr uint32_t SLEEPERS = 0x40000000;
+        static constexpr uint32_t READERS = 0x3FFFFFFF;
+
+    public:
+        AdaptiveReadWriteLock(const uint16_t maxSpins = AdaptiveCriticalSection::MaxSpins);
+        ~AdaptiveReadWriteLock();
+
+    public:
+        inline bool ReadLock(const uint32_t waitTime = Core::infinite)
+        {
+            uint32_t state = _state.load(std::memory_order_relaxed);
+            bool acquired = (((state & WRITER) == 0) && (_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed) == true));
+
+            if (acquired == false) {
+                acquired = Wait(false, waitTime);
+            }
+            if (acquired == true) {
+                _readAcquired.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return (acquired);
+        }
+        inline void ReadUnlock()
+        {
+            const uint32_t state = _state.fetch_sub(1, std::memory_order_release);
+
+            // If we want to unlock, we must have locked it and thus there must be readers.
+            ASSERT(((state & WRITER) == 0) && ((state & READERS) > 0));
+
+            if ((state & (READERS | SLEEPERS)) == (SLEEPERS | 1)) {
+                Wake();
+            }
+        }
+        inline bool WriteLock(const uint32_t waitTime = Core::infinite)
+        {
+            uint32_t state = 0;
+            bool acquired = _state.compare_exchange_weak(state, WRITER, std::memory_order_acquire, std::memory_order_relaxed);
+
+            if (acquired == false) {
+                acquired = Wait(true, waitTime);
+            }
+            if (acquired == true) {
+                // We own the lock, nobody else writes this counter.
+                _writeAcquired.store(_writeAcquired.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            return (acquired);
+        }
+        inline void WriteUnlock()
+        {
+            const uint32_t state = _state.fetch_and(~(WRITER | SLEEPERS), std::memory_order_release);
+
+            // If we want to unlock, we must have locked it and thus we must be the writer.
+            ASSERT(((state & WRITER) != 0) && ((state & READERS) == 0));
+
+            if ((state & SLEEPERS) != 0) {
+                Wake();
+            }
+        }
+
+        // Debug: how often it was taken to read and to write, of all those how often it was not
+        // free, and how often a thread had to sleep for it.
+        inline uint64_t ReadAcquired() const
+        {
+            return (_readAcquired.load(std::memory_order_relaxed));
+        }
+        inline uint64_t WriteAcquired() const
+        {
+            return (_writeAcquired.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Contended() const
+        {
+            return (_contended.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Parked() const
+        {
+            return (_parked.load(std::memory_order_relaxed));
+        }
+        void ResetStatistics()
+        {
+            _readAcquired.store(0, std::memory_order_relaxed);
+            _writeAcquired.store(0, std::memory_order_relaxed);
+            _contended.store(0, std::memory_order_relaxed);
+            _parked.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        bool Wait(const bool writer, const uint32_t waitTime);
+        void Sleep(const uint32_t state, const uint32_t waitTime);
+        void Wake();
+
+    private:
+        std::atomic<uint32_t> _state;
+        const uint16_t _maxSpins;
+        std::atomic<uint16_t> _spins;
+        std::atomic<uint64_t> _readAcquired;
+        std::atomic<uint64_t> _writeAcquired;
+        std::atomic<uint64_t> _contended;
+        std::atomic<uint64_t> _parked;
+    };
 }
 } // namespace Core
 
@@ -37,5 +37,124 @@ namespace Core {
         return (_instance);
 #endif
     }
+
+    ResourceMonitor::ResourceMonitor()
+        : _adminLock()
+        , _reactors()
+        , _sealed(false)
+    {
+        _reactors.push_back(new ResourceMonitorBase());
+    }
+
+    ResourceMonitor::~ResourceMonitor()
+    {
+        for (ResourceMonitorBase* reactor : _reactors) {
+            delete reactor;
+        }
+    }
+
+    uint32_t ResourceMonitor::Reactors(const uint8_t count)
+    {
+        uint32_t result = Core::ERROR_NONE;
+
+        ASSERT(count > 0);
+
+        _adminLock.Lock();
+
+        if (count != _reactors.size()) {
+
+            if (_sealed == true) {
+                // Resources are bound to a reactor and the reactors are used without a lock,
+                // once the first resource got registered they stay as they are.
+                result = Core::ERROR_ILLEGAL_STATE;
+            } else {
+                for (ResourceMonitorBase* reactor : _reactors) {
+                    delete reactor;
+                }
+
+                _reactors.clear();
+
+                for (uint8_t index = 0; index < count; index++) {
+                    _reactors.push_back(new ResourceMonitorBase());
+                }
+            }
+        }
+
+        _adminLock.Unlock();
+
+        return (result);
+    }
+
+    bool ResourceMonitor::IsMonitor(const ::ThreadId id) const
+    {
+        bool found = false;
+
+        for (const ResourceMonitorBase* reactor : _reactors) {
+            if ((reactor->Id() != 0) && (reactor->Id() == id)) {
+                found = true;
+                break;
+            }
+        }
+
+        return (found);
+    }
+
+    uint32_t ResourceMonitor::Runs() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* reactor : _reactors) {
+            result += reactor->Runs();
+        }
+
+        return (result);
+    }
+
+    uint32_t ResourceMonitor::Count() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* reactor : _reactors) {
+            result += reactor->Count();
+        }
+
+        return (result);
+    }
+
+    bool ResourceMonitor::Info(const uint32_t position, Metadata& info) const
+    {
+        bool found = false;
+        uint32_t offset = position;
+
+        // No _adminLock here, a reactor lock is taken below. Without resources there is nothing
+        // to report, with resources the reactors are sealed.
+        std::vector<ResourceMonitorBase*>::const_iterator index(_reactors.cbegin());
+
+        while ((found == false) && (index != _reactors.cend())) {
+            uint32_t count = (*index)->Count();
+
+            if (offset < count) {
+                found = (*index)->Info(offset, info);
+            } else {
+                offset -= count;
+            }
+            index++;
+        }
+
+        return (found);
+    }
+
+    void ResourceMonitor::Break()
+    {
+        // Reactors only have a thread to wake up once resources are registered, and by then they are sealed.
+        if (_sealed == true) {
+            for (ResourceMonitorBase* reactor : _reactors) {
+                // A reactor that never had a resource has no thread to wake up.
+                if (reactor->Id() != 0) {
+                    reactor->Break();
+                }
+            }
+        }
+    }
 }
 } // namespace WPEFramework::Core
@@ -27,6 +27,10 @@
 #include "Trace.h"
 #include "Timer.h"
 
+#if defined(__LINUX__) && !defined(__APPLE__)
+#define __RESOURCE_MONITOR_EPOLL__
+#endif
+
 namespace WPEFramework {
 
 namespace Core {
@@ -43,6 +47,21 @@ namespace Core {
 
     template <typename RESOURCE, typename WATCHDOG>
     class ResourceMonitorType {
+    public:
+        // The POLL engine rebuilds the full descriptor set on every run, the EPOLL engine
+        // keeps the descriptors registered in the kernel and only looks at the ready ones.
+        // EPOLL is only available on Linux, on other platforms the engine is ignored.
+        enum engine : uint8_t {
+            POLL,
+            EPOLL
+        };
+
+#if defined(__RESOURCE_MONITOR_EPOLL__) && !defined(RESOURCE_MONITOR_POLL)
+        static constexpr engine DefaultEngine = EPOLL;
+#else
+        static constexpr engine DefaultEngine = POLL;
+#endif
+
     private:
         static constexpr uint8_t FileDescriptorAllocation = 32;
 
@@ -86,6 +105,21 @@ namespace Core {
             Parent& _parent;
         };
 
+        struct Entry {
+            RESOURCE* resource;
+            IResource::handle descriptor;
+            uint16_t monitor;
+            uint16_t events;
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            // Registration with the epoll descriptor, 0 means not registered.
+            uint64_t cookie;
+            bool armed;
+            uint32_t run;
+#endif
+        };
+
+        typedef std::list<Entry> EntryList;
+
     public:
         struct Metadata {
             signed int descriptor;
@@ -95,7 +129,7 @@ namespace Core {
         };
 
     public:
-        ResourceMonitorType()
+        ResourceMonitorType(const engine type = DefaultEngine)
             : _monitor(nullptr)
             , _adminLock()
             , _resourceList()
@@ -108,8 +142,19 @@ namespace Core {
             , _descriptorArrayLength(FileDescriptorAllocation)
             , _descriptorArray(static_cast<struct pollfd*>(::malloc(sizeof(::pollfd) * (_descriptorArrayLength + 1))))
             , _signalDescriptor(-1)
+#endif
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            , _engine(type)
+            , _epollDescriptor(-1)
+            , _registrations()
+            , _pending()
+            , _cookie(0)
+            , _sweep(true)
 #endif
         {
+#ifndef __RESOURCE_MONITOR_EPOLL__
+            (void)type;
+#endif
         }
 
         ~ResourceMonitorType()
@@ -139,6 +184,11 @@ namespace Core {
                 ::close(_signalDescriptor);
             }
 #endif
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                ::close(_epollDescriptor);
+            }
+#endif
 #ifdef __WINDOWS__
             WSACloseEvent(_action);
 #endif
@@ -161,29 +211,30 @@ namespace Core {
         {
             return (static_cast<uint32_t>(_resourceList.size()));
         }
+        engine Engine() const
+        {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            return (_engine);
+#else
+            return (POLL);
+#endif
+        }
         bool Info (const uint32_t position, Metadata& info) const
         {
             uint32_t count = position;
 
             _adminLock.Lock();
 
-            typename std::list<RESOURCE*>::const_iterator index(_resourceList.cbegin());
+            typename EntryList::const_iterator index(_resourceList.cbegin());
             while ( (count != 0) && (index != _resourceList.cend()) ) { count--; index++; }
 
             bool found = (index != _resourceList.cend());
 
             if (found == true) {
-                info.descriptor = (*index)->Descriptor();
-                info.classname  = typeid(*(*index)).name();
-
-#ifdef __LINUX__
-                info.monitor = _descriptorArray[position + 1].events;
-                info.events  = _descriptorArray[position + 1].revents;
-#endif
-#ifdef __WINDOWS__
-                info.monitor = 0;
-                info.events  = 0;
-#endif
+                info.descriptor = index->descriptor;
+                info.classname  = (index->resource != nullptr ? typeid(*(index->resource)).name() : "<unregistered>");
+                info.monitor    = index->monitor;
+                info.events     = index->events;
             }
 
             _adminLock.Unlock();
@@ -195,9 +246,21 @@ namespace Core {
             _adminLock.Lock();
 
             // Make sure this entry does not exist, only register resources once !!!
-            ASSERT(std::find(_resourceList.begin(), _resourceList.end(), &resource) == _resourceList.end());
+            ASSERT(Find(&resource) == _resourceList.end());
+
+            Entry entry;
+            entry.resource = &resource;
+            entry.descriptor = resource.Descriptor();
+            entry.monitor = 0;
+            entry.events = 0;
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            entry.cookie = 0;
+            entry.armed = false;
+            entry.run = 0;
+            _sweep = true;
+#endif
 
-            _resourceList.push_back(&resource);
+            _resourceList.push_back(entry);
 
             if (_resourceList.size() == 1) {
                 if (_monitor == nullptr) {
@@ -219,13 +282,18 @@ namespace Core {
             _adminLock.Lock();
 
             // Make sure this entry does not exist, only register resources once !!!
-            typename std::list<RESOURCE*>::iterator index(std::find(_resourceList.begin(), _resourceList.end(), &resource));
+            typename EntryList::iterator index(Find(&resource));
 
             if (index != _resourceList.end()) {
 #ifdef __WINDOWS__
                 _resourceList.erase(index);
 #else
-                *index = nullptr;
+#ifdef __RESOURCE_MONITOR_EPOLL__
+                // The descriptor is most likely still open, take it out of the epoll
+                // set now, before the owner gets a chance to close it.
+                Deregister(*index);
+#endif
+                index->resource = nullptr;
                 Break();
 #endif
             }
@@ -252,6 +320,17 @@ namespace Core {
         };
 
     private:
+        typename EntryList::iterator Find(const RESOURCE* resource)
+        {
+            typename EntryList::iterator index(_resourceList.begin());
+
+            while ((index != _resourceList.end()) && (index->resource != resource)) {
+                index++;
+            }
+
+            return (index);
+        }
+
         HAS_MEMBER(Arm, hasArm);
 
         template <typename TYPE>
@@ -328,6 +407,28 @@ namespace Core {
             _descriptorArray[0].events = POLLIN;
             _descriptorArray[0].revents = 0;
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if ((_engine == EPOLL) && (_signalDescriptor != -1)) {
+                struct epoll_event signal;
+
+                signal.events = EPOLLIN;
+                signal.data.u64 = 0;
+
+                if ((_epollDescriptor = ::epoll_create1(EPOLL_CLOEXEC)) == -1) {
+                    TRACE_L1("Error on creating the epoll descriptor. Error %d", errno);
+                } else if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, _signalDescriptor, &signal) == -1) {
+                    TRACE_L1("Error on adding the signal descriptor to epoll. Error %d", errno);
+                    ::close(_epollDescriptor);
+                    _epollDescriptor = -1;
+                }
+
+                if (_epollDescriptor == -1) {
+                    // Epoll is not usable, but poll is always there. Fall back..
+                    _engine = POLL;
+                }
+            }
+#endif
+
             return (_signalDescriptor != -1);
         }
 #endif
@@ -335,6 +436,11 @@ namespace Core {
 #ifdef __LINUX__
         uint32_t Worker()
         {
+#ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_engine == EPOLL) {
+                return (EpollWorker());
+            }
+#endif
             uint32_t delay = 0;
 
             _monitorRuns++;
@@ -357,18 +463,20 @@ namespace Core {
             }
 
             int filledFileDescriptors = 1;
-            typename std::list<RESOURCE*>::iterator index = _resourceList.begin();
+            typename EntryList::iterator index = _resourceList.begin();
 
             // Fill in all entries required/updated..
             while (index != _resourceList.end()) {
-                RESOURCE* entry = (*index);
+                RESOURCE* entry = index->resource;
 
                 uint16_t events;
 
                 if ((entry == nullptr) || ((events = entry->Events()) == 0)) {
                     index = _resourceList.erase(index);
                 } else {
-                    _descriptorArray[filledFileDescriptors].fd = entry->Descriptor();
+                    index->descriptor = entry->Descriptor();
+                    index->monitor = events;
+                    _descriptorArray[filledFileDescriptors].fd = index->descriptor;
                     _descriptorArray[filledFileDescriptors].events = events;
                     _descriptorArray[filledFileDescriptors].revents = 0;
                     filledFileDescriptors++;
@@ -405,7 +513,9 @@ namespace Core {
                 while (fd_index < filledFileDescriptors) {
                     ASSERT(index != _resourceList.end());
 
-                    RESOURCE* entry = (*index);
+                    RESOURCE* entry = index->resource;
+
+                    index->events = _descriptorArray[fd_index].revents;
 
                     // The entry might have been removed from observing in the mean time...
                     if (entry != nullptr) {
@@ -438,11 +548,194 @@ namespace Core {
         }
 #endif
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+    private:
+        uint32_t EpollWorker()
+        {
+            uint32_t delay = 0;
+
+            _monitorRuns++;
+
+            _adminLock.Lock();
+
+            if (_sweep == true) {
+                // A Break() was issued, or resources were added, so anything could have changed.
+                // Ask every resource what it wants to be monitored on.
+                _sweep = false;
+                _pending.clear();
+
+                typename EntryList::iterator index(_resourceList.begin());
+
+                while (index != _resourceList.end()) {
+                    if (Evaluate(index) == true) {
+                        index++;
+                    } else {
+                        index = _resourceList.erase(index);
+                    }
+                }
+            } else {
+                // Only the resources that were handled in the previous run can have
+                // changed their interest, all others are still armed as they were.
+                for (typename EntryList::iterator& index : _pending) {
+                    if (Evaluate(index) == false) {
+                        _resourceList.erase(index);
+                    }
+                }
+                _pending.clear();
+            }
+
+            if (_resourceList.size() > 0) {
+                struct epoll_event eventArray[FileDescriptorAllocation];
+
+                _adminLock.Unlock();
+
+                int result = ::epoll_wait(_epollDescriptor, eventArray, FileDescriptorAllocation, -1);
+
+                _adminLock.Lock();
+
+                if (result == -1) {
+                    if (errno != EINTR) {
+                        TRACE_L1("epoll_wait failed with error <%d>", errno);
+                    }
+                } else {
+                    bool breakIssued = false;
+
+                    for (int slot = 0; slot < result; slot++) {
+                        const uint64_t cookie = eventArray[slot].data.u64;
+
+                        if (cookie == 0) {
+                            /* We have a valid signal, read the info from the fd */
+                            struct signalfd_siginfo info;
+                            uint32_t VARIABLE_IS_NOT_USED bytes = read(_signalDescriptor, &info, sizeof(info));
+                            ASSERT(bytes == sizeof(info) || bytes == 0);
+                            breakIssued = true;
+                        } else {
+                            // Resources that were unregistered while we were waiting are no longer
+                            // in the registrations, so they are dropped here.
+                            typename Registrations::iterator found(_registrations.find(cookie));
+
+                            if (found != _registrations.end()) {
+                                typename EntryList::iterator index(found->second);
+
+                                index->events = static_cast<uint16_t>(eventArray[slot].events);
+                                index->armed = false;
+                                index->run = _monitorRuns;
+                                _pending.push_back(index);
+
+                                if (index->resource != nullptr) {
+                                    ASSERT(index->resource->Descriptor() == index->descriptor);
+
+                                    Arm<WATCHDOG>();
+
+                                    index->resource->Handle(index->events);
+
+                                    Reset<WATCHDOG>();
+                                }
+                            }
+                        }
+                    }
+
+                    if (breakIssued == true) {
+                        // The poll engine hands every resource a Handle() call after a Break(), resources
+                        // rely on it (e.g. a pending write) so do the same for the ones that were not ready.
+                        typename EntryList::iterator index(_resourceList.begin());
+
+                        while (index != _resourceList.end()) {
+                            if ((index->resource != nullptr) && (index->run != _monitorRuns)) {
+                                index->events = 0;
+
+                                Arm<WATCHDOG>();
+
+                                index->resource->Handle(0);
+
+                                Reset<WATCHDOG>();
+                            }
+                            index++;
+                        }
+
+                        _sweep = true;
+                    }
+                }
+            } else {
+                _monitor->Block();
+                delay = Core::infinite;
+            }
+
+            _adminLock.Unlock();
+
+            return (delay);
+        }
+        // Synchronize the epoll registration with the interest of the resource. Returns false if
+        // the resource is no longer interested in anything and can be removed.
+        bool Evaluate(typename EntryList::iterator& index)
+        {
+            RESOURCE* entry = index->resource;
+            uint16_t events;
+
+            // Events() may have unregistered the resource itself.
+            if ((entry == nullptr) || ((events = entry->Events()) == 0) || (index->resource == nullptr)) {
+                Deregister(*index);
+                return (false);
+            }
+
+            IResource::handle descriptor = entry->Descriptor();
+
+            if ((index->cookie != 0) && (descriptor != index->descriptor)) {
+                // The resource switched descriptors, the old registration is useless.
+                Deregister(*index);
+            }
+
+            if ((index->cookie == 0) || (index->armed == false) || (index->monitor != events)) {
+                struct epoll_event interest;
+
+                // Registrations are one-shot: a descriptor that is closed by its owner while a
+                // forked child still holds a copy can not be removed from the epoll set anymore
+                // and would otherwise keep on firing for a resource that is long gone.
+                interest.events = events | EPOLLONESHOT;
+
+                if (index->cookie == 0) {
+                    interest.data.u64 = ++_cookie;
+
+                    if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, descriptor, &interest) == 0) {
+                        index->cookie = interest.data.u64;
+                        index->descriptor = descriptor;
+                        _registrations.insert(std::pair<const uint64_t, typename EntryList::iterator>(index->cookie, index));
+                    } else {
+                        TRACE_L1("epoll_ctl add of descriptor %d failed with error <%d>", descriptor, errno);
+                    }
+                } else {
+                    interest.data.u64 = index->cookie;
+
+                    if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_MOD, descriptor, &interest) != 0) {
+                        TRACE_L1("epoll_ctl modify of descriptor %d failed with error <%d>", descriptor, errno);
+                    }
+                }
+
+                index->monitor = events;
+                index->armed = true;
+            }
+
+            return (true);
+        }
+        void Deregister(Entry& entry)
+        {
+            if (entry.cookie != 0) {
+                // If the owner closed the descriptor already, the kernel dropped it from the set.
+                ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, entry.descriptor, nullptr);
+                _registrations.erase(entry.cookie);
+                entry.cookie = 0;
+                entry.armed = false;
+            }
+        }
+
+    public:
+#endif
+
 #ifdef __WINDOWS__
         uint32_t Worker()
         {
             uint32_t delay = 0;
-            typename std::list<RESOURCE*>::iterator index;
+            typename EntryList::iterator index;
 
             _monitorRuns++;
 
@@ -453,7 +746,7 @@ namespace Core {
 
             while (index != _resourceList.end()) {
 
-                RESOURCE* entry = (*index);
+                RESOURCE* entry = index->resource;
 
                 ASSERT(entry != nullptr);
 
@@ -463,8 +756,9 @@ namespace Core {
                     index = _resourceList.erase(index);
                 } else {
                     if ((events & 0x8000) != 0) {
-                        ::WSAEventSelect((*index)->Descriptor(), _action, (events & 0x7FFF));
+                        ::WSAEventSelect(entry->Descriptor(), _action, (events & 0x7FFF));
                     }
+                    index->monitor = (events & 0x7FFF);
                     index++;
                 }
             }
@@ -483,7 +777,7 @@ namespace Core {
                 ::WSAResetEvent(_action);
 
                 while (index != _resourceList.end()) {
-                    RESOURCE* entry = (*index);
+                    RESOURCE* entry = index->resource;
 
                     ASSERT(index != _resourceList.end());
                     ASSERT(entry != nullptr);
@@ -495,6 +789,8 @@ namespace Core {
 
                     uint16_t flagsSet = static_cast<uint16_t>(networkEvents.lNetworkEvents);
 
+                    index->events = flagsSet;
+
                     Arm<WATCHDOG>();
 
                     // Event if the flagsSet == 0, call handle, maybe a break was issued by this RESOURCE..
@@ -518,7 +814,7 @@ namespace Core {
     private:
         MonitorWorker* _monitor;
         mutable Core::CriticalSection _adminLock;
-        std::list<RESOURCE*> _resourceList;
+        EntryList _resourceList;
         uint32_t _monitorRuns;
         string _name;
         WATCHDOG _watchDog;
@@ -534,6 +830,16 @@ namespace Core {
 #endif
 #ifdef __APPLE__
         Core::NodeId _signalNode;
+#endif
+#ifdef __RESOURCE_MONITOR_EPOLL__
+        typedef std::unordered_map<uint64_t, typename EntryList::iterator> Registrations;
+
+        engine _engine;
+        int _epollDescriptor;
+        Registrations _registrations;
+        std::vector<typename EntryList::iterator> _pending;
+        uint64_t _cookie;
+        bool _sweep;
 #endif
     };
 
@@ -564,20 +870,81 @@ namespace Core {
     typedef ResourceMonitorType<IResource, Void> ResourceMonitorBase;
 #endif
 
-    class EXTERNAL ResourceMonitor : public ResourceMonitorBase {
+    // The ResourceMonitor runs one or more reactors, each with its own monitor thread. A
+    // resource is bound to a reactor by its address, so it sticks to the same reactor (and
+    // thread) for its whole lifetime and the owning channel sees all its callbacks in order.
+    class EXTERNAL ResourceMonitor {
     private:
-        ResourceMonitor()
-            : ResourceMonitorBase()
-        {
-        }
+        ResourceMonitor();
         ResourceMonitor(const ResourceMonitor&) = delete;
         ResourceMonitor& operator=(const ResourceMonitor&) = delete;
 
         friend class SingletonType<ResourceMonitor>;
 
     public:
+        typedef ResourceMonitorBase::Metadata Metadata;
+
         static ResourceMonitor& Instance();
-        ~ResourceMonitor() {}
+        ~ResourceMonitor();
+
+    public:
+        uint8_t Reactors() const
+        {
+            return (static_cast<uint8_t>(_reactors.size()));
+        }
+        // The number of reactors can only be changed before the first resource is registered.
+        uint32_t Reactors(const uint8_t count);
+        const TCHAR* Name() const
+        {
+            return (_reactors[0]->Name());
+        }
+        ::ThreadId Id(const uint8_t reactor = 0) const
+        {
+            ASSERT(reactor < _reactors.size());
+            return (_reactors[reactor]->Id());
+        }
+        bool IsMonitor(const ::ThreadId id) const;
+        uint32_t Runs() const;
+        uint32_t Count() const;
+        bool Info(const uint32_t position, Metadata& info) const;
+        // Called from within Handle() as well (e.g. an accepted socket being opened), with the
+        // lock of a reactor taken. So only the lock of the reactor involved may be taken here.
+        void Register(IResource& resource)
+        {
+            if (_sealed == false) {
+                // From now on the reactors are fixed, they can be used without _adminLock.
+                _adminLock.Lock();
+                _sealed = true;
+                _adminLock.Unlock();
+            }
+            Reactor(resource).Register(resource);
+        }
+        void Unregister(IResource& resource)
+        {
+            ASSERT(_sealed == true);
+            Reactor(resource).Unregister(resource);
+        }
+        // Wake up the reactor that monitors this resource, to reevaluate its state.
+        inline void Break(const IResource& resource)
+        {
+            Reactor(resource).Break();
+        }
+        // Wake up all reactors.
+        void Break();
+
+    private:
+        inline ResourceMonitorBase& Reactor(const IResource& resource) const
+        {
+            // Fibonacci hashing spreads the (aligned) addresses evenly over the reactors.
+            const uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&resource)) * 0x9E3779B97F4A7C15ULL;
+
+            return (*_reactors[_reactors.size() == 1 ? 0 : static_cast<uint32_t>(key >> 32) % _reactors.size()]);
+        }
+
+    private:
+        mutable Core::CriticalSection _adminLock;
+        std::vector<ResourceMonitorBase*> _reactors;
+        std::atomic<bool> _sealed;
     };
 }
 } // namespace WPEFramework::Core
@@ -0,0 +1,541 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RINGQUEUE_H
+#define __RINGQUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+
+#include "Module.h"
+#include "Sync.h"
+#include "Time.h"
+
+namespace WPEFramework {
+namespace Core {
+    // -------------------------------------------------------------------
+    // Bounded multi-producer/multi-consumer queue on a ring of slots,
+    // interchangeable with the QueueType. Producers and consumers only
+    // meet on the slot they are handing over (sequence numbers per slot),
+    // so there is no single administration lock and no allocation per
+    // entry. Locks and conditions are only used to park threads that have
+    // to wait (queue empty on Extract, high-water mark on Insert).
+    // A Remove leaves a revoked slot behind that is skipped by Extract.
+    // Like the QueueType, a Post never drops an entry. If the ring has no
+    // slot left, entries go to a locked overflow list until the consumers
+    // drained the ring.
+    // -------------------------------------------------------------------
+    template <typename CONTEXT>
+    class RingQueueType {
+    private:
+        enum state : uint8_t {
+            EMPTY,
+            FILLED,
+            INSPECTED,
+            REVOKED
+        };
+
+        struct Slot {
+            std::atomic<uint32_t> Sequence;
+            std::atomic<uint8_t> State;
+            CONTEXT Entry;
+        };
+
+        // Parks threads until the other side made progress. Threads register
+        // before they check the ring for the last time, so a Notify can never
+        // slip in between that check and the wait.
+        class Waiters {
+        public:
+            Waiters(const Waiters&) = delete;
+            Waiters& operator=(const Waiters&) = delete;
+
+            Waiters()
+                : _adminLock()
+                , _signal()
+                , _count(0)
+                , _epoch(0)
+            {
+            }
+            ~Waiters()
+            {
+            }
+
+        public:
+            inline uint32_t Enter()
+            {
+                _count.fetch_add(1);
+
+                // Make sure the check that follows sees any publication we would miss otherwise.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                return (_epoch.load());
+            }
+            bool Wait(const uint32_t epoch, const uint32_t waitTime)
+            {
+                bool result = true;
+
+                std::unique_lock<std::mutex> lock(_adminLock);
+
+                while ((_epoch.load() == epoch) && (result == true)) {
+                    if (waitTime == Core::infinite) {
+                        _signal.wait(lock);
+                    } else {
+                        result = (_signal.wait_for(lock, std::chrono::milliseconds(waitTime)) == std::cv_status::no_timeout);
+                    }
+                }
+
+                _count.fetch_sub(1);
+
+                return (_epoch.load() != epoch);
+            }
+            inline void Leave()
+            {
+                _count.fetch_sub(1);
+            }
+            void Notify()
+            {
+                // Make the publication visible before we look at the waiters.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (_count.load() != 0) {
+                    std::unique_lock<std::mutex> lock(_adminLock);
+
+                    _epoch.fetch_add(1);
+                    _signal.notify_all();
+                }
+            }
+
+        private:
+            std::mutex _adminLock;
+            std::condition_variable _signal;
+            std::atomic<uint32_t> _count;
+            std::atomic<uint32_t> _epoch;
+        };
+
+    public:
+        RingQueueType() = delete;
+        RingQueueType(const RingQueueType<CONTEXT>&) = delete;
+        RingQueueType<CONTEXT>& operator=(const RingQueueType<CONTEXT>&) = delete;
+
+        explicit RingQueueType(const uint32_t highWaterMark)
+            : _head(0)
+            , _tail(0)
+            , _count(0)
+            , _maxSlots(highWaterMark)
+            , _mask(Capacity(highWaterMark) - 1)
+            , _slots(new Slot[Capacity(highWaterMark)])
+            , _enabled(true)
+            , _overflowLock()
+            , _overflow()
+            , _overflowed(0)
+            , _consumers()
+            , _producers()
+        {
+            // A highwatermark of 0 is bullshit.
+            ASSERT(_maxSlots != 0);
+
+            for (uint32_t index = 0; index <= _mask; index++) {
+                _slots[index].Sequence.store(index, std::memory_order_relaxed);
+                _slots[index].State.store(EMPTY, std::memory_order_relaxed);
+            }
+
+            TRACE_L5("Constructor RingQueueType <%p>", (this));
+        }
+        ~RingQueueType()
+        {
+            TRACE_L5("Destructor RingQueueType <%p>", (this));
+
+            // Disable the queue and flush all entries.
+            Disable();
+
+            delete[] _slots;
+        }
+
+    public:
+        bool Remove(const CONTEXT& entry)
+        {
+            bool removed = false;
+
+            if (_enabled.load() == true) {
+                uint32_t position = _head.load(std::memory_order_acquire);
+                const uint32_t end = _tail.load(std::memory_order_acquire);
+
+                while ((removed == false) && (position != end)) {
+                    Slot& slot(_slots[position & _mask]);
+                    uint8_t expected = FILLED;
+
+                    // Only look at the slot if it still holds the entry for this position, it
+                    // might have been taken and filled again since we started.
+                    if (slot.Sequence.load(std::memory_order_acquire) != (position + 1)) {
+                        expected = EMPTY;
+                    } else {
+                        // Claim the slot for inspection, a consumer taking it waits for us.
+                        while ((slot.State.compare_exchange_strong(expected, INSPECTED, std::memory_order_acquire) == false) && (expected == INSPECTED)) {
+                            // Another Remove is looking at this entry.
+                            ::SleepMs(0);
+                            expected = FILLED;
+                        }
+                    }
+
+                    if (expected == FILLED) {
+                        // The slot can not be recycled while we hold it, check it did not happen before.
+                        if ((slot.Sequence.load(std::memory_order_acquire) == (position + 1)) && (slot.Entry == entry)) {
+                            slot.Entry = CONTEXT();
+                            slot.State.store(REVOKED, std::memory_order_release);
+                            removed = true;
+                        } else {
+                            slot.State.store(FILLED, std::memory_order_release);
+                        }
+                    }
+                    position++;
+                }
+
+                if ((removed == false) && (_overflowed.load() != 0)) {
+                    _overflowLock.Lock();
+
+                    typename std::list<CONTEXT>::iterator index(std::find(_overflow.begin(), _overflow.end(), entry));
+
+                    if (index != _overflow.end()) {
+                        _overflow.erase(index);
+                        _overflowed.fetch_sub(1);
+                        removed = true;
+                    }
+
+                    _overflowLock.Unlock();
+                }
+
+                if (removed == true) {
+                    _count.fetch_sub(1);
+                    _producers.Notify();
+                }
+            }
+
+            return (removed);
+        }
+
+        // Like the QueueType, a Post does not respect the high-water mark.
+        // It only fails if the queue is disabled.
+        bool Post(const CONTEXT& entry)
+        {
+            bool result = false;
+
+            if (_enabled.load() == true) {
+                _count.fetch_add(1);
+
+                Append(entry);
+
+                _consumers.Notify();
+                result = true;
+            }
+
+            return (result);
+        }
+
+        bool Insert(const CONTEXT& entry, uint32_t waitTime)
+        {
+            bool posted = false;
+
+            if (_enabled.load() == true) {
+                const uint64_t deadline = Deadline(waitTime);
+                bool triggered = true;
+
+                while ((posted == false) && (triggered == true)) {
+                    if (Reserve() == true) {
+                        Append(entry);
+
+                        posted = true;
+                        _consumers.Notify();
+                    } else {
+                        const uint32_t epoch = _producers.Enter();
+
+                        if ((_enabled.load() == true) && (IsFull() == true)) {
+                            triggered = _producers.Wait(epoch, Remaining(deadline));
+                        } else {
+                            _producers.Leave();
+                            ::SleepMs(0);
+                        }
+
+                        // If we were disabled, that is assumed to be also a timeout
+                        triggered = triggered && (_enabled.load() == true) && (Remaining(deadline) != 0);
+                    }
+                }
+            }
+
+            return (posted);
+        }
+
+        bool Extract(CONTEXT& result, uint32_t waitTime)
+        {
+            bool received = false;
+
+            if (_enabled.load() == true) {
+                const uint64_t deadline = Deadline(waitTime);
+                bool triggered = true;
+
+                while ((received == false) && (triggered == true)) {
+                    if (Pop(result) == true) {
+                        received = true;
+
+                        _count.fetch_sub(1);
+                        _producers.Notify();
+                    } else {
+                        const uint32_t epoch = _consumers.Enter();
+
+                        // Once registered as a waiter, check again so no Post can slip through.
+                        if (_enabled.load() == false) {
+                            _consumers.Leave();
+                            triggered = false;
+                        } else if (Pop(result) == true) {
+                            _consumers.Leave();
+                            received = true;
+
+                            _count.fetch_sub(1);
+                            _producers.Notify();
+                        } else {
+                            triggered = _consumers.Wait(epoch, Remaining(deadline));
+
+                            // If we were disabled, that is assumed to be also a timeout
+                            triggered = triggered && (_enabled.load() == true);
+                        }
+                    }
+                }
+            }
+
+            return (received);
+        }
+
+        void Enable()
+        {
+            _enabled.store(true);
+        }
+
+        void Disable()
+        {
+            if (_enabled.exchange(false) == true) {
+                _consumers.Notify();
+                _producers.Notify();
+            }
+        }
+
+        void Flush()
+        {
+            // Clear is only possible in a "DISABLED" state !!
+            ASSERT(_enabled.load() == false);
+
+            CONTEXT entry;
+
+            // Clear all entries !!
+            while (Pop(entry) == true) {
+                _count.fetch_sub(1);
+            }
+            entry = CONTEXT();
+        }
+
+        inline void FreeSlot() const
+        {
+            while ((_enabled.load() == true) && (IsFull() == true)) {
+                const uint32_t epoch = _producers.Enter();
+
+                if ((_enabled.load() == true) && (IsFull() == true)) {
+                    _producers.Wait(epoch, Core::infinite);
+                } else {
+                    _producers.Leave();
+                }
+            }
+        }
+        inline bool IsEmpty() const
+        {
+            return (_count.load() == 0);
+        }
+        inline bool IsFull() const
+        {
+            return (_count.load() >= _maxSlots);
+        }
+        inline uint32_t Length() const
+        {
+            return (_count.load());
+        }
+
+    private:
+        // Leave room in the ring for Posts beyond the high-water mark and
+        // revoked entries that are not yet skipped by a consumer.
+        static uint32_t Capacity(const uint32_t highWaterMark)
+        {
+            uint32_t result = 2;
+
+            while ((result < (2 * highWaterMark)) && (result < 0x80000000)) {
+                result <<= 1;
+            }
+
+            return (result);
+        }
+        static uint64_t Deadline(const uint32_t waitTime)
+        {
+            return (waitTime == Core::infinite ? ~0ULL : Core::Time::Now().Add(waitTime).Ticks());
+        }
+        static uint32_t Remaining(const uint64_t deadline)
+        {
+            uint32_t result = Core::infinite;
+
+            if (deadline != ~0ULL) {
+                const uint64_t now = Core::Time::Now().Ticks();
+
+                result = (now >= deadline ? 0 : static_cast<uint32_t>((deadline - now) / Core::Time::TicksPerMillisecond));
+            }
+
+            return (result);
+        }
+        bool Reserve()
+        {
+            uint32_t count = _count.load();
+
+            do {
+                if (count >= _maxSlots) {
+                    return (false);
+                }
+            } while (_count.compare_exchange_weak(count, count + 1) == false);
+
+            return (true);
+        }
+        void Append(const CONTEXT& entry)
+        {
+            // As long as there is an overflow, new entries go after it, to keep them in order.
+            if ((_overflowed.load() != 0) || (Push(entry) == false)) {
+                _overflowLock.Lock();
+
+                _overflow.push_back(entry);
+                _overflowed.fetch_add(1);
+
+                _overflowLock.Unlock();
+            }
+        }
+        bool Push(const CONTEXT& entry)
+        {
+            uint32_t position = _tail.load(std::memory_order_relaxed);
+
+            while (true) {
+                Slot& slot(_slots[position & _mask]);
+                const int32_t difference = static_cast<int32_t>(slot.Sequence.load(std::memory_order_acquire) - position);
+
+                if (difference == 0) {
+                    if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                        slot.Entry = entry;
+                        slot.State.store(FILLED, std::memory_order_release);
+                        slot.Sequence.store(position + 1, std::memory_order_release);
+                        return (true);
+                    }
+                } else if (difference < 0) {
+                    // The ring is full.
+                    return (false);
+                } else {
+                    position = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        bool Pop(CONTEXT& result)
+        {
+            uint32_t position = _head.load(std::memory_order_relaxed);
+
+            while (true) {
+                Slot& slot(_slots[position & _mask]);
+                const int32_t difference = static_cast<int32_t>(slot.Sequence.load(std::memory_order_acquire) - (position + 1));
+
+                if (difference == 0) {
+                    if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                        bool taken = Take(slot, result);
+
+                        slot.State.store(EMPTY, std::memory_order_relaxed);
+                        slot.Sequence.store(position + _mask + 1, std::memory_order_release);
+
+                        if (taken == true) {
+                            return (true);
+                        }
+
+                        // It was revoked, move on to the next one.
+                        position = _head.load(std::memory_order_relaxed);
+                    }
+                } else if (difference < 0) {
+                    // The ring is empty, the overflow (if any) holds the entries that came after it.
+                    return (PopOverflow(result));
+                } else {
+                    position = _head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        bool PopOverflow(CONTEXT& result)
+        {
+            bool taken = false;
+
+            if (_overflowed.load() != 0) {
+                _overflowLock.Lock();
+
+                if (_overflow.empty() == false) {
+                    result = _overflow.front();
+                    _overflow.pop_front();
+                    _overflowed.fetch_sub(1);
+                    taken = true;
+                }
+
+                _overflowLock.Unlock();
+            }
+
+            return (taken);
+        }
+        bool Take(Slot& slot, CONTEXT& result)
+        {
+            uint8_t expected = FILLED;
+
+            while (slot.State.compare_exchange_weak(expected, EMPTY, std::memory_order_acquire) == false) {
+                if (expected == REVOKED) {
+                    return (false);
+                } else if (expected == INSPECTED) {
+                    // A Remove is looking at this entry, it will be done shortly.
+                    ::SleepMs(0);
+                }
+                expected = FILLED;
+            }
+
+            result = slot.Entry;
+            slot.Entry = CONTEXT();
+
+            return (true);
+        }
+
+    private:
+        std::atomic<uint32_t> _head;
+        uint8_t _headPadding[64 - sizeof(std::atomic<uint32_t>)];
+        std::atomic<uint32_t> _tail;
+        uint8_t _tailPadding[64 - sizeof(std::atomic<uint32_t>)];
+        std::atomic<uint32_t> _count;
+        const uint32_t _maxSlots;
+        const uint32_t _mask;
+        Slot* _slots;
+        std::atomic<bool> _enabled;
+        Core::CriticalSection _overflowLock;
+        std::list<CONTEXT> _overflow;
+        std::atomic<uint32_t> _overflowed;
+        mutable Waiters _consumers;
+        mutable Waiters _producers;
+    };
+}
+} // namespace Core
+
+#endif // __RINGQUEUE_H
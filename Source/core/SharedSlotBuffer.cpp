@@ -0,0 +1,265 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SharedSlotBuffer.h"
+
+#ifdef __LINUX__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <climits>
+#endif
+
+namespace WPEFramework {
+
+namespace Core {
+
+    static constexpr uint32_t Spins = 128;
+
+    static constexpr uint32_t MaxSlots = 0x8000;
+
+    static uint32_t CacheLineAlign(const uint32_t size)
+    {
+        return ((size + 63) & ~static_cast<uint32_t>(63));
+    }
+
+    // The next power of two, as the slots are indexed with a mask.
+    static uint32_t SlotCount(const uint16_t slots)
+    {
+        uint32_t result = 1;
+
+        while ((result < slots) && (result < MaxSlots)) {
+            result <<= 1;
+        }
+
+        return (result);
+    }
+
+    SharedSlotBuffer::SharedSlotBuffer(const TCHAR name[])
+        : DataElementFile(name, File::USER_READ | File::USER_WRITE | File::SHAREABLE, 0)
+        , _administration(nullptr)
+        , _slots(nullptr)
+    {
+        if ((DataElementFile::IsValid() == true) && (DataElementFile::Size() >= sizeof(Administration))) {
+            const Administration* administration = reinterpret_cast<const Administration*>(DataElementFile::Buffer());
+            const uint32_t slots = administration->_slots;
+            const uint32_t administrationSize = administration->_administrationSize;
+
+            // Do not trust what we find, the slots must be what the producer would have made.
+            if ((slots != 0) && (slots <= MaxSlots) && ((slots & (slots - 1)) == 0)
+                && (administrationSize == CacheLineAlign(administrationSize))
+                && (administration->_stride == (SlotHeaderSize + static_cast<uint64_t>(administrationSize) + CacheLineAlign(administration->_slotSize)))
+                && ((sizeof(Administration) + (static_cast<uint64_t>(slots) * administration->_stride)) <= DataElementFile::Size())) {
+                _administration = reinterpret_cast<Administration*>(DataElementFile::Buffer());
+                _slots = &(DataElementFile::Buffer()[sizeof(Administration)]);
+            } else {
+                TRACE_L1("Shared memory [%s] is not set up as slots.", name);
+            }
+        }
+    }
+
+    SharedSlotBuffer::SharedSlotBuffer(const TCHAR name[], const uint32_t mode, const uint16_t slots, const uint32_t slotSize, const uint16_t administrationSize)
+        : DataElementFile(name, mode | File::SHAREABLE | File::CREATE, sizeof(Administration) + (SlotCount(slots) * (SlotHeaderSize + CacheLineAlign(administrationSize) + CacheLineAlign(slotSize))))
+        , _administration(nullptr)
+        , _slots(nullptr)
+    {
+        ASSERT(slots > 0);
+        ASSERT((slots & (slots - 1)) == 0);
+        ASSERT(slots <= MaxSlots);
+        ASSERT(DataElementFile::IsValid() == true);
+
+        if (DataElementFile::IsValid() == true) {
+            _administration = reinterpret_cast<Administration*>(DataElementFile::Buffer());
+            _slots = &(DataElementFile::Buffer()[sizeof(Administration)]);
+
+            ::memset(static_cast<void*>(_administration), 0, sizeof(Administration));
+
+            _administration->_slots = SlotCount(slots);
+            _administration->_slotSize = slotSize;
+            _administration->_administrationSize = CacheLineAlign(administrationSize);
+            _administration->_stride = SlotHeaderSize + CacheLineAlign(administrationSize) + CacheLineAlign(slotSize);
+
+            std::atomic_init(&(_administration->_produced._value), static_cast<uint32_t>(0));
+            std::atomic_init(&(_administration->_produced._sleepers), static_cast<uint32_t>(0));
+            std::atomic_init(&(_administration->_consumed._value), static_cast<uint32_t>(0));
+            std::atomic_init(&(_administration->_consumed._sleepers), static_cast<uint32_t>(0));
+            std::atomic_init(&(_administration->_released._value), static_cast<uint32_t>(0));
+            std::atomic_init(&(_administration->_released._sleepers), static_cast<uint32_t>(0));
+        }
+    }
+
+    SharedSlotBuffer::~SharedSlotBuffer()
+    {
+    }
+
+    uint32_t SharedSlotBuffer::RequestProduce(const uint32_t waitTime, uint16_t& slot)
+    {
+        const uint32_t produced = _administration->_produced._value.load(std::memory_order_relaxed);
+
+        // All slots are taken as long as the oldest one is not released.
+        uint32_t result = Wait(_administration->_released, produced - _administration->_slots, waitTime);
+
+        if (result == Core::ERROR_NONE) {
+            slot = Index(produced);
+        }
+
+        return (result);
+    }
+
+    uint32_t SharedSlotBuffer::Produced(const uint16_t slot)
+    {
+        const uint32_t produced = _administration->_produced._value.load(std::memory_order_relaxed);
+
+        ASSERT(slot == Index(produced));
+        DEBUG_VARIABLE(slot);
+
+        Signal(_administration->_produced, produced + 1);
+
+        return (Core::ERROR_NONE);
+    }
+
+    uint32_t SharedSlotBuffer::RequestConsume(const uint32_t waitTime, uint16_t& slot)
+    {
+        const uint32_t consumed = _administration->_consumed._value.load(std::memory_order_relaxed);
+
+        uint32_t result = Wait(_administration->_produced, consumed, waitTime);
+
+        if (result == Core::ERROR_NONE) {
+            slot = Index(consumed);
+        }
+
+        return (result);
+    }
+
+    uint32_t SharedSlotBuffer::Consumed(const uint16_t slot)
+    {
+        const uint32_t consumed = _administration->_consumed._value.load(std::memory_order_relaxed);
+
+        ASSERT(slot == Index(consumed));
+        DEBUG_VARIABLE(slot);
+
+        Signal(_administration->_consumed, consumed + 1);
+
+        return (Core::ERROR_NONE);
+    }
+
+    uint32_t SharedSlotBuffer::RequestResult(const uint32_t waitTime, uint16_t& slot)
+    {
+        const uint32_t released = _administration->_released._value.load(std::memory_order_relaxed);
+
+        uint32_t result = Wait(_administration->_consumed, released, waitTime);
+
+        if (result == Core::ERROR_NONE) {
+            slot = Index(released);
+        }
+
+        return (result);
+    }
+
+    uint32_t SharedSlotBuffer::Released(const uint16_t slot)
+    {
+        const uint32_t released = _administration->_released._value.load(std::memory_order_relaxed);
+
+        ASSERT(slot == Index(released));
+        DEBUG_VARIABLE(slot);
+
+        Signal(_administration->_released, released + 1);
+
+        return (Core::ERROR_NONE);
+    }
+
+    /* static */ uint32_t SharedSlotBuffer::Wait(Counter& counter, const uint32_t value, const uint32_t waitTime)
+    {
+        uint32_t result = Core::ERROR_NONE;
+        uint32_t spin = 0;
+
+        // The other side is most likely busy with it, try a while before going to sleep.
+        while ((counter._value.load(std::memory_order_acquire) == value) && (spin < Spins)) {
+            spin++;
+        }
+
+        if (spin == Spins) {
+#ifdef __LINUX__
+            struct timespec deadline;
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += (waitTime / 1000);
+            deadline.tv_nsec += ((waitTime % 1000) * 1000 * 1000);
+            deadline.tv_sec += (deadline.tv_nsec / 1000000000);
+            deadline.tv_nsec %= 1000000000;
+
+            // The sleepers count makes Signal wake us, it has to be up before we look again.
+            counter._sleepers.fetch_add(1);
+
+            while ((result == Core::ERROR_NONE) && (counter._value.load() == value)) {
+                struct timespec* timeout = nullptr;
+                struct timespec left;
+
+                if (waitTime != Core::infinite) {
+                    struct timespec now;
+                    clock_gettime(CLOCK_MONOTONIC, &now);
+
+                    int64_t nanoSeconds = ((static_cast<int64_t>(deadline.tv_sec) - now.tv_sec) * 1000000000) + (deadline.tv_nsec - now.tv_nsec);
+
+                    if (nanoSeconds <= 0) {
+                        result = Core::ERROR_TIMEDOUT;
+                        break;
+                    }
+
+                    left.tv_sec = static_cast<time_t>(nanoSeconds / 1000000000);
+                    left.tv_nsec = static_cast<long>(nanoSeconds % 1000000000);
+                    timeout = &left;
+                }
+
+                // Not private, the counter is shared with another process.
+                if ((::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&(counter._value)), FUTEX_WAIT, value, timeout, nullptr, 0) != 0) && (errno == ETIMEDOUT)) {
+                    result = Core::ERROR_TIMEDOUT;
+                }
+            }
+
+            counter._sleepers.fetch_sub(1);
+#else
+            uint32_t timeLeft = waitTime;
+
+            while ((counter._value.load() == value) && (result == Core::ERROR_NONE)) {
+                if (timeLeft == 0) {
+                    result = Core::ERROR_TIMEDOUT;
+                } else {
+                    ::SleepMs(1);
+                    if (timeLeft != Core::infinite) {
+                        timeLeft--;
+                    }
+                }
+            }
+#endif
+        }
+
+        return (result);
+    }
+
+    /* static */ void SharedSlotBuffer::Signal(Counter& counter, const uint32_t value)
+    {
+        counter._value.store(value);
+
+#ifdef __LINUX__
+        if (counter._sleepers.load() != 0) {
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&(counter._value)), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        }
+#endif
+    }
+}
+} // namespace WPEFramework::Core
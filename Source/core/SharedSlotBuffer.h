@@ -0,0 +1,171 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SHARED_SLOT_BUFFER_H
+#define __SHARED_SLOT_BUFFER_H
+
+// ---- Include local include files ----
+#include "DataElementFile.h"
+#include "Module.h"
+
+// ---- Referenced classes and types ----
+
+// ---- Helper types and constants ----
+
+namespace WPEFramework {
+
+namespace Core {
+    // Rationale:
+    // The SharedBuffer hands one buffer back and forth between a producer and a consumer process,
+    // so a request and its answer are strictly one after the other. This one has a number of
+    // slots, so the producer can queue the next requests while the consumer still works on the
+    // previous ones, and pick up the answers, in order, when they are there.
+    // A slot goes round: the producer fills it (RequestProduce/Produced), the consumer handles it
+    // (RequestConsume/Consumed) and the producer takes the answer out of it (RequestResult/Released),
+    // after which it can be filled again. Each of these steps is done by one thread at a time, the
+    // filling and the taking out of the answers can be done from different threads.
+    // Each of the steps moves a counter in the shared memory forward. Waiting for one to move, is
+    // a short spin, followed by a futex wait on it. Nothing is signalled if nobody waits.
+    // Next to the buffer, each slot has an administration area of its own, to pass the details
+    // of the request and the answer, like the SharedBuffer has one.
+    // The number of slots is a power of two, so the counters map on the slots with a mask, also
+    // when they wrap. The consumer does not take what it finds in the file for granted, if it is
+    // not what a producer would have set up, the buffer is not valid.
+    class EXTERNAL SharedSlotBuffer : public DataElementFile {
+    private:
+        SharedSlotBuffer() = delete;
+        SharedSlotBuffer(const SharedSlotBuffer&) = delete;
+        SharedSlotBuffer& operator=(const SharedSlotBuffer&) = delete;
+
+    private:
+        // Each on a cache line of its own, they are written from different sides.
+        struct Counter {
+            std::atomic<uint32_t> _value;
+            std::atomic<uint32_t> _sleepers;
+            uint8_t _padding[56];
+        };
+        struct Administration {
+            uint32_t _slots;
+            uint32_t _slotSize;
+            uint32_t _administrationSize;
+            uint32_t _stride;
+            uint8_t _padding[48];
+
+            Counter _produced;
+            Counter _consumed;
+            Counter _released;
+        };
+        struct Slot {
+            uint32_t _length;
+        };
+
+        static constexpr uint32_t SlotHeaderSize = 64;
+
+    public:
+        // This is the consumer constructor. It should always take place, after, the producer
+        // construct.
+        SharedSlotBuffer(const TCHAR name[]);
+
+        // This is the Producer constructor, it sets up the slots, all of them free.
+        SharedSlotBuffer(const TCHAR name[], const uint32_t mode, const uint16_t slots, const uint32_t slotSize, const uint16_t administrationSize);
+
+        ~SharedSlotBuffer() override;
+
+    public:
+        inline bool IsValid() const
+        {
+            return (_administration != nullptr);
+        }
+        inline uint16_t Slots() const
+        {
+            return (static_cast<uint16_t>(_administration->_slots));
+        }
+        inline uint32_t SlotSize() const
+        {
+            return (_administration->_slotSize);
+        }
+        inline uint8_t* Buffer(const uint16_t slot)
+        {
+            return (&(Entry(slot)[SlotHeaderSize + _administration->_administrationSize]));
+        }
+        inline const uint8_t* Buffer(const uint16_t slot) const
+        {
+            return (&(Entry(slot)[SlotHeaderSize + _administration->_administrationSize]));
+        }
+        inline uint8_t* AdministrationBuffer(const uint16_t slot)
+        {
+            return (&(Entry(slot)[SlotHeaderSize]));
+        }
+        inline const uint8_t* AdministrationBuffer(const uint16_t slot) const
+        {
+            return (&(Entry(slot)[SlotHeaderSize]));
+        }
+        // The number of bytes in the buffer of the slot that are used, set by the one filling it.
+        inline uint32_t Length(const uint16_t slot) const
+        {
+            return (reinterpret_cast<const Slot*>(Entry(slot))->_length);
+        }
+        inline void Length(const uint16_t slot, const uint32_t length)
+        {
+            ASSERT(length <= _administration->_slotSize);
+
+            reinterpret_cast<Slot*>(Entry(slot))->_length = length;
+        }
+        // The number of slots that are not free.
+        inline uint16_t Pending() const
+        {
+            return (static_cast<uint16_t>(_administration->_produced._value.load() - _administration->_released._value.load()));
+        }
+
+        // Producer: a free slot to fill.
+        uint32_t RequestProduce(const uint32_t waitTime, uint16_t& slot);
+        uint32_t Produced(const uint16_t slot);
+
+        // Consumer: the next slot that is filled.
+        uint32_t RequestConsume(const uint32_t waitTime, uint16_t& slot);
+        uint32_t Consumed(const uint16_t slot);
+
+        // Producer: the next slot that the consumer handed back, and done with it.
+        uint32_t RequestResult(const uint32_t waitTime, uint16_t& slot);
+        uint32_t Released(const uint16_t slot);
+
+    private:
+        inline uint8_t* Entry(const uint16_t slot) const
+        {
+            ASSERT(slot < _administration->_slots);
+
+            return (&(_slots[slot * _administration->_stride]));
+        }
+        inline uint16_t Index(const uint32_t counter) const
+        {
+            return (static_cast<uint16_t>(counter & (_administration->_slots - 1)));
+        }
+
+        // Waits until the counter is no longer at value.
+        static uint32_t Wait(Counter& counter, const uint32_t value, const uint32_t waitTime);
+        static void Signal(Counter& counter, const uint32_t value);
+
+    private:
+        Administration* _administration;
+        uint8_t* _slots;
+    };
+}
+} // namespace WPEFramework::Core
+
+#endif // __SHARED_SLOT_BUFFER_H
@@ -44,6 +44,7 @@
 #include <execinfo.h>
 #include <signal.h>
 #include <sys/ioctl.h>
+#include <sys/sendfile.h>
 #include <sys/signalfd.h>
 #endif
 
@@ -195,6 +196,9 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_TransferFile(-1)
+        , m_TransferOffset(0)
+        , m_TransferLength(0)
     {
         TRACE_L5("Constructor SocketPort (NodeId&) <%p>", (this));
     }
@@ -216,6 +220,9 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_TransferFile(-1)
+        , m_TransferOffset(0)
+        , m_TransferLength(0)
     {
         NodeId::SocketInfo localAddress;
         socklen_t localSize = sizeof(localAddress);
@@ -306,6 +313,7 @@ namespace Core {
         m_ReadBytes = 0;
         m_SendBytes = 0;
         m_SendOffset = 0;
+        m_TransferLength = 0;
 
         if ((m_State & (SocketPort::LINK | SocketPort::OPEN | SocketPort::MONITOR)) == (SocketPort::LINK | SocketPort::OPEN)) {
             // Open up an accepted socket, but not yet added to the monitor.
@@ -414,7 +422,7 @@ namespace Core {
 #endif
                 }
 
-                ResourceMonitor::Instance().Break();
+                ResourceMonitor::Instance().Break(*this);
             }
 
             if (waitTime > 0) {
@@ -426,7 +434,7 @@ namespace Core {
 
                     // We probably did not get a response from the otherside on the close
                     // sloppy but let's forcefully close it
-                    ResourceMonitor::Instance().Break();
+                    ResourceMonitor::Instance().Break(*this);
 
                     closed = (WaitForClosure(Core::infinite) == Core::ERROR_NONE);
 
@@ -447,7 +455,7 @@ namespace Core {
         if ((m_State & (SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) {
 
             m_State |= SocketPort::WRITESLOT;
-            ResourceMonitor::Instance().Break();
+            ResourceMonitor::Instance().Break(*this);
         }
         m_syncAdmin.Unlock();
     }
@@ -617,7 +625,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsOpen() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsMonitor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -652,7 +660,7 @@ namespace Core {
                 break;
             }
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsMonitor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -681,7 +689,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsClosed() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(ResourceMonitor::Instance().IsMonitor(Core::Thread::ThreadId()) == false);
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -806,6 +814,48 @@ namespace Core {
         return (::send(m_Socket, reinterpret_cast<const char*>(buffer), length, 0));
     }
 
+    /* virtual */ bool SocketPort::Transfer(const IResource::handle file, const uint32_t offset, const uint32_t length)
+    {
+        bool result = false;
+
+#ifdef __LINUX__
+        m_syncAdmin.Lock();
+
+        if ((m_SocketType == SocketPort::STREAM) && ((m_State & SocketPort::LINK) != 0) && (m_TransferLength == 0) && (file != -1) && (length > 0)) {
+            m_TransferFile = file;
+            m_TransferOffset = offset;
+            m_TransferLength = length;
+            result = true;
+        }
+
+        m_syncAdmin.Unlock();
+#else
+        DEBUG_VARIABLE(file);
+        DEBUG_VARIABLE(offset);
+        DEBUG_VARIABLE(length);
+#endif
+
+        return (result);
+    }
+
+    int32_t SocketPort::SendFile()
+    {
+        int32_t result = -1;
+
+#ifdef __LINUX__
+        // The socket is sized to the send buffer (BufferAlignment), so hand it no more than that at
+        // once. A bigger piece goes out as one large segment the socket can not take another one
+        // behind, and the peer is in no hurry to acknowledge a single segment, which stalls the
+        // connection on the delayed ACK timer for every piece.
+        off_t offset = m_TransferOffset;
+        result = static_cast<int32_t>(::sendfile(m_Socket, m_TransferFile, &offset, std::min(m_TransferLength, static_cast<uint32_t>(m_SendBufferSize))));
+#else
+        ASSERT(false);
+#endif
+
+        return (result);
+    }
+
     void SocketPort::Write()
     {
         bool dataLeftToSend = true;
@@ -815,44 +865,62 @@ namespace Core {
         m_State &= (~(SocketPort::WRITE | SocketPort::WRITESLOT));
 
         while (((m_State & (SocketPort::WRITE | SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) && (dataLeftToSend == true)) {
-            if (m_SendOffset == m_SendBytes) {
-                m_SendBytes = SendData(m_SendBuffer, m_SendBufferSize);
-                m_SendOffset = 0;
-                dataLeftToSend = (m_SendOffset != m_SendBytes);
+            int32_t sendSize = 0;
+
+            if ((m_SendOffset == m_SendBytes) && (m_TransferLength != 0)) {
+                // The send buffer is out, now the file that was handed over by the last SendData.
+                sendSize = SendFile();
+
+                if (sendSize > 0) {
+                    m_TransferOffset += sendSize;
+                    m_TransferLength -= sendSize;
+                } else if (sendSize == 0) {
+                    // The file is shorter than announced, the other side would wait for the rest forever.
+                    TRACE_L1("Transfer of a file ended %u bytes early", m_TransferLength);
+                    m_TransferLength = 0;
+                    m_State |= SocketPort::EXCEPTION;
+                    StateChange();
+                }
+            } else {
+                if (m_SendOffset == m_SendBytes) {
+                    m_SendBytes = SendData(m_SendBuffer, m_SendBufferSize);
+                    m_SendOffset = 0;
+                    dataLeftToSend = ((m_SendOffset != m_SendBytes) || (m_TransferLength != 0));
 
-                ASSERT(m_SendBytes <= m_SendBufferSize);
-            }
+                    ASSERT(m_SendBytes <= m_SendBufferSize);
+                }
 
-            if (dataLeftToSend == true) {
-                int32_t sendSize;
+                if (m_SendOffset != m_SendBytes) {
+                    // Sockets are non blocking the Send buffer size is equal to the buffer size. We only send
+                    // if the buffer free (SEND flag) is active, so the buffer should always fit.
+                    if (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true)) {
+                        ASSERT(m_RemoteNode.IsValid() == true);
 
-                // Sockets are non blocking the Send buffer size is equal to the buffer size. We only send
-                // if the buffer free (SEND flag) is active, so the buffer should always fit.
-                if (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true)) {
-                    ASSERT(m_RemoteNode.IsValid() == true);
+                        sendSize = ::sendto(m_Socket,
+                            reinterpret_cast<const char*>(&(m_SendBuffer[m_SendOffset])),
+                            m_SendBytes - m_SendOffset, 0,
+                            static_cast<const NodeId&>(m_RemoteNode),
+                            m_RemoteNode.Size());
 
-                    sendSize = ::sendto(m_Socket,
-                        reinterpret_cast<const char*>(&(m_SendBuffer[m_SendOffset])),
-                        m_SendBytes - m_SendOffset, 0,
-                        static_cast<const NodeId&>(m_RemoteNode),
-                        m_RemoteNode.Size());
+                    } else {
+                        sendSize = Write(&(m_SendBuffer[m_SendOffset]), m_SendBytes - m_SendOffset);
+                    }
 
-                } else {
-                    sendSize = Write(&(m_SendBuffer[m_SendOffset]), m_SendBytes - m_SendOffset);
+                    if (sendSize >= 0) {
+                        m_SendOffset = ((m_State & SocketPort::LINK) != 0 ? m_SendOffset + sendSize : m_SendBytes);
+                    }
                 }
+            }
 
-                if (sendSize >= 0) {
-                    m_SendOffset = ((m_State & SocketPort::LINK) != 0 ? m_SendOffset + sendSize : m_SendBytes);
-                } else {
-                    uint32_t l_Result = __ERRORRESULT__;
+            if (sendSize < 0) {
+                uint32_t l_Result = __ERRORRESULT__;
 
-                    if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__)) {
-                        m_State |= SocketPort::WRITE;
-                    } else {
-                        printf("Write exception %d: %s\n", l_Result, strerror(__ERRORRESULT__));
-                        m_State |= SocketPort::EXCEPTION;
-                        StateChange();
-                    }
+                if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__)) {
+                    m_State |= SocketPort::WRITE;
+                } else {
+                    printf("Write exception %d: %s\n", l_Result, strerror(__ERRORRESULT__));
+                    m_State |= SocketPort::EXCEPTION;
+                    StateChange();
                 }
             }
         }
@@ -937,6 +1005,7 @@ namespace Core {
         // Turn them all off, except for the SHUTDOWN bit, to show whether this was
         // done on our request, or closed from the other side...
         m_State &= SHUTDOWN;
+        m_TransferLength = 0;
 
         StateChange();
 
@@ -187,6 +187,7 @@ namespace Core {
             m_ReadBytes = 0;
             m_SendBytes = 0;
             m_SendOffset = 0;
+            m_TransferLength = 0;
             m_syncAdmin.Unlock();
         }
 
@@ -207,6 +208,13 @@ namespace Core {
         uint32_t Close(const uint32_t waitTime);
         void Trigger();
 
+        // Only to be called from SendData: once the bytes in the send buffer are out, send length
+        // bytes of the file, starting at offset, straight from the page cache (sendfile) instead
+        // of copying them through SendData. The file must stay open until SendData is called again.
+        // Returns false if this socket can not do that (not a connected stream, a port that
+        // transforms what it writes, or not Linux), the caller should copy the data then.
+        virtual bool Transfer(const IResource::handle file, const uint32_t offset, const uint32_t length);
+
         // Methods to extract and insert data into the socket buffers
         virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
         virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
@@ -244,6 +252,7 @@ namespace Core {
         void Accepted();
         void Read();
         void Write();
+        int32_t SendFile();
         void BufferAlignment(SOCKET socket);
         SOCKET ConstructSocket(NodeId& localNode, const string& interfaceName);
         uint32_t WaitForOpen(const uint32_t time) const;
@@ -265,6 +274,9 @@ namespace Core {
         uint16_t m_ReadBytes;
         uint16_t m_SendBytes;
         uint16_t m_SendOffset;
+        IResource::handle m_TransferFile;
+        uint32_t m_TransferOffset;
+        uint32_t m_TransferLength;
     };
 
     class EXTERNAL SocketStream : public SocketPort {
@@ -89,17 +89,21 @@ namespace Core {
 
         private:
             inline uint16_t Serialize(const Core::ProxyType<Core::JSON::IElement>& source, uint8_t* stream, const uint16_t length) const {
-                return(source->Serialize(reinterpret_cast<char*>(stream), length, _offset));
+                return(static_cast<uint16_t>(source->Serialize(reinterpret_cast<char*>(stream), length, _offset)));
             }
             inline uint16_t Serialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, uint8_t* stream, const uint16_t length) const {
-                return(source->Serialize(stream, length, _offset));
+                uint16_t offset = static_cast<uint16_t>(_offset);
+                uint16_t loaded = source->Serialize(stream, length, offset);
+                _offset = offset;
+                return (loaded);
             }
             
         private:
             ParentClass& _parent;
             mutable Core::CriticalSection _adminLock;
             mutable Core::ProxyList<INTERFACE> _sendQueue;
-            mutable uint16_t _offset;
+            // Progress in the element being sent, 32 bits as a JSON text may exceed 64KB.
+            mutable uint32_t _offset;
         };
         class DeserializerImpl {
         public:
@@ -152,17 +156,20 @@ namespace Core {
 
         private:
             inline uint16_t Deserialize(const Core::ProxyType<Core::JSON::IElement>& source, const uint8_t* stream, const uint16_t length) {
-                return(source->Deserialize(reinterpret_cast<const char*>(stream), length, _offset));
+                return(static_cast<uint16_t>(source->Deserialize(reinterpret_cast<const char*>(stream), length, _offset)));
             }
             inline uint16_t Deserialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, const uint8_t* stream, const uint16_t length) {
-                return (source->Deserialize(stream, length, _offset));
+                uint16_t offset = static_cast<uint16_t>(_offset);
+                uint16_t loaded = source->Deserialize(stream, length, offset);
+                _offset = offset;
+                return (loaded);
             }
 
         private:
             ParentClass& _parent;
             ALLOCATOR _factory;
             Core::ProxyType<INTERFACE> _current;
-            uint16_t _offset;
+            uint32_t _offset;
         };
 
         class HandlerType : public SOURCE {
@@ -38,6 +38,8 @@
 #include "ProcessInfo.h"
 #include "Trace.h"
 
+#include <thread>
+
 #ifdef CRITICAL_SECTION_LOCK_LOG
 #include "Thread.h"
 #endif
@@ -252,6 +254,66 @@ namespace Core {
 #endif
     }
 
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    // AdaptiveCriticalSection class
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+
+    AdaptiveCriticalSection::AdaptiveCriticalSection(const uint16_t maxSpins)
+        : CriticalSection()
+        , _maxSpins(SpinLimit(maxSpins))
+        , _spins(_maxSpins / 10)
+        , _acquired(0)
+        , _spun(0)
+        , _parked(0)
+    {
+    }
+
+    AdaptiveCriticalSection::~AdaptiveCriticalSection()
+    {
+    }
+
+    /* static */ uint16_t AdaptiveCriticalSection::SpinLimit(const uint16_t maxSpins)
+    {
+        static const bool singleCore = (std::thread::hardware_concurrency() == 1);
+
+        return (singleCore == true ? 0 : maxSpins);
+    }
+
+    void AdaptiveCriticalSection::Wait()
+    {
+        // Spin twice as long as it took on average, so a holder that is a bit slower than usual
+        // is still waited for, but one that takes much longer does not keep us spinning.
+        const uint16_t average = _spins.load(std::memory_order_relaxed);
+        const uint32_t limit = std::min(static_cast<uint32_t>(_maxSpins), (static_cast<uint32_t>(average) * 2) + 10);
+        uint32_t spin = 0;
+        bool acquired = false;
+
+        if (_maxSpins > 0) {
+            while ((acquired == false) && (spin < limit)) {
+                Pause();
+                spin++;
+                acquired = Acquire();
+            }
+        }
+
+        if (acquired == false) {
+            CriticalSection::Lock();
+
+            _parked.store(_parked.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            _spun.store(_spun.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        // Only the owner gets here, so there is no other writer. Sleeping moves it towards the
+        // limit, so the next time spins longer, up to the point it does not help anymore.
+        if (_maxSpins > 0) {
+            const int32_t delta = static_cast<int32_t>(acquired == true ? spin : limit) - average;
+            _spins.store(static_cast<uint16_t>(average + (delta / 8)), std::memory_order_relaxed);
+        }
+    }
+
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
     // BinairySemaphore class
@@ -101,6 +101,106 @@ namespace Core {
 #endif
     };
 
+    // ===========================================================================
+    // class AdaptiveCriticalSection
+    // ===========================================================================
+
+    // A CriticalSection (so recursive as well) that, if it is taken, first spins a while before
+    // the thread is put to sleep. Most locks are held for a short time only, so the sleep and the
+    // wake up cost more than the wait itself. How long it spins follows how long it took to get
+    // the lock spinning the previous times, up to MaxSpins. On a single core there is no point, the
+    // one holding the lock can not run while we spin, so it sleeps right away.
+    // It counts how often it was taken and how it went, to find the locks that are fought over.
+    class EXTERNAL AdaptiveCriticalSection : public CriticalSection {
+    private:
+        AdaptiveCriticalSection(const AdaptiveCriticalSection&) = delete;
+        AdaptiveCriticalSection& operator=(const AdaptiveCriticalSection&) = delete;
+
+    public:
+        static constexpr uint16_t MaxSpins = 1000;
+
+    public: // Methods
+        AdaptiveCriticalSection(const uint16_t maxSpins = MaxSpins);
+        ~AdaptiveCriticalSection();
+
+        inline void Lock()
+        {
+            if (Acquire() == false) {
+                Wait();
+            }
+
+            // We own the lock, nobody else writes the counters.
+            _acquired.store(_acquired.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        inline void Unlock()
+        {
+            CriticalSection::Unlock();
+        }
+
+        // Debug: how often the lock was taken, how often it was taken already, and of those how
+        // often spinning was enough or the thread had to sleep. Close, not exact, if read while
+        // the lock is in use.
+        inline uint64_t Acquired() const
+        {
+            return (_acquired.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Contended() const
+        {
+            return (_spun.load(std::memory_order_relaxed) + _parked.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Spun() const
+        {
+            return (_spun.load(std::memory_order_relaxed));
+        }
+        inline uint64_t Parked() const
+        {
+            return (_parked.load(std::memory_order_relaxed));
+        }
+        inline uint16_t Spins() const
+        {
+            return (_spins.load(std::memory_order_relaxed));
+        }
+        void ResetStatistics()
+        {
+            _acquired.store(0, std::memory_order_relaxed);
+            _spun.store(0, std::memory_order_relaxed);
+            _parked.store(0, std::memory_order_relaxed);
+        }
+
+        // Tells the CPU we are spinning, so the other hyperthread gets the core.
+        static inline void Pause()
+        {
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+            __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__arm__) || defined(__aarch64__))
+            __asm__ __volatile__("yield");
+#elif defined(__WINDOWS__)
+            YieldProcessor();
+#endif
+        }
+        // The most a spinning lock should spin on this system: nothing on a single core.
+        static uint16_t SpinLimit(const uint16_t maxSpins);
+
+    private:
+        inline bool Acquire()
+        {
+#ifdef __POSIX__
+            return (pthread_mutex_trylock(&m_syncMutex) == 0);
+#endif
+#ifdef __WINDOWS__
+            return (::TryEnterCriticalSection(&m_syncMutex) != FALSE);
+#endif
+        }
+        void Wait();
+
+    private:
+        const uint16_t _maxSpins;
+        std::atomic<uint16_t> _spins;
+        std::atomic<uint64_t> _acquired;
+        std::atomic<uint64_t> _spun;
+        std::atomic<uint64_t> _parked;
+    };
+
     // ===========================================================================
     // class BinairySemaphore
     // ===========================================================================
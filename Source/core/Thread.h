@@ -20,6 +20,7 @@
 #ifndef __THREAD_H
 #define __THREAD_H
 
+#include <deque>
 #include <sstream>
 
 #include "IAction.h"
@@ -27,6 +28,7 @@
 #include "Portability.h"
 #include "Proxy.h"
 #include "Queue.h"
+#include "RingQueue.h"
 #include "StateTrigger.h"
 #include "Sync.h"
 #include "TextFragment.h"
@@ -251,7 +253,11 @@ namespace Core {
 
     class EXTERNAL ThreadPool {
     public:
+#ifdef THREADPOOL_RING_QUEUE
+        typedef Core::RingQueueType< Core::ProxyType<IDispatch> > MessageQueue;
+#else
         typedef Core::QueueType< Core::ProxyType<IDispatch> > MessageQueue;
+#endif
 
         template<typename IMPLEMENTATION>
         class JobType {
@@ -345,13 +351,19 @@ namespace Core {
             Minion(const Minion&) = delete;
             Minion& operator=(const Minion&) = delete;
 
-            Minion(MessageQueue& queue)
+            Minion(MessageQueue& queue, ThreadPool* pool = nullptr)
                 : _queue(queue)
+                , _pool(pool)
                 , _adminLock()
                 , _signal(false, false)
                 , _interestCount(0)
                 , _currentRequest()
                 , _runs(0)
+                , _jobLock()
+                , _jobs()
+                , _owner(0)
+                , _local(0)
+                , _stolen(0)
             {
             }
             ~Minion()
@@ -362,6 +374,67 @@ namespace Core {
             uint32_t Runs() const {
                 return (_runs);
             }
+            uint32_t Local() const {
+                return (_local);
+            }
+            uint32_t Stolen() const {
+                return (_stolen);
+            }
+            bool IsOwner() const {
+                return (_owner == Core::Thread::ThreadId());
+            }
+            uint32_t Pending() const {
+                _jobLock.Lock();
+                uint32_t result = static_cast<uint32_t>(_jobs.size());
+                _jobLock.Unlock();
+                return (result);
+            }
+            // The owner pushes and pops at the back (most recent first, still hot in
+            // the cache), idle siblings steal the oldest job from the front.
+            // A full deque (highWaterMark) does not take the job, it is up to the caller.
+            bool Push(const Core::ProxyType<Core::IDispatch>& job, const uint32_t highWaterMark) {
+                bool result = false;
+                _jobLock.Lock();
+                if (_jobs.size() < highWaterMark) {
+                    _jobs.push_back(job);
+                    result = true;
+                }
+                _jobLock.Unlock();
+                return (result);
+            }
+            bool Pop(Core::ProxyType<Core::IDispatch>& job) {
+                bool result = false;
+                _jobLock.Lock();
+                if (_jobs.empty() == false) {
+                    job = _jobs.back();
+                    _jobs.pop_back();
+                    result = true;
+                }
+                _jobLock.Unlock();
+                return (result);
+            }
+            bool Steal(Core::ProxyType<Core::IDispatch>& job) {
+                bool result = false;
+                _jobLock.Lock();
+                if (_jobs.empty() == false) {
+                    job = _jobs.front();
+                    _jobs.pop_front();
+                    result = true;
+                }
+                _jobLock.Unlock();
+                return (result);
+            }
+            bool Remove(const Core::ProxyType<Core::IDispatch>& job) {
+                bool result = false;
+                _jobLock.Lock();
+                std::deque< Core::ProxyType<Core::IDispatch> >::iterator index(std::find(_jobs.begin(), _jobs.end(), job));
+                if (index != _jobs.end()) {
+                    _jobs.erase(index);
+                    result = true;
+                }
+                _jobLock.Unlock();
+                return (result);
+            }
             bool IsActive() const {
                 return (_currentRequest.IsValid());
             }
@@ -384,7 +457,9 @@ namespace Core {
             }
             void Process()
             {
-                while (_queue.Extract(_currentRequest, Core::infinite) == true) {
+                _owner = Core::Thread::ThreadId();
+
+                while (Next(_currentRequest) == true) {
 
                     ASSERT(_currentRequest.IsValid() == true);
 
@@ -408,15 +483,26 @@ namespace Core {
                     }
                     _adminLock.Unlock();
                 }
+
+                _owner = 0;
             }
 
+        private:
+            inline bool Next(Core::ProxyType<Core::IDispatch>& job);
+
         private:
             MessageQueue& _queue;
+            ThreadPool* _pool;
             Core::CriticalSection _adminLock;
             Core::Event _signal;
             uint32_t _interestCount;
             Core::ProxyType<Core::IDispatch> _currentRequest;
             uint32_t _runs;
+            mutable Core::CriticalSection _jobLock;
+            std::deque< Core::ProxyType<Core::IDispatch> > _jobs;
+            std::atomic< ::ThreadId> _owner;
+            uint32_t _local;
+            uint32_t _stolen;
         };
 
     private:
@@ -425,9 +511,9 @@ namespace Core {
             Executor(const Executor&) = delete;
             Executor& operator=(const Executor&) = delete;
 
-            Executor(MessageQueue* queue, const uint32_t stackSize, const TCHAR* name)
+            Executor(MessageQueue* queue, const uint32_t stackSize, const TCHAR* name, ThreadPool* pool)
                 : Core::Thread(stackSize == 0 ? Core::Thread::DefaultStackSize() : stackSize, name)
-                , _minion(*queue)
+                , _minion(*queue, pool)
             {
             }
             ~Executor() override
@@ -443,6 +529,9 @@ namespace Core {
             bool IsActive() const {
                 return (_minion.IsActive());
             }
+            const Minion& Me() const {
+                return (_minion);
+            }
             void Run () {
                 Core::Thread::Run();
             }
@@ -469,12 +558,22 @@ namespace Core {
         ThreadPool(const ThreadPool& a_Copy) = delete;
         ThreadPool& operator=(const ThreadPool& a_RHS) = delete;
 
-        ThreadPool(const uint8_t count, const uint32_t stackSize, const uint32_t queueSize) 
+        // With stealing enabled, jobs submitted from one of the pool threads are
+        // kept on that thread (local) and idle threads take them over (stolen).
+        ThreadPool(const uint8_t count, const uint32_t stackSize, const uint32_t queueSize, const bool stealing = false)
             : _queue(queueSize)
+            , _highWaterMark(queueSize)
+            , _stealing(stealing)
+            , _idle(0)
+            , _nudging(false)
+            , _nudge()
         {
             const TCHAR* name = _T("WorkerPool::Thread");
             for (uint8_t index = 0; index < count; index++) {
-                _units.emplace_back(&_queue, stackSize, name);
+                _units.emplace_back(&_queue, stackSize, name, (stealing == true ? this : nullptr));
+            }
+            if (stealing == true) {
+                _nudge = Core::ProxyType<Core::IDispatch>(Core::ProxyType<Nudge>::Create());
             }
         }
         ~ThreadPool() {
@@ -487,9 +586,23 @@ namespace Core {
         {
             return (static_cast<uint8_t>(_units.size()));
         }
+        bool IsStealing() const
+        {
+            return (_stealing);
+        }
         uint32_t Pending() const
         {
-            return (_queue.Length());
+            uint32_t result = _queue.Length();
+
+            if (_stealing == true) {
+                std::list<Executor>::const_iterator index = _units.cbegin();
+                while (index != _units.cend()) {
+                    result += index->Me().Pending();
+                    index++;
+                }
+            }
+
+            return (result);
         }
         void Runs(const uint8_t length, uint32_t* counters) const 
         {
@@ -501,6 +614,26 @@ namespace Core {
                 count++; 
             }
         }
+        void Local(const uint8_t length, uint32_t* counters) const
+        {
+            uint8_t count = 0;
+            std::list<Executor>::const_iterator ptr = _units.cbegin();
+            while ((count < length) && (ptr != _units.cend())) {
+                counters[count] = ptr->Me().Local();
+                ptr++;
+                count++;
+            }
+        }
+        void Stolen(const uint8_t length, uint32_t* counters) const
+        {
+            uint8_t count = 0;
+            std::list<Executor>::const_iterator ptr = _units.cbegin();
+            while ((count < length) && (ptr != _units.cend())) {
+                counters[count] = ptr->Me().Stolen();
+                ptr++;
+                count++;
+            }
+        }
         uint8_t Active() const
         {
             uint8_t count = 0;
@@ -527,7 +660,16 @@ namespace Core {
         }
         void Submit(const Core::ProxyType<IDispatch>& job, const uint32_t waitTime)
         {
-            _queue.Insert(job, waitTime);
+            Minion* owner = (_stealing == true ? Owner() : nullptr);
+
+            // Once the local jobs reach the high-water mark, the shared queue (and its
+            // waitTime) takes over, so a worker that fans out is held back as well.
+            if ((owner == nullptr) || (owner->Push(job, _highWaterMark) == false)) {
+                _queue.Insert(job, waitTime);
+            } else {
+                // If there are threads idling, wake one up to come and steal it.
+                Wake();
+            }
         }
         uint32_t Revoke(const Core::ProxyType<IDispatch>& job, const uint32_t waitTime)
         {
@@ -535,9 +677,16 @@ namespace Core {
 
             _queue.Remove(job);
 
-            // Check if it is currently being executed and wait till it is done.
             std::list<Executor>::iterator index = _units.begin();
 
+            if (_stealing == true) {
+                while ((index != _units.end()) && (index->Me().Remove(job) == false)) {
+                    index++;
+                }
+                index = _units.begin();
+            }
+
+            // Check if it is currently being executed and wait till it is done.
             while (index != _units.end()) {
                 uint32_t outcome = index->Me().Completed(job, waitTime);
                 if (outcome != Core::ERROR_NONE) {
@@ -570,10 +719,116 @@ namespace Core {
             }
         }
 
+    private:
+        class Nudge : public Core::IDispatch {
+        public:
+            Nudge(const Nudge&) = delete;
+            Nudge& operator=(const Nudge&) = delete;
+
+            Nudge() = default;
+            ~Nudge() override = default;
+
+        public:
+            void Dispatch() override
+            {
+            }
+        };
+
+        // There is at most one nudge in the queue. The thread picking it up, passes it
+        // on once it found something to steal, so the idle threads wake up one by one.
+        void Wake()
+        {
+            if ((_idle.load() != 0) && (_nudging.exchange(true) == false)) {
+                if (_queue.Post(_nudge) == false) {
+                    _nudging.store(false);
+                }
+            }
+        }
+        Minion* Owner()
+        {
+            Minion* result = nullptr;
+            std::list<Executor>::iterator index = _units.begin();
+
+            while ((result == nullptr) && (index != _units.end())) {
+                if (index->Me().IsOwner() == true) {
+                    result = &(index->Me());
+                }
+                index++;
+            }
+
+            return (result);
+        }
+        bool Steal(const Minion& thief, Core::ProxyType<Core::IDispatch>& job)
+        {
+            bool result = false;
+            std::list<Executor>::iterator index = _units.begin();
+
+            while ((result == false) && (index != _units.end())) {
+                if (&(index->Me()) != &thief) {
+                    result = index->Me().Steal(job);
+                }
+                index++;
+            }
+
+            return (result);
+        }
+
    private:
         MessageQueue _queue;
+        const uint32_t _highWaterMark;
         std::list<Executor> _units;
+        const bool _stealing;
+        std::atomic<uint32_t> _idle;
+        std::atomic<bool> _nudging;
+        Core::ProxyType<Core::IDispatch> _nudge;
     };
+
+    inline bool ThreadPool::Minion::Next(Core::ProxyType<Core::IDispatch>& job)
+    {
+        bool result = false;
+
+        if (_pool == nullptr) {
+            result = _queue.Extract(job, Core::infinite);
+        } else {
+            bool done = false;
+
+            while (done == false) {
+                if (Pop(job) == true) {
+                    _local++;
+                    result = true;
+                } else if (_queue.Extract(job, 0) == true) {
+                    result = true;
+                } else if (_pool->Steal(*this, job) == true) {
+                    _stolen++;
+                    result = true;
+                    _pool->Wake();
+                } else {
+                    _pool->_idle++;
+
+                    // Someone might have pushed a job before we registered as idle.
+                    if (_pool->Steal(*this, job) == true) {
+                        _stolen++;
+                        result = true;
+                    } else {
+                        result = _queue.Extract(job, Core::infinite);
+                    }
+
+                    _pool->_idle--;
+                }
+
+                // A nudge only wakes us up to go and steal.
+                if ((result == true) && (job == _pool->_nudge)) {
+                    job.Release();
+                    _pool->_nudging.store(false);
+                    result = false;
+                } else {
+                    done = true;
+                }
+            }
+        }
+
+        return (result);
+    }
 }
 } // namespace Core
 
@@ -27,7 +27,10 @@
 #include "Sync.h"
 #include "Thread.h"
 #include "Time.h"
+#include "TypeTraits.h"
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 // ---- Referenced classes and types ----
 
@@ -46,7 +49,328 @@
 //
 namespace WPEFramework {
 namespace Core {
-    template <typename CONTENT>
+    // Pending queues for the TimerType. ENTRY carries the ScheduleTime() and
+    // the Content(), entries with the same time are handled in the order they
+    // were scheduled.
+
+    // Sorted list, scheduling and revoking walk the list: O(n).
+    template <typename CONTENT, typename ENTRY>
+    class TimerListType {
+    private:
+        TimerListType(const TimerListType<CONTENT, ENTRY>&) = delete;
+        TimerListType<CONTENT, ENTRY>& operator=(const TimerListType<CONTENT, ENTRY>&) = delete;
+
+        typedef typename std::list<ENTRY> SubscriberList;
+
+    public:
+        TimerListType()
+            : _entries()
+        {
+        }
+        ~TimerListType()
+        {
+        }
+
+    public:
+        inline bool IsEmpty() const
+        {
+            return (_entries.empty());
+        }
+        inline uint32_t Count() const
+        {
+            return (static_cast<uint32_t>(_entries.size()));
+        }
+        inline uint64_t NextTime() const
+        {
+            return (_entries.front().ScheduleTime());
+        }
+        inline void Clear()
+        {
+            _entries.clear();
+        }
+        ENTRY Pop()
+        {
+            ENTRY result(std::move(_entries.front()));
+
+            _entries.pop_front();
+
+            return (result);
+        }
+        // Returns true if the new entry is the first one to fire.
+        bool Insert(ENTRY&& entry)
+        {
+            bool reevaluate = false;
+            typename SubscriberList::iterator index = _entries.begin();
+
+            while ((index != _entries.end()) && (entry.ScheduleTime() >= (*index).ScheduleTime())) {
+                ++index;
+            }
+
+            if (index == _entries.begin()) {
+                _entries.push_front(std::move(entry));
+
+                // If we added the new time up front, retrigger the scheduler.
+                reevaluate = true;
+            } else if (index == _entries.end()) {
+                _entries.push_back(std::move(entry));
+            } else {
+                _entries.insert(index, std::move(entry));
+            }
+
+            return (reevaluate);
+        }
+        // Returns true if an entry was removed, head is set if it was the first one to fire.
+        bool Remove(const CONTENT& info, const bool all, bool& head)
+        {
+            bool found = false;
+            typename SubscriberList::iterator index = _entries.begin();
+
+            head = false;
+
+            while ((index != _entries.end()) && ((found == false) || (all == true))) {
+                if (index->Content() == info) {
+                    head = head || (index == _entries.begin());
+                    found = true;
+
+                    // Remove this... Found it, remove it.
+                    index = _entries.erase(index);
+                } else {
+                    ++index;
+                }
+            }
+
+            return (found);
+        }
+
+    private:
+        SubscriberList _entries;
+    };
+
+    // 4-ary heap, scheduling and revoking is O(log n). If the CONTENT offers a
+    // "uint64_t Hash() const" (equal contents give equal hashes) entries are
+    // also indexed, so a Revoke does not have to look at all pending entries.
+    template <typename CONTENT, typename ENTRY>
+    class TimerHeapType {
+    private:
+        TimerHeapType(const TimerHeapType<CONTENT, ENTRY>&) = delete;
+        TimerHeapType<CONTENT, ENTRY>& operator=(const TimerHeapType<CONTENT, ENTRY>&) = delete;
+
+        static constexpr uint32_t Arity = 4;
+
+        struct Node {
+            Node(ENTRY&& entry, const uint64_t sequence)
+                : Entry(std::move(entry))
+                , Sequence(sequence)
+                , Position(0)
+            {
+            }
+
+            ENTRY Entry;
+            uint64_t Sequence;
+            uint32_t Position;
+        };
+
+        typedef std::unordered_multimap<uint64_t, Node*> Index;
+
+        HAS_MEMBER(Hash, hasHash);
+
+        typedef hasHash<CONTENT, uint64_t (CONTENT::*)() const> TraitHasHash;
+
+    public:
+        TimerHeapType()
+            : _heap()
+            , _index()
+            , _sequence(0)
+        {
+        }
+        ~TimerHeapType()
+        {
+            Clear();
+        }
+
+    public:
+        inline bool IsEmpty() const
+        {
+            return (_heap.empty());
+        }
+        inline uint32_t Count() const
+        {
+            return (static_cast<uint32_t>(_heap.size()));
+        }
+        inline uint64_t NextTime() const
+        {
+            return (_heap.front()->Entry.ScheduleTime());
+        }
+        void Clear()
+        {
+            for (Node* node : _heap) {
+                delete node;
+            }
+            _heap.clear();
+            _index.clear();
+        }
+        ENTRY Pop()
+        {
+            Node* node = _heap.front();
+
+            Erase(node);
+
+            ENTRY result(std::move(node->Entry));
+
+            delete node;
+
+            return (result);
+        }
+        // Returns true if the new entry is the first one to fire.
+        bool Insert(ENTRY&& entry)
+        {
+            Node* node = new Node(std::move(entry), _sequence++);
+
+            node->Position = static_cast<uint32_t>(_heap.size());
+            _heap.push_back(node);
+            Up(node->Position);
+
+            Indexing(TemplateIntToType<TraitHasHash::value>(), node, true);
+
+            return (node->Position == 0);
+        }
+        // Returns true if an entry was removed, head is set if it was the first one to fire.
+        bool Remove(const CONTENT& info, const bool all, bool& head)
+        {
+            std::vector<Node*> nodes;
+
+            head = false;
+
+            Find(TemplateIntToType<TraitHasHash::value>(), info, all, nodes);
+
+            for (Node* node : nodes) {
+                head = head || (node->Position == 0);
+
+                Erase(node);
+
+                delete node;
+            }
+
+            return (nodes.empty() == false);
+        }
+
+    private:
+        inline static bool Earlier(const Node* lhs, const Node* rhs)
+        {
+            return ((lhs->Entry.ScheduleTime() < rhs->Entry.ScheduleTime()) || ((lhs->Entry.ScheduleTime() == rhs->Entry.ScheduleTime()) && (lhs->Sequence < rhs->Sequence)));
+        }
+        inline void Place(Node* node, const uint32_t position)
+        {
+            _heap[position] = node;
+            node->Position = position;
+        }
+        void Up(uint32_t position)
+        {
+            Node* node = _heap[position];
+
+            while (position > 0) {
+                uint32_t parent = (position - 1) / Arity;
+
+                if (Earlier(node, _heap[parent]) == false) {
+                    break;
+                }
+                Place(_heap[parent], position);
+                position = parent;
+            }
+            Place(node, position);
+        }
+        void Down(uint32_t position)
+        {
+            Node* node = _heap[position];
+            const uint32_t size = static_cast<uint32_t>(_heap.size());
+
+            while (true) {
+                uint32_t first = (position * Arity) + 1;
+                uint32_t earliest = position;
+                Node* candidate = node;
+
+                for (uint32_t child = first; (child < size) && (child < (first + Arity)); child++) {
+                    if (Earlier(_heap[child], candidate) == true) {
+                        earliest = child;
+                        candidate = _heap[child];
+                    }
+                }
+                if (earliest == position) {
+                    break;
+                }
+                Place(candidate, position);
+                position = earliest;
+            }
+            Place(node, position);
+        }
+        void Erase(Node* node)
+        {
+            const uint32_t position = node->Position;
+            Node* last = _heap.back();
+
+            _heap.pop_back();
+
+            if (last != node) {
+                Place(last, position);
+                Down(position);
+                Up(last->Position);
+            }
+
+            Indexing(TemplateIntToType<TraitHasHash::value>(), node, false);
+        }
+        void Indexing(const TemplateIntToType<true>&, Node* node, const bool add)
+        {
+            const uint64_t key = node->Entry.Content().Hash();
+
+            if (add == true) {
+                _index.emplace(key, node);
+            } else {
+                std::pair<typename Index::iterator, typename Index::iterator> range(_index.equal_range(key));
+
+                while ((range.first != range.second) && (range.first->second != node)) {
+                    ++range.first;
+                }
+
+                ASSERT(range.first != range.second);
+
+                if (range.first != range.second) {
+                    _index.erase(range.first);
+                }
+            }
+        }
+        void Indexing(const TemplateIntToType<false>&, Node*, const bool)
+        {
+        }
+        void Find(const TemplateIntToType<true>&, const CONTENT& info, const bool all, std::vector<Node*>& nodes)
+        {
+            std::pair<typename Index::iterator, typename Index::iterator> range(_index.equal_range(info.Hash()));
+
+            while ((range.first != range.second) && ((nodes.empty() == true) || (all == true))) {
+                if (range.first->second->Entry.Content() == info) {
+                    nodes.push_back(range.first->second);
+                }
+                ++range.first;
+            }
+        }
+        void Find(const TemplateIntToType<false>&, const CONTENT& info, const bool all, std::vector<Node*>& nodes)
+        {
+            typename std::vector<Node*>::iterator index = _heap.begin();
+
+            while ((index != _heap.end()) && ((nodes.empty() == true) || (all == true))) {
+                if ((*index)->Entry.Content() == info) {
+                    nodes.push_back(*index);
+                }
+                ++index;
+            }
+        }
+
+    private:
+        std::vector<Node*> _heap;
+        Index _index;
+        uint64_t _sequence;
+    };
+
+    template <typename CONTENT, template <typename, typename> class PENDING = TimerHeapType>
     class TimerType {
     private:
         TimerType(const TimerType&);
@@ -147,11 +471,11 @@ namespace Core {
             }
 
         private:
-            TimerType<CONTENT>& m_Parent;
+            TimerType<CONTENT, PENDING>& m_Parent;
         };
 
         typedef TimedInfo<CONTENT> TimeInfoBlocks;
-        typedef typename std::list<TimeInfoBlocks> SubscriberList;
+        typedef PENDING<CONTENT, TimeInfoBlocks> SubscriberList;
 
     public:
         TimerType(const uint32_t stackSize, const TCHAR* timerName)
@@ -170,7 +494,7 @@ namespace Core {
             m_TimerThread.Stop();
 
             // Force kill on all pending stuff...
-            m_PendingQueue.clear();
+            m_PendingQueue.Clear();
             m_Admin.Unlock();
 
             m_TimerThread.Wait(Thread::BLOCKED|Thread::STOPPED, Core::infinite);
@@ -201,7 +525,7 @@ namespace Core {
         {
             m_Admin.Lock();
 
-            if (ScheduleEntry(std::move(timeInfo)) == true) {
+            if (m_PendingQueue.Insert(std::move(timeInfo)) == true) {
                 m_TimerThread.Run();
             }
 
@@ -213,20 +537,13 @@ namespace Core {
         void Trigger(const uint64_t& time, const CONTENT& info)
         {
             TimedInfo<CONTENT> newEntry(time, info);
+            bool head = false;
 
             m_Admin.Lock();
 
-            typename SubscriberList::iterator index = m_PendingQueue.begin();
-
-            while ((index != m_PendingQueue.end()) && ((*index).Content() != info)) {
-                ++index;
-            }
+            m_PendingQueue.Remove(info, false, head);
 
-            if (index != m_PendingQueue.end()) {
-                m_PendingQueue.erase(index);
-            }
-
-            if (ScheduleEntry(std::move(newEntry)) == true) {
+            if ((m_PendingQueue.Insert(std::move(newEntry)) == true) || (head == true)) {
                 m_TimerThread.Run();
             }
 
@@ -235,20 +552,17 @@ namespace Core {
 
         bool Revoke(const CONTENT& info)
         {
-            bool foundElement = false;
+            bool head = false;
 
             m_Admin.Lock();
 
-            typename SubscriberList::iterator index = m_PendingQueue.begin();
-
             // Since we have the admin lock, we are pretty sure that there is not any
             // context running, so we can be pretty sure that if it was scheduled, it
             // is gone !!!
-            if (RemoveEntry(index, info) == true) {
+            bool foundElement = m_PendingQueue.Remove(info, true, head);
 
-                foundElement = true;
-
-                // If we added the new time up front, retrigger the scheduler.
+            if (head == true) {
+                // If we removed the first one, retrigger the scheduler.
                 m_TimerThread.Run();
             }
 
@@ -264,7 +578,7 @@ namespace Core {
 
         uint32_t Pending() const
         {
-            return (m_PendingQueue.size());
+            return (m_PendingQueue.Count());
         }
 
         ::ThreadId ThreadId() const
@@ -284,11 +598,9 @@ namespace Core {
             // Ranging from 0-Core::infinite
             m_TimerThread.Block();
 
-            while ((m_PendingQueue.empty() == false) && (m_PendingQueue.front().ScheduleTime() <= now)) {
-                TimedInfo<CONTENT> info(std::move(m_PendingQueue.front()));
-
+            while ((m_PendingQueue.IsEmpty() == false) && (m_PendingQueue.NextTime() <= now)) {
                 // Make sure we loose the current one before we do the call, that one might add ;-)
-                m_PendingQueue.pop_front();
+                TimedInfo<CONTENT> info(m_PendingQueue.Pop());
 
                 m_Admin.Unlock();
 
@@ -300,24 +612,24 @@ namespace Core {
                     ASSERT(reschedule > now);
 
                     info.ScheduleTime(reschedule);
-                    ScheduleEntry(std::move(info));
+                    m_PendingQueue.Insert(std::move(info));
                 }
             }
 
             // Calculate the delay...
-            if (m_PendingQueue.empty() == true) {
+            if (m_PendingQueue.IsEmpty() == true) {
                 m_NextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
             } else {
                 // Refresh the time, just to be on the safe side...
                 uint64_t delta = Time::Now().Ticks();
 
-                if (delta >= m_PendingQueue.front().ScheduleTime()) {
+                if (delta >= m_PendingQueue.NextTime()) {
                     m_NextTrigger = delta;
                     delayTime = 0;
                 } else {
                     // The windows counter is in 100ns intervals dus we mmoeten even delen door  1000 (us) * 10 ns = 10.000
                     // om de waarde in ms te krijgen.
-                    m_NextTrigger = m_PendingQueue.front().ScheduleTime();
+                    m_NextTrigger = m_PendingQueue.NextTime();
                     delayTime = static_cast<uint32_t>((m_NextTrigger - delta) / Time::TicksPerMillisecond);
                 }
             }
@@ -327,48 +639,6 @@ namespace Core {
             return (delayTime);
         }
 
-    private:
-        bool ScheduleEntry(TimedInfo<CONTENT>&& infoBlock)
-        {
-            bool reevaluate = false;
-            typename SubscriberList::iterator index = m_PendingQueue.begin();
-
-            while ((index != m_PendingQueue.end()) && (infoBlock.ScheduleTime() >= (*index).ScheduleTime())) {
-                ++index;
-            }
-
-            if (index == m_PendingQueue.begin()) {
-                m_PendingQueue.push_front(std::move(infoBlock));
-
-                // If we added the new time up front, retrigger the scheduler.
-                reevaluate = true;
-            } else if (index == m_PendingQueue.end()) {
-                m_PendingQueue.push_back(std::move(infoBlock));
-            } else {
-                m_PendingQueue.insert(index, std::move(infoBlock));
-            }
-
-            return (reevaluate);
-        }
-        bool RemoveEntry(typename SubscriberList::iterator& index, const CONTENT& info)
-        {
-            bool changedHead = false;
-
-            while (index != m_PendingQueue.end()) {
-                if (index->Content() == info) {
-                    changedHead = (index == m_PendingQueue.begin());
-
-                    // Remove this... Found it, remove it.
-                    index = m_PendingQueue.erase(index);
-                } else {
-
-                    ++index;
-                }
-            }
-
-            return (changedHead);
-        }
-
     private:
         SubscriberList m_PendingQueue;
         TimeWorker m_TimerThread;
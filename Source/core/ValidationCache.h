@@ -0,0 +1,220 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __VALIDATIONCACHE_H
+#define __VALIDATIONCACHE_H
+
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+#include <unordered_map>
+
+#include "Module.h"
+#include "Portability.h"
+#include "Sync.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    // Remembers the outcome of validating a token (a JWT, a session id, ...) for a limited time,
+    // so a token that is presented over and over again is validated once per lifetime. The map
+    // hashes the token and compares the full token on a hit, so a token that was never validated
+    // can not hit on the entry of another one. At most "entries" tokens are kept: when full, the
+    // expired ones go first, if none expired the one closest to expiring makes room. The VALUE
+    // is copied in and out, so it should be cheap to copy; reference counted ones should hold a
+    // reference in their copy constructor. Thread safe.
+    template <typename VALUE>
+    class ValidationCacheType {
+    public:
+        struct Statistics {
+            uint32_t Hits;
+            uint32_t Misses;
+            uint32_t Expired;
+            uint32_t Evicted;
+            uint32_t Entries;
+        };
+
+    private:
+        struct Entry {
+            Entry(const VALUE& value, const uint64_t validUntil)
+                : Value(value)
+                , ValidUntil(validUntil)
+            {
+            }
+
+            VALUE Value;
+            uint64_t ValidUntil;
+        };
+
+        using Container = std::unordered_map<string, Entry>;
+
+    public:
+        ValidationCacheType() = delete;
+        ValidationCacheType(const ValidationCacheType<VALUE>&) = delete;
+        ValidationCacheType<VALUE>& operator=(const ValidationCacheType<VALUE>&) = delete;
+
+        // Lifetime in milliseconds, no entries (or no lifetime) turns the cache off.
+        ValidationCacheType(const uint16_t entries, const uint32_t lifetime)
+            : _adminLock()
+            , _entries(entries)
+            , _lifetime(lifetime)
+            , _cache()
+            , _hits(0)
+            , _misses(0)
+            , _expired(0)
+            , _evicted(0)
+        {
+            _cache.reserve(_entries);
+        }
+        ~ValidationCacheType()
+        {
+            _cache.clear();
+        }
+
+    public:
+        inline bool IsEnabled() const
+        {
+            return ((_entries != 0) && (_lifetime != 0));
+        }
+        bool Find(const string& token, VALUE& value)
+        {
+            bool result = false;
+
+            _adminLock.Lock();
+
+            typename Container::iterator index(_cache.find(token));
+
+            if (index == _cache.end()) {
+                _misses++;
+            } else if (index->second.ValidUntil <= Now()) {
+                _cache.erase(index);
+                _expired++;
+                _misses++;
+            } else {
+                value = index->second.Value;
+                _hits++;
+                result = true;
+            }
+
+            _adminLock.Unlock();
+
+            return (result);
+        }
+        // The token itself might expire before the lifetime of the cache is over (like the "exp"
+        // claim of a JWT), the entry goes with it then. A token that has expired is not added.
+        void Add(const string& token, const VALUE& value, const uint32_t lifetime = ~0)
+        {
+            if (IsEnabled() == true) {
+                const uint64_t now = Now();
+                const uint32_t valid = std::min(_lifetime, lifetime);
+
+                _adminLock.Lock();
+
+                typename Container::iterator index(_cache.find(token));
+
+                if (valid == 0) {
+                    if (index != _cache.end()) {
+                        _cache.erase(index);
+                    }
+                } else if (index != _cache.end()) {
+                    index->second.Value = value;
+                    index->second.ValidUntil = now + valid;
+                } else {
+                    if (_cache.size() >= _entries) {
+                        MakeRoom(now);
+                    }
+                    _cache.emplace(std::piecewise_construct, std::forward_as_tuple(token), std::forward_as_tuple(value, now + valid));
+                }
+
+                _adminLock.Unlock();
+            }
+        }
+        void Remove(const string& token)
+        {
+            _adminLock.Lock();
+            _cache.erase(token);
+            _adminLock.Unlock();
+        }
+        void Clear()
+        {
+            _adminLock.Lock();
+            _cache.clear();
+            _adminLock.Unlock();
+        }
+        Statistics Counters() const
+        {
+            Statistics result;
+
+            _adminLock.Lock();
+
+            result.Hits = _hits;
+            result.Misses = _misses;
+            result.Expired = _expired;
+            result.Evicted = _evicted;
+            result.Entries = static_cast<uint32_t>(_cache.size());
+
+            _adminLock.Unlock();
+
+            return (result);
+        }
+
+    private:
+        void MakeRoom(const uint64_t now)
+        {
+            typename Container::iterator oldest(_cache.end());
+            typename Container::iterator index(_cache.begin());
+
+            while (index != _cache.end()) {
+                if (index->second.ValidUntil <= now) {
+                    index = _cache.erase(index);
+                    _expired++;
+                } else {
+                    if ((oldest == _cache.end()) || (index->second.ValidUntil < oldest->second.ValidUntil)) {
+                        oldest = index;
+                    }
+                    index++;
+                }
+            }
+
+            if (_cache.size() >= _entries) {
+                ASSERT(oldest != _cache.end());
+
+                _cache.erase(oldest);
+                _evicted++;
+            }
+        }
+        static uint64_t Now()
+        {
+            return (static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()));
+        }
+
+    private:
+        mutable CriticalSection _adminLock;
+        const uint16_t _entries;
+        const uint32_t _lifetime;
+        Container _cache;
+        uint32_t _hits;
+        uint32_t _misses;
+        uint32_t _expired;
+        uint32_t _evicted;
+    };
+}
+} // namespace WPEFramework::Core
+
+#endif // __VALIDATIONCACHE_H
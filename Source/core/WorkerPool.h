@@ -78,6 +78,8 @@ namespace Core {
             uint32_t Occupation;
             uint8_t Slots;
             uint32_t* Slot;
+            uint32_t* Local;
+            uint32_t* Stolen;
         };
 
         static void Assign(IWorkerPool* instance);
@@ -125,6 +127,10 @@ namespace Core {
             {
                 return (!operator==(RHS));
             }
+            uint64_t Hash() const
+            {
+                return (_job.IsValid() == true ? reinterpret_cast<uintptr_t>(_job.operator->()) : 0);
+            }
             uint64_t Timed(const uint64_t /* scheduledTime */)
             {
                 ASSERT(_pool != nullptr);
@@ -144,15 +150,17 @@ namespace Core {
         WorkerPool(const WorkerPool&) = delete;
         WorkerPool& operator=(const WorkerPool&) = delete;
 
-        WorkerPool(const uint8_t threadCount, const uint32_t stackSize, const uint32_t queueSize)
-            : _threadPool(threadCount, stackSize, queueSize)
-            , _external(_threadPool.Queue())
+        WorkerPool(const uint8_t threadCount, const uint32_t stackSize, const uint32_t queueSize, const bool stealing = false)
+            : _threadPool(threadCount, stackSize, queueSize, stealing)
+            , _external(_threadPool.Queue(), (stealing == true ? &_threadPool : nullptr))
             , _timer(1024 * 1024, _T("WorkerPoolType::Timer"))
             , _metadata()
             , _joined(0)
         {
             _metadata.Slots = threadCount + 1;
             _metadata.Slot = new uint32_t[threadCount + 1];
+            _metadata.Local = new uint32_t[threadCount + 1];
+            _metadata.Stolen = new uint32_t[threadCount + 1];
 
             _threadPool.Run();
         }
@@ -160,6 +168,8 @@ namespace Core {
         {
             _threadPool.Stop();
             delete[] _metadata.Slot;
+            delete[] _metadata.Local;
+            delete[] _metadata.Stolen;
         }
 
     public:
@@ -207,8 +217,12 @@ namespace Core {
             _metadata.Pending = _threadPool.Pending();
             _metadata.Occupation = _threadPool.Active();
             _metadata.Slot[0] = _external.Runs();
+            _metadata.Local[0] = _external.Local();
+            _metadata.Stolen[0] = _external.Stolen();
 
             _threadPool.Runs(_threadPool.Count(), &(_metadata.Slot[1]));
+            _threadPool.Local(_threadPool.Count(), &(_metadata.Local[1]));
+            _threadPool.Stolen(_threadPool.Count(), &(_metadata.Stolen[1]));
 
             return (_metadata);
         }
@@ -40,6 +40,7 @@
 #include "IObserver.h"
 
 #include "ASN1.h"
+#include "CRC32.h"
 #include "DoorBell.h"
 #include "CyclicBuffer.h"
 #include "DataBuffer.h"
@@ -49,11 +50,15 @@
 #include "Factory.h"
 #include "FileSystem.h"
 #include "Frame.h"
+#include "Histogram.h"
 #include "IPCMessage.h"
 #include "IPCChannel.h"
+#include "IPCSharedMemory.h"
 #include "IPCConnector.h"
 #include "ISO639.h"
 #include "JSON.h"
+#include "JSONReader.h"
+#include "JSONMessagePack.h"
 #include "JSONRPC.h"
 #include "KeyValue.h"
 #include "Library.h"
@@ -73,10 +78,12 @@
 #include "Range.h"
 #include "ReadWriteLock.h"
 #include "ResourceMonitor.h"
+#include "RingQueue.h"
 #include "SerialPort.h"
 #include "Serialization.h"
 #include "Services.h"
 #include "SharedBuffer.h"
+#include "SharedSlotBuffer.h"
 #include "Singleton.h"
 #include "SocketPort.h"
 #include "SocketServer.h"
@@ -98,6 +105,7 @@
 #include "Trace.h"
 #include "TriState.h"
 #include "TypeTraits.h"
+#include "ValidationCache.h"
 #include "ValueRecorder.h"
 #include "XGetopt.h"
 #include "WorkerPool.h"
@@ -18,14 +18,89 @@
  */
  
 #include "AES.h"
+#include "AESAcceleration.h"
 
 namespace WPEFramework {
 namespace Crypto {
 
+    // The blocks that are encrypted in one go, where the blocks do not depend on each other (ECB, CTR,
+    // GCM and CBC decryption), so the instructions of the blocks can overlap.
+    static constexpr uint8_t Batch = 8;
+
+    static void Blocks(mbedtls_aes_context& context, const int mode, const uint32_t blocks, const uint8_t input[], uint8_t output[])
+    {
+        if (AESAcceleration::Active() == false) {
+            for (uint32_t index = 0; index < blocks; index++) {
+                mbedtls_aes_crypt_ecb(&context, mode, &(input[index * 16]), &(output[index * 16]));
+            }
+        } else if (mode == MBEDTLS_AES_ENCRYPT) {
+            AESAcceleration::Encrypt(context, blocks, input, output);
+        } else {
+            AESAcceleration::Decrypt(context, blocks, input, output);
+        }
+    }
+
+    static void Xor(const uint32_t length, const uint8_t input[], const uint8_t stream[], uint8_t output[])
+    {
+        uint32_t index = 0;
+
+        // A word at a time, memcpy keeps it legal for unaligned buffers and compiles to plain loads.
+        for (; (index + sizeof(uint64_t)) <= length; index += sizeof(uint64_t)) {
+            uint64_t left, right;
+            ::memcpy(&left, &(input[index]), sizeof(left));
+            ::memcpy(&right, &(stream[index]), sizeof(right));
+            left ^= right;
+            ::memcpy(&(output[index]), &left, sizeof(left));
+        }
+        for (; index < length; index++) {
+            output[index] = input[index] ^ stream[index];
+        }
+    }
+
+    // The counter is the whole block, big endian, like mbedtls_aes_crypt_ctr, and so is the state
+    // between calls: offset is how much of the key stream in stream is used.
+    static void Counter(mbedtls_aes_context& context, uint8_t counter[16], uint8_t stream[16], size_t& offset, uint32_t length, const uint8_t input[], uint8_t output[])
+    {
+        while ((offset != 0) && (length > 0)) {
+            *output++ = (*input++ ^ stream[offset]);
+            offset = ((offset + 1) & 0x0F);
+            length--;
+        }
+
+        while (length > 0) {
+            uint8_t keys[Batch * 16];
+            const uint32_t blocks = std::min(static_cast<uint32_t>((length + 15) / 16), static_cast<uint32_t>(Batch));
+
+            for (uint32_t index = 0; index < blocks; index++) {
+                ::memcpy(&(keys[index * 16]), counter, 16);
+
+                for (uint8_t position = 16; (position > 0) && (++counter[position - 1] == 0); position--)
+                    ;
+            }
+
+            Blocks(context, MBEDTLS_AES_ENCRYPT, blocks, keys, keys);
+
+            const uint32_t size = std::min(length, static_cast<uint32_t>(blocks * 16));
+            Xor(size, input, keys, output);
+
+            if ((size % 16) != 0) {
+                // The rest of the last key stream block is for the next call.
+                ::memcpy(stream, &(keys[(blocks - 1) * 16]), 16);
+                offset = (size % 16);
+            }
+
+            input += size;
+            output += size;
+            length -= size;
+        }
+    }
+
     AESEncryption::AESEncryption(const aesType type)
         : _type(type)
+        , _offset(0)
     {
         ::memset(_iv, 0, sizeof(_iv));
+        ::memset(_stream, 0, sizeof(_stream));
     }
 
     AESEncryption::~AESEncryption()
@@ -46,14 +121,11 @@ namespace Crypto {
 
         switch (Type()) {
         case AES_ECB: {
-            uint32_t offset = 0;
             uint32_t blockSize = ((length / 16) * 16);
 
-            while (offset < blockSize) {
-                // First encrypt the whole blocks. No padding needed, yet
-                result = mbedtls_aes_crypt_ecb(&_context, MBEDTLS_AES_ENCRYPT, &(input[offset]), &(output[offset]));
-                offset += 16;
-            }
+            // First the whole blocks. No padding needed, yet
+            Blocks(_context, MBEDTLS_AES_ENCRYPT, (blockSize / 16), input, output);
+            result = Core::ERROR_NONE;
 
             if (blockSize < length) {
 
@@ -171,6 +243,11 @@ namespace Crypto {
             result = mbedtls_aes_crypt_ofb(&_context, length, &_offset, _iv, input, output);
             break;
 #endif
+        case AES_CTR: {
+            Counter(_context, _iv, _stream, _offset, length, input, output);
+            result = Core::ERROR_NONE;
+            break;
+        }
         default:
             ASSERT(false);
             break;
@@ -184,6 +261,7 @@ namespace Crypto {
         , _offset(0)
     {
         ::memset(_iv, 0, sizeof(_iv));
+        ::memset(_stream, 0, sizeof(_stream));
     }
 
     AESDecryption::~AESDecryption()
@@ -210,14 +288,11 @@ namespace Crypto {
 
         switch (Type()) {
         case AES_ECB: {
-            uint32_t offset = 0;
             uint32_t blockSize = ((length / 16) * 16);
 
-            while (offset < blockSize) {
-                // First encrypt the whole blocks. No padding needed, yet
-                result = mbedtls_aes_crypt_ecb(&_context, MBEDTLS_AES_DECRYPT, &(input[offset]), &(output[offset]));
-                offset += 16;
-            }
+            // First the whole blocks. No padding needed, yet
+            Blocks(_context, MBEDTLS_AES_DECRYPT, (blockSize / 16), input, output);
+            result = Core::ERROR_NONE;
 
             if (blockSize < length) {
 
@@ -237,7 +312,21 @@ namespace Crypto {
         case AES_CBC: {
             uint32_t blockSize = ((length / 16) * 16);
 
-            if (blockSize > 0) {
+            if ((blockSize > 0) && (AESAcceleration::Active() == true)) {
+                // The blocks can be decrypted independently, only the XOR depends on the previous one.
+                uint8_t cipher[Batch * 16];
+
+                for (uint32_t offset = 0; offset < blockSize; offset += sizeof(cipher)) {
+                    const uint32_t size = std::min(static_cast<uint32_t>(blockSize - offset), static_cast<uint32_t>(sizeof(cipher)));
+
+                    ::memcpy(cipher, &(input[offset]), size);
+                    AESAcceleration::Decrypt(_context, (size / 16), cipher, &(output[offset]));
+                    Xor(16, &(output[offset]), _iv, &(output[offset]));
+                    Xor((size - 16), &(output[offset + 16]), cipher, &(output[offset + 16]));
+                    ::memcpy(_iv, &(cipher[size - 16]), 16);
+                }
+                result = Core::ERROR_NONE;
+            } else if (blockSize > 0) {
                 // First encrypt the whole blocks. No padding needed, yet
                 result = mbedtls_aes_crypt_cbc(&_context, MBEDTLS_AES_DECRYPT, blockSize, _iv, input, output);
             }
@@ -333,6 +422,11 @@ namespace Crypto {
             break;
         }
 #endif
+        case AES_CTR: {
+            Counter(_context, _iv, _stream, _offset, length, input, output);
+            result = Core::ERROR_NONE;
+            break;
+        }
         default:
             ASSERT(false);
             break;
@@ -340,5 +434,254 @@ namespace Crypto {
 
         return (result);
     }
+
+    // The 4 bits tables GHASH of mbedtls (gcm.c, Shoup's method).
+    static const uint64_t Last4[16] = {
+        0x0000, 0x1c20, 0x3840, 0x2460,
+        0x7080, 0x6ca0, 0x48c0, 0x54e0,
+        0xe100, 0xfd20, 0xd940, 0xc560,
+        0x9180, 0x8da0, 0xa9c0, 0xb5e0
+    };
+
+    static uint64_t Load64(const uint8_t data[])
+    {
+        uint64_t result = 0;
+
+        for (uint8_t index = 0; index < 8; index++) {
+            result = (result << 8) | data[index];
+        }
+
+        return (result);
+    }
+
+    static void Store64(uint64_t value, uint8_t data[])
+    {
+        for (uint8_t index = 8; index > 0; index--) {
+            data[index - 1] = static_cast<uint8_t>(value & 0xFF);
+            value >>= 8;
+        }
+    }
+
+    static void Multiply(const uint64_t HL[16], const uint64_t HH[16], uint8_t X[16])
+    {
+        uint8_t low = (X[15] & 0x0F);
+        uint64_t zh = HH[low];
+        uint64_t zl = HL[low];
+
+        for (int8_t index = 15; index >= 0; index--) {
+            const uint8_t high = ((X[index] >> 4) & 0x0F);
+            uint8_t remainder;
+
+            low = (X[index] & 0x0F);
+
+            if (index != 15) {
+                remainder = static_cast<uint8_t>(zl & 0x0F);
+                zl = (zh << 60) | (zl >> 4);
+                zh = (zh >> 4) ^ (Last4[remainder] << 48) ^ HH[low];
+                zl ^= HL[low];
+            }
+
+            remainder = static_cast<uint8_t>(zl & 0x0F);
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ (Last4[remainder] << 48) ^ HH[high];
+            zl ^= HL[high];
+        }
+
+        Store64(zh, &(X[0]));
+        Store64(zl, &(X[8]));
+    }
+
+    AESGCM::AESGCM()
+    {
+        mbedtls_aes_init(&_context);
+        ::memset(_HL, 0, sizeof(_HL));
+        ::memset(_HH, 0, sizeof(_HH));
+        ::memset(_hkey, 0, sizeof(_hkey));
+    }
+
+    AESGCM::~AESGCM()
+    {
+        mbedtls_aes_free(&_context);
+        ::memset(_HL, 0, sizeof(_HL));
+        ::memset(_HH, 0, sizeof(_HH));
+        ::memset(_hkey, 0, sizeof(_hkey));
+    }
+
+    uint32_t AESGCM::Key(const uint8_t length, const uint8_t key[])
+    {
+        static_assert(sizeof(_hkey) == AESAcceleration::GHASHKeySize, "The GHASH key does not fit");
+
+        ASSERT((length == 16 /* 128 bits */) || (length == 24 /* 192 bits */) || (length == 32 /* 256 bits */));
+
+        mbedtls_aes_init(&_context);
+
+        uint32_t result = mbedtls_aes_setkey_enc(&_context, key, (length << 3));
+
+        if (result == Core::ERROR_NONE) {
+            uint8_t H[16];
+
+            ::memset(H, 0, sizeof(H));
+            Blocks(_context, MBEDTLS_AES_ENCRYPT, 1, H, H);
+
+            uint64_t vh = Load64(&(H[0]));
+            uint64_t vl = Load64(&(H[8]));
+
+            _HL[0] = 0;
+            _HH[0] = 0;
+            _HL[8] = vl;
+            _HH[8] = vh;
+
+            for (uint8_t index = 4; index > 0; index >>= 1) {
+                const uint64_t reduce = (vl & 1) * 0xe1000000ULL;
+                vl = (vh << 63) | (vl >> 1);
+                vh = (vh >> 1) ^ (reduce << 32);
+                _HL[index] = vl;
+                _HH[index] = vh;
+            }
+            for (uint8_t index = 2; index <= 8; index <<= 1) {
+                for (uint8_t entry = 1; entry < index; entry++) {
+                    _HH[index + entry] = _HH[index] ^ _HH[entry];
+                    _HL[index + entry] = _HL[index] ^ _HL[entry];
+                }
+            }
+
+            AESAcceleration::GHASHKey(H, _hkey);
+
+            ::memset(H, 0, sizeof(H));
+        }
+
+        return (result);
+    }
+
+    uint32_t AESGCM::Encrypt(const uint8_t ivLength, const uint8_t iv[], const uint32_t aadLength, const uint8_t aad[],
+        const uint32_t length, const uint8_t input[], uint8_t output[], uint8_t tag[16])
+    {
+        ASSERT(ivLength > 0);
+
+        Crypt(true, ivLength, iv, aadLength, aad, length, input, output, tag);
+
+        return (Core::ERROR_NONE);
+    }
+
+    uint32_t AESGCM::Decrypt(const uint8_t ivLength, const uint8_t iv[], const uint32_t aadLength, const uint8_t aad[],
+        const uint32_t length, const uint8_t input[], uint8_t output[], const uint8_t tag[16])
+    {
+        ASSERT(ivLength > 0);
+
+        uint32_t result = Core::ERROR_NONE;
+        uint8_t calculated[16];
+        uint8_t difference = 0;
+
+        Crypt(false, ivLength, iv, aadLength, aad, length, input, output, calculated);
+
+        // All bytes, no early exit, it should not tell how much of the tag was right.
+        for (uint8_t index = 0; index < sizeof(calculated); index++) {
+            difference |= (calculated[index] ^ tag[index]);
+        }
+
+        if (difference != 0) {
+            ::memset(output, 0, length);
+            result = Core::ERROR_INVALID_SIGNATURE;
+        }
+
+        return (result);
+    }
+
+    void AESGCM::Hash(uint8_t X[16], const uint32_t length, const uint8_t data[]) const
+    {
+        const uint32_t blocks = (length / 16);
+        const uint32_t rest = (length % 16);
+
+        if (AESAcceleration::Active() == true) {
+            AESAcceleration::GHASH(_hkey, X, blocks, data);
+        } else {
+            for (uint32_t index = 0; index < blocks; index++) {
+                Xor(16, X, &(data[index * 16]), X);
+                Multiply(_HL, _HH, X);
+            }
+        }
+
+        if (rest != 0) {
+            // The last block is padded with zeroes, which leaves those bytes of X as they are.
+            Xor(rest, X, &(data[blocks * 16]), X);
+
+            if (AESAcceleration::Active() == true) {
+                uint8_t zero[16];
+                ::memset(zero, 0, sizeof(zero));
+                AESAcceleration::GHASH(_hkey, X, 1, zero);
+            } else {
+                Multiply(_HL, _HH, X);
+            }
+        }
+    }
+
+    void AESGCM::Crypt(const bool encrypt, const uint8_t ivLength, const uint8_t iv[], const uint32_t aadLength, const uint8_t aad[],
+        const uint32_t length, const uint8_t input[], uint8_t output[], uint8_t tag[16])
+    {
+        uint8_t J0[16];
+        uint8_t X[16];
+        uint8_t block[16];
+
+        ::memset(X, 0, sizeof(X));
+
+        if (ivLength == 12) {
+            ::memcpy(J0, iv, 12);
+            J0[12] = 0;
+            J0[13] = 0;
+            J0[14] = 0;
+            J0[15] = 1;
+        } else {
+            ::memset(J0, 0, sizeof(J0));
+            Hash(J0, ivLength, iv);
+            ::memset(block, 0, 8);
+            Store64(static_cast<uint64_t>(ivLength) << 3, &(block[8]));
+            Hash(J0, sizeof(block), block);
+        }
+
+        Hash(X, aadLength, aad);
+
+        uint32_t counter = ((J0[12] << 24) | (J0[13] << 16) | (J0[14] << 8) | J0[15]);
+        uint32_t offset = 0;
+
+        while (offset < length) {
+            uint8_t keys[Batch * 16];
+            const uint32_t size = std::min(static_cast<uint32_t>(length - offset), static_cast<uint32_t>(sizeof(keys)));
+            const uint32_t blocks = ((size + 15) / 16);
+
+            // inc32: only the last 32 bits of the counter block count.
+            for (uint32_t index = 0; index < blocks; index++) {
+                uint8_t* key = &(keys[index * 16]);
+
+                counter++;
+                ::memcpy(key, J0, 12);
+                key[12] = static_cast<uint8_t>(counter >> 24);
+                key[13] = static_cast<uint8_t>(counter >> 16);
+                key[14] = static_cast<uint8_t>(counter >> 8);
+                key[15] = static_cast<uint8_t>(counter);
+            }
+
+            Blocks(_context, MBEDTLS_AES_ENCRYPT, blocks, keys, keys);
+
+            // The hash is over the cipher text, so before decrypting, the input may be the output.
+            if (encrypt == false) {
+                Hash(X, size, &(input[offset]));
+            }
+
+            Xor(size, &(input[offset]), keys, &(output[offset]));
+
+            if (encrypt == true) {
+                Hash(X, size, &(output[offset]));
+            }
+
+            offset += size;
+        }
+
+        Store64(static_cast<uint64_t>(aadLength) << 3, &(block[0]));
+        Store64(static_cast<uint64_t>(length) << 3, &(block[8]));
+        Hash(X, sizeof(block), block);
+
+        Blocks(_context, MBEDTLS_AES_ENCRYPT, 1, J0, block);
+        Xor(16, X, block, tag);
+    }
 }
 } // namespace WPEFramework::Crypto
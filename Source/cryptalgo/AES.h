@@ -31,7 +31,14 @@ namespace Crypto {
         AES_CBC,
         AES_CFB8,
         AES_CFB128,
-        AES_OFB
+        AES_OFB,
+        AES_CTR
+    };
+
+    enum aesEngine : uint8_t {
+        AES_ENGINE_TABLES,
+        AES_ENGINE_AESNI,
+        AES_ENGINE_ARMV8
     };
 
     enum bitLength : uint16_t {
@@ -40,6 +47,12 @@ namespace Crypto {
         BITLENGTH_256 = 256
     };
 
+    // What does the AES rounds, for all modes. The CPU instructions are used, if they are there.
+    // Switching them off (accelerated = false) is for testing and measuring, it returns the engine
+    // that is used from then on.
+    EXTERNAL aesEngine AESEngine();
+    EXTERNAL aesEngine AESEngine(const bool accelerated);
+
     class EXTERNAL AESEncryption {
     private:
         AESEncryption() = delete;
@@ -72,6 +85,7 @@ namespace Crypto {
         aesType _type;
         mbedtls_aes_context _context;
         uint8_t _iv[16];
+        uint8_t _stream[16];
         size_t _offset;
     };
 
@@ -109,8 +123,42 @@ namespace Crypto {
         aesType _type;
         mbedtls_aes_context _context;
         uint8_t _iv[16];
+        uint8_t _stream[16];
         size_t _offset;
     };
+
+    // Authenticated encryption (NIST SP 800-38D), a message at a time. The IV must never be used
+    // twice with the same key, 12 bytes is the recommended, and fastest, length. Decrypt returns
+    // Core::ERROR_INVALID_SIGNATURE, and clears the output, if the tag does not match.
+    class EXTERNAL AESGCM {
+    private:
+        AESGCM(const AESGCM&) = delete;
+        AESGCM& operator=(const AESGCM&) = delete;
+
+    public:
+        AESGCM();
+        ~AESGCM();
+
+    public:
+        uint32_t Key(const uint8_t length, const uint8_t key[]);
+
+        uint32_t Encrypt(const uint8_t ivLength, const uint8_t iv[], const uint32_t aadLength, const uint8_t aad[],
+            const uint32_t length, const uint8_t input[], uint8_t output[], uint8_t tag[16]);
+        uint32_t Decrypt(const uint8_t ivLength, const uint8_t iv[], const uint32_t aadLength, const uint8_t aad[],
+            const uint32_t length, const uint8_t input[], uint8_t output[], const uint8_t tag[16]);
+
+    private:
+        void Crypt(const bool encrypt, const uint8_t ivLength, const uint8_t iv[], const uint32_t aadLength, const uint8_t aad[],
+            const uint32_t length, const uint8_t input[], uint8_t output[], uint8_t tag[16]);
+        void Hash(uint8_t X[16], const uint32_t length, const uint8_t data[]) const;
+
+    private:
+        mbedtls_aes_context _context;
+        // H in the 4 bits tables for the table GHASH, and H to H^4 for the instructions.
+        uint64_t _HL[16];
+        uint64_t _HH[16];
+        uint8_t _hkey[64];
+    };
 }
 } // namespace Crypto
 
@@ -0,0 +1,559 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AESAcceleration.h"
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#if defined(__x86_64__) || defined(__i386__)
+#define __AES_NI__
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__linux__)
+#define __AES_ARMV8__
+#include <arm_neon.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace WPEFramework {
+namespace Crypto {
+
+    static constexpr uint8_t MaxRounds = 14;
+    static constexpr uint8_t Interleave = 8;
+
+#ifdef __AES_NI__
+
+#define AES_NI_TARGET __attribute__((target("aes,pclmul,ssse3,sse4.1")))
+
+    AES_NI_TARGET static void EncryptNI(const mbedtls_aes_context& context, uint32_t blocks, const uint8_t input[], uint8_t output[])
+    {
+        const uint8_t rounds = static_cast<uint8_t>(context.nr);
+        const __m128i* keys = reinterpret_cast<const __m128i*>(context.rk);
+        __m128i key[MaxRounds + 1];
+
+        for (uint8_t index = 0; index <= rounds; index++) {
+            key[index] = _mm_loadu_si128(&keys[index]);
+        }
+
+        while (blocks >= Interleave) {
+            __m128i block[Interleave];
+
+            for (uint8_t index = 0; index < Interleave; index++) {
+                block[index] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[index * 16])), key[0]);
+            }
+            for (uint8_t round = 1; round < rounds; round++) {
+                for (uint8_t index = 0; index < Interleave; index++) {
+                    block[index] = _mm_aesenc_si128(block[index], key[round]);
+                }
+            }
+            for (uint8_t index = 0; index < Interleave; index++) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[index * 16]), _mm_aesenclast_si128(block[index], key[rounds]));
+            }
+
+            input += (Interleave * 16);
+            output += (Interleave * 16);
+            blocks -= Interleave;
+        }
+
+        while (blocks > 0) {
+            __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)), key[0]);
+
+            for (uint8_t round = 1; round < rounds; round++) {
+                block = _mm_aesenc_si128(block, key[round]);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_aesenclast_si128(block, key[rounds]));
+
+            input += 16;
+            output += 16;
+            blocks--;
+        }
+    }
+
+    AES_NI_TARGET static void DecryptNI(const mbedtls_aes_context& context, uint32_t blocks, const uint8_t input[], uint8_t output[])
+    {
+        const uint8_t rounds = static_cast<uint8_t>(context.nr);
+        const __m128i* keys = reinterpret_cast<const __m128i*>(context.rk);
+        __m128i key[MaxRounds + 1];
+
+        for (uint8_t index = 0; index <= rounds; index++) {
+            key[index] = _mm_loadu_si128(&keys[index]);
+        }
+
+        while (blocks >= Interleave) {
+            __m128i block[Interleave];
+
+            for (uint8_t index = 0; index < Interleave; index++) {
+                block[index] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[index * 16])), key[0]);
+            }
+            for (uint8_t round = 1; round < rounds; round++) {
+                for (uint8_t index = 0; index < Interleave; index++) {
+                    block[index] = _mm_aesdec_si128(block[index], key[round]);
+                }
+            }
+            for (uint8_t index = 0; index < Interleave; index++) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[index * 16]), _mm_aesdeclast_si128(block[index], key[rounds]));
+            }
+
+            input += (Interleave * 16);
+            output += (Interleave * 16);
+            blocks -= Interleave;
+        }
+
+        while (blocks > 0) {
+            __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)), key[0]);
+
+            for (uint8_t round = 1; round < rounds; round++) {
+                block = _mm_aesdec_si128(block, key[round]);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_aesdeclast_si128(block, key[rounds]));
+
+            input += 16;
+            output += 16;
+            blocks--;
+        }
+    }
+
+    // GHASH works on bit reflected values, with the bytes swapped the carry-less multiplication
+    // gives the product shifted one bit, which is corrected before the reduction. See Intel's
+    // "Carry-Less Multiplication Instruction and its Usage for Computing the GCM Mode".
+    AES_NI_TARGET static inline __m128i SwapNI(const __m128i value)
+    {
+        return (_mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+    }
+
+    // The 256 bits product, not reduced yet, so products can be added before the reduction.
+    AES_NI_TARGET static inline void MultiplyNI(const __m128i a, const __m128i b, __m128i& low, __m128i& high)
+    {
+        __m128i middle = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01));
+
+        low = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x00), _mm_slli_si128(middle, 8));
+        high = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x11), _mm_srli_si128(middle, 8));
+    }
+
+    AES_NI_TARGET static inline __m128i ReduceNI(__m128i low, __m128i high)
+    {
+        // Shift the 256 bits left by one.
+        __m128i carryLow = _mm_srli_epi32(low, 31);
+        __m128i carryHigh = _mm_srli_epi32(high, 31);
+
+        low = _mm_slli_epi32(low, 1);
+        high = _mm_slli_epi32(high, 1);
+
+        const __m128i crossing = _mm_srli_si128(carryLow, 12);
+        carryHigh = _mm_slli_si128(carryHigh, 4);
+        carryLow = _mm_slli_si128(carryLow, 4);
+        low = _mm_or_si128(low, carryLow);
+        high = _mm_or_si128(_mm_or_si128(high, carryHigh), crossing);
+
+        // Reduce modulo x^128 + x^7 + x^2 + x + 1.
+        __m128i first = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(low, 31), _mm_slli_epi32(low, 30)), _mm_slli_epi32(low, 25));
+        const __m128i remainder = _mm_srli_si128(first, 4);
+
+        low = _mm_xor_si128(low, _mm_slli_si128(first, 12));
+
+        __m128i second = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(low, 1), _mm_srli_epi32(low, 2)), _mm_srli_epi32(low, 7));
+        second = _mm_xor_si128(second, remainder);
+
+        return (_mm_xor_si128(high, _mm_xor_si128(low, second)));
+    }
+
+    AES_NI_TARGET static void GHASHKeyNI(const uint8_t H[16], uint8_t key[AESAcceleration::GHASHKeySize])
+    {
+        const __m128i h = SwapNI(_mm_loadu_si128(reinterpret_cast<const __m128i*>(H)));
+        __m128i power = h;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&key[0]), h);
+
+        for (uint8_t index = 1; index < 4; index++) {
+            __m128i low, high;
+            MultiplyNI(power, h, low, high);
+            power = ReduceNI(low, high);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&key[index * 16]), power);
+        }
+    }
+
+    AES_NI_TARGET static void GHASHNI(const uint8_t key[AESAcceleration::GHASHKeySize], uint8_t X[16], uint32_t blocks, const uint8_t data[])
+    {
+        const __m128i h1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&key[0]));
+        const __m128i h2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&key[16]));
+        const __m128i h3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&key[32]));
+        const __m128i h4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&key[48]));
+        __m128i x = SwapNI(_mm_loadu_si128(reinterpret_cast<const __m128i*>(X)));
+
+        // (X + D0).H^4 + D1.H^3 + D2.H^2 + D3.H, one reduction for four blocks.
+        while (blocks >= 4) {
+            __m128i low, high, partLow, partHigh;
+
+            MultiplyNI(_mm_xor_si128(x, SwapNI(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[0])))), h4, low, high);
+            MultiplyNI(SwapNI(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[16]))), h3, partLow, partHigh);
+            low = _mm_xor_si128(low, partLow);
+            high = _mm_xor_si128(high, partHigh);
+            MultiplyNI(SwapNI(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[32]))), h2, partLow, partHigh);
+            low = _mm_xor_si128(low, partLow);
+            high = _mm_xor_si128(high, partHigh);
+            MultiplyNI(SwapNI(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[48]))), h1, partLow, partHigh);
+            low = _mm_xor_si128(low, partLow);
+            high = _mm_xor_si128(high, partHigh);
+
+            x = ReduceNI(low, high);
+
+            data += 64;
+            blocks -= 4;
+        }
+
+        while (blocks > 0) {
+            __m128i low, high;
+
+            MultiplyNI(_mm_xor_si128(x, SwapNI(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)))), h1, low, high);
+            x = ReduceNI(low, high);
+
+            data += 16;
+            blocks--;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(X), SwapNI(x));
+    }
+
+    static bool Detect()
+    {
+        unsigned int eax, ebx, ecx, edx;
+
+        // AES-NI (ecx 25), PCLMULQDQ (ecx 1), SSSE3 (ecx 9) and SSE4.1 (ecx 19).
+        return ((__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & ((1u << 25) | (1u << 1) | (1u << 9) | (1u << 19))) == ((1u << 25) | (1u << 1) | (1u << 9) | (1u << 19))));
+    }
+
+    static constexpr aesEngine Hardware = AES_ENGINE_AESNI;
+
+#endif // __AES_NI__
+
+#ifdef __AES_ARMV8__
+
+#ifdef __clang__
+#define AES_ARMV8_TARGET __attribute__((target("crypto")))
+#else
+#define AES_ARMV8_TARGET __attribute__((target("+crypto")))
+#endif
+
+    AES_ARMV8_TARGET static void EncryptARMv8(const mbedtls_aes_context& context, uint32_t blocks, const uint8_t input[], uint8_t output[])
+    {
+        const uint8_t rounds = static_cast<uint8_t>(context.nr);
+        const uint8_t* keys = reinterpret_cast<const uint8_t*>(context.rk);
+        uint8x16_t key[MaxRounds + 1];
+
+        for (uint8_t index = 0; index <= rounds; index++) {
+            key[index] = vld1q_u8(&keys[index * 16]);
+        }
+
+        // AESE is AddRoundKey, SubBytes and ShiftRows, so the last round key is added separately.
+        while (blocks >= Interleave) {
+            uint8x16_t block[Interleave];
+
+            for (uint8_t index = 0; index < Interleave; index++) {
+                block[index] = vld1q_u8(&input[index * 16]);
+            }
+            for (uint8_t round = 0; round < (rounds - 1); round++) {
+                for (uint8_t index = 0; index < Interleave; index++) {
+                    block[index] = vaesmcq_u8(vaeseq_u8(block[index], key[round]));
+                }
+            }
+            for (uint8_t index = 0; index < Interleave; index++) {
+                vst1q_u8(&output[index * 16], veorq_u8(vaeseq_u8(block[index], key[rounds - 1]), key[rounds]));
+            }
+
+            input += (Interleave * 16);
+            output += (Interleave * 16);
+            blocks -= Interleave;
+        }
+
+        while (blocks > 0) {
+            uint8x16_t block = vld1q_u8(input);
+
+            for (uint8_t round = 0; round < (rounds - 1); round++) {
+                block = vaesmcq_u8(vaeseq_u8(block, key[round]));
+            }
+            vst1q_u8(output, veorq_u8(vaeseq_u8(block, key[rounds - 1]), key[rounds]));
+
+            input += 16;
+            output += 16;
+            blocks--;
+        }
+    }
+
+    AES_ARMV8_TARGET static void DecryptARMv8(const mbedtls_aes_context& context, uint32_t blocks, const uint8_t input[], uint8_t output[])
+    {
+        const uint8_t rounds = static_cast<uint8_t>(context.nr);
+        const uint8_t* keys = reinterpret_cast<const uint8_t*>(context.rk);
+        uint8x16_t key[MaxRounds + 1];
+
+        for (uint8_t index = 0; index <= rounds; index++) {
+            key[index] = vld1q_u8(&keys[index * 16]);
+        }
+
+        while (blocks >= Interleave) {
+            uint8x16_t block[Interleave];
+
+            for (uint8_t index = 0; index < Interleave; index++) {
+                block[index] = vld1q_u8(&input[index * 16]);
+            }
+            for (uint8_t round = 0; round < (rounds - 1); round++) {
+                for (uint8_t index = 0; index < Interleave; index++) {
+                    block[index] = vaesimcq_u8(vaesdq_u8(block[index], key[round]));
+                }
+            }
+            for (uint8_t index = 0; index < Interleave; index++) {
+                vst1q_u8(&output[index * 16], veorq_u8(vaesdq_u8(block[index], key[rounds - 1]), key[rounds]));
+            }
+
+            input += (Interleave * 16);
+            output += (Interleave * 16);
+            blocks -= Interleave;
+        }
+
+        while (blocks > 0) {
+            uint8x16_t block = vld1q_u8(input);
+
+            for (uint8_t round = 0; round < (rounds - 1); round++) {
+                block = vaesimcq_u8(vaesdq_u8(block, key[round]));
+            }
+            vst1q_u8(output, veorq_u8(vaesdq_u8(block, key[rounds - 1]), key[rounds]));
+
+            input += 16;
+            output += 16;
+            blocks--;
+        }
+    }
+
+    // The same algorithm as the x86 one, the byte shifts of SSE are done with VEXT.
+    AES_ARMV8_TARGET static inline uint8x16_t SwapARMv8(const uint8x16_t value)
+    {
+        const uint8x16_t swapped = vrev64q_u8(value);
+
+        return (vextq_u8(swapped, swapped, 8));
+    }
+
+    template <const int LEFT, const int RIGHT>
+    AES_ARMV8_TARGET static inline uint8x16_t CarrylessARMv8(const uint8x16_t a, const uint8x16_t b)
+    {
+        return (vreinterpretq_u8_p128(vmull_p64(vgetq_lane_p64(vreinterpretq_p64_u8(a), LEFT), vgetq_lane_p64(vreinterpretq_p64_u8(b), RIGHT))));
+    }
+
+    AES_ARMV8_TARGET static inline void MultiplyARMv8(const uint8x16_t a, const uint8x16_t b, uint8x16_t& low, uint8x16_t& high)
+    {
+        const uint8x16_t zero = vdupq_n_u8(0);
+        const uint8x16_t middle = veorq_u8(CarrylessARMv8<0, 1>(a, b), CarrylessARMv8<1, 0>(a, b));
+
+        low = veorq_u8(CarrylessARMv8<0, 0>(a, b), vextq_u8(zero, middle, 8));
+        high = veorq_u8(CarrylessARMv8<1, 1>(a, b), vextq_u8(middle, zero, 8));
+    }
+
+    AES_ARMV8_TARGET static inline uint8x16_t ShiftRight32(const uint8x16_t value, const int bits)
+    {
+        return (vreinterpretq_u8_u32(vshlq_u32(vreinterpretq_u32_u8(value), vdupq_n_s32(-bits))));
+    }
+
+    AES_ARMV8_TARGET static inline uint8x16_t ShiftLeft32(const uint8x16_t value, const int bits)
+    {
+        return (vreinterpretq_u8_u32(vshlq_u32(vreinterpretq_u32_u8(value), vdupq_n_s32(bits))));
+    }
+
+    AES_ARMV8_TARGET static inline uint8x16_t ReduceARMv8(uint8x16_t low, uint8x16_t high)
+    {
+        const uint8x16_t zero = vdupq_n_u8(0);
+
+        uint8x16_t carryLow = ShiftRight32(low, 31);
+        uint8x16_t carryHigh = ShiftRight32(high, 31);
+
+        low = ShiftLeft32(low, 1);
+        high = ShiftLeft32(high, 1);
+
+        const uint8x16_t crossing = vextq_u8(carryLow, zero, 12);
+        carryHigh = vextq_u8(zero, carryHigh, 12);
+        carryLow = vextq_u8(zero, carryLow, 12);
+        low = vorrq_u8(low, carryLow);
+        high = vorrq_u8(vorrq_u8(high, carryHigh), crossing);
+
+        const uint8x16_t first = veorq_u8(veorq_u8(ShiftLeft32(low, 31), ShiftLeft32(low, 30)), ShiftLeft32(low, 25));
+        const uint8x16_t remainder = vextq_u8(first, zero, 4);
+
+        low = veorq_u8(low, vextq_u8(zero, first, 4));
+
+        uint8x16_t second = veorq_u8(veorq_u8(ShiftRight32(low, 1), ShiftRight32(low, 2)), ShiftRight32(low, 7));
+        second = veorq_u8(second, remainder);
+
+        return (veorq_u8(high, veorq_u8(low, second)));
+    }
+
+    AES_ARMV8_TARGET static void GHASHKeyARMv8(const uint8_t H[16], uint8_t key[AESAcceleration::GHASHKeySize])
+    {
+        const uint8x16_t h = SwapARMv8(vld1q_u8(H));
+        uint8x16_t power = h;
+
+        vst1q_u8(&key[0], h);
+
+        for (uint8_t index = 1; index < 4; index++) {
+            uint8x16_t low, high;
+            MultiplyARMv8(power, h, low, high);
+            power = ReduceARMv8(low, high);
+            vst1q_u8(&key[index * 16], power);
+        }
+    }
+
+    AES_ARMV8_TARGET static void GHASHARMv8(const uint8_t key[AESAcceleration::GHASHKeySize], uint8_t X[16], uint32_t blocks, const uint8_t data[])
+    {
+        const uint8x16_t h1 = vld1q_u8(&key[0]);
+        const uint8x16_t h2 = vld1q_u8(&key[16]);
+        const uint8x16_t h3 = vld1q_u8(&key[32]);
+        const uint8x16_t h4 = vld1q_u8(&key[48]);
+        uint8x16_t x = SwapARMv8(vld1q_u8(X));
+
+        while (blocks >= 4) {
+            uint8x16_t low, high, partLow, partHigh;
+
+            MultiplyARMv8(veorq_u8(x, SwapARMv8(vld1q_u8(&data[0]))), h4, low, high);
+            MultiplyARMv8(SwapARMv8(vld1q_u8(&data[16])), h3, partLow, partHigh);
+            low = veorq_u8(low, partLow);
+            high = veorq_u8(high, partHigh);
+            MultiplyARMv8(SwapARMv8(vld1q_u8(&data[32])), h2, partLow, partHigh);
+            low = veorq_u8(low, partLow);
+            high = veorq_u8(high, partHigh);
+            MultiplyARMv8(SwapARMv8(vld1q_u8(&data[48])), h1, partLow, partHigh);
+            low = veorq_u8(low, partLow);
+            high = veorq_u8(high, partHigh);
+
+            x = ReduceARMv8(low, high);
+
+            data += 64;
+            blocks -= 4;
+        }
+
+        while (blocks > 0) {
+            uint8x16_t low, high;
+
+            MultiplyARMv8(veorq_u8(x, SwapARMv8(vld1q_u8(data))), h1, low, high);
+            x = ReduceARMv8(low, high);
+
+            data += 16;
+            blocks--;
+        }
+
+        vst1q_u8(X, SwapARMv8(x));
+    }
+
+    static bool Detect()
+    {
+        const unsigned long capabilities = ::getauxval(AT_HWCAP);
+
+        return (((capabilities & HWCAP_AES) != 0) && ((capabilities & HWCAP_PMULL) != 0));
+    }
+
+    static constexpr aesEngine Hardware = AES_ENGINE_ARMV8;
+
+#endif // __AES_ARMV8__
+
+#if defined(__AES_NI__) || defined(__AES_ARMV8__)
+    static const bool Supported = Detect();
+#else
+    static constexpr bool Supported = false;
+    static constexpr aesEngine Hardware = AES_ENGINE_TABLES;
+#endif
+
+    static std::atomic<bool> Enabled(Supported);
+
+    /* static */ bool AESAcceleration::Active()
+    {
+        return (Enabled.load(std::memory_order_relaxed));
+    }
+
+    /* static */ void AESAcceleration::Encrypt(const mbedtls_aes_context& context, const uint32_t blocks, const uint8_t input[], uint8_t output[])
+    {
+        ASSERT(Active() == true);
+
+#if defined(__AES_NI__)
+        EncryptNI(context, blocks, input, output);
+#elif defined(__AES_ARMV8__)
+        EncryptARMv8(context, blocks, input, output);
+#else
+        DEBUG_VARIABLE(context);
+        DEBUG_VARIABLE(blocks);
+        DEBUG_VARIABLE(input);
+        DEBUG_VARIABLE(output);
+#endif
+    }
+
+    /* static */ void AESAcceleration::Decrypt(const mbedtls_aes_context& context, const uint32_t blocks, const uint8_t input[], uint8_t output[])
+    {
+        ASSERT(Active() == true);
+
+#if defined(__AES_NI__)
+        DecryptNI(context, blocks, input, output);
+#elif defined(__AES_ARMV8__)
+        DecryptARMv8(context, blocks, input, output);
+#else
+        DEBUG_VARIABLE(context);
+        DEBUG_VARIABLE(blocks);
+        DEBUG_VARIABLE(input);
+        DEBUG_VARIABLE(output);
+#endif
+    }
+
+    /* static */ void AESAcceleration::GHASHKey(const uint8_t H[16], uint8_t key[GHASHKeySize])
+    {
+        // The key is made even if the instructions are switched off, they might be switched on.
+        if (Supported == true) {
+#if defined(__AES_NI__)
+            GHASHKeyNI(H, key);
+#elif defined(__AES_ARMV8__)
+            GHASHKeyARMv8(H, key);
+#endif
+        } else {
+            DEBUG_VARIABLE(H);
+            ::memset(key, 0, GHASHKeySize);
+        }
+    }
+
+    /* static */ void AESAcceleration::GHASH(const uint8_t key[GHASHKeySize], uint8_t X[16], const uint32_t blocks, const uint8_t data[])
+    {
+        ASSERT(Active() == true);
+
+#if defined(__AES_NI__)
+        GHASHNI(key, X, blocks, data);
+#elif defined(__AES_ARMV8__)
+        GHASHARMv8(key, X, blocks, data);
+#else
+        DEBUG_VARIABLE(key);
+        DEBUG_VARIABLE(X);
+        DEBUG_VARIABLE(blocks);
+        DEBUG_VARIABLE(data);
+#endif
+    }
+
+    aesEngine AESEngine()
+    {
+        return (Enabled.load(std::memory_order_relaxed) == true ? Hardware : AES_ENGINE_TABLES);
+    }
+
+    aesEngine AESEngine(const bool accelerated)
+    {
+        Enabled.store((accelerated == true) && (Supported == true), std::memory_order_relaxed);
+
+        return (AESEngine());
+    }
+}
+} // namespace WPEFramework::Crypto
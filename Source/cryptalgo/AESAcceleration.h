@@ -0,0 +1,60 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __AES_ACCELERATION_H
+#define __AES_ACCELERATION_H
+
+#include "AES.h"
+#include "AESImplementation.h"
+#include "Module.h"
+
+namespace WPEFramework {
+namespace Crypto {
+
+    // The AES rounds and the GHASH multiplication done with the instructions the CPU has for them:
+    // AES-NI and PCLMULQDQ on x86, the crypto extensions (AESE/AESD and PMULL) on AArch64. Whether
+    // they are there, is checked once, at run time. If they are not, or if they are switched off,
+    // Active() is false and the callers use the tables of AESImplementation.
+    // The round keys are the ones the tables use (mbedtls_aes_setkey_enc/dec), on a little endian
+    // CPU their bytes are in the order the instructions expect them, the decryption keys are the
+    // "equivalent inverse cipher" ones, which is what AESDEC/AESD need.
+    class AESAcceleration {
+    private:
+        AESAcceleration() = delete;
+        AESAcceleration(const AESAcceleration&) = delete;
+        AESAcceleration& operator=(const AESAcceleration&) = delete;
+
+    public:
+        static constexpr uint8_t GHASHKeySize = 4 * 16;
+
+    public:
+        static bool Active();
+
+        // ECB, any number of blocks, interleaved 8 at a time so the rounds of the blocks overlap.
+        static void Encrypt(const mbedtls_aes_context& context, const uint32_t blocks, const uint8_t input[], uint8_t output[]);
+        static void Decrypt(const mbedtls_aes_context& context, const uint32_t blocks, const uint8_t input[], uint8_t output[]);
+
+        // GHASH (GCM): key holds H to H^4, to take 4 blocks per reduction.
+        static void GHASHKey(const uint8_t H[16], uint8_t key[GHASHKeySize]);
+        static void GHASH(const uint8_t key[GHASHKeySize], uint8_t X[16], const uint32_t blocks, const uint8_t data[]);
+    };
+}
+} // namespace WPEFramework::Crypto
+
+#endif // __AES_ACCELERATION_H
@@ -26,6 +26,7 @@
 */
 
 #include "AESImplementation.h"
+#include "AESAcceleration.h"
 #include <stdio.h>
 #include <string.h>
 extern "C" {
@@ -734,6 +735,15 @@ int mbedtls_aes_crypt_ecb(mbedtls_aes_context* ctx,
     const unsigned char input[16],
     unsigned char output[16])
 {
+    if (WPEFramework::Crypto::AESAcceleration::Active() == true) {
+        if (mode == MBEDTLS_AES_ENCRYPT)
+            WPEFramework::Crypto::AESAcceleration::Encrypt(*ctx, 1, input, output);
+        else
+            WPEFramework::Crypto::AESAcceleration::Decrypt(*ctx, 1, input, output);
+
+        return (0);
+    }
+
 #if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
     if (mbedtls_aesni_has_support(MBEDTLS_AESNI_AES))
         return (mbedtls_aesni_crypt_ecb(ctx, mode, input, output));
@@ -35,16 +35,22 @@ namespace WPEFramework {
 namespace Crypto {
     template <typename HASHALGORITHM>
     class HMACType {
+    private:
+        static constexpr uint8_t Batch = 32;
+
     public:
         HMACType(const HMACType&) = delete;
         HMACType& operator=(const HMACType&) = delete;
 
-        HMACType() : _algorithm() {
+        HMACType() : _computed(false), _inner(), _outer(), _algorithm() {
             Key(EMPTY_STRING);
         }
-        HMACType(const string& key) : _algorithm() {
+        HMACType(const string& key) : _computed(false), _inner(), _outer(), _algorithm() {
             Key(key);
         }
+        HMACType(const uint8_t key[], const uint32_t length) : _computed(false), _inner(), _outer(), _algorithm() {
+            Key(key, length);
+        }
        ~HMACType() = default;
 
     public:
@@ -52,44 +58,55 @@ namespace Crypto {
         static const uint8_t Length = HASHALGORITHM::Length;
 
         void Key(const string& key) {
+            Key(reinterpret_cast<const uint8_t*>(key.c_str()), static_cast<uint32_t>(key.length()));
+        }
+        void Key(const uint8_t key[], const uint32_t length) {
+            uint8_t pad[HASHALGORITHM::BlockSize];
             uint8_t keyLength;
             const uint8_t* encryptionKey;
             HASHALGORITHM hashKey;
 
-            if (key.length() > sizeof(_innerKeyPad)) {
+            if (length > sizeof(pad)) {
                 keyLength = HASHALGORITHM::Length;
 
                 // Calculate the Hash over the key to use that i.s.o. the actual key.
-                hashKey.Input(reinterpret_cast<const uint8_t*>(key.c_str()), static_cast<uint16_t>(key.length()));
+                hashKey.Input(key, length);
                 encryptionKey = hashKey.Result();
             } else {
-                keyLength = static_cast<uint8_t>(key.length());
+                keyLength = static_cast<uint8_t>(length);
 
                 // Use the key as is..
-                encryptionKey = reinterpret_cast<const uint8_t*>(key.c_str());
+                encryptionKey = key;
             }
 
-            // We have a suitable key, move it to the inner and outer pads
-            ::memset(&_innerKeyPad[keyLength], 0x36, sizeof(_innerKeyPad) - keyLength);
-            ::memset(&_outerKeyPad[keyLength], 0x5C, sizeof(_outerKeyPad) - keyLength);
+            // Both hashes start with a block holding the padded key, the same for every message. So
+            // these blocks are hashed once, here, and the messages start from a copy of that state.
+            ::memset(&pad[keyLength], 0x36, sizeof(pad) - keyLength);
+            for (uint8_t index = 0; index < keyLength; index++) {
+                pad[index] = encryptionKey[index] ^ 0x36;
+            }
+            _inner.Reset();
+            _inner.Input(pad, sizeof(pad));
 
-            /* XOR key with inner keypad and outer key pad values */
+            ::memset(&pad[keyLength], 0x5C, sizeof(pad) - keyLength);
             for (uint8_t index = 0; index < keyLength; index++) {
-                _innerKeyPad[index] = encryptionKey[index] ^ 0x36;
-                _outerKeyPad[index] = encryptionKey[index] ^ 0x5c;
+                pad[index] = encryptionKey[index] ^ 0x5C;
             }
+            _outer.Reset();
+            _outer.Input(pad, sizeof(pad));
+
+            ::memset(pad, 0, sizeof(pad));
 
             // Reset the algorithm. We start from scratch..
             Reset();
         }
         inline static uint8_t BlockLength()
         {
-            return (sizeof(_innerKeyPad));
+            return (HASHALGORITHM::BlockSize);
         }
         void Reset()
         {
-            _algorithm.Reset();
-            _algorithm.Input(_innerKeyPad, sizeof(_innerKeyPad));
+            _algorithm = _inner;
             _computed = false;
         }
         const uint8_t* Result()
@@ -102,8 +119,7 @@ namespace Crypto {
                 ::memcpy(hashKey, _algorithm.Result(), sizeof(hashKey));
 
                 // Now use the newly generated key to calulate the outer value..
-                _algorithm.Reset();
-                _algorithm.Input(_outerKeyPad, sizeof(_outerKeyPad));
+                _algorithm = _outer;
                 _algorithm.Input(hashKey, sizeof(hashKey));
             }
 
@@ -113,11 +129,36 @@ namespace Crypto {
         /*
          *  Provide input to HMACType
          */
-        inline void Input(const uint8_t message_array[], const uint16_t length)
+        inline void Input(const uint8_t message_array[], const uint64_t length)
         {
             _algorithm.Input(message_array, length);
         }
 
+        /*
+         *  The HMAC of count messages with the current key, in one go. digests
+         *  receives count * Length bytes. Only for the algorithms that have a
+         *  Digest: SHA1, SHA224 and SHA256.
+         */
+        void Digest(const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[]) const
+        {
+            const uint8_t* inner[Batch];
+            uint32_t innerLengths[Batch];
+
+            _inner.Digest(count, messages, lengths, digests);
+
+            // The outer hashes are taken over the inner ones, in place.
+            for (uint32_t offset = 0; offset < count; offset += Batch) {
+                const uint32_t size = std::min(static_cast<uint32_t>(Batch), count - offset);
+
+                for (uint32_t index = 0; index < size; index++) {
+                    inner[index] = &(digests[(offset + index) * Length]);
+                    innerLengths[index] = Length;
+                }
+
+                _outer.Digest(size, inner, innerLengths, &(digests[offset * Length]));
+            }
+        }
+
         inline HMACType<HASHALGORITHM>& operator<<(const uint8_t message_array[])
         {
             uint16_t length = 0;
@@ -126,7 +167,7 @@ namespace Crypto {
                 length++;
             }
 
-            _algorithm.Input(&message_array, length);
+            _algorithm.Input(message_array, length);
 
             return (*this);
         }
@@ -140,8 +181,8 @@ namespace Crypto {
 
     private:
         bool _computed;
-        uint8_t _innerKeyPad[64];
-        uint8_t _outerKeyPad[64];
+        HASHALGORITHM _inner;
+        HASHALGORITHM _outer;
         HASHALGORITHM _algorithm;
     };
 
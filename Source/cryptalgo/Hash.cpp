@@ -36,6 +36,7 @@
 	*/
 
 #include "Hash.h"
+#include "HashAcceleration.h"
 
 #ifdef __LINUX__
 #include <arpa/inet.h>
@@ -196,6 +197,134 @@
 
 namespace WPEFramework {
 namespace Crypto {
+    // The update functions count in unsigned int, larger input is handed to them in parts of this
+    // size (a multiple of all block sizes).
+    static constexpr uint32_t MaxUpdate = 0x40000000;
+
+    // --------------------------------------------------------------------------------------------
+    // SHA1/SHA224/SHA256 multi-buffer functionality
+    // --------------------------------------------------------------------------------------------
+    // Runs HashAcceleration::Lanes messages side by side, a lane takes the next message as soon as
+    // it is done with the one it had. The blocks are read from the messages in place, only the
+    // last one or two, that hold the padding, are put together in the lane.
+    // With the CPU instructions for one message at a time, that is faster than lanes. The messages
+    // are hashed in place here too, that saves the copying and the bookkeeping of the classes.
+    template <const uint8_t WORDS, const uint8_t LENGTH>
+    static void Sequential(const uint32_t initial[WORDS], const uint64_t prefix, const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[], void (*compress)(uint32_t[WORDS], const uint32_t, const uint8_t[]))
+    {
+        uint32_t state[WORDS];
+        uint8_t tail[128];
+
+        for (uint32_t index = 0; index < count; index++) {
+            const uint32_t length = lengths[index];
+            const uint32_t full = (length / 64);
+            const uint32_t rest = (length % 64);
+            const uint32_t size = ((rest + 9) > 64 ? 128 : 64);
+            uint8_t* digest = &(digests[index * LENGTH]);
+
+            ::memcpy(state, initial, sizeof(state));
+            ::memcpy(tail, &(messages[index][full * 64]), rest);
+            tail[rest] = 0x80;
+            ::memset(&(tail[rest + 1]), 0, size - rest - 1);
+            UNPACK64(((prefix + length) << 3), &(tail[size - 8]));
+
+            if (full > 0) {
+                compress(state, full, messages[index]);
+            }
+            compress(state, (size / 64), tail);
+
+            for (uint8_t word = 0; word < (LENGTH / 4); word++) {
+                UNPACK32(state[word], &(digest[word * 4]));
+            }
+        }
+    }
+
+    template <const uint8_t WORDS, const uint8_t LENGTH>
+    static void MultiBuffer(const uint32_t initial[WORDS], const uint64_t prefix, const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[], void (*compress)(uint32_t[WORDS][HashAcceleration::Lanes], const uint8_t* const[HashAcceleration::Lanes]))
+    {
+        struct Lane {
+            uint32_t message;
+            uint32_t block;
+            uint32_t full; // Blocks read from the message
+            uint32_t blocks; // Including the ones in tail
+            uint8_t tail[128];
+        };
+
+        static const uint8_t idle[64] = {};
+
+        uint32_t state[WORDS][HashAcceleration::Lanes];
+        const uint8_t* blocks[HashAcceleration::Lanes];
+        Lane lanes[HashAcceleration::Lanes];
+        uint32_t next = 0;
+        uint8_t active = 0;
+
+        auto start = [&](const uint8_t index) -> bool {
+            Lane& lane(lanes[index]);
+
+            if (next < count) {
+                const uint32_t length = lengths[next];
+                const uint32_t rest = (length % 64);
+                const uint32_t size = ((rest + 9) > 64 ? 128 : 64);
+
+                lane.message = next++;
+                lane.block = 0;
+                lane.full = (length / 64);
+                lane.blocks = lane.full + (size / 64);
+
+                ::memcpy(lane.tail, &(messages[lane.message][lane.full * 64]), rest);
+                lane.tail[rest] = 0x80;
+                ::memset(&(lane.tail[rest + 1]), 0, size - rest - 1);
+                UNPACK64(((prefix + length) << 3), &(lane.tail[size - 8]));
+
+                for (uint8_t word = 0; word < WORDS; word++) {
+                    state[word][index] = initial[word];
+                }
+            } else {
+                lane.message = count;
+            }
+
+            return (lane.message < count);
+        };
+
+        for (uint8_t index = 0; index < HashAcceleration::Lanes; index++) {
+            if (start(index) == true) {
+                active++;
+            }
+        }
+
+        while (active > 0) {
+            for (uint8_t index = 0; index < HashAcceleration::Lanes; index++) {
+                const Lane& lane(lanes[index]);
+
+                if (lane.message == count) {
+                    blocks[index] = idle;
+                } else if (lane.block < lane.full) {
+                    blocks[index] = &(messages[lane.message][lane.block * 64]);
+                } else {
+                    blocks[index] = &(lane.tail[(lane.block - lane.full) * 64]);
+                }
+            }
+
+            compress(state, blocks);
+
+            for (uint8_t index = 0; index < HashAcceleration::Lanes; index++) {
+                Lane& lane(lanes[index]);
+
+                if ((lane.message < count) && (++lane.block == lane.blocks)) {
+                    uint8_t* digest = &(digests[lane.message * LENGTH]);
+
+                    for (uint8_t word = 0; word < (LENGTH / 4); word++) {
+                        UNPACK32(state[word][index], &(digest[word * 4]));
+                    }
+
+                    if (start(index) == false) {
+                        active--;
+                    }
+                }
+            }
+        }
+    }
+
     // --------------------------------------------------------------------------------------------
     // SHA1 functionality
     // --------------------------------------------------------------------------------------------
@@ -217,31 +346,48 @@ namespace Crypto {
  *  Comments:
  *
  */
-    void SHA1::Input(const uint8_t message_array[], const uint16_t length)
+    void SHA1::Input(const uint8_t message_array[], const uint64_t length)
     {
-        uint16_t counter = length;
+        uint64_t counter = length;
         const uint8_t* current = &(message_array[0]);
 
         ASSERT((_computed == false) || (_corrupted == false));
 
-        while (counter-- && !_corrupted) {
-            _messageBlock[_messageIndex++] = *current;
+        if ((_corrupted == false) && (counter > 0)) {
+            // The length in bits has to fit in 64 bits.
+            if ((counter > (0x1FFFFFFFFFFFFFFFULL - _length))) {
+                _corrupted = true; // Message is too long
+            } else {
+                _length += counter;
 
-            _lengthLow++;
-            if (_lengthLow == 0x20000000) {
-                _lengthLow = 0;
-                _lengthHigh++;
-                if (_lengthHigh == 0) {
-                    _corrupted = true; // Message is too long
+                if (_messageIndex > 0) {
+                    const uint32_t size = static_cast<uint32_t>(std::min(counter, static_cast<uint64_t>(sizeof(_messageBlock) - _messageIndex)));
+
+                    ::memcpy(&(_messageBlock[_messageIndex]), current, size);
+                    _messageIndex += size;
+                    current += size;
+                    counter -= size;
+
+                    if (_messageIndex == sizeof(_messageBlock)) {
+                        Process(_messageBlock, 1);
+                        _messageIndex = 0;
+                    }
                 }
-            }
 
-            if (_messageIndex == 64) {
-                ProcessMessageBlock();
-                _messageIndex = 0;
-            }
+                // Whole blocks are taken from where they are, no need to copy them.
+                while (counter >= sizeof(_messageBlock)) {
+                    const uint32_t blocks = static_cast<uint32_t>(std::min(counter / sizeof(_messageBlock), static_cast<uint64_t>(0x01000000)));
+
+                    Process(current, blocks);
+                    current += (blocks * sizeof(_messageBlock));
+                    counter -= (blocks * sizeof(_messageBlock));
+                }
 
-            current++;
+                if (counter > 0) {
+                    ::memcpy(&(_messageBlock[_messageIndex]), current, static_cast<size_t>(counter));
+                    _messageIndex += static_cast<uint32_t>(counter);
+                }
+            }
         }
     }
 
@@ -299,15 +445,26 @@ namespace Crypto {
         return *this;
     }
 
+    void SHA1::Process(const uint8_t data[], const uint32_t blocks)
+    {
+        if (HashAcceleration::Active() == true) {
+            HashAcceleration::SHA1(H, blocks, data);
+        } else {
+            for (uint32_t index = 0; index < blocks; index++) {
+                ProcessMessageBlock(&(data[index * sizeof(_messageBlock)]));
+            }
+        }
+    }
+
     /*
  *  ProcessMessageBlock
  *
  *  Description:
- *      This function will process the next 512 bits of the message
- *      stored in the _messageBlock array.
+ *      This function will process the next 512 bits of the message.
  *
  *  Parameters:
- *      None.
+ *      block: [in]
+ *          The 64 octets of the block.
  *
  *  Returns:
  *      Nothing.
@@ -318,7 +475,7 @@ namespace Crypto {
  *      in the publication.
  *
  */
-    void SHA1::ProcessMessageBlock()
+    void SHA1::ProcessMessageBlock(const uint8_t block[])
     {
         const unsigned K[] = { // Constants defined for SHA-1
             0x5A827999,
@@ -335,10 +492,10 @@ namespace Crypto {
      *  Initialize the first 16 words in the array W
      */
         for (t = 0; t < 16; t++) {
-            W[t] = ((unsigned)_messageBlock[t * 4]) << 24;
-            W[t] |= ((unsigned)_messageBlock[t * 4 + 1]) << 16;
-            W[t] |= ((unsigned)_messageBlock[t * 4 + 2]) << 8;
-            W[t] |= ((unsigned)_messageBlock[t * 4 + 3]);
+            W[t] = ((unsigned)block[t * 4]) << 24;
+            W[t] |= ((unsigned)block[t * 4 + 1]) << 16;
+            W[t] |= ((unsigned)block[t * 4 + 2]) << 8;
+            W[t] |= ((unsigned)block[t * 4 + 3]);
         }
 
         for (t = 16; t < 80; t++) {
@@ -431,7 +588,7 @@ namespace Crypto {
 
             ::memset(&(_messageBlock[_messageIndex]), 0, (64 - _messageIndex));
 
-            ProcessMessageBlock();
+            Process(_messageBlock, 1);
 
             _messageIndex = 0;
         } else {
@@ -442,16 +599,9 @@ namespace Crypto {
         /*
      *  Store the message length as the last 8 octets
      */
-        _messageBlock[56] = (_lengthHigh >> 24) & 0xFF;
-        _messageBlock[57] = (_lengthHigh >> 16) & 0xFF;
-        _messageBlock[58] = (_lengthHigh >> 8) & 0xFF;
-        _messageBlock[59] = (_lengthHigh)&0xFF;
-        _messageBlock[60] = (_lengthLow >> 21) & 0xFF;
-        _messageBlock[61] = (_lengthLow >> 13) & 0xFF;
-        _messageBlock[62] = (_lengthLow >> 5) & 0xFF;
-        _messageBlock[63] = (_lengthLow << 3) & 0xFF;
+        UNPACK64((_length << 3), &(_messageBlock[56]));
 
-        ProcessMessageBlock();
+        Process(_messageBlock, 1);
 
         uint32_t* writer = reinterpret_cast<uint32_t*>(&_messageBlock[0]);
 
@@ -462,6 +612,25 @@ namespace Crypto {
         _computed = true;
     }
 
+    void SHA1::Digest(const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[]) const
+    {
+        ASSERT(_messageIndex == 0);
+        ASSERT((_computed == false) && (_corrupted == false));
+
+        if (HashAcceleration::Active() == true) {
+            Sequential<5, Length>(H, _length, count, messages, lengths, digests, HashAcceleration::SHA1);
+        } else if ((count > 1) && (HashAcceleration::MultiBuffer() == true)) {
+            MultiBuffer<5, Length>(H, _length, count, messages, lengths, digests, HashAcceleration::SHA1);
+        } else {
+            for (uint32_t index = 0; index < count; index++) {
+                SHA1 hash(*this);
+
+                hash.Input(messages[index], lengths[index]);
+                ::memcpy(&(digests[index * Length]), hash.Result(), Length);
+            }
+        }
+    }
+
     // --------------------------------------------------------------------------------------------
     // MD5 functionality
     // --------------------------------------------------------------------------------------------
@@ -660,18 +829,18 @@ namespace Crypto {
         _context.buffer[15] = _context.d >> 24;
     }
 
-    void MD5::Input(const uint8_t message_array[], const uint16_t length)
+    void MD5::Input(const uint8_t message_array[], const uint64_t length)
     {
-        uint16_t sizeToHandle = length;
+        uint64_t sizeToHandle = length;
         const uint8_t* source = &message_array[0];
 
         while (sizeToHandle > 0) {
-            if (sizeToHandle > 512) {
-                MD5_Update(&_context, source, 512);
-                source += 512;
-                sizeToHandle -= 512;
+            if (sizeToHandle > MaxUpdate) {
+                MD5_Update(&_context, source, MaxUpdate);
+                source += MaxUpdate;
+                sizeToHandle -= MaxUpdate;
             } else {
-                MD5_Update(&_context, source, sizeToHandle);
+                MD5_Update(&_context, source, static_cast<unsigned int>(sizeToHandle));
                 sizeToHandle = 0;
             }
         }
@@ -835,6 +1004,11 @@ namespace Crypto {
         int j;
 #endif
 
+        if (HashAcceleration::Active() == true) {
+            HashAcceleration::SHA256(ctx->h, block_nb, message);
+            block_nb = 0;
+        }
+
         for (i = 0; i < (int)block_nb; i++) {
             sub_block = message + (i << 6);
 
@@ -1081,7 +1255,7 @@ namespace Crypto {
     {
         unsigned int block_nb;
         unsigned int pm_len;
-        unsigned int len_b;
+        uint64_t len_b;
 
 #ifndef UNROLL_LOOPS
         int i;
@@ -1094,7 +1268,7 @@ namespace Crypto {
 
         memset(_context.block + _context.len, 0, pm_len - _context.len);
         _context.block[_context.len] = 0x80;
-        UNPACK32(len_b, _context.block + pm_len - 4);
+        UNPACK64(len_b, _context.block + pm_len - 8);
 
         sha256_transf(&_context, _context.block, block_nb);
 
@@ -1114,18 +1288,18 @@ namespace Crypto {
 #endif /* !UNROLL_LOOPS */
     }
 
-    void SHA256::Input(const uint8_t message_array[], const uint16_t length)
+    void SHA256::Input(const uint8_t message_array[], const uint64_t length)
     {
-        uint16_t sizeToHandle = length;
+        uint64_t sizeToHandle = length;
         const uint8_t* source = &message_array[0];
 
         while (sizeToHandle > 0) {
-            if (sizeToHandle > SHA256_BLOCK_SIZE) {
-                sha256_update(&_context, source, SHA256_BLOCK_SIZE);
-                source += SHA256_BLOCK_SIZE;
-                sizeToHandle -= SHA256_BLOCK_SIZE;
+            if (sizeToHandle > MaxUpdate) {
+                sha256_update(&_context, source, MaxUpdate);
+                source += MaxUpdate;
+                sizeToHandle -= MaxUpdate;
             } else {
-                sha256_update(&_context, source, sizeToHandle);
+                sha256_update(&_context, source, static_cast<unsigned int>(sizeToHandle));
                 sizeToHandle = 0;
             }
         }
@@ -1186,6 +1360,25 @@ namespace Crypto {
         return *this;
     }
 
+    void SHA256::Digest(const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[]) const
+    {
+        ASSERT(_context.len == 0);
+        ASSERT(_computed == false);
+
+        if (HashAcceleration::Active() == true) {
+            Sequential<8, Length>(_context.h, _context.tot_len, count, messages, lengths, digests, HashAcceleration::SHA256);
+        } else if ((count > 1) && (HashAcceleration::MultiBuffer() == true)) {
+            MultiBuffer<8, Length>(_context.h, _context.tot_len, count, messages, lengths, digests, HashAcceleration::SHA256);
+        } else {
+            for (uint32_t index = 0; index < count; index++) {
+                SHA256 hash(*this);
+
+                hash.Input(messages[index], lengths[index]);
+                ::memcpy(&(digests[index * Length]), hash.Result(), Length);
+            }
+        }
+    }
+
     // --------------------------------------------------------------------------------------------
     // SHA224 functionality
     // --------------------------------------------------------------------------------------------
@@ -1249,7 +1442,7 @@ namespace Crypto {
     {
         unsigned int block_nb;
         unsigned int pm_len;
-        unsigned int len_b;
+        uint64_t len_b;
 
 #ifndef UNROLL_LOOPS
         int i;
@@ -1262,7 +1455,7 @@ namespace Crypto {
 
         memset(_context.block + _context.len, 0, pm_len - _context.len);
         _context.block[_context.len] = 0x80;
-        UNPACK32(len_b, _context.block + pm_len - 4);
+        UNPACK64(len_b, _context.block + pm_len - 8);
 
         sha256_transf(&_context, _context.block, block_nb);
 
@@ -1281,18 +1474,18 @@ namespace Crypto {
 #endif /* !UNROLL_LOOPS */
     }
 
-    void SHA224::Input(const uint8_t message_array[], const uint16_t length)
+    void SHA224::Input(const uint8_t message_array[], const uint64_t length)
     {
-        uint16_t sizeToHandle = length;
+        uint64_t sizeToHandle = length;
         const uint8_t* source = &message_array[0];
 
         while (sizeToHandle > 0) {
-            if (sizeToHandle > SHA224_BLOCK_SIZE) {
-                sha224_update(&_context, source, SHA224_BLOCK_SIZE);
-                source += SHA224_BLOCK_SIZE;
-                sizeToHandle -= SHA224_BLOCK_SIZE;
+            if (sizeToHandle > MaxUpdate) {
+                sha224_update(&_context, source, MaxUpdate);
+                source += MaxUpdate;
+                sizeToHandle -= MaxUpdate;
             } else {
-                sha224_update(&_context, source, sizeToHandle);
+                sha224_update(&_context, source, static_cast<unsigned int>(sizeToHandle));
                 sizeToHandle = 0;
             }
         }
@@ -1353,6 +1546,25 @@ namespace Crypto {
         return *this;
     }
 
+    void SHA224::Digest(const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[]) const
+    {
+        ASSERT(_context.len == 0);
+        ASSERT(_computed == false);
+
+        if (HashAcceleration::Active() == true) {
+            Sequential<8, Length>(_context.h, _context.tot_len, count, messages, lengths, digests, HashAcceleration::SHA256);
+        } else if ((count > 1) && (HashAcceleration::MultiBuffer() == true)) {
+            MultiBuffer<8, Length>(_context.h, _context.tot_len, count, messages, lengths, digests, HashAcceleration::SHA256);
+        } else {
+            for (uint32_t index = 0; index < count; index++) {
+                SHA224 hash(*this);
+
+                hash.Input(messages[index], lengths[index]);
+                ::memcpy(&(digests[index * Length]), hash.Result(), Length);
+            }
+        }
+    }
+
     // --------------------------------------------------------------------------------------------
     // SHA512 functionality
     // --------------------------------------------------------------------------------------------
@@ -1583,7 +1795,7 @@ namespace Crypto {
     {
         unsigned int block_nb;
         unsigned int pm_len;
-        unsigned int len_b;
+        uint64_t len_b;
 
 #ifndef UNROLL_LOOPS
         int i;
@@ -1596,7 +1808,8 @@ namespace Crypto {
 
         memset(_context.block + _context.len, 0, pm_len - _context.len);
         _context.block[_context.len] = 0x80;
-        UNPACK32(len_b, _context.block + pm_len - 4);
+        UNPACK64((_context.tot_len + _context.len) >> 61, _context.block + pm_len - 16);
+        UNPACK64(len_b, _context.block + pm_len - 8);
 
         sha512_transf(&_context, _context.block, block_nb);
 
@@ -1616,18 +1829,18 @@ namespace Crypto {
 #endif /* !UNROLL_LOOPS */
     }
 
-    void SHA512::Input(const uint8_t message_array[], const uint16_t length)
+    void SHA512::Input(const uint8_t message_array[], const uint64_t length)
     {
-        uint16_t sizeToHandle = length;
+        uint64_t sizeToHandle = length;
         const uint8_t* source = &message_array[0];
 
         while (sizeToHandle > 0) {
-            if (sizeToHandle > SHA512_BLOCK_SIZE) {
-                sha512_update(&_context, source, SHA512_BLOCK_SIZE);
-                source += SHA512_BLOCK_SIZE;
-                sizeToHandle -= SHA512_BLOCK_SIZE;
+            if (sizeToHandle > MaxUpdate) {
+                sha512_update(&_context, source, MaxUpdate);
+                source += MaxUpdate;
+                sizeToHandle -= MaxUpdate;
             } else {
-                sha512_update(&_context, source, sizeToHandle);
+                sha512_update(&_context, source, static_cast<unsigned int>(sizeToHandle));
                 sizeToHandle = 0;
             }
         }
@@ -1752,7 +1965,7 @@ namespace Crypto {
     {
         unsigned int block_nb;
         unsigned int pm_len;
-        unsigned int len_b;
+        uint64_t len_b;
 
 #ifndef UNROLL_LOOPS
         int i;
@@ -1765,7 +1978,8 @@ namespace Crypto {
 
         memset(_context.block + _context.len, 0, pm_len - _context.len);
         _context.block[_context.len] = 0x80;
-        UNPACK32(len_b, _context.block + pm_len - 4);
+        UNPACK64((_context.tot_len + _context.len) >> 61, _context.block + pm_len - 16);
+        UNPACK64(len_b, _context.block + pm_len - 8);
 
         sha512_transf(&_context, _context.block, block_nb);
 
@@ -1783,18 +1997,18 @@ namespace Crypto {
 #endif /* !UNROLL_LOOPS */
     }
 
-    void SHA384::Input(const uint8_t message_array[], const uint16_t length)
+    void SHA384::Input(const uint8_t message_array[], const uint64_t length)
     {
-        uint16_t sizeToHandle = length;
+        uint64_t sizeToHandle = length;
         const uint8_t* source = &message_array[0];
 
         while (sizeToHandle > 0) {
-            if (sizeToHandle > SHA384_BLOCK_SIZE) {
-                sha384_update(&_context, source, SHA384_BLOCK_SIZE);
-                source += SHA384_BLOCK_SIZE;
-                sizeToHandle -= SHA384_BLOCK_SIZE;
+            if (sizeToHandle > MaxUpdate) {
+                sha384_update(&_context, source, MaxUpdate);
+                source += MaxUpdate;
+                sizeToHandle -= MaxUpdate;
             } else {
-                sha384_update(&_context, source, sizeToHandle);
+                sha384_update(&_context, source, static_cast<unsigned int>(sizeToHandle));
                 sizeToHandle = 0;
             }
         }
@@ -80,17 +80,29 @@ namespace Crypto {
         HASH_SHA512 = 64
     };
 
-    class EXTERNAL SHA1 {
-    private:
-        SHA1(const SHA1&);
-        SHA1& operator=(const SHA1&);
+    enum hashEngine : uint8_t {
+        HASH_ENGINE_PORTABLE,
+        HASH_ENGINE_MULTIBUFFER, // Portable, but Digest hashes 8 messages at a time (AVX2)
+        HASH_ENGINE_SHANI,
+        HASH_ENGINE_ARMV8
+    };
+
+    // What does the SHA-1 and SHA-256 compression, the best the CPU has is used. Limiting it (to
+    // HASH_ENGINE_PORTABLE or HASH_ENGINE_MULTIBUFFER) is for testing and measuring, it returns
+    // the engine that is used from then on.
+    EXTERNAL hashEngine HashEngine();
+    EXTERNAL hashEngine HashEngine(const hashEngine highest);
 
+    class EXTERNAL SHA1 {
     public:
+        SHA1(const SHA1&) = default;
+        SHA1& operator=(const SHA1&) = default;
+
         inline SHA1()
         {
             Reset();
         }
-        inline SHA1(const uint8_t message_array[], const uint16_t length)
+        inline SHA1(const uint8_t message_array[], const uint64_t length)
         {
             Reset();
 
@@ -103,11 +115,11 @@ namespace Crypto {
     public:
         static const EnumHashType Type = HASH_SHA1;
         static const uint8_t Length = 20;
+        static const uint8_t BlockSize = 64;
 
         void Reset()
         {
-            _lengthLow = 0;
-            _lengthHigh = 0;
+            _length = 0;
             _messageIndex = 0;
 
             H[0] = 0x67452301;
@@ -137,16 +149,24 @@ namespace Crypto {
         /*
          *  Provide input to SHA1
          */
-        void Input(const uint8_t message_array[], const uint16_t length);
+        void Input(const uint8_t message_array[], const uint64_t length);
+
+        /*
+         *  Hash count messages in one go, each one as if it was the input
+         *  following what this object got so far (which must be a multiple of
+         *  BlockSize). digests receives count * Length bytes.
+         */
+        void Digest(const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[]) const;
 
         SHA1& operator<<(const uint8_t message_array[]);
         SHA1& operator<<(const uint8_t message_element);
 
     private:
         /*
-         *  Process the next 512 bits of the message
+         *  Process the next blocks of 512 bits of the message
          */
-        void ProcessMessageBlock();
+        void Process(const uint8_t data[], const uint32_t blocks);
+        void ProcessMessageBlock(const uint8_t block[]);
 
         /*
          *  Pads the current message block to 512 bits
@@ -178,8 +198,7 @@ namespace Crypto {
 
         uint32_t H[5]; // Message digest buffers
 
-        uint32_t _lengthLow; // Message length in bits
-        uint32_t _lengthHigh; // Message length in bits
+        uint64_t _length; // Message length in bytes
 
         uint8_t _messageBlock[64]; // 512-bit message blocks
         uint32_t _messageIndex; // Index into message block array
@@ -189,11 +208,10 @@ namespace Crypto {
     };
 
     class EXTERNAL MD5 {
-    private:
-        MD5(const MD5&);
-        MD5& operator=(const MD5&);
-
     public:
+        MD5(const MD5&) = default;
+        MD5& operator=(const MD5&) = default;
+
         typedef struct {
             uint32_t lo, hi;
             uint32_t a, b, c, d;
@@ -206,7 +224,7 @@ namespace Crypto {
         {
             Reset();
         }
-        inline MD5(const uint8_t message_array[], const uint16_t length)
+        inline MD5(const uint8_t message_array[], const uint64_t length)
         {
             Reset();
 
@@ -219,6 +237,7 @@ namespace Crypto {
     public:
         static const EnumHashType Type = HASH_MD5;
         static const uint8_t Length = 16;
+        static const uint8_t BlockSize = 64;
 
         void Reset()
         {
@@ -252,7 +271,7 @@ namespace Crypto {
         /*
          *  Provide input to MD5
          */
-        void Input(const uint8_t message_array[], const uint16_t length);
+        void Input(const uint8_t message_array[], const uint64_t length);
 
         MD5& operator<<(const uint8_t message_array[]);
         MD5& operator<<(const uint8_t message_element);
@@ -269,22 +288,21 @@ namespace Crypto {
     class EXTERNAL SHA256 {
     public:
         typedef struct {
-            uint32_t tot_len;
+            uint64_t tot_len;
             uint32_t len;
             uint8_t block[2 * (512 / 8)];
             uint32_t h[8];
         } Context;
 
-    private:
-        SHA256(const SHA256&);
-        SHA256& operator=(const SHA256&);
-
     public:
+        SHA256(const SHA256&) = default;
+        SHA256& operator=(const SHA256&) = default;
+
         inline SHA256()
         {
             Reset();
         }
-        inline SHA256(const uint8_t message_array[], const uint16_t length)
+        inline SHA256(const uint8_t message_array[], const uint64_t length)
         {
             Reset();
 
@@ -298,6 +316,7 @@ namespace Crypto {
         void Reset();
         static const EnumHashType Type = HASH_SHA256;
         static const uint8_t Length = 32;
+        static const uint8_t BlockSize = 64;
         inline const uint8_t* Result()
         {
             if (_computed == false) {
@@ -311,7 +330,12 @@ namespace Crypto {
         /*
          *  Provide input to SHA1
          */
-        void Input(const uint8_t message_array[], const uint16_t length);
+        void Input(const uint8_t message_array[], const uint64_t length);
+
+        /*
+         *  Hash count messages in one go, see SHA1::Digest
+         */
+        void Digest(const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[]) const;
 
         SHA256& operator<<(const uint8_t message_array[]);
         SHA256& operator<<(const uint8_t message_element);
@@ -325,16 +349,15 @@ namespace Crypto {
     };
 
     class EXTERNAL SHA224 {
-    private:
-        SHA224(const SHA224&);
-        SHA224& operator=(const SHA224&);
-
     public:
+        SHA224(const SHA224&) = default;
+        SHA224& operator=(const SHA224&) = default;
+
         inline SHA224()
         {
             Reset();
         }
-        inline SHA224(const uint8_t message_array[], const uint16_t length)
+        inline SHA224(const uint8_t message_array[], const uint64_t length)
         {
             Reset();
 
@@ -348,6 +371,7 @@ namespace Crypto {
         void Reset();
         static const EnumHashType Type = HASH_SHA224;
         static const uint8_t Length = 28;
+        static const uint8_t BlockSize = 64;
         inline const uint8_t* Result()
         {
             if (_computed == false) {
@@ -361,7 +385,12 @@ namespace Crypto {
         /*
          *  Provide input to SHA224
          */
-        void Input(const uint8_t message_array[], const uint16_t length);
+        void Input(const uint8_t message_array[], const uint64_t length);
+
+        /*
+         *  Hash count messages in one go, see SHA1::Digest
+         */
+        void Digest(const uint32_t count, const uint8_t* const messages[], const uint32_t lengths[], uint8_t digests[]) const;
 
         SHA224& operator<<(const uint8_t message_array[]);
         SHA224& operator<<(const uint8_t message_element);
@@ -377,22 +406,21 @@ namespace Crypto {
     class EXTERNAL SHA512 {
     public:
         typedef struct {
-            uint32_t tot_len;
+            uint64_t tot_len;
             uint32_t len;
             uint8_t block[2 * (1024 / 8)];
             uint64_t h[8];
         } Context;
 
-    private:
-        SHA512(const SHA512&);
-        SHA512& operator=(const SHA512&);
-
     public:
+        SHA512(const SHA512&) = default;
+        SHA512& operator=(const SHA512&) = default;
+
         inline SHA512()
         {
             Reset();
         }
-        inline SHA512(const uint8_t message_array[], const uint16_t length)
+        inline SHA512(const uint8_t message_array[], const uint64_t length)
         {
             Reset();
 
@@ -406,6 +434,7 @@ namespace Crypto {
         void Reset();
         static const EnumHashType Type = HASH_SHA512;
         static const uint8_t Length = 64;
+        static const uint8_t BlockSize = 128;
         inline const uint8_t* Result()
         {
             if (_computed == false) {
@@ -419,7 +448,7 @@ namespace Crypto {
         /*
          *  Provide input to SHA512
          */
-        void Input(const uint8_t message_array[], const uint16_t length);
+        void Input(const uint8_t message_array[], const uint64_t length);
 
         SHA512& operator<<(const uint8_t message_array[]);
         SHA512& operator<<(const uint8_t message_element);
@@ -433,16 +462,15 @@ namespace Crypto {
     };
 
     class EXTERNAL SHA384 {
-    private:
-        SHA384(const SHA384&);
-        SHA384& operator=(const SHA384&);
-
     public:
+        SHA384(const SHA384&) = default;
+        SHA384& operator=(const SHA384&) = default;
+
         inline SHA384()
         {
             Reset();
         }
-        inline SHA384(const uint8_t message_array[], const uint16_t length)
+        inline SHA384(const uint8_t message_array[], const uint64_t length)
         {
             Reset();
 
@@ -456,6 +484,7 @@ namespace Crypto {
         void Reset();
         static const EnumHashType Type = HASH_SHA384;
         static const uint8_t Length = 48;
+        static const uint8_t BlockSize = 128;
         inline const uint8_t* Result()
         {
             if (_computed == false) {
@@ -469,7 +498,7 @@ namespace Crypto {
         /*
          *  Provide input to SHA384
          */
-        void Input(const uint8_t message_array[], const uint16_t length);
+        void Input(const uint8_t message_array[], const uint64_t length);
 
         SHA384& operator<<(const uint8_t message_array[]);
         SHA384& operator<<(const uint8_t message_element);
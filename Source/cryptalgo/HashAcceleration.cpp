@@ -0,0 +1,571 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HashAcceleration.h"
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#if defined(__x86_64__) || defined(__i386__)
+#define __SHA_NI__
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__linux__)
+#define __SHA_ARMV8__
+#include <arm_neon.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace WPEFramework {
+namespace Crypto {
+
+    static const uint32_t SHA1Constants[4] = {
+        0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
+    };
+
+    static const uint32_t SHA256Constants[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+#ifdef __SHA_NI__
+
+#define SHA_NI_TARGET __attribute__((target("sha,ssse3,sse4.1")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+    // The rounds are written per group of 4, the group number is a template argument so the
+    // message registers (m[group % 4]) and the round functions are known at compile time.
+    template <const uint8_t GROUP>
+    SHA_NI_TARGET static inline void SHA1Rounds(__m128i& abcd, __m128i e[2], __m128i m[4])
+    {
+        __m128i& current = e[GROUP & 1];
+
+        if (GROUP == 0) {
+            current = _mm_add_epi32(current, m[0]);
+        } else {
+            current = _mm_sha1nexte_epu32(current, m[GROUP % 4]);
+        }
+
+        e[(GROUP + 1) & 1] = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, current, (GROUP / 5));
+
+        if ((GROUP >= 3) && (GROUP <= 18)) {
+            m[(GROUP + 1) % 4] = _mm_sha1msg2_epu32(m[(GROUP + 1) % 4], m[GROUP % 4]);
+        }
+        if ((GROUP >= 1) && (GROUP <= 16)) {
+            m[(GROUP + 3) % 4] = _mm_sha1msg1_epu32(m[(GROUP + 3) % 4], m[GROUP % 4]);
+        }
+        if ((GROUP >= 2) && (GROUP <= 17)) {
+            m[(GROUP + 2) % 4] = _mm_xor_si128(m[(GROUP + 2) % 4], m[GROUP % 4]);
+        }
+    }
+
+    SHA_NI_TARGET static void SHA1NI(uint32_t state[5], uint32_t blocks, const uint8_t data[])
+    {
+        const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+        __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+        __m128i e[2] = { _mm_set_epi32(state[4], 0, 0, 0), _mm_setzero_si128() };
+
+        while (blocks > 0) {
+            const __m128i abcdSaved = abcd;
+            const __m128i eSaved = e[0];
+            __m128i m[4];
+
+            for (uint8_t index = 0; index < 4; index++) {
+                m[index] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[index * 16])), mask);
+            }
+
+            SHA1Rounds<0>(abcd, e, m);
+            SHA1Rounds<1>(abcd, e, m);
+            SHA1Rounds<2>(abcd, e, m);
+            SHA1Rounds<3>(abcd, e, m);
+            SHA1Rounds<4>(abcd, e, m);
+            SHA1Rounds<5>(abcd, e, m);
+            SHA1Rounds<6>(abcd, e, m);
+            SHA1Rounds<7>(abcd, e, m);
+            SHA1Rounds<8>(abcd, e, m);
+            SHA1Rounds<9>(abcd, e, m);
+            SHA1Rounds<10>(abcd, e, m);
+            SHA1Rounds<11>(abcd, e, m);
+            SHA1Rounds<12>(abcd, e, m);
+            SHA1Rounds<13>(abcd, e, m);
+            SHA1Rounds<14>(abcd, e, m);
+            SHA1Rounds<15>(abcd, e, m);
+            SHA1Rounds<16>(abcd, e, m);
+            SHA1Rounds<17>(abcd, e, m);
+            SHA1Rounds<18>(abcd, e, m);
+            SHA1Rounds<19>(abcd, e, m);
+
+            e[0] = _mm_sha1nexte_epu32(e[0], eSaved);
+            abcd = _mm_add_epi32(abcd, abcdSaved);
+
+            data += 64;
+            blocks--;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1B));
+        state[4] = static_cast<uint32_t>(_mm_extract_epi32(e[0], 3));
+    }
+
+    template <const uint8_t GROUP>
+    SHA_NI_TARGET static inline void SHA256Rounds(__m128i& state0, __m128i& state1, __m128i m[4])
+    {
+        __m128i message = _mm_add_epi32(m[GROUP % 4], _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA256Constants[GROUP * 4])));
+
+        state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+
+        if ((GROUP >= 3) && (GROUP <= 14)) {
+            m[(GROUP + 1) % 4] = _mm_add_epi32(m[(GROUP + 1) % 4], _mm_alignr_epi8(m[GROUP % 4], m[(GROUP + 3) % 4], 4));
+            m[(GROUP + 1) % 4] = _mm_sha256msg2_epu32(m[(GROUP + 1) % 4], m[GROUP % 4]);
+        }
+
+        message = _mm_shuffle_epi32(message, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, message);
+
+        if ((GROUP >= 1) && (GROUP <= 12)) {
+            m[(GROUP + 3) % 4] = _mm_sha256msg1_epu32(m[(GROUP + 3) % 4], m[GROUP % 4]);
+        }
+    }
+
+    SHA_NI_TARGET static void SHA256NI(uint32_t state[8], uint32_t blocks, const uint8_t data[])
+    {
+        const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+        // The instructions want the state as ABEF and CDGH.
+        __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+        __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+        __m128i state0 = _mm_alignr_epi8(cdab, efgh, 8);
+        __m128i state1 = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+        while (blocks > 0) {
+            const __m128i saved0 = state0;
+            const __m128i saved1 = state1;
+            __m128i m[4];
+
+            for (uint8_t index = 0; index < 4; index++) {
+                m[index] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[index * 16])), mask);
+            }
+
+            SHA256Rounds<0>(state0, state1, m);
+            SHA256Rounds<1>(state0, state1, m);
+            SHA256Rounds<2>(state0, state1, m);
+            SHA256Rounds<3>(state0, state1, m);
+            SHA256Rounds<4>(state0, state1, m);
+            SHA256Rounds<5>(state0, state1, m);
+            SHA256Rounds<6>(state0, state1, m);
+            SHA256Rounds<7>(state0, state1, m);
+            SHA256Rounds<8>(state0, state1, m);
+            SHA256Rounds<9>(state0, state1, m);
+            SHA256Rounds<10>(state0, state1, m);
+            SHA256Rounds<11>(state0, state1, m);
+            SHA256Rounds<12>(state0, state1, m);
+            SHA256Rounds<13>(state0, state1, m);
+            SHA256Rounds<14>(state0, state1, m);
+            SHA256Rounds<15>(state0, state1, m);
+
+            state0 = _mm_add_epi32(state0, saved0);
+            state1 = _mm_add_epi32(state1, saved1);
+
+            data += 64;
+            blocks--;
+        }
+
+        cdab = _mm_shuffle_epi32(state0, 0x1B);
+        efgh = _mm_shuffle_epi32(state1, 0xB1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(cdab, efgh, 0xF0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(efgh, cdab, 8));
+    }
+
+    // Multi-buffer: word t of the 8 messages in one register.
+    AVX2_TARGET static inline __m256i Load8(const uint8_t* const blocks[HashAcceleration::Lanes], const uint8_t word)
+    {
+        uint32_t values[HashAcceleration::Lanes];
+
+        for (uint8_t lane = 0; lane < HashAcceleration::Lanes; lane++) {
+            uint32_t value;
+            ::memcpy(&value, &(blocks[lane][word * 4]), sizeof(value));
+            values[lane] = __builtin_bswap32(value);
+        }
+
+        return (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+    }
+
+    AVX2_TARGET static inline __m256i Rotate8(const __m256i value, const int bits)
+    {
+        return (_mm256_or_si256(_mm256_slli_epi32(value, bits), _mm256_srli_epi32(value, 32 - bits)));
+    }
+
+    AVX2_TARGET static void SHA1AVX2(uint32_t state[5][HashAcceleration::Lanes], const uint8_t* const blocks[HashAcceleration::Lanes])
+    {
+        __m256i w[16];
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[0]));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[1]));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[2]));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[3]));
+        __m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[4]));
+
+        for (uint8_t round = 0; round < 80; round++) {
+            __m256i f;
+
+            if (round < 16) {
+                w[round] = Load8(blocks, round);
+            } else {
+                w[round & 15] = Rotate8(_mm256_xor_si256(_mm256_xor_si256(w[(round - 3) & 15], w[(round - 8) & 15]), _mm256_xor_si256(w[(round - 14) & 15], w[round & 15])), 1);
+            }
+
+            if (round < 20) {
+                f = _mm256_xor_si256(d, _mm256_and_si256(b, _mm256_xor_si256(c, d)));
+            } else if ((round >= 40) && (round < 60)) {
+                f = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_and_si256(d, _mm256_or_si256(b, c)));
+            } else {
+                f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);
+            }
+
+            const __m256i temp = _mm256_add_epi32(_mm256_add_epi32(Rotate8(a, 5), f), _mm256_add_epi32(_mm256_add_epi32(e, w[round & 15]), _mm256_set1_epi32(SHA1Constants[round / 20])));
+
+            e = d;
+            d = c;
+            c = Rotate8(b, 30);
+            b = a;
+            a = temp;
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[0]), _mm256_add_epi32(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[0]))));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[1]), _mm256_add_epi32(b, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[1]))));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[2]), _mm256_add_epi32(c, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[2]))));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[3]), _mm256_add_epi32(d, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[3]))));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[4]), _mm256_add_epi32(e, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[4]))));
+    }
+
+    AVX2_TARGET static inline __m256i RotateRight8(const __m256i value, const int bits)
+    {
+        return (_mm256_or_si256(_mm256_srli_epi32(value, bits), _mm256_slli_epi32(value, 32 - bits)));
+    }
+
+    AVX2_TARGET static void SHA256AVX2(uint32_t state[8][HashAcceleration::Lanes], const uint8_t* const blocks[HashAcceleration::Lanes])
+    {
+        __m256i w[16];
+        __m256i v[8];
+
+        for (uint8_t index = 0; index < 8; index++) {
+            v[index] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[index]));
+        }
+
+        for (uint8_t round = 0; round < 64; round++) {
+            if (round < 16) {
+                w[round] = Load8(blocks, round);
+            } else {
+                const __m256i& w15 = w[(round - 15) & 15];
+                const __m256i& w2 = w[(round - 2) & 15];
+                const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(RotateRight8(w15, 7), RotateRight8(w15, 18)), _mm256_srli_epi32(w15, 3));
+                const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(RotateRight8(w2, 17), RotateRight8(w2, 19)), _mm256_srli_epi32(w2, 10));
+
+                w[round & 15] = _mm256_add_epi32(_mm256_add_epi32(w[round & 15], s0), _mm256_add_epi32(w[(round - 7) & 15], s1));
+            }
+
+            const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(RotateRight8(v[4], 6), RotateRight8(v[4], 11)), RotateRight8(v[4], 25));
+            const __m256i ch = _mm256_xor_si256(_mm256_and_si256(v[4], v[5]), _mm256_andnot_si256(v[4], v[6]));
+            const __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(v[7], s1), _mm256_add_epi32(ch, w[round & 15])), _mm256_set1_epi32(SHA256Constants[round]));
+            const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(RotateRight8(v[0], 2), RotateRight8(v[0], 13)), RotateRight8(v[0], 22));
+            const __m256i maj = _mm256_or_si256(_mm256_and_si256(v[0], v[1]), _mm256_and_si256(v[2], _mm256_or_si256(v[0], v[1])));
+
+            v[7] = v[6];
+            v[6] = v[5];
+            v[5] = v[4];
+            v[4] = _mm256_add_epi32(v[3], t1);
+            v[3] = v[2];
+            v[2] = v[1];
+            v[1] = v[0];
+            v[0] = _mm256_add_epi32(t1, _mm256_add_epi32(s0, maj));
+        }
+
+        for (uint8_t index = 0; index < 8; index++) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[index]), _mm256_add_epi32(v[index], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[index]))));
+        }
+    }
+
+    static bool Detect()
+    {
+        unsigned int eax, ebx, ecx, edx;
+
+        // SSSE3 (ecx 9) and SSE4.1 (ecx 19), SHA (leaf 7, ebx 29).
+        return ((__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & ((1u << 9) | (1u << 19))) == ((1u << 9) | (1u << 19))) && (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) && ((ebx & (1u << 29)) != 0));
+    }
+
+    static bool DetectLanes()
+    {
+        unsigned int eax, ebx, ecx, edx;
+        bool result = false;
+
+        // AVX2 (leaf 7, ebx 5), and an OS that saves the YMM registers (OSXSAVE, XCR0 bits 1 and 2).
+        if ((__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & (1u << 27)) != 0) && (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) && ((ebx & (1u << 5)) != 0)) {
+            uint32_t low, high;
+            __asm__("xgetbv"
+                    : "=a"(low), "=d"(high)
+                    : "c"(0));
+            result = ((low & 0x06) == 0x06);
+        }
+
+        return (result);
+    }
+
+    static constexpr hashEngine Hardware = HASH_ENGINE_SHANI;
+
+#endif // __SHA_NI__
+
+#ifdef __SHA_ARMV8__
+
+#ifdef __clang__
+#define SHA_ARMV8_TARGET __attribute__((target("crypto")))
+#else
+#define SHA_ARMV8_TARGET __attribute__((target("+crypto")))
+#endif
+
+    template <const uint8_t GROUP>
+    SHA_ARMV8_TARGET static inline void SHA1Rounds(uint32x4_t& abcd, uint32_t& e, uint32x4_t m[4])
+    {
+        const uint32x4_t message = vaddq_u32(m[GROUP % 4], vdupq_n_u32(SHA1Constants[GROUP / 5]));
+        const uint32_t next = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+
+        if (GROUP < 5) {
+            abcd = vsha1cq_u32(abcd, e, message);
+        } else if ((GROUP >= 10) && (GROUP < 15)) {
+            abcd = vsha1mq_u32(abcd, e, message);
+        } else {
+            abcd = vsha1pq_u32(abcd, e, message);
+        }
+        e = next;
+
+        if (GROUP <= 15) {
+            m[GROUP % 4] = vsha1su1q_u32(vsha1su0q_u32(m[GROUP % 4], m[(GROUP + 1) % 4], m[(GROUP + 2) % 4]), m[(GROUP + 3) % 4]);
+        }
+    }
+
+    SHA_ARMV8_TARGET static void SHA1ARMv8(uint32_t state[5], uint32_t blocks, const uint8_t data[])
+    {
+        uint32x4_t abcd = vld1q_u32(state);
+        uint32_t e = state[4];
+
+        while (blocks > 0) {
+            const uint32x4_t abcdSaved = abcd;
+            const uint32_t eSaved = e;
+            uint32x4_t m[4];
+
+            for (uint8_t index = 0; index < 4; index++) {
+                m[index] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&data[index * 16])));
+            }
+
+            SHA1Rounds<0>(abcd, e, m);
+            SHA1Rounds<1>(abcd, e, m);
+            SHA1Rounds<2>(abcd, e, m);
+            SHA1Rounds<3>(abcd, e, m);
+            SHA1Rounds<4>(abcd, e, m);
+            SHA1Rounds<5>(abcd, e, m);
+            SHA1Rounds<6>(abcd, e, m);
+            SHA1Rounds<7>(abcd, e, m);
+            SHA1Rounds<8>(abcd, e, m);
+            SHA1Rounds<9>(abcd, e, m);
+            SHA1Rounds<10>(abcd, e, m);
+            SHA1Rounds<11>(abcd, e, m);
+            SHA1Rounds<12>(abcd, e, m);
+            SHA1Rounds<13>(abcd, e, m);
+            SHA1Rounds<14>(abcd, e, m);
+            SHA1Rounds<15>(abcd, e, m);
+            SHA1Rounds<16>(abcd, e, m);
+            SHA1Rounds<17>(abcd, e, m);
+            SHA1Rounds<18>(abcd, e, m);
+            SHA1Rounds<19>(abcd, e, m);
+
+            abcd = vaddq_u32(abcd, abcdSaved);
+            e += eSaved;
+
+            data += 64;
+            blocks--;
+        }
+
+        vst1q_u32(state, abcd);
+        state[4] = e;
+    }
+
+    template <const uint8_t GROUP>
+    SHA_ARMV8_TARGET static inline void SHA256Rounds(uint32x4_t& abcd, uint32x4_t& efgh, uint32x4_t m[4])
+    {
+        const uint32x4_t message = vaddq_u32(m[GROUP % 4], vld1q_u32(&SHA256Constants[GROUP * 4]));
+        const uint32x4_t saved = abcd;
+
+        if (GROUP <= 11) {
+            m[GROUP % 4] = vsha256su1q_u32(vsha256su0q_u32(m[GROUP % 4], m[(GROUP + 1) % 4]), m[(GROUP + 2) % 4], m[(GROUP + 3) % 4]);
+        }
+
+        abcd = vsha256hq_u32(abcd, efgh, message);
+        efgh = vsha256h2q_u32(efgh, saved, message);
+    }
+
+    SHA_ARMV8_TARGET static void SHA256ARMv8(uint32_t state[8], uint32_t blocks, const uint8_t data[])
+    {
+        uint32x4_t abcd = vld1q_u32(&state[0]);
+        uint32x4_t efgh = vld1q_u32(&state[4]);
+
+        while (blocks > 0) {
+            const uint32x4_t abcdSaved = abcd;
+            const uint32x4_t efghSaved = efgh;
+            uint32x4_t m[4];
+
+            for (uint8_t index = 0; index < 4; index++) {
+                m[index] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&data[index * 16])));
+            }
+
+            SHA256Rounds<0>(abcd, efgh, m);
+            SHA256Rounds<1>(abcd, efgh, m);
+            SHA256Rounds<2>(abcd, efgh, m);
+            SHA256Rounds<3>(abcd, efgh, m);
+            SHA256Rounds<4>(abcd, efgh, m);
+            SHA256Rounds<5>(abcd, efgh, m);
+            SHA256Rounds<6>(abcd, efgh, m);
+            SHA256Rounds<7>(abcd, efgh, m);
+            SHA256Rounds<8>(abcd, efgh, m);
+            SHA256Rounds<9>(abcd, efgh, m);
+            SHA256Rounds<10>(abcd, efgh, m);
+            SHA256Rounds<11>(abcd, efgh, m);
+            SHA256Rounds<12>(abcd, efgh, m);
+            SHA256Rounds<13>(abcd, efgh, m);
+            SHA256Rounds<14>(abcd, efgh, m);
+            SHA256Rounds<15>(abcd, efgh, m);
+
+            abcd = vaddq_u32(abcd, abcdSaved);
+            efgh = vaddq_u32(efgh, efghSaved);
+
+            data += 64;
+            blocks--;
+        }
+
+        vst1q_u32(&state[0], abcd);
+        vst1q_u32(&state[4], efgh);
+    }
+
+    static bool Detect()
+    {
+        const unsigned long capabilities = ::getauxval(AT_HWCAP);
+
+        return (((capabilities & HWCAP_SHA1) != 0) && ((capabilities & HWCAP_SHA2) != 0));
+    }
+
+    static bool DetectLanes()
+    {
+        return (false);
+    }
+
+    static constexpr hashEngine Hardware = HASH_ENGINE_ARMV8;
+
+#endif // __SHA_ARMV8__
+
+#if defined(__SHA_NI__) || defined(__SHA_ARMV8__)
+    static const bool Supported = Detect();
+    static const bool SupportedLanes = DetectLanes();
+#else
+    static constexpr bool Supported = false;
+    static constexpr bool SupportedLanes = false;
+    static constexpr hashEngine Hardware = HASH_ENGINE_PORTABLE;
+#endif
+
+    static std::atomic<uint8_t> Highest(HASH_ENGINE_ARMV8);
+
+    /* static */ bool HashAcceleration::Active()
+    {
+        return ((Supported == true) && (Highest.load(std::memory_order_relaxed) >= HASH_ENGINE_SHANI));
+    }
+
+    /* static */ bool HashAcceleration::MultiBuffer()
+    {
+        return ((SupportedLanes == true) && (Highest.load(std::memory_order_relaxed) >= HASH_ENGINE_MULTIBUFFER));
+    }
+
+    /* static */ void HashAcceleration::SHA1(uint32_t state[5], const uint32_t blocks, const uint8_t data[])
+    {
+        ASSERT(Active() == true);
+
+#if defined(__SHA_NI__)
+        SHA1NI(state, blocks, data);
+#elif defined(__SHA_ARMV8__)
+        SHA1ARMv8(state, blocks, data);
+#else
+        DEBUG_VARIABLE(state);
+        DEBUG_VARIABLE(blocks);
+        DEBUG_VARIABLE(data);
+#endif
+    }
+
+    /* static */ void HashAcceleration::SHA256(uint32_t state[8], const uint32_t blocks, const uint8_t data[])
+    {
+        ASSERT(Active() == true);
+
+#if defined(__SHA_NI__)
+        SHA256NI(state, blocks, data);
+#elif defined(__SHA_ARMV8__)
+        SHA256ARMv8(state, blocks, data);
+#else
+        DEBUG_VARIABLE(state);
+        DEBUG_VARIABLE(blocks);
+        DEBUG_VARIABLE(data);
+#endif
+    }
+
+    /* static */ void HashAcceleration::SHA1(uint32_t state[5][Lanes], const uint8_t* const blocks[Lanes])
+    {
+        ASSERT(MultiBuffer() == true);
+
+#if defined(__SHA_NI__)
+        SHA1AVX2(state, blocks);
+#else
+        DEBUG_VARIABLE(state);
+        DEBUG_VARIABLE(blocks);
+#endif
+    }
+
+    /* static */ void HashAcceleration::SHA256(uint32_t state[8][Lanes], const uint8_t* const blocks[Lanes])
+    {
+        ASSERT(MultiBuffer() == true);
+
+#if defined(__SHA_NI__)
+        SHA256AVX2(state, blocks);
+#else
+        DEBUG_VARIABLE(state);
+        DEBUG_VARIABLE(blocks);
+#endif
+    }
+
+    hashEngine HashEngine()
+    {
+        return (HashAcceleration::Active() == true ? Hardware : (HashAcceleration::MultiBuffer() == true ? HASH_ENGINE_MULTIBUFFER : HASH_ENGINE_PORTABLE));
+    }
+
+    hashEngine HashEngine(const hashEngine highest)
+    {
+        Highest.store(highest, std::memory_order_relaxed);
+
+        return (HashEngine());
+    }
+}
+} // namespace WPEFramework::Crypto
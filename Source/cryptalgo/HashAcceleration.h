@@ -0,0 +1,58 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __HASH_ACCELERATION_H
+#define __HASH_ACCELERATION_H
+
+#include "Hash.h"
+#include "Module.h"
+
+namespace WPEFramework {
+namespace Crypto {
+
+    // The SHA-1 and SHA-256 compression functions done with the instructions the CPU has for them:
+    // the SHA extensions on x86 (SHA-NI), the crypto extensions on AArch64. With AVX2, on x86,
+    // there are also the "multi-buffer" versions, that compress one block of 8 independent
+    // messages at a time, one message per 32 bits lane. What is there is checked once, at run
+    // time, the Hash classes use their own code if it is not there or switched off.
+    class HashAcceleration {
+    private:
+        HashAcceleration() = delete;
+        HashAcceleration(const HashAcceleration&) = delete;
+        HashAcceleration& operator=(const HashAcceleration&) = delete;
+
+    public:
+        static constexpr uint8_t Lanes = 8;
+
+    public:
+        static bool Active();
+        static bool MultiBuffer();
+
+        // state is H0..H4 (H0..H7), as words, blocks of 64 bytes.
+        static void SHA1(uint32_t state[5], const uint32_t blocks, const uint8_t data[]);
+        static void SHA256(uint32_t state[8], const uint32_t blocks, const uint8_t data[]);
+
+        // state[word][lane], one block of 64 bytes per lane.
+        static void SHA1(uint32_t state[5][Lanes], const uint8_t* const blocks[Lanes]);
+        static void SHA256(uint32_t state[8][Lanes], const uint8_t* const blocks[Lanes]);
+    };
+}
+} // namespace WPEFramework::Crypto
+
+#endif // __HASH_ACCELERATION_H
@@ -54,6 +54,11 @@ namespace Crypto {
             int32_t Read(uint8_t buffer[], const uint16_t length) const override;
             int32_t Write(const uint8_t buffer[], const uint16_t length) override;
 
+            // Everything has to go through SSL_write, sendfile would put the file on the wire in plain.
+            bool Transfer(const Core::IResource::handle, const uint32_t, const uint32_t) override {
+                return (false);
+            }
+
             // Methods to extract and insert data into the socket buffers
             uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override {
                 return (_parent.SendData(dataFrame, maxSendSize));
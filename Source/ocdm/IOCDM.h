@@ -141,18 +141,18 @@ struct ISessionExt : virtual public WPEFramework::Core::IUnknown {
     // Encrypted fragements.
     virtual std::string BufferIdExt() const = 0;
 
-    virtual OCDM_RESULT SetDrmHeader(const uint8_t drmHeader[] /* @length:drmHeaderLength */,
+    virtual OCDM_RESULT SetDrmHeader(const uint8_t drmHeader[] /* @length:drmHeaderLength @stream */,
         uint32_t drmHeaderLength)
         = 0;
 
-    virtual OCDM_RESULT GetChallengeDataExt(uint8_t* challenge /* @inout @length:challengeSize */,
+    virtual OCDM_RESULT GetChallengeDataExt(uint8_t* challenge /* @inout @length:challengeSize @stream */,
         uint32_t& challengeSize /* @inout */,
         uint32_t isLDL)
         = 0;
 
     virtual OCDM_RESULT CancelChallengeDataExt() = 0;
 
-    virtual OCDM_RESULT StoreLicenseData(const uint8_t licenseData[] /* @length:licenseDataSize */,
+    virtual OCDM_RESULT StoreLicenseData(const uint8_t licenseData[] /* @length:licenseDataSize @stream */,
         uint32_t licenseDataSize,
         uint8_t* secureStopId /* @out @length:16 */)
         = 0;
@@ -112,7 +112,11 @@ namespace PluginHost {
                 }
 
                 if (_current.IsValid() == true) {
-                    loaded = _current->Serialize(stream, length, _offset);
+                    if (_parent.IsPacked() == false) {
+                        loaded = static_cast<uint16_t>(_current->Serialize(stream, length, _offset));
+                    } else {
+                        loaded = Packed(reinterpret_cast<uint8_t*>(stream), length);
+                    }
                     if ( (_offset == 0) || (loaded != length) ) {
                         _current.Release();
                     }
@@ -121,10 +125,29 @@ namespace PluginHost {
                 return (loaded);
             }
 
+        private:
+            uint16_t Packed(uint8_t* stream, const uint16_t length) const
+            {
+                uint16_t loaded = 0;
+                const Core::JSON::IMessagePack* element = dynamic_cast<const Core::JSON::IMessagePack*>(&(*_current));
+
+                ASSERT(element != nullptr);
+
+                if (element == nullptr) {
+                    _offset = 0;
+                } else {
+                    uint16_t offset = static_cast<uint16_t>(_offset);
+                    loaded = element->Serialize(stream, length, offset);
+                    _offset = offset;
+                }
+
+                return (loaded);
+            }
+
         private:
             Channel& _parent;
             mutable Core::ProxyType<const Core::JSON::IElement> _current;
-            mutable uint16_t _offset;
+            mutable uint32_t _offset;
         };
         class EXTERNAL DeserializerImpl {
         public:
@@ -158,9 +181,19 @@ namespace PluginHost {
                     }
                 } 
 				if (_current.IsValid() == true) {
-                    loaded = _current->Deserialize(stream, length, _offset);
+                    if (_parent.IsPacked() == false) {
+                        loaded = static_cast<uint16_t>(_current->Deserialize(stream, length, _offset));
+                    } else {
+                        loaded = Packed(reinterpret_cast<const uint8_t*>(stream), length);
+                    }
                     if ( (_offset == 0) || (loaded != length)) {
-                        _parent.Received(_current);
+                        // A message of which the params or result have no JSON equivalent is not
+                        // dispatched, without them it would mean something else.
+                        if ((_parent.IsPacked() == false) || (Channel::Unpack(_current) == true)) {
+                            _parent.Received(_current);
+                        } else {
+                            _parent.Refuse(_current);
+                        }
                         _current.Release();
                     }
                 }
@@ -168,10 +201,29 @@ namespace PluginHost {
 				return (loaded);
             }
 
+        private:
+            uint16_t Packed(const uint8_t* stream, const uint16_t length)
+            {
+                uint16_t loaded = length;
+                Core::JSON::IMessagePack* element = dynamic_cast<Core::JSON::IMessagePack*>(&(*_current));
+
+                ASSERT(element != nullptr);
+
+                if (element == nullptr) {
+                    _offset = 0;
+                } else {
+                    uint16_t offset = static_cast<uint16_t>(_offset);
+                    loaded = element->Deserialize(stream, length, offset);
+                    _offset = offset;
+                }
+
+                return (loaded);
+            }
+
         private:
             Channel& _parent;
             Core::ProxyType<Core::JSON::IElement> _current;
-            uint16_t _offset;
+            uint32_t _offset;
         };
 
     public:
@@ -182,6 +234,7 @@ namespace PluginHost {
             RAW = 0x08,
             TEXT = 0x10,
             JSONRPC = 0x20,
+            PACKED = 0x2000,
             PINGED = 0x4000,
             NOTIFIED = 0x8000
         };
@@ -236,6 +289,11 @@ namespace PluginHost {
         {
             return ((_state & NOTIFIED) != 0);
         }
+        // JSON-RPC messages go over the line as MessagePack (binary) frames.
+        inline bool IsPacked() const
+        {
+            return ((_state & PACKED) != 0);
+        }
         inline void Submit(const string& text)
         {
             if (IsOpen() == true) {
@@ -257,6 +315,10 @@ namespace PluginHost {
         {
             if (IsOpen() == true) {
 
+                if (IsPacked() == true) {
+                    Pack(entry);
+                }
+
                 _adminLock.Lock();
 
                 _sendQueue.emplace_back(entry);
@@ -296,10 +358,10 @@ namespace PluginHost {
         {
             _nameOffset = offset;
         }
-        inline void State(const ChannelState state, const bool notification)
+        inline void State(const ChannelState state, const bool notification, const bool packed = false)
         {
-            Binary(state == RAW);
-            _state = state | (notification ? NOTIFIED : 0x0000);
+            Binary((state == RAW) || (packed == true));
+            _state = state | (notification ? NOTIFIED : 0x0000) | (packed ? PACKED : 0x0000);
         }
         inline uint16_t Serialize(uint8_t* dataFrame, const uint16_t maxSendSize)
         {
@@ -406,6 +468,77 @@ namespace PluginHost {
             return (handled);
         }
 
+    private:
+        // On a packed channel the params and result of the messages travel as MessagePack,
+        // in here (and in the plugins) they are JSON text, like on any other channel.
+        static void Pack(const Core::ProxyType<Core::JSON::IElement>& element)
+        {
+            Core::ProxyType<Core::JSONRPC::Message> message(Core::proxy_cast<Core::JSONRPC::Message>(element));
+
+            if (message.IsValid() == true) {
+                Pack(message->Parameters);
+                Pack(message->Result);
+            }
+        }
+        static void Pack(Core::JSONRPC::Message::Payload& payload)
+        {
+            if ((payload.IsSet() == true) && (payload.IsNull() == false)) {
+                string packed;
+
+                if (Core::JSON::MessagePack::FromText(payload.Value(), packed) == false) {
+                    // Not a valid JSON text, pass it on as a string.
+                    string quoted;
+                    Core::JSON::String(payload.Value()).ToString(quoted);
+                    Core::JSON::MessagePack::FromText(quoted, packed);
+                }
+
+                payload = packed;
+            }
+        }
+        static bool Unpack(const Core::ProxyType<Core::JSON::IElement>& element)
+        {
+            bool result = true;
+            Core::ProxyType<Core::JSONRPC::Message> message(Core::proxy_cast<Core::JSONRPC::Message>(element));
+
+            if (message.IsValid() == true) {
+                result = ((Unpack(message->Parameters) == true) && (Unpack(message->Result) == true));
+            }
+
+            return (result);
+        }
+        // A request that could not be unpacked still gets an answer, the caller would wait for it
+        // in vain. Without an id nobody waits, it is just dropped.
+        void Refuse(const Core::ProxyType<Core::JSON::IElement>& element)
+        {
+            Core::ProxyType<Core::JSONRPC::Message> message(Core::proxy_cast<Core::JSONRPC::Message>(element));
+
+            if ((message.IsValid() == true) && (message->Id.IsSet() == true) && (message->Designator.IsSet() == true)) {
+                message->Designator.Clear();
+                message->Parameters.Clear();
+                message->Result.Clear();
+                message->Error.SetError(Core::ERROR_INVALID_SIGNATURE);
+                message->Error.Text = _T("params have no JSON equivalent.");
+                Submit(Core::ProxyType<Core::JSON::IElement>(message));
+            }
+        }
+        static bool Unpack(Core::JSONRPC::Message::Payload& payload)
+        {
+            bool result = true;
+
+            if ((payload.IsSet() == true) && (payload.IsNull() == false)) {
+                string text;
+
+                if (Core::JSON::MessagePack::ToText(payload.Value(), text) == false) {
+                    TRACE_L1("Dropped a message with a MessagePack payload that has no JSON equivalent, %d bytes", static_cast<uint32_t>(payload.Value().length()));
+                    result = false;
+                } else {
+                    payload = text;
+                }
+            }
+
+            return (result);
+        }
+
     private:
         // Handle the WebRequest coming in.
         virtual void LinkBody(Core::ProxyType<Request>& request) = 0;
@@ -304,7 +304,12 @@ namespace PluginHost {
                     break;
                 case STATE_CUSTOM:
                     string result;
-                    uint32_t code = source->Invoke(Core::JSONRPC::Connection(channelId, inbound.Id.Value()), inbound.FullMethod(), inbound.Parameters.Value(), result);
+                    uint32_t code;
+                    {
+                        Core::CallLatencies::Measurement measurement(Core::CallLatencies::Instance().Histogram(_callsign, Core::JSONRPC::Message::Method(method)));
+
+                        code = source->Invoke(Core::JSONRPC::Connection(channelId, inbound.Id.Value()), inbound.FullMethod(), inbound.Parameters.Value(), result);
+                    }
                     if (response.IsValid() == true) {
                         if (code == static_cast<uint32_t>(~0)) {
                             response.Release();
@@ -325,9 +330,9 @@ namespace PluginHost {
         state Destination(const string& designator, Core::JSONRPC::Handler*& source)
         {
             state result = STATE_INCORRECT_HANDLER;
-            string callsign(Core::JSONRPC::Message::Callsign(designator));
+            size_t length = Core::JSONRPC::Message::CallsignLength(designator);
 
-            if (callsign.empty() || (callsign == _callsign)) {
+            if ((length == 0) || (designator.compare(0, length, _callsign) == 0)) {
                 // Seems we are on the right handler..
                 // now see if someone supports this version
                 uint8_t version = Core::JSONRPC::Message::Version(designator);
@@ -342,18 +347,19 @@ namespace PluginHost {
                 if (index == _handlers.end()) {
                     result = STATE_INCORRECT_VERSION;
                 } else {
-                    string method(Core::JSONRPC::Message::Method(designator));
+                    // Look at the method in place, this is the hot path for every call.
+                    size_t offset = Core::JSONRPC::Message::MethodPosition(designator, length);
 
-                    if (method == _T("register")) {
+                    if (designator.compare(offset, length, _T("register")) == 0) {
                         result = STATE_REGISTRATION;
                         source = &(*index);
-                    } else if (method == _T("unregister")) {
+                    } else if (designator.compare(offset, length, _T("unregister")) == 0) {
                         result = STATE_UNREGISTRATION;
                         source = &(*index);
-                    } else if (method == _T("exists")) {
+                    } else if (designator.compare(offset, length, _T("exists")) == 0) {
                         result = STATE_EXISTS;
                         source = &(*index);
-                    } else if (index->Exists(method) == Core::ERROR_NONE) {
+                    } else if (index->Exists(&(designator.c_str()[offset]), length) == Core::ERROR_NONE) {
                         source = &(*index);
                         result = STATE_CUSTOM;
                     } else {
@@ -221,11 +221,26 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
     {
     }
 
+    MetaData::Server::TokenCache::TokenCache()
+    {
+        Core::JSON::Container::Add(_T("hits"), &Hits);
+        Core::JSON::Container::Add(_T("misses"), &Misses);
+        Core::JSON::Container::Add(_T("expired"), &Expired);
+        Core::JSON::Container::Add(_T("evicted"), &Evicted);
+        Core::JSON::Container::Add(_T("entries"), &Entries);
+    }
+    MetaData::Server::TokenCache::~TokenCache()
+    {
+    }
+
     MetaData::Server::Server()
     {
         Core::JSON::Container::Add(_T("threads"), &ThreadPoolRuns);
+        Core::JSON::Container::Add(_T("local"), &ThreadPoolLocal);
+        Core::JSON::Container::Add(_T("stolen"), &ThreadPoolStolen);
         Core::JSON::Container::Add(_T("pending"), &PendingRequests);
         Core::JSON::Container::Add(_T("occupation"), &PoolOccupation);
+        Core::JSON::Container::Add(_T("tokencache"), &Tokens);
     }
     MetaData::Server::~Server()
     {
@@ -156,6 +156,24 @@ namespace PluginHost {
             Server(const Server& copy) = delete;
             Server& operator=(const Server&) = delete;
 
+        public:
+            class EXTERNAL TokenCache : public Core::JSON::Container {
+            private:
+                TokenCache(const TokenCache& copy) = delete;
+                TokenCache& operator=(const TokenCache&) = delete;
+
+            public:
+                TokenCache();
+                ~TokenCache();
+
+            public:
+                Core::JSON::DecUInt32 Hits;
+                Core::JSON::DecUInt32 Misses;
+                Core::JSON::DecUInt32 Expired;
+                Core::JSON::DecUInt32 Evicted;
+                Core::JSON::DecUInt32 Entries;
+            };
+
         public:
             Server();
             ~Server();
@@ -163,12 +181,17 @@ namespace PluginHost {
             inline void Clear()
             {
                 ThreadPoolRuns.Clear();
+                ThreadPoolLocal.Clear();
+                ThreadPoolStolen.Clear();
             }
 
         public:
             Core::JSON::ArrayType<Core::JSON::DecUInt32> ThreadPoolRuns;
+            Core::JSON::ArrayType<Core::JSON::DecUInt32> ThreadPoolLocal;
+            Core::JSON::ArrayType<Core::JSON::DecUInt32> ThreadPoolStolen;
             Core::JSON::DecUInt32 PendingRequests;
             Core::JSON::DecUInt32 PoolOccupation;
+            TokenCache Tokens;
         };
 
         class EXTERNAL SubSystem : public Core::JSON::Container {
@@ -86,23 +86,46 @@ namespace PluginHost {
     }
 #endif
 
-    void Service::FileToServe(const string& webServiceRequest, Web::Response& response)
+    void Service::FileToServe(const Web::Request& request, Web::Response& response)
     {
         Web::MIMETypes result;
+        const string& webServiceRequest(request.Path);
         uint16_t offset = static_cast<uint16_t>(_config.WebPrefix().length()) + (_webURLPath.empty() ? 1 : static_cast<uint16_t>(_webURLPath.length()) + 2);
         string fileToService = _webServerFilePath;
+        Core::ProxyType<Web::FileBody> fileBody(IFactories::Instance().FileBody());
 
         if ((webServiceRequest.length() <= offset) || (Web::MIMETypeForFile(webServiceRequest.substr(offset, -1), fileToService, result) == false)) {
-            Core::ProxyType<Web::FileBody> fileBody(IFactories::Instance().FileBody());
-
             // No filename gives, be default, we go for the index.html page..
             *fileBody = fileToService + _T("index.html");
             response.ContentType = Web::MIME_HTML;
-            response.Body<Web::FileBody>(fileBody);
         } else {
-            Core::ProxyType<Web::FileBody> fileBody(IFactories::Instance().FileBody());
             *fileBody = fileToService;
             response.ContentType = result;
+        }
+
+        response.AcceptRange = _T("bytes");
+
+        if ((request.Range.IsSet() == true) && (fileBody->Exists() == true)) {
+            const uint64_t size = fileBody->Size();
+            uint64_t first = 0;
+            uint64_t last = 0;
+
+            switch (Web::ByteRange(request.Range.Value(), size, first, last)) {
+            case Web::STATUS_PARTIAL_CONTENT:
+                fileBody->Range(static_cast<uint32_t>(first), static_cast<uint32_t>(last - first + 1));
+                response.ErrorCode = Web::STATUS_PARTIAL_CONTENT;
+                response.ContentRange = _T("bytes ") + Core::NumberType<uint64_t>(first).Text() + _T("-") + Core::NumberType<uint64_t>(last).Text() + _T("/") + Core::NumberType<uint64_t>(size).Text();
+                response.Body<Web::FileBody>(fileBody);
+                break;
+            case Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE:
+                response.ErrorCode = Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE;
+                response.ContentRange = _T("bytes */") + Core::NumberType<uint64_t>(size).Text();
+                break;
+            default:
+                response.Body<Web::FileBody>(fileBody);
+                break;
+            }
+        } else {
             response.Body<Web::FileBody>(fileBody);
         }
     }
@@ -448,7 +448,8 @@ namespace PluginHost {
             _processedObjects++;
         }
 #endif
-        void FileToServe(const string& webServiceRequest, Web::Response& response);
+        // Answers a range request for a single range with 206 (or 416 if it is beyond the file).
+        void FileToServe(const Web::Request& request, Web::Response& response);
 
     private:
         mutable Core::CriticalSection _adminLock;
@@ -0,0 +1,299 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceBinary.h"
+
+namespace WPEFramework {
+namespace Trace {
+
+    namespace {
+
+        // The most a width or precision can ask for, as much as a record can carry.
+        constexpr int32_t MaxWidth = 0xFFFF;
+
+        class Arguments {
+        public:
+            Arguments() = delete;
+            Arguments(const Arguments&) = delete;
+            Arguments& operator=(const Arguments&) = delete;
+
+            Arguments(const char data[], const uint16_t length)
+                : _data(data)
+                , _length(length)
+                , _offset(0)
+            {
+            }
+            ~Arguments()
+            {
+            }
+
+        public:
+            // Returns the tag of the next argument, 0 if there is none (left).
+            char Next(int64_t& number, double& real, const char*& text, uint16_t& textLength)
+            {
+                char result = 0;
+
+                if (_offset < _length) {
+                    const char type = _data[_offset];
+                    const uint16_t left = _length - _offset - 1;
+                    const char* value = &_data[_offset + 1];
+
+                    switch (type) {
+                    case Binary::INT32:
+                        result = Load<int32_t>(value, left, number);
+                        break;
+                    case Binary::UINT32:
+                        result = Load<uint32_t>(value, left, number);
+                        break;
+                    case Binary::INT64:
+                        result = Load<int64_t>(value, left, number);
+                        break;
+                    case Binary::UINT64:
+                    case Binary::POINTER:
+                        result = Load<uint64_t>(value, left, number);
+                        break;
+                    case Binary::DOUBLE:
+                        if (left >= sizeof(double)) {
+                            ::memcpy(&real, value, sizeof(double));
+                            _offset += 1 + sizeof(double);
+                            result = type;
+                        }
+                        break;
+                    case Binary::STRING:
+                        if (left >= sizeof(uint16_t)) {
+                            ::memcpy(&textLength, value, sizeof(uint16_t));
+                            if ((left - sizeof(uint16_t)) >= textLength) {
+                                text = &value[sizeof(uint16_t)];
+                                _offset += 1 + sizeof(uint16_t) + textLength;
+                                result = type;
+                            }
+                        }
+                        break;
+                    default:
+                        break;
+                    }
+
+                    if (result == 0) {
+                        // Broken, do not look any further.
+                        _offset = _length;
+                    } else {
+                        result = type;
+                    }
+                }
+
+                return (result);
+            }
+
+        private:
+            template <typename TYPE>
+            char Load(const char value[], const uint16_t left, int64_t& number)
+            {
+                char result = 0;
+
+                if (left >= sizeof(TYPE)) {
+                    TYPE loaded;
+                    ::memcpy(&loaded, value, sizeof(TYPE));
+                    number = static_cast<int64_t>(loaded);
+                    _offset += 1 + sizeof(TYPE);
+                    result = 1;
+                }
+
+                return (result);
+            }
+
+        private:
+            const char* _data;
+            const uint16_t _length;
+            uint16_t _offset;
+        };
+
+        void Append(string& text, const char specification[], const char type, const int64_t number, const double real, const char value[], const uint16_t length)
+        {
+            char buffer[128];
+            int written = 0;
+
+            if (type == Binary::DOUBLE) {
+                written = ::snprintf(buffer, sizeof(buffer), specification, real);
+            } else if (type == Binary::STRING) {
+                // Strings might be cut short, or not terminated, print only what we have.
+                const string copy(value, length);
+                written = ::snprintf(nullptr, 0, specification, copy.c_str());
+
+                if (written > 0) {
+                    std::vector<char> large(written + 1);
+                    ::snprintf(large.data(), large.size(), specification, copy.c_str());
+                    text.append(large.data(), written);
+                }
+                written = 0;
+            } else if (type == Binary::POINTER) {
+                written = ::snprintf(buffer, sizeof(buffer), specification, reinterpret_cast<void*>(static_cast<uintptr_t>(number)));
+            } else {
+                written = ::snprintf(buffer, sizeof(buffer), specification, static_cast<long long>(number));
+            }
+
+            if (written > 0) {
+                text.append(buffer, std::min(written, static_cast<int>(sizeof(buffer) - 1)));
+            }
+        }
+    }
+
+    bool Decoder::Decode(const char data[], const uint16_t length, string& text)
+    {
+        bool result = true;
+
+        if (Binary::IsBinary(data, length) == false) {
+            text.assign(data, length);
+        } else {
+            uint32_t id;
+            ::memcpy(&id, &data[2], sizeof(id));
+
+            if (data[1] == Binary::DEFINITION) {
+                _formats[id] = string(&data[Binary::HeaderSize], length - Binary::HeaderSize);
+                result = false;
+            } else {
+                std::unordered_map<uint32_t, string>::const_iterator index(_formats.find(id));
+
+                text.clear();
+
+                if (index != _formats.end()) {
+                    Format(index->second, &data[Binary::HeaderSize], length - Binary::HeaderSize, text);
+                } else {
+                    Arguments arguments(&data[Binary::HeaderSize], length - Binary::HeaderSize);
+                    int64_t number = 0;
+                    double real = 0;
+                    const char* value = nullptr;
+                    uint16_t valueLength = 0;
+                    char type;
+
+                    char prefix[24];
+                    ::snprintf(prefix, sizeof(prefix), "<format 0x%08X>", id);
+                    text = prefix;
+
+                    while ((type = arguments.Next(number, real, value, valueLength)) != 0) {
+                        text += ' ';
+                        if (type == Binary::DOUBLE) {
+                            Append(text, "%g", type, number, real, value, valueLength);
+                        } else if (type == Binary::STRING) {
+                            Append(text, "\"%s\"", type, number, real, value, valueLength);
+                        } else if (type == Binary::POINTER) {
+                            Append(text, "%p", type, number, real, value, valueLength);
+                        } else {
+                            Append(text, "%lld", type, number, real, value, valueLength);
+                        }
+                    }
+                }
+            }
+        }
+
+        return (result);
+    }
+
+    void Decoder::Format(const string& format, const char data[], const uint16_t length, string& text) const
+    {
+        Arguments arguments(data, length);
+        string::size_type index = 0;
+
+        while (index < format.length()) {
+            const string::size_type percent = format.find('%', index);
+
+            if (percent == string::npos) {
+                text.append(format, index, string::npos);
+                break;
+            }
+
+            text.append(format, index, percent - index);
+            index = percent + 1;
+
+            if ((index < format.length()) && (format[index] == '%')) {
+                text += '%';
+                index++;
+                continue;
+            }
+
+            // Rebuild the specification without the length modifiers, the value as it was
+            // stored determines how it is passed.
+            string specification("%");
+            int64_t number = 0;
+            double real = 0;
+            const char* value = nullptr;
+            uint16_t valueLength = 0;
+
+            while ((index < format.length()) && (::strchr("-+ #0123456789.*", format[index]) != nullptr)) {
+                if ((format[index] == '*') || ((format[index] >= '1') && (format[index] <= '9'))) {
+                    // Width and precision, from the arguments or from the format. Both come out of the
+                    // buffer, a record never holds more than MaxWidth, so neither needs to be wider.
+                    int64_t width = 0;
+
+                    if (format[index] == '*') {
+                        number = 0;
+                        arguments.Next(number, real, value, valueLength);
+                        width = number;
+                        index++;
+                    } else {
+                        while ((index < format.length()) && (format[index] >= '0') && (format[index] <= '9')) {
+                            width = std::min((width * 10) + (format[index] - '0'), static_cast<int64_t>(MaxWidth));
+                            index++;
+                        }
+                    }
+
+                    width = std::max(std::min(width, static_cast<int64_t>(MaxWidth)), -static_cast<int64_t>(MaxWidth));
+                    specification += Core::NumberType<int32_t>(static_cast<int32_t>(width)).Text();
+                } else {
+                    specification += format[index];
+                    index++;
+                }
+            }
+            while ((index < format.length()) && (::strchr("hlLqjzt", format[index]) != nullptr)) {
+                index++;
+            }
+
+            if (index >= format.length()) {
+                text += specification;
+                break;
+            }
+
+            const char conversion = format[index++];
+            const char type = arguments.Next(number, real, value, valueLength);
+
+            if (type == 0) {
+                text += _T("<?>");
+            } else if (type == Binary::DOUBLE) {
+                Append(text, (specification + (::strchr("fFeEgGaA", conversion) != nullptr ? conversion : 'g')).c_str(), type, number, real, value, valueLength);
+            } else if (type == Binary::STRING) {
+                Append(text, (specification + 's').c_str(), type, number, real, value, valueLength);
+            } else if ((type == Binary::POINTER) && (conversion == 'p')) {
+                Append(text, (specification + 'p').c_str(), type, number, real, value, valueLength);
+            } else if ((conversion == 'c') && (type != Binary::POINTER)) {
+                text += static_cast<char>(number);
+            } else if (::strchr("uxXo", conversion) != nullptr) {
+                // Unsigned conversions show the bits as they were stored, not sign extended.
+                if ((type == Binary::INT32) || (type == Binary::UINT32)) {
+                    number = static_cast<uint32_t>(number);
+                }
+                Append(text, (specification + "ll" + conversion).c_str(), Binary::UINT64, number, real, value, valueLength);
+            } else {
+                if (type == Binary::UINT32) {
+                    number = static_cast<int32_t>(number);
+                }
+                Append(text, (specification + "lld").c_str(), Binary::INT64, number, real, value, valueLength);
+            }
+        }
+    }
+}
+} // namespace WPEFramework::Trace
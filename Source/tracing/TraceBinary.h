@@ -0,0 +1,242 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TRACEBINARY_H
+#define __TRACEBINARY_H
+
+// ---- Include system wide include files ----
+#include <type_traits>
+
+// ---- Include local include files ----
+#include "ITraceControl.h"
+#include "Module.h"
+
+// ---- Helper types and constants ----
+
+// Like TRACE, but the text is not formatted here. The format is registered once, the trace only
+// carries its id and the raw arguments, the side reading the traces formats them (Trace::Decoder).
+// Arguments can be integers, enums, floating points, strings and pointers.
+#define TRACE_BINARY(CATEGORY, FORMAT, ...)                                                                                  \
+    if (WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::IsEnabled() == true) {          \
+        static const uint32_t __format__ = WPEFramework::Trace::TraceUnit::Instance().Format(FORMAT);                        \
+        WPEFramework::Trace::Binary __data__(__format__, ##__VA_ARGS__);                                                    \
+        WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME> __message__(__data__.Data(), __data__.Length()); \
+        WPEFramework::Trace::TraceUnit::Instance().Trace(                                                                   \
+            __FILE__,                                                                                                        \
+            __LINE__,                                                                                                        \
+            typeid(*this).name(),                                                                                            \
+            &__message__);                                                                                                   \
+    }
+
+#define TRACE_BINARY_GLOBAL(CATEGORY, FORMAT, ...)                                                                           \
+    if (WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME>::IsEnabled() == true) {          \
+        static const uint32_t __format__ = WPEFramework::Trace::TraceUnit::Instance().Format(FORMAT);                        \
+        WPEFramework::Trace::Binary __data__(__format__, ##__VA_ARGS__);                                                    \
+        WPEFramework::Trace::TraceType<CATEGORY, &WPEFramework::Core::System::MODULE_NAME> __message__(__data__.Data(), __data__.Length()); \
+        WPEFramework::Trace::TraceUnit::Instance().Trace(                                                                   \
+            __FILE__,                                                                                                        \
+            __LINE__,                                                                                                        \
+            __FUNCTION__,                                                                                                    \
+            &__message__);                                                                                                   \
+    }
+
+// ---- Class Definition ----
+namespace WPEFramework {
+namespace Trace {
+
+    // The data of a binary trace starts with a 0, which a text trace never does, followed by:
+    //   DEFINITION: id (4) - the format, as registered under that id
+    //   RECORD:     id (4) - the arguments, each a type tag followed by the value
+    // All in host byte order, like the rest of the trace entry.
+    class EXTERNAL Binary {
+    public:
+        enum kind : uint8_t {
+            DEFINITION = 0x01,
+            RECORD = 0x02
+        };
+
+        enum tag : char {
+            INT32 = 'i',
+            UINT32 = 'u',
+            INT64 = 'I',
+            UINT64 = 'U',
+            DOUBLE = 'd',
+            STRING = 's', // 16 bits length, followed by the characters
+            POINTER = 'p'
+        };
+
+        static constexpr uint16_t HeaderSize = 6;
+
+    public:
+        Binary() = delete;
+        Binary(const Binary&) = delete;
+        Binary& operator=(const Binary&) = delete;
+
+        template <typename... ARGUMENTS>
+        Binary(const uint32_t id, const ARGUMENTS&... arguments)
+            : _length(HeaderSize)
+        {
+            _buffer[0] = 0;
+            _buffer[1] = RECORD;
+            ::memcpy(&_buffer[2], &id, sizeof(id));
+
+            Encode(arguments...);
+        }
+        ~Binary()
+        {
+        }
+
+    public:
+        inline const char* Data() const
+        {
+            return (_buffer);
+        }
+        inline uint16_t Length() const
+        {
+            return (_length);
+        }
+
+        static bool IsBinary(const char data[], const uint16_t length)
+        {
+            return ((length >= HeaderSize) && (data[0] == 0) && ((data[1] == DEFINITION) || (data[1] == RECORD)));
+        }
+
+    private:
+        inline void Encode()
+        {
+        }
+        template <typename FIRST, typename... REST>
+        inline void Encode(const FIRST& first, const REST&... rest)
+        {
+            Add(first);
+            Encode(rest...);
+        }
+
+        template <typename TYPE>
+        inline typename std::enable_if<(std::is_integral<TYPE>::value || std::is_enum<TYPE>::value) && std::is_signed<TYPE>::value && (sizeof(TYPE) <= 4)>::type
+        Add(const TYPE value)
+        {
+            Store(INT32, static_cast<int32_t>(value));
+        }
+        template <typename TYPE>
+        inline typename std::enable_if<(std::is_integral<TYPE>::value || std::is_enum<TYPE>::value) && !std::is_signed<TYPE>::value && (sizeof(TYPE) <= 4)>::type
+        Add(const TYPE value)
+        {
+            Store(UINT32, static_cast<uint32_t>(value));
+        }
+        template <typename TYPE>
+        inline typename std::enable_if<std::is_integral<TYPE>::value && std::is_signed<TYPE>::value && (sizeof(TYPE) == 8)>::type
+        Add(const TYPE value)
+        {
+            Store(INT64, static_cast<int64_t>(value));
+        }
+        template <typename TYPE>
+        inline typename std::enable_if<std::is_integral<TYPE>::value && !std::is_signed<TYPE>::value && (sizeof(TYPE) == 8)>::type
+        Add(const TYPE value)
+        {
+            Store(UINT64, static_cast<uint64_t>(value));
+        }
+        template <typename TYPE>
+        inline typename std::enable_if<std::is_floating_point<TYPE>::value>::type
+        Add(const TYPE value)
+        {
+            Store(DOUBLE, static_cast<double>(value));
+        }
+        template <typename TYPE>
+        inline void Add(const TYPE* value)
+        {
+            Store(POINTER, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        }
+        inline void Add(const char value[])
+        {
+            if (value == nullptr) {
+                Add(static_cast<const void*>(value));
+            } else {
+                Add(value, static_cast<uint16_t>(::strlen(value)));
+            }
+        }
+        inline void Add(const string& value)
+        {
+            Add(value.c_str(), static_cast<uint16_t>(value.length()));
+        }
+        void Add(const char value[], const uint16_t length)
+        {
+            // What does not fit is cut off, but the tag and length always go in.
+            if ((_length + 1 + sizeof(uint16_t)) <= sizeof(_buffer)) {
+                const uint16_t size = std::min(length, static_cast<uint16_t>(sizeof(_buffer) - _length - 1 - sizeof(uint16_t)));
+
+                _buffer[_length] = STRING;
+                ::memcpy(&_buffer[_length + 1], &size, sizeof(size));
+                ::memcpy(&_buffer[_length + 1 + sizeof(size)], value, size);
+                _length += 1 + sizeof(size) + size;
+            }
+        }
+        template <typename VALUE>
+        inline void Store(const tag type, const VALUE value)
+        {
+            if ((_length + 1 + sizeof(VALUE)) <= sizeof(_buffer)) {
+                _buffer[_length] = type;
+                ::memcpy(&_buffer[_length + 1], &value, sizeof(VALUE));
+                _length += 1 + sizeof(VALUE);
+            }
+        }
+
+    private:
+        uint16_t _length;
+        char _buffer[TRACINGBUFFERSIZE];
+    };
+
+    // For the side reading the trace entries: turns binary traces back into text. Definitions are
+    // remembered and produce no text themselves. A record of which the definition was never seen,
+    // for example because it was overwritten before it was read, shows its id and raw arguments.
+    class EXTERNAL Decoder {
+    public:
+        Decoder(const Decoder&) = delete;
+        Decoder& operator=(const Decoder&) = delete;
+
+        Decoder()
+            : _formats()
+        {
+        }
+        ~Decoder()
+        {
+        }
+
+    public:
+        // Returns true if there is text to show, text traces are returned as is.
+        bool Decode(const char data[], const uint16_t length, string& text);
+        void Clear()
+        {
+            _formats.clear();
+        }
+        inline uint32_t Formats() const
+        {
+            return (static_cast<uint32_t>(_formats.size()));
+        }
+
+    private:
+        void Format(const string& format, const char arguments[], const uint16_t length, string& text) const;
+
+    private:
+        std::unordered_map<uint32_t, string> _formats;
+    };
+}
+} // namespace Trace
+
+#endif // __TRACEBINARY_H
@@ -131,7 +131,13 @@ namespace Trace {
         TraceType<CATEGORY, MODULENAME>& operator=(const TraceType<CATEGORY, MODULENAME>&) = delete;
 
         TraceType(CATEGORY& category)
-            : _traceInfo(category)
+            : _data(category.Data())
+            , _length(category.Length())
+        {
+        }
+        TraceType(const char data[], const uint16_t length)
+            : _data(data)
+            , _length(length)
         {
         }
         virtual ~TraceType()
@@ -177,15 +183,16 @@ namespace Trace {
 
         virtual const char* Data() const
         {
-            return (_traceInfo.Data());
+            return (_data);
         }
         virtual uint16_t Length() const
         {
-            return (_traceInfo.Length());
+            return (_length);
         }
 
     private:
-        CATEGORY& _traceInfo;
+        const char* _data;
+        const uint16_t _length;
         static TraceControl<CATEGORY, MODULENAME> s_TraceControl;
     };
 
@@ -0,0 +1,157 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Reads the trace entries left in a trace buffer, and prints them with the binary traces formatted:
+//   TraceDecoder <trace buffer file> [--follow]
+
+#define MODULE_NAME TraceDecoder
+
+#include "tracing.h"
+
+MODULE_NAME_DECLARATION(BUILD_REFERENCE)
+
+using namespace WPEFramework;
+
+namespace {
+
+    class TraceReader : public Core::CyclicBuffer {
+    public:
+        TraceReader() = delete;
+        TraceReader(const TraceReader&) = delete;
+        TraceReader& operator=(const TraceReader&) = delete;
+
+        TraceReader(const string& fileName)
+            : Core::CyclicBuffer(fileName, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE, 0, false)
+        {
+        }
+        ~TraceReader() override = default;
+
+    private:
+        uint32_t GetReadSize(Cursor& cursor) override
+        {
+            uint16_t entrySize = 0;
+            cursor.Peek(entrySize);
+
+            return (entrySize);
+        }
+    };
+
+    // length (2) - clock ticks (8) - line number (4) - file/module/category/className ('\0' terminated) - data
+    bool Print(Trace::Decoder& decoder, const char entry[], const uint16_t length)
+    {
+        bool result = false;
+        const char* fields[4];
+        uint16_t offset = 2 + 8 + 4;
+        uint8_t index = 0;
+
+        while ((index < 4) && (offset < length)) {
+            const char* end = static_cast<const char*>(::memchr(&entry[offset], '\0', length - offset));
+
+            if (end == nullptr) {
+                break;
+            }
+
+            fields[index++] = &entry[offset];
+            offset = static_cast<uint16_t>(end - entry) + 1;
+        }
+
+        if (index == 4) {
+            uint64_t ticks;
+            uint32_t line;
+            string text;
+
+            ::memcpy(&ticks, &entry[2], sizeof(ticks));
+            ::memcpy(&line, &entry[10], sizeof(line));
+
+            if (decoder.Decode(&entry[offset], length - offset, text) == true) {
+                printf("[%s] %s [%s] %s:%u %s: %s\n",
+                    Core::Time(ticks).ToTimeOnly(true).c_str(),
+                    fields[1], fields[2], fields[0], line, fields[3], text.c_str());
+            }
+
+            result = true;
+        }
+
+        return (result);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int result = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <trace buffer file> [--follow]\n", argv[0]);
+        result = 1;
+    } else {
+        const bool follow = ((argc > 2) && (::strcmp(argv[2], "--follow") == 0));
+        TraceReader buffer(argv[1]);
+
+        if (buffer.IsValid() == false) {
+            fprintf(stderr, "Could not open trace buffer %s\n", argv[1]);
+            result = 2;
+        } else {
+            Trace::Decoder decoder;
+            uint8_t entry[Trace::TRACINGBUFFERSIZE + 1024];
+
+            do {
+                Core::CyclicBuffer::Span records;
+
+                // All entries there are in one go, printed from where they are in the buffer.
+                while (buffer.Records(records) != 0) {
+                    uint32_t offset = 0;
+
+                    while (offset < records.Length()) {
+                        uint16_t length;
+                        records.Read(offset, &length, sizeof(length));
+
+                        const char* data = reinterpret_cast<const char*>(&(records.First()[offset]));
+                        uint16_t size = length;
+
+                        if ((offset + length) > records.FirstLength()) {
+                            // Not in one piece, put it together.
+                            size = std::min(length, static_cast<uint16_t>(sizeof(entry)));
+                            records.Read(offset, entry, size);
+                            data = reinterpret_cast<const char*>(entry);
+                        }
+
+                        if (Print(decoder, data, size) == false) {
+                            fprintf(stderr, "Skipped a broken trace entry of %u bytes\n", length);
+                        }
+
+                        offset += length;
+                    }
+
+                    if (buffer.Consume(records) == false) {
+                        fprintf(stderr, "Trace entries were overwritten while they were printed\n");
+                    }
+                }
+
+                if (follow == true) {
+                    // The doorbell belongs to whoever serves the buffer (TraceControl), poll instead.
+                    SleepMs(100);
+                }
+            } while (follow == true);
+        }
+    }
+
+    Core::Singleton::Dispose();
+
+    return (result);
+}
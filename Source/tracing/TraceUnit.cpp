@@ -18,6 +18,7 @@
  */
 
 #include "TraceUnit.h"
+#include "TraceBinary.h"
 #include "TraceCategories.h"
 #include "Logging.h"
 
@@ -108,10 +109,54 @@ namespace Trace {
 
     /* static */ const TCHAR* CyclicBufferName = _T("tracebuffer");
 
+    // The definition of a binary trace format, it goes into the buffer like any other trace.
+    class FormatDefinition : public ITrace {
+    public:
+        FormatDefinition() = delete;
+        FormatDefinition(const FormatDefinition&) = delete;
+        FormatDefinition& operator=(const FormatDefinition&) = delete;
+
+        FormatDefinition(const uint32_t id, const string& format)
+            : _data(Binary::HeaderSize, 0)
+        {
+            _data[1] = Binary::DEFINITION;
+            ::memcpy(&_data[2], &id, sizeof(id));
+            _data.append(format, 0, TRACINGBUFFERSIZE - Binary::HeaderSize);
+        }
+        ~FormatDefinition()
+        {
+        }
+
+    public:
+        const char* Category() const override
+        {
+            return (_T("Format"));
+        }
+        const char* Module() const override
+        {
+            return (_T("Tracing"));
+        }
+        const char* Data() const override
+        {
+            return (_data.c_str());
+        }
+        uint16_t Length() const override
+        {
+            return (static_cast<uint16_t>(_data.length()));
+        }
+
+    private:
+        std::string _data;
+    };
+
     TraceUnit::TraceUnit()
         : m_Categories()
         , m_Admin()
         , m_OutputChannel(nullptr)
+        , m_Producers(0)
+        , m_EnabledCategories()
+        , m_Formats()
+        , m_Decoder()
         , m_DirectOut(false)
     {
     }
@@ -219,11 +264,16 @@ namespace Trace {
 
         ASSERT(m_OutputChannel != nullptr);
 
-        if (m_OutputChannel != nullptr) {
-            delete m_OutputChannel;
+        TraceBuffer* outputChannel = m_OutputChannel.exchange(nullptr);
+
+        // Traces that already picked up the buffer, finish with it first.
+        while (m_Producers.load() != 0) {
+            SleepMs(0);
         }
 
-        m_OutputChannel = nullptr;
+        if (outputChannel != nullptr) {
+            delete outputChannel;
+        }
 
         m_Admin.Unlock();
 
@@ -379,13 +429,68 @@ namespace Trace {
         return isDefaultCategory;
     }
 
+    uint32_t TraceUnit::Format(const char format[])
+    {
+        // FNV-1a, so the same format has the same id in every run.
+        uint32_t id = 0x811C9DC5;
+
+        for (const char* index = format; *index != '\0'; index++) {
+            id = (id ^ static_cast<uint8_t>(*index)) * 0x01000193;
+        }
+
+        m_Admin.Lock();
+
+        std::unordered_map<uint32_t, string>::iterator entry(m_Formats.find(id));
+
+        // The id is only a name for the format in this process, on a clash just take the next.
+        while ((entry != m_Formats.end()) && (entry->second != format)) {
+            id++;
+            entry = m_Formats.find(id);
+        }
+
+        if (entry == m_Formats.end()) {
+            m_Formats.emplace(id, format);
+            Define(id, format);
+        }
+
+        m_Admin.Unlock();
+
+        return (id);
+    }
+
+    void TraceUnit::Define(const uint32_t id, const string& format)
+    {
+        FormatDefinition definition(id, format);
+        string text;
+
+        // Our own direct output needs to know it as well.
+        m_Decoder.Decode(definition.Data(), definition.Length(), text);
+
+        Trace(__FILE__, __LINE__, "", &definition);
+    }
+
+    void TraceUnit::Definitions()
+    {
+        m_Admin.Lock();
+
+        for (const std::pair<const uint32_t, string>& entry : m_Formats) {
+            Define(entry.first, entry.second);
+        }
+
+        m_Admin.Unlock();
+    }
+
     void TraceUnit::Trace(const char file[], const uint32_t lineNumber, const char className[], const ITrace* const information)
     {
         const char* fileName(Core::FileNameOnly(file));
 
-        m_Admin.Lock();
+        // No lock, traces from different threads go into the buffer side by side. Close waits
+        // for the ones in flight before the buffer goes.
+        m_Producers++;
 
-        if (m_OutputChannel != nullptr) {
+        TraceBuffer* outputChannel = m_OutputChannel;
+
+        if (outputChannel != nullptr) {
 
             const char* category(information->Category());
             const char* module(information->Module());
@@ -402,40 +507,58 @@ namespace Trace {
 
             const uint32_t fullLength = informationLength + headerLength; // Actual data (no '\0' needed).
 
-            // Tell the buffer how much we are going to write.
-            const uint32_t actualLength = m_OutputChannel->Reserve(fullLength);
+            // Maximum entry size is one less than the buffer, if it is more the information is cut short.
+            const uint32_t actualLength = std::min(fullLength, static_cast<uint32_t>(outputChannel->Size() - 1));
+
+            Core::CyclicBuffer::Span entry;
 
-            if (actualLength >= headerLength) {
+            if ((actualLength >= headerLength) && (outputChannel->Claim(actualLength, entry) != 0)) {
+                // The entry is written in place, next to the ones other threads are writing.
                 const uint16_t convertedLength = static_cast<uint16_t>(actualLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(&convertedLength), 2);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(&current), 8);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(&lineNumber), 4);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(fileName), fileNameLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(module), moduleLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(category), categoryLength);
-                m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(className), classNameLength);
-
-                if (actualLength >= fullLength) {
-                    // We can write the whole information.
-                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(information->Data()), informationLength);
-                } else {
-                    // Can only write information partially
-                    const uint16_t dropLength = actualLength - headerLength;
-
-                    m_OutputChannel->Write(reinterpret_cast<const uint8_t*>(information->Data()), dropLength);
-                }
+                uint32_t position = 0;
+
+                entry.Write(position, &convertedLength, 2);
+                position += 2;
+                entry.Write(position, &current, 8);
+                position += 8;
+                entry.Write(position, &lineNumber, 4);
+                position += 4;
+                entry.Write(position, fileName, fileNameLength);
+                position += fileNameLength;
+                entry.Write(position, module, moduleLength);
+                position += moduleLength;
+                entry.Write(position, category, categoryLength);
+                position += categoryLength;
+                entry.Write(position, className, classNameLength);
+                position += classNameLength;
+                entry.Write(position, information->Data(), actualLength - headerLength);
+
+                outputChannel->Commit(entry);
             }
         }
 
+        m_Producers--;
+
         if (m_DirectOut == true) {
-            string time(Core::Time::Now().ToRFC1123(true));
-            Core::TextFragment cleanClassName(Core::ClassNameOnly(className));
+            string text;
+            bool show = true;
+
+            if (Binary::IsBinary(information->Data(), information->Length()) == false) {
+                text = information->Data();
+            } else {
+                m_Admin.Lock();
+                show = m_Decoder.Decode(information->Data(), information->Length(), text);
+                m_Admin.Unlock();
+            }
 
-            fprintf(stdout, "[%s]:[%s:%d]:[%s] %s: %s\n", time.c_str(), fileName, lineNumber, cleanClassName.Data(), information->Category(), information->Data());
-            fflush(stdout);
-        }
+            if (show == true) {
+                string time(Core::Time::Now().ToRFC1123(true));
+                Core::TextFragment cleanClassName(Core::ClassNameOnly(className));
 
-        m_Admin.Unlock();
+                fprintf(stdout, "[%s]:[%s:%d]:[%s] %s: %s\n", time.c_str(), fileName, lineNumber, cleanClassName.Data(), information->Category(), text.c_str());
+                fflush(stdout);
+            }
+        }
     }
 }
 } // namespace WPEFramework::Trace
@@ -25,6 +25,7 @@
 // ---- Include local include files ----
 #include "ITraceMedia.h"
 #include "Module.h"
+#include "TraceBinary.h"
 
 // ---- Helper types and constants ----
 
@@ -212,9 +213,13 @@ namespace Trace {
 
         void Trace(const char fileName[], const uint32_t lineNumber, const char className[], const ITrace* const information);
 
+        // Registers the format of binary traces (TRACE_BINARY), the returned id is what the traces
+        // carry. The definition goes into the trace buffer, the reading side needs it to format them.
+        uint32_t Format(const char format[]);
+
         inline Core::CyclicBuffer* CyclicBuffer()
         {
-            return (m_OutputChannel);
+            return (m_OutputChannel.load());
         }
         inline bool HasDirectOutput() const
         {
@@ -226,19 +231,19 @@ namespace Trace {
         }
         inline void Announce() {
             ASSERT (m_OutputChannel != nullptr);
-            m_OutputChannel->Ring();
+            m_OutputChannel.load()->Ring();
         }
         inline void Acknowledge() {
             ASSERT (m_OutputChannel != nullptr);
-            m_OutputChannel->Acknowledge();
+            m_OutputChannel.load()->Acknowledge();
         }
         inline uint32_t Wait (const uint32_t waitTime) {
             ASSERT (m_OutputChannel != nullptr);
-            return (m_OutputChannel->Wait(waitTime));
+            return (m_OutputChannel.load()->Wait(waitTime));
         }
         inline void Relinquish() {
             ASSERT(m_OutputChannel != nullptr);
-            return (m_OutputChannel->Relinquish());
+            return (m_OutputChannel.load()->Relinquish());
         }
 
     private:
@@ -246,18 +251,28 @@ namespace Trace {
         {
             ASSERT(m_OutputChannel == nullptr);
 
-            m_OutputChannel = new TraceBuffer(doorBell, fileName);
+            TraceBuffer* outputChannel = new TraceBuffer(doorBell, fileName);
+
+            ASSERT(outputChannel->IsValid() == true);
+
+            m_OutputChannel = outputChannel;
 
-            ASSERT(m_OutputChannel->IsValid() == true);
+            // Formats registered before there was a buffer to put them in.
+            Definitions();
 
-            return (m_OutputChannel->IsValid() ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+            return (outputChannel->IsValid() ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
         }
         void UpdateEnabledCategories(const Core::JSON::ArrayType<Setting::JSON>& info);
+        void Define(const uint32_t id, const string& format);
+        void Definitions();
 
         TraceControlList m_Categories;
         Core::CriticalSection m_Admin;
-        TraceBuffer* m_OutputChannel;
+        std::atomic<TraceBuffer*> m_OutputChannel;
+        std::atomic<uint32_t> m_Producers;
         Settings m_EnabledCategories;
+        std::unordered_map<uint32_t, string> m_Formats;
+        Decoder m_Decoder;
         bool m_DirectOut;
     };
 }
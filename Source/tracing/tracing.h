@@ -22,6 +22,7 @@
 #include "ITraceControl.h"
 #include "ITraceMedia.h"
 #include "Logging.h"
+#include "TraceBinary.h"
 #include "TraceCategories.h"
 #include "TraceControl.h"
 #include "TraceMedia.h"
@@ -37,6 +37,24 @@ namespace JSONRPC {
 
         typedef std::function<void(const Core::JSONRPC::Message&)> CallbackFunction;
 
+        // A MessagePack link negotiates the packed subprotocol, the params and results of
+        // the messages are then MessagePack values instead of JSON texts.
+        static constexpr bool IsPacked()
+        {
+            return (std::is_same<INTERFACE, Core::JSON::IMessagePack>::value);
+        }
+
+        struct CompressionSettings {
+            uint8_t Mode;
+            uint16_t Threshold;
+            uint8_t WindowBits;
+        };
+        static CompressionSettings& Defaults()
+        {
+            static CompressionSettings settings = { Web::WebSocket::Deflate::DISABLED, 0, 15 };
+            return (settings);
+        }
+
         class CommunicationChannel {
         private:
             // -----------------------------------------------------------------------------------------------
@@ -73,6 +91,10 @@ namespace JSONRPC {
                     {
                         return (!operator==(rhs));
                     }
+                    uint64_t Hash() const
+                    {
+                        return (reinterpret_cast<uintptr_t>(_client));
+                    }
     
                 public:
                     uint64_t Timed(const uint64_t scheduledTime) {
@@ -132,9 +154,14 @@ namespace JSONRPC {
     
             public:
                 ChannelImpl(CommunicationChannel* parent, const Core::NodeId& remoteNode, const string& callsign, const string& query)
-                    : BaseClass(5, FactoryImpl::Instance(), callsign, _T("JSON"), query, "", false, false, false, remoteNode.AnyInterface(), remoteNode, 256, 256)
+                    : BaseClass(5, FactoryImpl::Instance(), callsign, (IsPacked() == true ? Core::JSONRPC::Message::PackedProtocol : _T("JSON")), query, "", IsPacked(), false, false, remoteNode.AnyInterface(), remoteNode, 256, 256)
                     , _parent(*parent)
                 {
+                    const CompressionSettings& compression(LinkType<INTERFACE>::Defaults());
+
+                    if (compression.Mode != Web::WebSocket::Deflate::DISABLED) {
+                        BaseClass::Link().Compression(compression.Mode, compression.Threshold, compression.WindowBits);
+                    }
                 }
                 virtual ~ChannelImpl()
                 {
@@ -619,6 +646,19 @@ namespace JSONRPC {
             _channel->Unregister(*this);
         }
 
+        // Offer permessage-deflate on the channels opened from now on. Links to the same host and
+        // callsign share a channel, so set it before the first of them is created.
+        static void Compression(const uint8_t mode, const uint16_t threshold, const uint8_t windowBits)
+        {
+            ASSERT((windowBits >= 9) && (windowBits <= 15));
+
+            CompressionSettings& settings(Defaults());
+
+            settings.Mode = mode;
+            settings.Threshold = threshold;
+            settings.WindowBits = windowBits;
+        }
+
     public:
         const string& Namespace() const
         {
@@ -1035,41 +1075,44 @@ namespace JSONRPC {
                 } else {
                     message->Designator = method;
                 }
-                ToMessage(parameters, message);
-
-                _adminLock.Lock();
+                if (ToMessage(parameters, message) == false) {
+                    // Parameters that can not be converted are not silently left out.
+                    result = Core::ERROR_BAD_REQUEST;
+                } else {
+                    _adminLock.Lock();
 
-                typename std::pair< typename PendingMap::iterator, bool> newElement = _pendingQueue.emplace(std::piecewise_construct,
-                    std::forward_as_tuple(id),
-                    std::forward_as_tuple());
-                ASSERT(newElement.second == true);
+                    typename std::pair< typename PendingMap::iterator, bool> newElement = _pendingQueue.emplace(std::piecewise_construct,
+                        std::forward_as_tuple(id),
+                        std::forward_as_tuple());
+                    ASSERT(newElement.second == true);
 
-                if (newElement.second == true) {
+                    if (newElement.second == true) {
 
-                    Entry& slot(newElement.first->second);
+                        Entry& slot(newElement.first->second);
 
-                    _adminLock.Unlock();
+                        _adminLock.Unlock();
 
-                    _channel->Submit(Core::ProxyType<INTERFACE>(message));
+                        _channel->Submit(Core::ProxyType<INTERFACE>(message));
 
-                    message.Release();
+                        message.Release();
 
-                    if (slot.WaitForResponse(waitTime) == true) {
-                        response = slot.Response();
+                        if (slot.WaitForResponse(waitTime) == true) {
+                            response = slot.Response();
 
-                        // See if we have a response, maybe it was just the connection
-                        // that closed?
-                        if (response.IsValid() == true) {
-                            result = Core::ERROR_NONE;
+                            // See if we have a response, maybe it was just the connection
+                            // that closed?
+                            if (response.IsValid() == true) {
+                                result = Core::ERROR_NONE;
+                            }
                         }
-                    }
 
-                    _adminLock.Lock();
+                        _adminLock.Lock();
 
-                    _pendingQueue.erase(id);
-                }
+                        _pendingQueue.erase(id);
+                    }
 
-                _adminLock.Unlock();
+                    _adminLock.Unlock();
+                }
             }
 
             return (result);
@@ -1093,29 +1136,32 @@ namespace JSONRPC {
                 } else {
                     message->Designator = method;
                 }
-                ToMessage(parameters, message);
-
-                _adminLock.Lock();
+                if (ToMessage(parameters, message) == false) {
+                    // Parameters that can not be converted are not silently left out.
+                    result = Core::ERROR_BAD_REQUEST;
+                } else {
+                    _adminLock.Lock();
 
-                typename std::pair<typename PendingMap::iterator, bool> newElement = _pendingQueue.emplace(std::piecewise_construct,
-                    std::forward_as_tuple(id),
-                    std::forward_as_tuple(waitTime, response));
-                ASSERT(newElement.second == true);
+                    typename std::pair<typename PendingMap::iterator, bool> newElement = _pendingQueue.emplace(std::piecewise_construct,
+                        std::forward_as_tuple(id),
+                        std::forward_as_tuple(waitTime, response));
+                    ASSERT(newElement.second == true);
 
-                if (newElement.second == true) {
+                    if (newElement.second == true) {
 
-                    _channel->Submit(Core::ProxyType<INTERFACE>(message));
+                        _channel->Submit(Core::ProxyType<INTERFACE>(message));
 
-                    result = Core::ERROR_NONE;
+                        result = Core::ERROR_NONE;
 
-                    message.Release();
-                    if ((_scheduledTime == 0) || (_scheduledTime > newElement.first->second.Expiry())) {
-                        _scheduledTime = newElement.first->second.Expiry();
-                        CommunicationChannel::Trigger(_scheduledTime, this);
+                        message.Release();
+                        if ((_scheduledTime == 0) || (_scheduledTime > newElement.first->second.Expiry())) {
+                            _scheduledTime = newElement.first->second.Expiry();
+                            CommunicationChannel::Trigger(_scheduledTime, this);
+                        }
                     }
-                }
 
-                _adminLock.Unlock();
+                    _adminLock.Unlock();
+                }
             }
 
             return (result);
@@ -1155,7 +1201,18 @@ namespace JSONRPC {
                     ASSERT(inbound->Id.IsSet() == false);
 
                     string response;
-                    _handler.Invoke(Core::JSONRPC::Connection(~0, ~0), inbound->FullMethod(), inbound->Parameters.Value(), response);
+                    if (IsPacked() == false) {
+                        _handler.Invoke(Core::JSONRPC::Connection(~0, ~0), inbound->FullMethod(), inbound->Parameters.Value(), response);
+                    } else {
+                        // The handlers take JSON text. An event with params that do not convert is
+                        // dropped, rather than reported without them.
+                        string parameters;
+                        if (Core::JSON::MessagePack::ToText(inbound->Parameters.Value(), parameters) == true) {
+                            _handler.Invoke(Core::JSONRPC::Connection(~0, ~0), inbound->FullMethod(), parameters, response);
+                        } else {
+                            TRACE_L1("Dropped event %s, its params are not valid MessagePack", inbound->FullMethod().c_str());
+                        }
+                    }
                 }
             }
 
@@ -1163,19 +1220,31 @@ namespace JSONRPC {
         }
 
     private:
-        void ToMessage(const string& parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
+        // Returns false if the parameters could not be put in the message, it should not be sent then.
+        bool ToMessage(const string& parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
         {
+           bool result = true;
+
            if (parameters.empty() != true) {
-               message->Parameters = parameters;
+               if (IsPacked() == false) {
+                   message->Parameters = parameters;
+               } else {
+                   string packed;
+                   result = Core::JSON::MessagePack::FromText(parameters, packed);
+                   if (result == true) {
+                       message->Parameters = packed;
+                   }
+               }
            }
+
+           return (result);
         }
         template <typename PARAMETERS>
-        void ToMessage(PARAMETERS& parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
+        bool ToMessage(PARAMETERS& parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
         {
-             ToMessage((INTERFACE*)(&parameters), message);
-             return;
+             return (ToMessage((INTERFACE*)(&parameters), message));
         }
-        void ToMessage(Core::JSON::IMessagePack* parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
+        bool ToMessage(Core::JSON::IMessagePack* parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
         {
              std::vector<uint8_t> values;
              parameters->ToBuffer(values);
@@ -1183,16 +1252,16 @@ namespace JSONRPC {
                  string strValues(values.begin(), values.end());
                  message->Parameters = strValues;
              }
-             return;
+             return (true);
         }
-        void ToMessage(Core::JSON::IElement* parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
+        bool ToMessage(Core::JSON::IElement* parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
         {
              string values;
              parameters->ToString(values);
              if (values.empty() != true) {
                  message->Parameters = values;
              }
-             return;
+             return (true);
         }
         void FromMessage(Core::JSON::IElement* response, const Core::JSONRPC::Message& message)
         {
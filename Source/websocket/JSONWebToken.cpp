@@ -63,9 +63,33 @@ namespace Web
         Core::JSON::EnumType<JSONWebToken::mode> Algorithm;
     };
 
-    JSONWebToken::JSONWebToken(const mode type, const uint8_t length, const uint8_t key[])
+    class EXTERNAL JSONWebClaims : public Core::JSON::Container {
+    private:
+        JSONWebClaims(const JSONWebClaims&);
+        JSONWebClaims& operator=(const JSONWebClaims&);
+
+    public:
+        JSONWebClaims(const uint8_t data[], const uint16_t length)
+            : Core::JSON::Container()
+            , Expiry()
+        {
+            Add(_T("exp"), &Expiry);
+
+            FromString(string(reinterpret_cast<const char*>(data), length));
+        }
+        ~JSONWebClaims()
+        {
+        }
+
+    public:
+        Core::JSON::DecUInt64 Expiry;
+    };
+
+    JSONWebToken::JSONWebToken(const mode type, const uint8_t length, const uint8_t key[], const uint16_t cacheSize, const uint32_t cacheLifetime)
         : _mode(type)
-        , _key(string(reinterpret_cast<const char*>(key), length))
+        , _header()
+        , _key(key, length)
+        , _cache(cacheSize, cacheLifetime)
     {
         Core::EnumerateType<mode> modeData(type);
         string sourceBuffer(_T("{\"alg\":\"") + string(modeData.Data()) + _T("\",\"typ\":\"JWT\"}"));
@@ -98,11 +122,11 @@ namespace Web
 
 		if (_mode == JSONWebToken::SHA256) {
             TCHAR signature[((Crypto::SHA256HMAC::Length * 8) / 6) + 4];
-            Crypto::SHA256HMAC hash(_key);
-            hash.Input(reinterpret_cast<const uint8_t*>(token.c_str()), static_cast<uint16_t>(token.length()));
-            const uint8_t* inputSignature = hash.Result(); // 32 length
-           
-            convertedLength = Core::URL::Base64Encode(inputSignature, hash.Length, signature, sizeof(signature), false);
+            uint8_t inputSignature[Crypto::SHA256HMAC::Length];
+
+            Signature(token, token.length(), inputSignature);
+
+            convertedLength = Core::URL::Base64Encode(inputSignature, sizeof(inputSignature), signature, sizeof(signature), false);
             token += '.' + string(signature, convertedLength);
 		}
 
@@ -111,6 +135,25 @@ namespace Web
         return (static_cast<uint16_t>(token.length()));
     }
     uint16_t JSONWebToken::Decode(const string& token, const uint16_t maxLength, uint8_t payload[]) const
+    {
+        uint16_t length;
+        string cached;
+
+        if ((_cache.IsEnabled() == true) && (_cache.Find(token, cached) == true) && (cached.length() <= maxLength)) {
+            length = static_cast<uint16_t>(cached.length());
+            ::memcpy(payload, cached.data(), length);
+        } else {
+            length = Validate(token, maxLength, payload);
+
+            // A payload that filled the buffer might have been cut short, do not remember that one.
+            if ((length < maxLength) && (_cache.IsEnabled() == true)) {
+                _cache.Add(token, string(reinterpret_cast<const char*>(payload), length));
+            }
+        }
+
+        return (length);
+    }
+    uint16_t JSONWebToken::Validate(const string& token, const uint16_t maxLength, uint8_t payload[]) const
     {
         uint16_t length = 0;
 
@@ -163,15 +206,15 @@ namespace Web
         if (pos != string::npos) {
 		
             if (type == JSONWebToken::mode::SHA256) {
-                // Now calculate what we think it should be..
-                Crypto::SHA256HMAC hash(_key);
-
                 // Extract the signature and convert it to a binary string.
 				uint8_t signature[Crypto::SHA256HMAC::Length];
-                if (Core::URL::Base64Decode(token.substr(pos + 1).c_str(), static_cast<uint16_t>(token.length() - pos - 1), signature, sizeof(signature), nullptr) == sizeof(signature)) {
+                if (Core::URL::Base64Decode(&(token.c_str()[pos + 1]), static_cast<uint16_t>(token.length() - pos - 1), signature, sizeof(signature), nullptr) == sizeof(signature)) {
+
+                    // Now calculate what we think it should be..
+                    uint8_t calculated[Crypto::SHA256HMAC::Length];
 
-					hash.Input(reinterpret_cast<const uint8_t*>(token.substr(0, pos).c_str()), static_cast<uint16_t>(pos * sizeof(TCHAR)));
-					result = (::memcmp(hash.Result(), signature, sizeof(signature)) == 0);
+                    Signature(token, pos, calculated);
+					result = (::memcmp(calculated, signature, sizeof(signature)) == 0);
 				}
             }
 		}
@@ -179,6 +222,43 @@ namespace Web
 		return (result);
     }
 
+    void JSONWebToken::Signature(const string& token, const size_t length, uint8_t signature[]) const
+    {
+        const uint8_t* message = reinterpret_cast<const uint8_t*>(token.c_str());
+        const uint32_t size = static_cast<uint32_t>(length * sizeof(TCHAR));
+
+        // Digest starts from the prepared key and leaves _key as is, so this can run concurrently.
+        _key.Digest(1, &message, &size, signature);
+    }
+
+    /* static */ uint32_t JSONWebToken::Lifetime(const string& token)
+    {
+        uint32_t result = ~0;
+        size_t first = token.find_first_of('.');
+        size_t last = token.find_last_of('.');
+
+        if ((first != string::npos) && (last > first)) {
+            const uint16_t length = static_cast<uint16_t>(last - first - 1);
+            uint8_t* payload = reinterpret_cast<uint8_t*>(ALLOCA(length));
+
+            JSONWebClaims claims(payload, Core::URL::Base64Decode(&(token.c_str()[first + 1]), length, payload, length, nullptr));
+
+            if (claims.Expiry.IsSet() == true) {
+                // The claim is in seconds since the epoch.
+                const uint64_t expiry = Core::Time(1970, 1, 1, 0, 0, 0, 0, false).Ticks() + (claims.Expiry.Value() * 1000 * Core::Time::TicksPerMillisecond);
+                const uint64_t now = Core::Time::Now().Ticks();
+
+                if (expiry <= now) {
+                    result = 0;
+                } else if (((expiry - now) / Core::Time::TicksPerMillisecond) < static_cast<uint32_t>(~0)) {
+                    result = static_cast<uint32_t>((expiry - now) / Core::Time::TicksPerMillisecond);
+                }
+            }
+        }
+
+        return (result);
+    }
+
 	uint16_t JSONWebToken::PayloadLength(const string& token) const
     {
         uint16_t result = ~0;
@@ -31,12 +31,19 @@ namespace Web {
         JSONWebToken(const JSONWebToken&) = delete;
         JSONWebToken& operator= (const JSONWebToken&) = delete;
 
+        typedef Core::ValidationCacheType<string> Cache;
+
 	public:
 		enum mode : uint8_t {
 			SHA256
 		};
-		
-		JSONWebToken(const mode type, const uint8_t length, const uint8_t key[]);
+
+        typedef Cache::Statistics Statistics;
+
+        // A token that decoded correctly is remembered, with its payload, for cacheLifetime
+        // milliseconds, so presenting it again skips the decoding and the signature check. A
+        // cacheSize of 0 turns this off.
+		JSONWebToken(const mode type, const uint8_t length, const uint8_t key[], const uint16_t cacheSize = 16, const uint32_t cacheLifetime = 60000);
         ~JSONWebToken();
 
 	public:
@@ -44,13 +51,30 @@ namespace Web {
         uint16_t Decode(const string& token, const uint16_t maxLength, uint8_t payload[]) const;
         uint16_t PayloadLength(const string& token) const;
 
+        // The milliseconds left till the "exp" claim of the token, 0 once it passed and ~0 if
+        // there is no such claim. The signature is not checked, use it on a token that was.
+        static uint32_t Lifetime(const string& token);
+
+        inline Statistics CacheCounters() const
+        {
+            return (_cache.Counters());
+        }
+        inline void Flush()
+        {
+            _cache.Clear();
+        }
+
 	private:
+        uint16_t Validate(const string& token, const uint16_t maxLength, uint8_t payload[]) const;
         bool ValidSignature(const mode type, const string& token) const;
+        void Signature(const string& token, const size_t length, uint8_t signature[]) const;
 
 	private:
         mode _mode;
         string _header; 
-		string _key;
+        // The key is hashed into the HMAC once, every signature starts from that state.
+        Crypto::SHA256HMAC _key;
+        mutable Cache _cache;
     };
 
 } } // namespace WPEFramework::Web
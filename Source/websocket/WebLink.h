@@ -72,6 +72,10 @@ namespace Web {
             }
 
         private:
+            virtual bool Transfer(const Core::IResource::handle file, const uint32_t offset, const uint32_t length)
+            {
+                return (_parent.TransferFile(_parent, file, offset, length));
+            }
             virtual void Serialized(const typename OUTBOUND::BaseElement& element)
             {
                 _lock.Lock();
@@ -349,6 +353,30 @@ namespace Web {
             return (_serializerImpl.Serialize(dataFrame, receivedSize));
         }
 
+        // A file body goes straight from the file onto a plain socket, unless it has to be transformed
+        // or the link is not a plain socket (TLS), then it is copied.
+        template <typename CLASSNAME>
+        inline typename Core::TypeTraits::enable_if<CLASSNAME::TraitSerializer::value, bool>::type
+        TransferFile(const CLASSNAME&, const Core::IResource::handle, const uint32_t, const uint32_t)
+        {
+            return (false);
+        }
+
+        template <typename CLASSNAME>
+        inline typename Core::TypeTraits::enable_if<!CLASSNAME::TraitSerializer::value, bool>::type
+        TransferFile(const CLASSNAME&, const Core::IResource::handle file, const uint32_t offset, const uint32_t length)
+        {
+            return (TransferFile(::TemplateIntToType<std::is_base_of<Core::SocketPort, LINK>::value>(), file, offset, length));
+        }
+        inline bool TransferFile(const ::TemplateIntToType<1>&, const Core::IResource::handle file, const uint32_t offset, const uint32_t length)
+        {
+            return (_channel.Transfer(file, offset, length));
+        }
+        inline bool TransferFile(const ::TemplateIntToType<0>&, const Core::IResource::handle, const uint32_t, const uint32_t)
+        {
+            return (false);
+        }
+
     private:
         SerializerImpl _serializerImpl;
         DeserializerImpl _deserialiserImpl;
@@ -95,6 +95,14 @@ namespace Web {
         // The Serialize and Deserialize methods allow the content to be serialized/deserialized.
         virtual void Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */) const = 0;
         virtual void Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */) = 0;
+
+        // A body that lives in a file can be sent by the link straight from that file, instead of
+        // through Serialize(stream, maxLength). Asked before the first byte of the body is serialized,
+        // returns the file and the position to send from if that is possible.
+        virtual bool Transferable(Core::IResource::handle& /* file */, uint32_t& /* offset */) const
+        {
+            return (false);
+        }
     };
 
     class EXTERNAL Signature {
@@ -246,7 +254,8 @@ namespace Web {
             MAN,
             M_X,
             S_T,
-			AUTHORIZATION
+			AUTHORIZATION,
+            RANGE
         };
 
         enum type {
@@ -313,6 +322,13 @@ namespace Web {
         public:
             virtual void Serialized(const Web::Request& element) = 0;
 
+            // The link can take over a body that lives in a file (see IBody::Transferable) and send it
+            // once the headers are out. Links that can not, keep the default and get the body copied.
+            virtual bool Transfer(const Core::IResource::handle /* file */, const uint32_t /* offset */, const uint32_t /* length */)
+            {
+                return (false);
+            }
+
             void Flush()
             {
                 _lock.Lock();
@@ -592,6 +608,7 @@ namespace Web {
             MX.Clear();
             ST.Clear();
             WebToken.Clear();
+            Range.Clear();
 
             if (_body.IsValid() == true) {
                 _body.Release();
@@ -629,6 +646,7 @@ namespace Web {
         Core::OptionalType<string> ST;
         Core::OptionalType<uint32_t> MX;
         Core::OptionalType<Authorization> WebToken;
+        Core::OptionalType<string> Range;
 
         inline bool HasBody() const
         {
@@ -71,6 +71,12 @@ namespace Web {
 
     };
 
+    // Resolves a Range header against a file of the given size. Only a single range is honoured
+    // ("bytes=first-last", "bytes=first-" or "bytes=-suffix"), for anything else STATUS_OK is
+    // returned and the whole file should be served, as HTTP allows. A FileBody can not address
+    // beyond 31 bits, for larger files the range is ignored as well.
+    WebStatus EXTERNAL ByteRange(const string& range, const uint64_t size, uint64_t& first, uint64_t& last);
+
     class EXTERNAL Response {
     public:
         typedef Response BaseElement;
@@ -95,12 +101,14 @@ namespace Web {
             ALLOW,
             WEBSOCKET_ACCEPT,
             WEBSOCKET_PROTOCOL,
+            WEBSOCKET_EXTENSIONS,
             LOCATION,
             WAKEUP,
             U_S_N,
             S_T,
             CACHE_CONTROL,
-            APPLICATION_URL
+            APPLICATION_URL,
+            CONTENT_RANGE
         };
 
         enum upgrade {
@@ -151,6 +159,13 @@ namespace Web {
         public:
             virtual void Serialized(const Web::Response& element) = 0;
 
+            // The link can take over a body that lives in a file (see IBody::Transferable) and send it
+            // once the headers are out. Links that can not, keep the default and get the body copied.
+            virtual bool Transfer(const Core::IResource::handle /* file */, const uint32_t /* offset */, const uint32_t /* length */)
+            {
+                return (false);
+            }
+
             void Flush()
             {
                 _lock.Lock();
@@ -404,6 +419,7 @@ namespace Web {
             ContentLength.Clear();
             ContentEncoding.Clear();
             WebSocketAccept.Clear();
+            WebSocketExtensions.Clear();
             AccessControlOrigin.Clear();
             AccessControlMethod.Clear();
             AccessControlHeaders.Clear();
@@ -418,6 +434,7 @@ namespace Web {
             WakeUp.Clear();
             CacheControl.Clear();
             ApplicationURL.Clear();
+            ContentRange.Clear();
 
             if (_body.IsValid() == true) {
                 _body.Release();
@@ -452,8 +469,10 @@ namespace Web {
         Core::OptionalType<string> WakeUp;
         Core::OptionalType<string> ETag;
         Core::OptionalType<string> WebSocketProtocol;
+        Core::OptionalType<string> WebSocketExtensions;
         Core::OptionalType<string> CacheControl;
         Core::OptionalType<Core::URL> ApplicationURL;
+        Core::OptionalType<string> ContentRange;
 
         inline bool HasBody() const
         {
@@ -63,6 +63,7 @@ static const TCHAR __ST[] = _T("ST:");
 static const TCHAR __MAN[] = _T("MAN:");
 static const TCHAR __MX[] = _T("MX:");
 static const TCHAR __AUTHORIZATION[] = _T("AUTHORIZATION:");
+static const TCHAR __RANGE[] = _T("RANGE:");
 
 static const TCHAR __DATE[] = _T("DATE:");
 static const TCHAR __SERVER[] = _T("SERVER:");
@@ -84,6 +85,7 @@ static const TCHAR __LOCATION[] = _T("LOCATION:");
 static const TCHAR __WAKEUP[] = _T("WAKEUP:");
 static const TCHAR __CACHE_CONTROL[] = _T("CACHE-CONTROL:");
 static const TCHAR __APPLICATION_URL[] = _T("APPLICATION-URL:");
+static const TCHAR __CONTENT_RANGE[] = _T("CONTENT-RANGE:");
 
 static const TCHAR __CHARACTER_SET[] = _T("CHARSET=");
 
@@ -227,10 +229,12 @@ ENUM_CONVERSION_BEGIN(Web::Request::keywords)
     { Web::Request::WEBSOCKET_KEY, __TXT(__WEBSOCKET_KEY) },
     { Web::Request::WEBSOCKET_PROTOCOL, __TXT(__WEBSOCKET_PROTOCOL) },
     { Web::Request::WEBSOCKET_VERSION, __TXT(__WEBSOCKET_VERSION) },
+    { Web::Request::WEBSOCKET_EXTENSIONS, __TXT(__WEBSOCKET_EXTENSIONS) },
     { Web::Request::MAN, __TXT(__MAN) },
     { Web::Request::M_X, __TXT(__MX) },
     { Web::Request::S_T, __TXT(__ST) },
     { Web::Request::AUTHORIZATION, __TXT(__AUTHORIZATION) },
+    { Web::Request::RANGE, __TXT(__RANGE) },
 
 ENUM_CONVERSION_END(Web::Request::keywords)
 
@@ -271,12 +275,14 @@ ENUM_CONVERSION_BEGIN(Web::Response::keywords)
     { Web::Response::ACCESS_CONTROL_MAX_AGE, __TXT(__ACCESS_CONTROL_MAX_AGE) },
     { Web::Response::WEBSOCKET_ACCEPT, __TXT(__WEBSOCKET_ACCEPT) },
     { Web::Response::WEBSOCKET_PROTOCOL, __TXT(__WEBSOCKET_PROTOCOL) },
+    { Web::Response::WEBSOCKET_EXTENSIONS, __TXT(__WEBSOCKET_EXTENSIONS) },
     { Web::Response::LOCATION, __TXT(__LOCATION) },
     { Web::Response::WAKEUP, __TXT(__WAKEUP) },
     { Web::Response::U_S_N, __TXT(__USN) },
     { Web::Response::S_T, __TXT(__ST) },
     { Web::Response::CACHE_CONTROL, __TXT(__CACHE_CONTROL) },
     { Web::Response::APPLICATION_URL, __TXT(__APPLICATION_URL) },
+    { Web::Response::CONTENT_RANGE, __TXT(__CONTENT_RANGE) },
 
 ENUM_CONVERSION_END(Web::Response::keywords)
 
@@ -407,6 +413,58 @@ namespace Web
         return (filePresent);
     }
 
+    static bool RangeNumber(const string& text, uint64_t& value)
+    {
+        string::const_iterator index(text.begin());
+
+        value = 0;
+
+        // Stop at the first number that does not fit, the text is not a range then.
+        while ((index != text.end()) && (isdigit(*index) != 0) && (value <= ((Core::NumberType<uint64_t>::Max() - (*index - '0')) / 10))) {
+            value = (value * 10) + (*index - '0');
+            index++;
+        }
+
+        return ((text.empty() == false) && (index == text.end()));
+    }
+
+    WebStatus ByteRange(const string& range, const uint64_t size, uint64_t& first, uint64_t& last)
+    {
+        static const TCHAR Unit[] = _T("bytes=");
+        static const uint32_t UnitLength = (sizeof(Unit) / sizeof(TCHAR)) - 1;
+
+        WebStatus result = STATUS_OK;
+        size_t dash;
+
+        if ((size <= static_cast<uint64_t>(Core::NumberType<int32_t>::Max())) && (range.compare(0, UnitLength, Unit) == 0) && (range.find(',') == string::npos) && ((dash = range.find('-', UnitLength)) != string::npos)) {
+            const string start(range.substr(UnitLength, dash - UnitLength));
+            const string end(range.substr(dash + 1));
+            uint64_t value;
+
+            if (start.empty() == true) {
+                if (RangeNumber(end, value) == true) {
+                    if ((value == 0) || (size == 0)) {
+                        result = STATUS_REQUEST_RANGE_NOT_SATISFIABLE;
+                    } else {
+                        first = (value < size ? size - value : 0);
+                        last = size - 1;
+                        result = STATUS_PARTIAL_CONTENT;
+                    }
+                }
+            } else if (RangeNumber(start, first) == true) {
+                if (end.empty() == true) {
+                    last = size - 1;
+                    result = (first < size ? STATUS_PARTIAL_CONTENT : STATUS_REQUEST_RANGE_NOT_SATISFIABLE);
+                } else if ((RangeNumber(end, value) == true) && (value >= first)) {
+                    last = (value < size ? value : size - 1);
+                    result = (first < size ? STATUS_PARTIAL_CONTENT : STATUS_REQUEST_RANGE_NOT_SATISFIABLE);
+                }
+            }
+        }
+
+        return (result);
+    }
+
     static Signature ToSignature(const string& input)
     {
         Core::TextFragment inputLine(input);
@@ -820,6 +878,11 @@ namespace Web
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_SIGNATURE : _T("Content-HMAC:"));
                             FromSignature(_current->ContentSignature.Value(), _value);
                             _offset = 0;
+                        } else if ((_keyIndex <= 24) && (_current->Range.IsSet() == true)) {
+                            _keyIndex = 25;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __RANGE : _T("Range:"));
+                            _value = _current->Range.Value();
+                            _offset = 0;
                         }
                     }
 
@@ -864,15 +927,24 @@ namespace Web
                 }
                 case BODY: {
                     if (_bodyLength != 0) {
-                        ASSERT(maxLength >= current);
-                        uint32_t size = (static_cast<uint32_t>(maxLength - current) <= _bodyLength ? static_cast<uint32_t>(maxLength - current) : _bodyLength);
+                        Core::IResource::handle file;
+                        uint32_t position;
+
+                        ASSERT(_current->_body.IsValid() == true);
 
-                        if (size > 0) {
-                            ASSERT(_current->_body.IsValid() == true);
+                        // A body that fits in what is left of the stream is copied, it then goes out in one
+                        // write with the header. Otherwise the link sends it straight from the file, if it can.
+                        if ((_bodyLength > static_cast<uint32_t>(maxLength - current)) && (_current->_body->Transferable(file, position) == true) && (Transfer(file, position, _bodyLength) == true)) {
+                            _bodyLength = 0;
+                        } else {
+                            ASSERT(maxLength >= current);
+                            uint32_t size = (static_cast<uint32_t>(maxLength - current) <= _bodyLength ? static_cast<uint32_t>(maxLength - current) : _bodyLength);
 
-                            _current->_body->Serialize(&(stream[current]), size);
-                            _bodyLength -= size;
-                            current += size;
+                            if (size > 0) {
+                                _current->_body->Serialize(&(stream[current]), size);
+                                _bodyLength -= size;
+                                current += size;
+                            }
                         }
                     }
 
@@ -1060,7 +1132,7 @@ namespace Web
                             _offset = 0;
                         } else if ((_keyIndex <= 6) && (_current->AcceptRange.IsSet() == true)) {
                             _keyIndex = 7;
-                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCEPT_RANGE : _T("Accept-Range:"));
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCEPT_RANGE : _T("Accept-Ranges:"));
                             _value = _current->AcceptRange.Value();
                             _offset = 0;
                         } else if ((_keyIndex <= 7) && (_current->ETag.IsSet() == true)) {
@@ -1073,8 +1145,13 @@ namespace Web
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WEBSOCKET_PROTOCOL : _T("Sec-WebSocket-Protocol:"));
                             _value = _current->WebSocketProtocol.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 9) && (_current->Allowed.IsSet() == true)) {
+                        } else if ((_keyIndex <= 9) && (_current->WebSocketExtensions.IsSet() == true)) {
                             _keyIndex = 10;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WEBSOCKET_EXTENSIONS : _T("Sec-WebSocket-Extensions:"));
+                            _value = _current->WebSocketExtensions.Value();
+                            _offset = 0;
+                        } else if ((_keyIndex <= 10) && (_current->Allowed.IsSet() == true)) {
+                            _keyIndex = 11;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ALLOW : _T("Allow:"));
                             _value = _T("");
                             _offset = 0;
@@ -1093,18 +1170,18 @@ namespace Web
                                 }
                                 entry = Core::EnumerateType<Request::type>::Entry(++index);
                             }
-                        } else if ((_keyIndex <= 10) && (_current->AccessControlHeaders.IsSet() == true)) {
-                            _keyIndex = 11;
+                        } else if ((_keyIndex <= 11) && (_current->AccessControlHeaders.IsSet() == true)) {
+                            _keyIndex = 12;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_HEADERS : _T("Access-Control-Allow-Headers:"));
                             _value = _current->AccessControlHeaders.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 11) && (_current->AccessControlOrigin.IsSet() == true)) {
-                            _keyIndex = 12;
+                        } else if ((_keyIndex <= 12) && (_current->AccessControlOrigin.IsSet() == true)) {
+                            _keyIndex = 13;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_ORIGIN : _T("Access-Control-Allow-Origin:"));
                             _value = _current->AccessControlOrigin.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 12) && (_current->AccessControlMethod.IsSet() == true)) {
-                            _keyIndex = 13;
+                        } else if ((_keyIndex <= 13) && (_current->AccessControlMethod.IsSet() == true)) {
+                            _keyIndex = 14;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_METHODS : _T("Access-Control-Allow-Methods:"));
                             _value = _T("");
                             _offset = 0;
@@ -1123,17 +1200,17 @@ namespace Web
                                 }
                                 entry = Core::EnumerateType<Request::type>::Entry(++index);
                             }
-                        } else if ((_keyIndex <= 13) && (_current->AccessControlMaxAge.IsSet() == true)) {
-                            _keyIndex = 14;
+                        } else if ((_keyIndex <= 14) && (_current->AccessControlMaxAge.IsSet() == true)) {
+                            _keyIndex = 15;
 
                             Core::NumberType<uint32_t, false, BASE_DECIMAL> number(_current->AccessControlMaxAge.Value());
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_MAX_AGE : _T("Access-Control-Max-Age:"));
                             number.Serialize(_value);
                             _offset = 0;
-                        } else if ((_keyIndex <= 14) && (_current->ContentType.IsSet() == true)) {
+                        } else if ((_keyIndex <= 15) && (_current->ContentType.IsSet() == true)) {
                             Core::EnumerateType<MIMETypes> enumValue(_current->ContentType.Value());
 
-                            _keyIndex = 15;
+                            _keyIndex = 16;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_TYPE : _T("Content-Type:"));
                             _value = enumValue.Data();
                             if (_current->ContentCharacterSet.IsSet() == true) {
@@ -1143,62 +1220,67 @@ namespace Web
                             }
 
                             _offset = 0;
-                        } else if ((_keyIndex <= 15) && (_current->ContentEncoding.IsSet() == true)) {
+                        } else if ((_keyIndex <= 16) && (_current->ContentEncoding.IsSet() == true)) {
                             Core::EnumerateType<EncodingTypes> enumValue(_current->ContentEncoding.Value());
 
-                            _keyIndex = 16;
+                            _keyIndex = 17;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_ENCODING : _T("Content-Encoding:"));
                             _value = enumValue.Data();
                             _offset = 0;
-                        } else if ((_keyIndex <= 16) && (_current->TransferEncoding.IsSet() == true)) {
+                        } else if ((_keyIndex <= 17) && (_current->TransferEncoding.IsSet() == true)) {
                             Core::EnumerateType<TransferTypes> enumValue(_current->TransferEncoding.Value());
 
-                            _keyIndex = 17;
+                            _keyIndex = 18;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __TRANSFER_ENCODING : _T("Transfer-Encoding:"));
                             _value = enumValue.Data();
                             _offset = 0;
-                        } else if ((_keyIndex <= 17) && (_current->Location.IsSet() == true)) {
-                            _keyIndex = 18;
+                        } else if ((_keyIndex <= 18) && (_current->Location.IsSet() == true)) {
+                            _keyIndex = 19;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __LOCATION : _T("Location:"));
                             _value = _current->Location.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 18) && (_current->WakeUp.IsSet() == true)) {
-                            _keyIndex = 19;
+                        } else if ((_keyIndex <= 19) && (_current->WakeUp.IsSet() == true)) {
+                            _keyIndex = 20;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WAKEUP : _T("Wakeup:"));
                             _value = _current->WakeUp.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 19) && (_current->USN.IsSet() == true)) {
-                            _keyIndex = 20;
+                        } else if ((_keyIndex <= 20) && (_current->USN.IsSet() == true)) {
+                            _keyIndex = 21;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __USN : _T("USN:"));
                             _value = _current->USN.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 20) && (_current->ST.IsSet() == true)) {
-                            _keyIndex = 21;
+                        } else if ((_keyIndex <= 21) && (_current->ST.IsSet() == true)) {
+                            _keyIndex = 22;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ST : _T("ST:"));
                             _value = _current->ST.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 21) && (_current->CacheControl.IsSet() == true)) {
-                            _keyIndex = 22;
+                        } else if ((_keyIndex <= 22) && (_current->CacheControl.IsSet() == true)) {
+                            _keyIndex = 23;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CACHE_CONTROL : _T("Cache-Control:"));
                             _value = _current->CacheControl.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 22) && (_current->ApplicationURL.IsSet() == true)) {
-                            _keyIndex = 23;
+                        } else if ((_keyIndex <= 23) && (_current->ApplicationURL.IsSet() == true)) {
+                            _keyIndex = 24;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __APPLICATION_URL : _T("Application-URL:"));
                             _value = _current->ApplicationURL.Value().Text();
                             _offset = 0;
-                        } else if ((_keyIndex <= 23) && (((_bodyLength = (_current->_body.IsValid() ? _current->_body->Serialize() : 0)) > 0) || (_current->ContentLength.IsSet() == true) || (!_current->Connection.IsSet()) || (_current->Connection.Value() != Response::CONNECTION_CLOSE))) {
-                            _keyIndex = (_bodyLength > 0 ? 24 : 25);
+                        } else if ((_keyIndex <= 24) && (((_bodyLength = (_current->_body.IsValid() ? _current->_body->Serialize() : 0)) > 0) || (_current->ContentLength.IsSet() == true) || (!_current->Connection.IsSet()) || (_current->Connection.Value() != Response::CONNECTION_CLOSE))) {
+                            _keyIndex = (_bodyLength > 0 ? 25 : 26);
 
                             Core::NumberType<uint32_t, false, BASE_DECIMAL> number(_bodyLength);
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_LENGTH : _T("Content-Length:"));
                             number.Serialize(_value);
                             _offset = 0;
-                        } else if ((_keyIndex <= 24) && (_current->ContentSignature.IsSet() == true)) {
-                            _keyIndex = 25;
+                        } else if ((_keyIndex <= 25) && (_current->ContentSignature.IsSet() == true)) {
+                            _keyIndex = 26;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_SIGNATURE : _T("Content-HMAC:"));
                             FromSignature(_current->ContentSignature.Value(), _value);
                             _offset = 0;
+                        } else if ((_keyIndex <= 26) && (_current->ContentRange.IsSet() == true)) {
+                            _keyIndex = 27;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_RANGE : _T("Content-Range:"));
+                            _value = _current->ContentRange.Value();
+                            _offset = 0;
                         }
                     }
 
@@ -1243,15 +1325,24 @@ namespace Web
                 }
                 case BODY: {
                     if (_bodyLength != 0) {
-                        ASSERT(maxLength >= current);
-                        uint32_t size = (static_cast<uint32_t>(maxLength - current) <= _bodyLength ? static_cast<uint32_t>(maxLength - current) : _bodyLength);
+                        Core::IResource::handle file;
+                        uint32_t position;
+
+                        ASSERT(_current->_body.IsValid() == true);
 
-                        if (size > 0) {
-                            ASSERT(_current->_body.IsValid() == true);
+                        // A body that fits in what is left of the stream is copied, it then goes out in one
+                        // write with the header. Otherwise the link sends it straight from the file, if it can.
+                        if ((_bodyLength > static_cast<uint32_t>(maxLength - current)) && (_current->_body->Transferable(file, position) == true) && (Transfer(file, position, _bodyLength) == true)) {
+                            _bodyLength = 0;
+                        } else {
+                            ASSERT(maxLength >= current);
+                            uint32_t size = (static_cast<uint32_t>(maxLength - current) <= _bodyLength ? static_cast<uint32_t>(maxLength - current) : _bodyLength);
 
-                            _current->_body->Serialize(&(stream[current]), size);
-                            _bodyLength -= size;
-                            current += size;
+                            if (size > 0) {
+                                _current->_body->Serialize(&(stream[current]), size);
+                                _bodyLength -= size;
+                                current += size;
+                            }
                         }
                     }
 
@@ -1479,6 +1570,9 @@ namespace Web
             case Request::AUTHORIZATION:
                 _current->WebToken = ToAuthorization(buffer);
                 break;
+            case Request::RANGE:
+                _current->Range = buffer;
+                break;
             case Request::CONTENT_SIGNATURE:
                 _current->ContentSignature = ToSignature(buffer);
                 break;
@@ -1799,6 +1893,9 @@ namespace Web
             case Response::ACCEPT_RANGE:
                 _current->AcceptRange = buffer;
                 break;
+            case Response::CONTENT_RANGE:
+                _current->ContentRange = buffer;
+                break;
             case Response::ACCESS_CONTROL_ALLOW_ORIGIN:
                 _current->AccessControlOrigin = buffer;
                 break;
@@ -1817,6 +1914,9 @@ namespace Web
             case Response::WEBSOCKET_PROTOCOL:
                 _current->WebSocketProtocol = buffer;
                 break;
+            case Response::WEBSOCKET_EXTENSIONS:
+                _current->WebSocketExtensions = buffer;
+                break;
             case Response::CONTENT_SIGNATURE:
                 _current->ContentSignature = ToSignature(buffer);
                 break;
@@ -143,12 +143,14 @@ namespace Web {
             : Core::File()
             , _opened(false)
             , _startPosition(0)
+            , _length(~0)
         {
         }
         FileBody(const string& path, const bool sharable)
             : Core::File(path, sharable)
             , _opened(false)
             , _startPosition(0)
+            , _length(~0)
         {
         }
         ~FileBody() override = default;
@@ -158,6 +160,7 @@ namespace Web {
         {
             Core::File::operator=(location);
             _startPosition = 0;
+            _length = ~0;
 
             return (*this);
         }
@@ -165,21 +168,38 @@ namespace Web {
         {
             Core::File::operator=(RHS);
             _startPosition = Core::File::Position();
+            _length = ~0;
 
             return (*this);
         }
 
+        // Only send length bytes of the file, starting at offset (the answer to a range request).
+        inline void Range(const uint32_t offset, const uint32_t length)
+        {
+            _startPosition = offset;
+            _length = length;
+        }
+
     protected:
         uint32_t Serialize() const override
         {
+            uint32_t result = 0;
+
             // Are we opening the file ?
             _opened = (Core::File::IsOpen() == false);
 
             if (_opened == false) {
                 const_cast<FileBody*>(this)->LoadFileInfo();
+            }
+            if ((_opened == false) || (Core::File::Open() == true)) {
                 const_cast<FileBody*>(this)->Position(false, _startPosition);
+
+                if (Core::File::Size() > static_cast<uint64_t>(_startPosition)) {
+                    const uint64_t left = Core::File::Size() - _startPosition;
+                    result = (left < _length ? static_cast<uint32_t>(left) : _length);
+                }
             }
-            return (((_opened == false) || (Core::File::Open() == true)) ? static_cast<uint32_t>(Core::File::Size() - _startPosition) : 0);
+            return (result);
         }
         uint32_t Deserialize() override
         {
@@ -204,10 +224,28 @@ namespace Web {
                 }
             }
         }
+        bool Transferable(Core::IResource::handle& file, uint32_t& offset) const override
+        {
+            bool result = false;
+
+#ifdef __POSIX__
+            if (Core::File::IsOpen() == true) {
+                file = const_cast<FileBody*>(this)->operator Core::File::Handle();
+                offset = static_cast<uint32_t>(Core::File::Position());
+                result = true;
+            }
+#else
+            DEBUG_VARIABLE(file);
+            DEBUG_VARIABLE(offset);
+#endif
+
+            return (result);
+        }
 
     private:
         mutable bool _opened;
         mutable int32_t _startPosition;
+        uint32_t _length;
     };
 
     template <typename HASHALGORITHM>
@@ -340,7 +378,7 @@ namespace Web {
     private:
         mutable uint32_t _lastPosition;
         mutable string _body;
-        uint16_t _offset;
+        uint32_t _offset;
     };
 
     template <typename JSONOBJECT, typename HASHALGORITHM>
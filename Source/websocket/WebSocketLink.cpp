@@ -20,6 +20,15 @@
 #include "WebSocketLink.h"
 
 namespace WPEFramework {
+
+ENUM_CONVERSION_BEGIN(Web::WebSocket::Deflate::mode)
+
+    { Web::WebSocket::Deflate::DISABLED, _TXT("disabled") },
+    { Web::WebSocket::Deflate::ENABLED, _TXT("enabled") },
+    { static_cast<Web::WebSocket::Deflate::mode>(Web::WebSocket::Deflate::ENABLED | Web::WebSocket::Deflate::NO_CONTEXT_TAKEOVER), _TXT("nocontexttakeover") },
+
+ENUM_CONVERSION_END(Web::WebSocket::Deflate::mode)
+
 namespace Web {
     namespace WebSocket {
         static RequestAllocator _requestAllocator;
@@ -40,8 +49,317 @@ namespace Web {
         static const uint8_t TYPE_FRAME = 0x0F;
         static const uint8_t MASKING_FRAME = 0x80;
         static const uint8_t CONTROL_FRAME = 0x08;
+        static const uint8_t COMPRESSED_FRAME = 0x40;
         static const uint8_t HandShakeKey[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
+        static const TCHAR PermessageDeflate[] = _T("permessage-deflate");
+        static const uint8_t DeflateTail[] = { 0x00, 0x00, 0xFF, 0xFF };
+        static const uint16_t DeflateChunk = 1024;
+
+        static string Trim(const string& text)
+        {
+            string::size_type begin = text.find_first_not_of(_T(" \t"));
+            string::size_type end = text.find_last_not_of(_T(" \t"));
+
+            return (begin == string::npos ? string() : text.substr(begin, end - begin + 1));
+        }
+
+        // Splits "permessage-deflate; server_no_context_takeover; client_max_window_bits=10" in the
+        // name of the extension (returned) and its parameters.
+        static string Split(const string& extension, std::list<std::pair<string, string>>& parameters)
+        {
+            string::size_type start = extension.find(';');
+            string name = Trim(extension.substr(0, start));
+
+            while (start != string::npos) {
+                string::size_type end = extension.find(';', start + 1);
+                string parameter = extension.substr(start + 1, (end == string::npos ? string::npos : end - start - 1));
+                string::size_type equal = parameter.find('=');
+                string value;
+
+                if (equal != string::npos) {
+                    value = Trim(parameter.substr(equal + 1));
+
+                    if ((value.length() >= 2) && (value[0] == '\"') && (value[value.length() - 1] == '\"')) {
+                        value = value.substr(1, value.length() - 2);
+                    }
+                    parameter = parameter.substr(0, equal);
+                }
+
+                parameters.emplace_back(Trim(parameter), value);
+                start = end;
+            }
+
+            return (name);
+        }
+
+        // The value of a max_window_bits parameter, 0 if it is not valid.
+        static uint8_t WindowBits(const string& value)
+        {
+            uint8_t result = 0;
+
+            if ((value.length() == 1) && (value[0] >= '8') && (value[0] <= '9')) {
+                result = static_cast<uint8_t>(value[0] - '0');
+            } else if ((value.length() == 2) && (value[0] == '1') && (value[1] >= '0') && (value[1] <= '5')) {
+                result = static_cast<uint8_t>(10 + (value[1] - '0'));
+            }
+
+            return (result);
+        }
+
+        string Deflate::Offer() const
+        {
+            string result(PermessageDeflate);
+
+            result += _T("; client_max_window_bits");
+
+            if ((_mode & NO_CONTEXT_TAKEOVER) != 0) {
+                result += _T("; client_no_context_takeover; server_no_context_takeover");
+            }
+
+            return (result);
+        }
+
+        bool Deflate::Agreed(const string& response)
+        {
+            std::list<std::pair<string, string>> parameters;
+            uint8_t windowBits = _windowBits;
+            bool noContextTakeover = ((_mode & NO_CONTEXT_TAKEOVER) != 0);
+
+            Reset();
+
+            // We only offered the one extension, so that is all the server can come back with.
+            bool result = ((response.find(',') == string::npos) && (Split(response, parameters) == PermessageDeflate));
+
+            std::list<std::pair<string, string>>::const_iterator index(parameters.begin());
+
+            while ((result == true) && (index != parameters.end())) {
+                if ((index->first == _T("server_no_context_takeover")) && (index->second.empty() == true)) {
+                    // Nothing to do, our inflater does not mind the server starting all over.
+                } else if ((index->first == _T("client_no_context_takeover")) && (index->second.empty() == true)) {
+                    noContextTakeover = true;
+                } else if (index->first == _T("server_max_window_bits")) {
+                    result = (WindowBits(index->second) != 0);
+                } else if (index->first == _T("client_max_window_bits")) {
+                    const uint8_t bits = WindowBits(index->second);
+
+                    // zlib can not produce a raw stream with a 256 byte window.
+                    result = (bits >= 9);
+                    windowBits = std::min(windowBits, bits);
+                } else {
+                    result = false;
+                }
+                index++;
+            }
+
+            if (result == true) {
+                result = Activate(windowBits, noContextTakeover);
+            }
+
+            return (result);
+        }
+
+        bool Deflate::Accept(const string& offers, string& response)
+        {
+            bool result = false;
+            string::size_type start = 0;
+
+            Reset();
+
+            while ((result == false) && (start != string::npos)) {
+                std::list<std::pair<string, string>> parameters;
+                string::size_type end = offers.find(',', start);
+
+                if (Split(offers.substr(start, (end == string::npos ? string::npos : end - start)), parameters) == PermessageDeflate) {
+                    uint8_t windowBits = _windowBits;
+                    uint8_t maxWindowBits = 0;
+                    bool noContextTakeover = ((_mode & NO_CONTEXT_TAKEOVER) != 0);
+                    bool clientNoContextTakeover = noContextTakeover;
+                    bool valid = true;
+
+                    std::list<std::pair<string, string>>::const_iterator index(parameters.begin());
+
+                    while ((valid == true) && (index != parameters.end())) {
+                        if ((index->first == _T("server_no_context_takeover")) && (index->second.empty() == true)) {
+                            noContextTakeover = true;
+                        } else if ((index->first == _T("client_no_context_takeover")) && (index->second.empty() == true)) {
+                            clientNoContextTakeover = true;
+                        } else if (index->first == _T("server_max_window_bits")) {
+                            maxWindowBits = WindowBits(index->second);
+
+                            // zlib can not produce a raw stream with a 256 byte window, try the next offer.
+                            valid = (maxWindowBits >= 9);
+                            windowBits = std::min(windowBits, maxWindowBits);
+                        } else if (index->first == _T("client_max_window_bits")) {
+                            // Our inflater takes any window, no need to limit the client.
+                            valid = ((index->second.empty() == true) || (WindowBits(index->second) != 0));
+                        } else {
+                            valid = false;
+                        }
+                        index++;
+                    }
+
+                    if ((valid == true) && (Activate(windowBits, noContextTakeover) == true)) {
+                        response = PermessageDeflate;
+
+                        if (noContextTakeover == true) {
+                            response += _T("; server_no_context_takeover");
+                        }
+                        if (clientNoContextTakeover == true) {
+                            response += _T("; client_no_context_takeover");
+                        }
+                        if (maxWindowBits != 0) {
+                            response += _T("; server_max_window_bits=") + Core::NumberType<uint8_t>(windowBits).Text();
+                        }
+
+                        result = true;
+                    }
+                }
+
+                start = (end == string::npos ? string::npos : end + 1);
+            }
+
+            return (result);
+        }
+
+        void Deflate::Reset()
+        {
+            if ((_state & ACTIVE) != 0) {
+                deflateEnd(&_deflater);
+                inflateEnd(&_inflater);
+            }
+
+            _state = 0;
+            _outbound.clear();
+            _offset = 0;
+        }
+
+        bool Deflate::Activate(const uint8_t windowBits, const bool noContextTakeover)
+        {
+            Reset();
+
+            _deflater.zalloc = Z_NULL;
+            _deflater.zfree = Z_NULL;
+            _deflater.opaque = Z_NULL;
+            _inflater.zalloc = Z_NULL;
+            _inflater.zfree = Z_NULL;
+            _inflater.opaque = Z_NULL;
+            _inflater.next_in = Z_NULL;
+            _inflater.avail_in = 0;
+
+            // Negative window bits, raw DEFLATE streams without a zlib header or trailer.
+            if (deflateInit2(&_deflater, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -windowBits, 8, Z_DEFAULT_STRATEGY) == Z_OK) {
+                if (inflateInit2(&_inflater, -15) == Z_OK) {
+                    _state = (ACTIVE | (noContextTakeover == true ? RESET : 0));
+                } else {
+                    deflateEnd(&_deflater);
+                }
+            }
+
+            return (IsActive());
+        }
+
+        void Deflate::Compress(const uint8_t data[], const uint16_t length, const bool final)
+        {
+            ASSERT(IsActive() == true);
+
+            if (_offset == _outbound.size()) {
+                _outbound.clear();
+                _offset = 0;
+            }
+
+            _deflater.next_in = const_cast<uint8_t*>(data);
+            _deflater.avail_in = length;
+
+            do {
+                const uint32_t used = static_cast<uint32_t>(_outbound.size());
+
+                _outbound.resize(used + DeflateChunk);
+                _deflater.next_out = &(_outbound[used]);
+                _deflater.avail_out = DeflateChunk;
+
+                deflate(&_deflater, (final == true ? Z_SYNC_FLUSH : Z_NO_FLUSH));
+
+                _outbound.resize(used + DeflateChunk - _deflater.avail_out);
+            } while (_deflater.avail_out == 0);
+
+            if (final == false) {
+                _state |= COMPRESSING;
+            } else {
+                // The flush ends with an empty stored block, the receiver puts it back.
+                ASSERT((Pending() >= sizeof(DeflateTail)) && (::memcmp(&(_outbound[_outbound.size() - sizeof(DeflateTail)]), DeflateTail, sizeof(DeflateTail)) == 0));
+
+                _outbound.resize(_outbound.size() - sizeof(DeflateTail));
+                _state &= (~COMPRESSING);
+
+                if ((_state & RESET) != 0) {
+                    deflateReset(&_deflater);
+                }
+            }
+        }
+
+        uint16_t Deflate::Compressed(uint8_t data[], const uint16_t maxLength)
+        {
+            uint16_t result = static_cast<uint16_t>(std::min(static_cast<uint32_t>(maxLength), Pending()));
+
+            if (result > 0) {
+                ::memcpy(data, &(_outbound[_offset]), result);
+                _offset += result;
+            }
+
+            return (result);
+        }
+
+        void Deflate::Decompress(const uint8_t data[], const uint16_t length, const bool final)
+        {
+            ASSERT(IsActive() == true);
+            ASSERT(_inflater.avail_in == 0);
+
+            _inflater.next_in = const_cast<uint8_t*>(data);
+            _inflater.avail_in = length;
+
+            if (final == true) {
+                _state |= TAIL;
+            }
+        }
+
+        uint16_t Deflate::Decompressed(uint8_t data[], const uint16_t maxLength)
+        {
+            uint16_t result = 0;
+
+            if ((_state & (ACTIVE | FAILED)) == ACTIVE) {
+                int status = Z_OK;
+
+                _inflater.next_out = data;
+                _inflater.avail_out = maxLength;
+
+                while ((_inflater.avail_out != 0) && (status == Z_OK)) {
+                    if ((_inflater.avail_in == 0) && ((_state & TAIL) != 0)) {
+                        _inflater.next_in = const_cast<uint8_t*>(DeflateTail);
+                        _inflater.avail_in = sizeof(DeflateTail);
+                        _state &= (~TAIL);
+                    }
+
+                    status = inflate(&_inflater, Z_SYNC_FLUSH);
+
+                    if (status == Z_STREAM_END) {
+                        // The peer ended the stream (BFINAL), whatever follows starts a new one.
+                        status = inflateReset(&_inflater);
+                    }
+                }
+
+                // A Z_BUF_ERROR just means there is nothing more to do, for now.
+                if ((status != Z_OK) && (status != Z_BUF_ERROR)) {
+                    _state |= FAILED;
+                    _inflater.avail_in = 0;
+                }
+
+                result = maxLength - static_cast<uint16_t>(_inflater.avail_out);
+            }
+
+            return (result);
+        }
+
         std::string Protocol::RequestKey() const
         {
             string baseEncodedKey;
@@ -127,11 +445,11 @@ namespace Web {
 
                 if (usedSize < maxSendSize) {
                     // Seems like not all available space is used, so I guess we are ready..
-                    dataFrame[0] = FINISHING_FRAME | (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = FINISHING_FRAME | (SendInProgress() == true ? CONTINUATION_FRAME : (TYPE_FRAME | COMPRESSED_FRAME) & _setFlags);
                     _progressInfo &= (~0x40);
                 } else {
                     // There is more to come, this is just part of a bigger picture
-                    dataFrame[0] = (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = (SendInProgress() == true ? CONTINUATION_FRAME : (TYPE_FRAME | COMPRESSED_FRAME) & _setFlags);
                     _progressInfo |= (0x40);
                 }
 
@@ -175,11 +493,15 @@ namespace Web {
                         receivedSize = _pendingReceiveBytes;
                     }
 
-                    while (_pendingReceiveBytes != 0) {
+                    // Only unscramble what we have, the rest of the frame is still to come.
+                    uint16_t bytesToMove = receivedSize;
+                    _pendingReceiveBytes -= receivedSize;
+
+                    while (bytesToMove != 0) {
                         *source = (*source ^ _scrambleKey[(_progressInfo & 0x3)]);
                         source++;
                         _progressInfo = ((_progressInfo + 1) & 0x03) | (_progressInfo & 0xFC);
-                        _pendingReceiveBytes--;
+                        bytesToMove--;
                     }
                 } else {
                     if (_pendingReceiveBytes > receivedSize) {
@@ -219,6 +541,11 @@ namespace Web {
                         _progressInfo |= 0x80;
                     }
 
+                    // The first frame of a message tells if it is compressed, control frames can be in between.
+                    if (((dataFrame[0] & TYPE_FRAME) != CONTINUATION_FRAME) && ((dataFrame[0] & CONTROL_FRAME) == 0)) {
+                        _progressInfo = ((dataFrame[0] & COMPRESSED_FRAME) != 0 ? (_progressInfo | 0x10) : (_progressInfo & (~0x10)));
+                    }
+
                     // Is this a continuing frame...
                     if ((dataFrame[0] & FINISHING_FRAME) == 0) {
                         // Only if this is a Textframe or a BinaryFrame, The Finished flag is allowed to be '0'.
@@ -90,6 +90,16 @@ namespace Web {
             {
                 return ((_progressInfo & 0x40) != 0);
             }
+            // Sets the RSV1 bit (permessage-deflate) on the first frame of the next message(s).
+            inline void SendCompressed(const bool compressed)
+            {
+                _setFlags = (compressed ? (_setFlags | 0x40) : (_setFlags & 0xBF));
+            }
+            // The RSV1 bit (permessage-deflate) was set on the first frame of the message being received.
+            inline bool ReceiveCompressed() const
+            {
+                return ((_progressInfo & 0x10) != 0);
+            }
             inline bool IsCompleteMessage() const
             {
                 return (_pendingReceiveBytes == 0);
@@ -131,6 +141,116 @@ namespace Web {
             uint8_t _controlStatus;
         };
 
+        // RFC 7692, the permessage-deflate extension. Negotiated during the upgrade, from then on
+        // each message (not each frame) is compressed as a whole, with a raw DEFLATE stream that
+        // is flushed (and stripped from its 0x00 0x00 0xFF 0xFF tail) at the end of a message.
+        class EXTERNAL Deflate {
+        public:
+            enum mode : uint8_t {
+                DISABLED = 0x00,
+                ENABLED = 0x01,
+                // Start every message with an empty compression context, in both directions. Costs
+                // ratio, but the peers do not have to keep the sliding window between messages.
+                NO_CONTEXT_TAKEOVER = 0x02
+            };
+
+        private:
+            enum state : uint8_t {
+                ACTIVE = 0x01,
+                COMPRESSING = 0x02,
+                TAIL = 0x04,
+                RESET = 0x08,
+                FAILED = 0x10
+            };
+
+        public:
+            Deflate(const Deflate&) = delete;
+            Deflate& operator=(const Deflate&) = delete;
+
+            Deflate()
+                : _mode(DISABLED)
+                , _windowBits(15)
+                , _threshold(0)
+                , _state(0)
+                , _deflater()
+                , _inflater()
+                , _outbound()
+                , _offset(0)
+            {
+            }
+            ~Deflate()
+            {
+                Reset();
+            }
+
+        public:
+            // Messages smaller than the threshold are sent as they are, the window bits limit the
+            // memory used (and the ratio reached) by our compressor.
+            inline void Configure(const uint8_t mode, const uint16_t threshold, const uint8_t windowBits)
+            {
+                ASSERT((windowBits >= 9) && (windowBits <= 15));
+
+                _mode = mode;
+                _threshold = threshold;
+                _windowBits = windowBits;
+            }
+            inline bool IsEnabled() const
+            {
+                return ((_mode & ENABLED) != 0);
+            }
+            inline bool IsActive() const
+            {
+                return ((_state & ACTIVE) != 0);
+            }
+            inline bool IsValid() const
+            {
+                return ((_state & FAILED) == 0);
+            }
+            inline uint16_t Threshold() const
+            {
+                return (_threshold);
+            }
+            // A message has been handed to Compress() partially, the rest is still to come.
+            inline bool IsCompressing() const
+            {
+                return ((_state & COMPRESSING) != 0);
+            }
+            // Compressed bytes, waiting to be taken out with Compressed().
+            inline uint32_t Pending() const
+            {
+                return (static_cast<uint32_t>(_outbound.size()) - _offset);
+            }
+
+            // Negotiation, client side: what to put in the Sec-WebSocket-Extensions of the request and
+            // what to make of the one in the response. Server side: pick the first acceptable offer
+            // from the request and report what to put in the response.
+            string Offer() const;
+            bool Agreed(const string& response);
+            bool Accept(const string& offers, string& response);
+            void Reset();
+
+            // Sending side, call Compress() with the parts of the message, final on the last part.
+            void Compress(const uint8_t data[], const uint16_t length, const bool final);
+            uint16_t Compressed(uint8_t data[], const uint16_t maxLength);
+
+            // Receiving side, call Decompressed() till it returns 0 before the next Decompress().
+            void Decompress(const uint8_t data[], const uint16_t length, const bool final);
+            uint16_t Decompressed(uint8_t data[], const uint16_t maxLength);
+
+        private:
+            bool Activate(const uint8_t windowBits, const bool noContextTakeover);
+
+        private:
+            uint8_t _mode;
+            uint8_t _windowBits;
+            uint16_t _threshold;
+            uint8_t _state;
+            z_stream _deflater;
+            z_stream _inflater;
+            std::vector<uint8_t> _outbound;
+            uint32_t _offset;
+        };
+
         class EXTERNAL RequestAllocator : public Core::ProxyPoolType<Web::Request> {
         private:
             RequestAllocator(const RequestAllocator&) = delete;
@@ -237,6 +357,10 @@ namespace Web {
                 {
                     return (OUTBOUND::Serializer::Serialize(stream, maxLength));
                 }
+                virtual bool Transfer(const Core::IResource::handle file, const uint32_t offset, const uint32_t length)
+                {
+                    return (_parent.TransferFile(::TemplateIntToType<std::is_base_of<Core::SocketPort, ACTUALLINK>::value>(), file, offset, length));
+                }
                 void Flush()
                 {
                     _adminLock.Lock();
@@ -670,6 +794,18 @@ namespace Web {
             {
                 _handler.Masking(masking);
             }
+            // Offer (client) or accept (server) permessage-deflate on the next upgrade.
+            inline void Compression(const uint8_t mode, const uint16_t threshold, const uint8_t windowBits)
+            {
+                _adminLock.Lock();
+                _deflate.Configure(mode, threshold, windowBits);
+                _adminLock.Unlock();
+            }
+            // permessage-deflate was agreed upon during the upgrade.
+            inline bool IsCompressed() const
+            {
+                return (_deflate.IsActive());
+            }
             inline void Ping()
             {
                 _pingFireTime = Core::Time::Now().Ticks();
@@ -751,7 +887,11 @@ namespace Web {
 
                 if ((_state & WEBSOCKET) != 0) {
                     if (maxSendSize > 4) {
-                        result = _parent.SendData(&(dataFrame[4]), (maxSendSize - 4));
+                        if (_deflate.IsActive() == true) {
+                            result = Deflated(&(dataFrame[4]), (maxSendSize - 4));
+                        } else {
+                            result = _parent.SendData(&(dataFrame[4]), (maxSendSize - 4));
+                        }
 
                         result = _handler.Encoder(dataFrame, (maxSendSize - 4), result);
                     }
@@ -786,7 +926,7 @@ namespace Web {
                         tooSmall = ((headerSize == 0) && (actualDataSize == 0));
 
                         if (tooSmall == false) {
-                            if ((_handler.FrameType() & 0xF0) != 0) {
+                            if (((_handler.FrameType() & 0xF0) != 0) || ((_handler.ReceiveCompressed() == true) && (_deflate.IsActive() == false))) {
 
                                 TRACE_L1("Oops we received uncomprehensable data on the web socket 0x%X", _handler.FrameType());
 
@@ -826,6 +966,10 @@ namespace Web {
                                 }
 
                                 result += headerSize; // actualDataSize
+                            } else if (_handler.ReceiveCompressed() == true) {
+                                Inflate(&(dataFrame[result + headerSize]), actualDataSize, ((_handler.ReceiveInProgress() == false) && (_handler.IsCompleteMessage() == true)));
+
+                                result += (headerSize + actualDataSize);
                             } else {
                                 _parent.ReceiveData(&(dataFrame[result + headerSize]), actualDataSize);
 
@@ -872,6 +1016,71 @@ namespace Web {
             }
 
         private:
+            // Only a plain socket can send a file body straight from the file, through TLS it is copied.
+            inline bool TransferFile(const ::TemplateIntToType<1>&, const Core::IResource::handle file, const uint32_t offset, const uint32_t length)
+            {
+                return (ACTUALLINK::Transfer(file, offset, length));
+            }
+            inline bool TransferFile(const ::TemplateIntToType<0>&, const Core::IResource::handle, const uint32_t, const uint32_t)
+            {
+                return (false);
+            }
+            // A compressed message is only framed once it is compressed, and all but its last frame
+            // need to be filled up completely, as a frame that is not full ends the message.
+            uint16_t Deflated(uint8_t* dataFrame, const uint16_t maxSendSize)
+            {
+                uint16_t result = 0;
+
+                if ((_handler.SendInProgress() == false) && (_deflate.IsCompressing() == false) && (_deflate.Pending() == 0)) {
+                    result = _parent.SendData(dataFrame, maxSendSize);
+
+                    // Small messages are not worth the trouble, send them as they are.
+                    const bool compress = ((result == maxSendSize) || (result >= _deflate.Threshold()));
+
+                    _handler.SendCompressed(compress);
+
+                    if ((compress == true) && (result > 0)) {
+                        _deflate.Compress(dataFrame, result, (result < maxSendSize));
+                        result = 0;
+                    }
+                }
+
+                if (_deflate.IsCompressing() == true) {
+                    while ((_deflate.IsCompressing() == true) && (_deflate.Pending() < maxSendSize)) {
+                        const uint16_t loaded = _parent.SendData(dataFrame, maxSendSize);
+
+                        _deflate.Compress(dataFrame, loaded, (loaded < maxSendSize));
+                    }
+                }
+
+                if (_deflate.Pending() > 0) {
+                    uint16_t length = maxSendSize;
+
+                    if ((_deflate.IsCompressing() == false) && (_deflate.Pending() <= maxSendSize)) {
+                        // The last frame of the message, it must not fill up the frame completely.
+                        length = static_cast<uint16_t>(_deflate.Pending() == maxSendSize ? maxSendSize - 1 : _deflate.Pending());
+                    }
+
+                    result = _deflate.Compressed(dataFrame, length);
+                }
+
+                return (result);
+            }
+            void Inflate(uint8_t* dataFrame, const uint16_t length, const bool final)
+            {
+                uint8_t buffer[1024];
+                uint16_t loaded;
+
+                _deflate.Decompress(dataFrame, length, final);
+
+                while ((loaded = _deflate.Decompressed(buffer, sizeof(buffer))) > 0) {
+                    _parent.ReceiveData(buffer, loaded);
+                }
+
+                if (_deflate.IsValid() == false) {
+                    TRACE_L1("Oops we received a message on the web socket that does not inflate (%d)", length);
+                }
+            }
             inline uint32_t CheckForClose(uint32_t waitTime)
             {
                 uint32_t result = 0;
@@ -965,6 +1174,14 @@ namespace Web {
                             if (_protocol.empty() == false) {
                                 _webSocketMessage->WebSocketProtocol = _protocol;
                             }
+
+                            string extension;
+
+                            _deflate.Reset();
+
+                            if ((_deflate.IsEnabled() == true) && (element->WebSocketExtensions.IsSet() == true) && (_deflate.Accept(element->WebSocketExtensions.Value(), extension) == true)) {
+                                _webSocketMessage->WebSocketExtensions = extension;
+                            }
                         }
                     }
 
@@ -1027,6 +1244,12 @@ namespace Web {
                         _webSocketMessage->WebSocketProtocol = protocol;
                     }
 
+                    _deflate.Reset();
+
+                    if (_deflate.IsEnabled() == true) {
+                        _webSocketMessage->WebSocketExtensions = _deflate.Offer();
+                    }
+
                     _query = query;
                     _path = path;
                     _protocol = protocol;
@@ -1046,7 +1269,8 @@ namespace Web {
             inline void ReceivedWebSocket(Core::ProxyType<INBOUND>& element, const TemplateIntToType<0>& /* For compile time diffrentiation */)
             {
                 // We might receive a response on the update request
-                if ((_webSocketMessage.IsValid() == true) && (element->ErrorCode == Web::STATUS_SWITCH_PROTOCOL) && (element->WebSocketAccept.Value() == _handler.ResponseKey(_webSocketMessage->WebSocketKey.Value()))) {
+                // An extension we did not offer (or can not live with) fails the upgrade.
+                if ((_webSocketMessage.IsValid() == true) && (element->ErrorCode == Web::STATUS_SWITCH_PROTOCOL) && (element->WebSocketAccept.Value() == _handler.ResponseKey(_webSocketMessage->WebSocketKey.Value())) && ((element->WebSocketExtensions.IsSet() == false) || ((_deflate.IsEnabled() == true) && (_deflate.Agreed(element->WebSocketExtensions.Value()) == true)))) {
                     ASSERT((_state & UPGRADING) != 0);
 
                     _adminLock.Lock();
@@ -1074,6 +1298,7 @@ namespace Web {
             string _query;
             string _origin;
             string _commandData;
+            WebSocket::Deflate _deflate;
             Core::ProxyType<typename OUTBOUND::BaseElement> _webSocketMessage;
             uint64_t _pingFireTime;
         };
@@ -1222,6 +1447,14 @@ namespace Web {
         {
             return (_channel.Masking());
         }
+        inline void Compression(const uint8_t mode, const uint16_t threshold, const uint8_t windowBits)
+        {
+            _channel.Compression(mode, threshold, windowBits);
+        }
+        inline bool IsCompressed() const
+        {
+            return (_channel.IsCompressed());
+        }
         inline void ResetActivity()
         {
             return (_channel.ResetActivity());
@@ -1541,6 +1774,14 @@ namespace Web {
         {
             return (_channel.Masking());
         }
+        inline void Compression(const uint8_t mode, const uint16_t threshold, const uint8_t windowBits)
+        {
+            _channel.Compression(mode, threshold, windowBits);
+        }
+        inline bool IsCompressed() const
+        {
+            return (_channel.IsCompressed());
+        }
         inline uint32_t Open(const uint32_t waitTime)
         {
             return (_channel.Open(waitTime));
@@ -1779,6 +2020,14 @@ namespace Web {
         {
             return (_channel.Masking());
         }
+        inline void Compression(const uint8_t mode, const uint16_t threshold, const uint8_t windowBits)
+        {
+            _channel.Compression(mode, threshold, windowBits);
+        }
+        inline bool IsCompressed() const
+        {
+            return (_channel.IsCompressed());
+        }
         inline uint32_t Open(const uint32_t waitTime)
         {
             return (_channel.Open(waitTime));
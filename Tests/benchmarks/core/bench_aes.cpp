@@ -0,0 +1,131 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+#include <cryptalgo/cryptalgo.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // Throughput per mode, key length (first argument, in bits) and engine (second argument, 0 for
+    // the tables, 1 for the AES instructions if the CPU has them) on 16 KB messages.
+    static constexpr uint32_t MessageSize = 16 * 1024;
+
+    static bool Select(benchmark::State& state)
+    {
+        const bool accelerated = (state.range(1) != 0);
+        const bool available = ((Crypto::AESEngine(accelerated) != Crypto::AES_ENGINE_TABLES) == accelerated);
+
+        if (available == false) {
+            state.SkipWithError("No AES instructions on this CPU");
+        }
+
+        return (available);
+    }
+
+    static void Done(benchmark::State& state)
+    {
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * MessageSize);
+        Crypto::AESEngine(true);
+    }
+
+    static void Encrypt(benchmark::State& state, const Crypto::aesType type)
+    {
+        if (Select(state) == true) {
+            const std::vector<uint8_t> key(static_cast<uint32_t>(state.range(0) / 8), 0x5A);
+            std::vector<uint8_t> message(MessageSize, 0xA5);
+            uint8_t vector[16];
+            Crypto::AESEncryption encryption(type);
+
+            ::memset(vector, 0x3C, sizeof(vector));
+            encryption.Key(static_cast<uint8_t>(key.size()), key.data());
+
+            for (auto _ : state) {
+                encryption.InitialVector(vector);
+                encryption.Encrypt(MessageSize, message.data(), message.data());
+                benchmark::ClobberMemory();
+            }
+
+            Done(state);
+        }
+    }
+
+    static void Decrypt(benchmark::State& state, const Crypto::aesType type)
+    {
+        if (Select(state) == true) {
+            const std::vector<uint8_t> key(static_cast<uint32_t>(state.range(0) / 8), 0x5A);
+            std::vector<uint8_t> message(MessageSize, 0xA5);
+            uint8_t vector[16];
+            Crypto::AESDecryption decryption(type);
+
+            ::memset(vector, 0x3C, sizeof(vector));
+            decryption.Key(static_cast<uint8_t>(key.size()), key.data());
+
+            for (auto _ : state) {
+                decryption.InitialVector(vector);
+                decryption.Decrypt(MessageSize, message.data(), message.data());
+                benchmark::ClobberMemory();
+            }
+
+            Done(state);
+        }
+    }
+
+    static void AESGCM(benchmark::State& state)
+    {
+        if (Select(state) == true) {
+            const std::vector<uint8_t> key(static_cast<uint32_t>(state.range(0) / 8), 0x5A);
+            const uint8_t iv[12] = { 0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88 };
+            std::vector<uint8_t> message(MessageSize, 0xA5);
+            uint8_t tag[16];
+            Crypto::AESGCM gcm;
+
+            gcm.Key(static_cast<uint8_t>(key.size()), key.data());
+
+            for (auto _ : state) {
+                gcm.Encrypt(sizeof(iv), iv, sizeof(tag), tag, MessageSize, message.data(), message.data(), tag);
+                benchmark::ClobberMemory();
+            }
+
+            Done(state);
+        }
+    }
+
+    static void Arguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "bits", "accelerated" });
+
+        for (const int64_t bits : { 128, 192, 256 }) {
+            benchmark->Args({ bits, 0 });
+            benchmark->Args({ bits, 1 });
+        }
+    }
+
+    BENCHMARK_CAPTURE(Encrypt, ECB, Crypto::AES_ECB)->Apply(Arguments);
+    BENCHMARK_CAPTURE(Decrypt, ECB, Crypto::AES_ECB)->Apply(Arguments);
+    BENCHMARK_CAPTURE(Encrypt, CBC, Crypto::AES_CBC)->Apply(Arguments);
+    BENCHMARK_CAPTURE(Decrypt, CBC, Crypto::AES_CBC)->Apply(Arguments);
+    BENCHMARK_CAPTURE(Encrypt, CTR, Crypto::AES_CTR)->Apply(Arguments);
+    BENCHMARK(AESGCM)->Apply(Arguments);
+
+} // Benchmarks
+} // WPEFramework
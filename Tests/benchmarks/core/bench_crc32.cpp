@@ -0,0 +1,66 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // The CRC over a section of the given size, as MPEGSection::ValidCRC does it. The engine is the
+    // last argument: 0 for the table, 1 for the slicing tables and 2 for carry-less multiply.
+    static void SectionCRC(benchmark::State& state)
+    {
+        const uint32_t size = static_cast<uint32_t>(state.range(0));
+        const Core::crcEngine engine = static_cast<Core::crcEngine>(state.range(1));
+
+        if (Core::CRCEngine(engine) != engine) {
+            state.SkipWithError("Engine not available on this CPU");
+        } else {
+            std::vector<uint8_t> section(size, 0xA5);
+            Core::DataElement element(section.size(), section.data());
+
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(element.CRC32(0, size));
+            }
+
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * size);
+        }
+
+        Core::CRCEngine(Core::CRC_ENGINE_CLMUL);
+    }
+
+    static void Sections(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "size", "engine" });
+
+        // A short table section, a transport stream packet, a typical and a maximum private section.
+        for (const int64_t size : { 16, 188, 1024, 4096 }) {
+            for (const int64_t engine : { Core::CRC_ENGINE_TABLE, Core::CRC_ENGINE_SLICING, Core::CRC_ENGINE_CLMUL }) {
+                benchmark->Args({ size, engine });
+            }
+        }
+    }
+
+    BENCHMARK(SectionCRC)->Apply(Sections);
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,100 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // Records prefixed with their 16 bits size, like the trace entries.
+    class SizedBuffer : public Core::CyclicBuffer {
+    public:
+        SizedBuffer(const SizedBuffer&) = delete;
+        SizedBuffer& operator=(const SizedBuffer&) = delete;
+
+        SizedBuffer(const string& fileName, const uint32_t size)
+            : Core::CyclicBuffer(fileName, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE, size, false)
+        {
+        }
+        ~SizedBuffer() override = default;
+
+    private:
+        uint32_t GetReadSize(Cursor& cursor) override
+        {
+            uint16_t size = 0;
+            cursor.Peek(size);
+
+            return (size);
+        }
+    };
+
+    static constexpr uint32_t Records = 256;
+
+    static void Fill(SizedBuffer& buffer, const uint8_t record[], const uint16_t length)
+    {
+        for (uint32_t index = 0; index < Records; index++) {
+            buffer.Publish(record, length);
+        }
+    }
+
+    // The reader side of a trace buffer: take what came in since the last time, record by record,
+    // or all of it in one go, in place.
+    template <const bool BATCH>
+    static void CyclicBufferDrain(benchmark::State& state)
+    {
+        SizedBuffer buffer(_T("/tmp/benchmark_cyclicbuffer"), 128 * 1024);
+        uint8_t record[120];
+        uint8_t copy[sizeof(record)];
+        uint16_t length = sizeof(record);
+        uint64_t checksum = 0;
+
+        ::memset(record, 0x55, sizeof(record));
+        ::memcpy(record, &length, sizeof(length));
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            Fill(buffer, record, length);
+            state.ResumeTiming();
+
+            if (BATCH == true) {
+                Core::CyclicBuffer::Span records;
+
+                while (buffer.Records(records) != 0) {
+                    for (uint32_t offset = 0; offset < records.Length(); offset += length) {
+                        records.Read(offset + sizeof(length), &checksum, sizeof(checksum));
+                    }
+                    buffer.Consume(records);
+                }
+            } else {
+                while (buffer.Read(copy, sizeof(copy)) != 0) {
+                    ::memcpy(&checksum, &copy[sizeof(length)], sizeof(checksum));
+                }
+            }
+        }
+
+        benchmark::DoNotOptimize(checksum);
+        state.SetItemsProcessed(state.iterations() * Records);
+    }
+
+    BENCHMARK_TEMPLATE(CyclicBufferDrain, false)->Name("CyclicBufferDrain/Read");
+    BENCHMARK_TEMPLATE(CyclicBufferDrain, true)->Name("CyclicBufferDrain/Records");
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,175 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    static const TCHAR FileName[] = _T("/tmp/wpeframework_bench_filebody.bin");
+
+    // A file body as it was before, always copied through the send buffer.
+    class CopiedFileBody : public Web::FileBody {
+    public:
+        using Web::FileBody::operator=;
+
+    protected:
+        bool Transferable(Core::IResource::handle&, uint32_t&) const override
+        {
+            return (false);
+        }
+    };
+
+    template <typename FILEBODY>
+    class FileServer : public Web::WebLinkType<Core::SocketStream, Web::Request, Web::Response, Core::ProxyPoolType<Web::Request>> {
+    private:
+        typedef Web::WebLinkType<Core::SocketStream, Web::Request, Web::Response, Core::ProxyPoolType<Web::Request>> BaseClass;
+
+    public:
+        FileServer(const SOCKET connector, const Core::NodeId& remote, const uint16_t sendBufferSize)
+            : BaseClass(2, false, connector, remote, sendBufferSize, 1024)
+            , _body(Core::ProxyType<FILEBODY>::Create())
+            , _response(Core::ProxyType<Web::Response>::Create())
+        {
+        }
+        ~FileServer() override
+        {
+            BaseClass::Close(Core::infinite);
+        }
+
+    private:
+        void LinkBody(Core::ProxyType<Web::Request>&) override
+        {
+        }
+        void Received(Core::ProxyType<Web::Request>&) override
+        {
+            *_body = string(FileName);
+            _response->Body<FILEBODY>(_body);
+            Submit(_response);
+        }
+        void Send(const Core::ProxyType<Web::Response>&) override
+        {
+        }
+        void StateChange() override
+        {
+        }
+
+    private:
+        Core::ProxyType<FILEBODY> _body;
+        Core::ProxyType<Web::Response> _response;
+    };
+
+    // Serves a file of the given size, over and over again, on a loopback TCP connection that is kept
+    // alive, as a browser loads the static assets of a UI. The second argument is the send buffer of
+    // the server side, the socket is sized to it.
+    template <typename FILEBODY>
+    static void Serve(benchmark::State& state)
+    {
+        const uint32_t fileSize = static_cast<uint32_t>(state.range(0));
+        const uint16_t sendBufferSize = static_cast<uint16_t>(state.range(1));
+        std::vector<uint8_t> content(fileSize, 0x5A);
+        Core::File file((string(FileName)));
+
+        file.Create();
+        file.Write(content.data(), fileSize);
+        file.Close();
+
+        struct sockaddr_in address;
+        socklen_t size = sizeof(address);
+
+        ::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        const SOCKET listener = ::socket(AF_INET, SOCK_STREAM, 0);
+        ::bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+        ::listen(listener, 1);
+        ::getsockname(listener, reinterpret_cast<struct sockaddr*>(&address), &size);
+
+        const SOCKET client = ::socket(AF_INET, SOCK_STREAM, 0);
+        ::connect(client, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+
+        const SOCKET connector = ::accept(listener, nullptr, nullptr);
+        const int noDelay = 1;
+
+        // As a web server does, otherwise Nagle and the delayed ACK of the other side measure 40ms waits.
+        ::setsockopt(connector, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        {
+            FileServer<FILEBODY> server(connector, Core::NodeId(_T("127.0.0.1"), ntohs(address.sin_port)), sendBufferSize);
+            const string request(_T("GET /file HTTP/1.1\r\nHost: localhost\r\n\r\n"));
+            std::vector<char> buffer(65536);
+
+            server.Open(0);
+
+            for (auto _ : state) {
+                string headers;
+                size_t end = string::npos;
+                uint32_t body = 0;
+
+                ::send(client, request.c_str(), request.length(), 0);
+
+                while (end == string::npos) {
+                    const ssize_t loaded = ::recv(client, buffer.data(), buffer.size(), 0);
+                    headers.append(buffer.data(), loaded);
+                    end = headers.find(_T("\r\n\r\n"));
+                }
+
+                body = static_cast<uint32_t>(headers.length() - (end + 4));
+
+                while (body < fileSize) {
+                    body += static_cast<uint32_t>(::recv(client, buffer.data(), std::min(buffer.size(), static_cast<size_t>(fileSize - body)), 0));
+                }
+            }
+
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * fileSize);
+        }
+
+        ::close(client);
+        ::close(listener);
+        file.Destroy();
+    }
+
+    static void Sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "size", "buffer" });
+
+        // A small stylesheet, a script bundle, an image and a download, with the send buffer of the
+        // PluginHost channel and with the system default (~0).
+        for (const int64_t size : { 4096, 65536, 1048576, 8388608 }) {
+            benchmark->Args({ size, 1024 });
+            benchmark->Args({ size, 65535 });
+        }
+    }
+
+    BENCHMARK_TEMPLATE(Serve, CopiedFileBody)->Apply(Sizes)->UseRealTime();
+    BENCHMARK_TEMPLATE(Serve, Web::FileBody)->Apply(Sizes)->UseRealTime();
+
+} // Benchmarks
+} // WPEFramework
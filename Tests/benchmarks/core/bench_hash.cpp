@@ -0,0 +1,183 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+#include <cryptalgo/cryptalgo.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // The engine is the last argument: 0 for the portable code, 1 for the multi-buffer lanes (only
+    // Digest uses them) and 2 for the SHA instructions of the CPU, if it has them.
+    static constexpr uint32_t LargeSize = 16 * 1024;
+    static constexpr uint32_t SmallSize = 64;
+    static constexpr uint32_t SmallCount = 256;
+
+    static bool Select(benchmark::State& state, const uint8_t argument)
+    {
+        Crypto::hashEngine engine = static_cast<Crypto::hashEngine>(state.range(argument));
+
+        if ((engine == Crypto::HASH_ENGINE_SHANI) && (Crypto::HashEngine(Crypto::HASH_ENGINE_ARMV8) == Crypto::HASH_ENGINE_ARMV8)) {
+            engine = Crypto::HASH_ENGINE_ARMV8;
+        }
+
+        const bool available = (Crypto::HashEngine(engine) == engine);
+
+        if (available == false) {
+            state.SkipWithError("Engine not available on this CPU");
+        }
+
+        return (available);
+    }
+
+    static void Done(benchmark::State& state, const uint32_t bytes)
+    {
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * bytes);
+        Crypto::HashEngine(Crypto::HASH_ENGINE_ARMV8);
+    }
+
+    // One large message.
+    template <typename HASH>
+    static void Throughput(benchmark::State& state)
+    {
+        if (Select(state, 0) == true) {
+            const std::vector<uint8_t> message(LargeSize, 0xA5);
+
+            for (auto _ : state) {
+                HASH hash(message.data(), message.size());
+                benchmark::DoNotOptimize(hash.Result());
+            }
+
+            Done(state, LargeSize);
+        }
+    }
+
+    // Many small messages, one by one or in one Digest.
+    template <typename HASH>
+    static void Small(benchmark::State& state)
+    {
+        if (Select(state, 1) == true) {
+            const std::vector<uint8_t> data(SmallCount * SmallSize, 0x5A);
+            const std::vector<uint32_t> lengths(SmallCount, SmallSize);
+            std::vector<const uint8_t*> messages;
+            std::vector<uint8_t> digests(SmallCount * HASH::Length);
+            const HASH initial;
+
+            for (uint32_t index = 0; index < SmallCount; index++) {
+                messages.push_back(&data[index * SmallSize]);
+            }
+
+            for (auto _ : state) {
+                if (state.range(0) == 0) {
+                    for (uint32_t index = 0; index < SmallCount; index++) {
+                        HASH hash(messages[index], SmallSize);
+                        ::memcpy(&digests[index * HASH::Length], hash.Result(), HASH::Length);
+                    }
+                } else {
+                    initial.Digest(SmallCount, messages.data(), lengths.data(), digests.data());
+                }
+                benchmark::ClobberMemory();
+            }
+
+            Done(state, SmallCount * SmallSize);
+        }
+    }
+
+    // HMAC of small messages: a new HMAC (so a new key) per message, as it used to be done, the
+    // prepared key reused for all, or all of them in one Digest.
+    template <typename HMAC>
+    static void SmallHMAC(benchmark::State& state)
+    {
+        if (Select(state, 1) == true) {
+            const string key(_T("secret"));
+            const std::vector<uint8_t> data(SmallCount * SmallSize, 0x5A);
+            const std::vector<uint32_t> lengths(SmallCount, SmallSize);
+            std::vector<const uint8_t*> messages;
+            std::vector<uint8_t> digests(SmallCount * HMAC::Length);
+            HMAC prepared(key);
+
+            for (uint32_t index = 0; index < SmallCount; index++) {
+                messages.push_back(&data[index * SmallSize]);
+            }
+
+            for (auto _ : state) {
+                if (state.range(0) == 0) {
+                    for (uint32_t index = 0; index < SmallCount; index++) {
+                        HMAC hmac(key);
+                        hmac.Input(messages[index], SmallSize);
+                        ::memcpy(&digests[index * HMAC::Length], hmac.Result(), HMAC::Length);
+                    }
+                } else if (state.range(0) == 1) {
+                    for (uint32_t index = 0; index < SmallCount; index++) {
+                        prepared.Reset();
+                        prepared.Input(messages[index], SmallSize);
+                        ::memcpy(&digests[index * HMAC::Length], prepared.Result(), HMAC::Length);
+                    }
+                } else {
+                    prepared.Digest(SmallCount, messages.data(), lengths.data(), digests.data());
+                }
+                benchmark::ClobberMemory();
+            }
+
+            Done(state, SmallCount * SmallSize);
+        }
+    }
+
+    static void Engines(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "engine" });
+        benchmark->Arg(Crypto::HASH_ENGINE_PORTABLE);
+        benchmark->Arg(Crypto::HASH_ENGINE_SHANI);
+    }
+
+    static void Batches(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "digest", "engine" });
+
+        for (const int64_t engine : { Crypto::HASH_ENGINE_PORTABLE, Crypto::HASH_ENGINE_MULTIBUFFER, Crypto::HASH_ENGINE_SHANI }) {
+            benchmark->Args({ 0, engine });
+            benchmark->Args({ 1, engine });
+        }
+    }
+
+    static void HMACs(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "mode", "engine" });
+
+        for (const int64_t engine : { Crypto::HASH_ENGINE_PORTABLE, Crypto::HASH_ENGINE_MULTIBUFFER, Crypto::HASH_ENGINE_SHANI }) {
+            benchmark->Args({ 0, engine });
+            benchmark->Args({ 1, engine });
+            benchmark->Args({ 2, engine });
+        }
+    }
+
+    BENCHMARK_TEMPLATE(Throughput, Crypto::MD5)->Arg(Crypto::HASH_ENGINE_PORTABLE)->ArgNames({ "engine" });
+    BENCHMARK_TEMPLATE(Throughput, Crypto::SHA1)->Apply(Engines);
+    BENCHMARK_TEMPLATE(Throughput, Crypto::SHA256)->Apply(Engines);
+    BENCHMARK_TEMPLATE(Throughput, Crypto::SHA512)->Arg(Crypto::HASH_ENGINE_PORTABLE)->ArgNames({ "engine" });
+    BENCHMARK_TEMPLATE(Small, Crypto::SHA1)->Apply(Batches);
+    BENCHMARK_TEMPLATE(Small, Crypto::SHA256)->Apply(Batches);
+    BENCHMARK_TEMPLATE(SmallHMAC, Crypto::SHA1HMAC)->Apply(HMACs);
+    BENCHMARK_TEMPLATE(SmallHMAC, Crypto::SHA256HMAC)->Apply(HMACs);
+
+} // Benchmarks
+} // WPEFramework
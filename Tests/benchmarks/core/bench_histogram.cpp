@@ -0,0 +1,70 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // What measuring a call adds to it: the lookup of the histogram and the two clock reads.
+    static void CallLatencyComRpc(benchmark::State& state)
+    {
+        Core::CallLatencies& latencies(Core::CallLatencies::Instance());
+        uint32_t method = 3;
+
+        for (auto _ : state) {
+            Core::CallLatencies::Measurement measurement(latencies.Histogram(Core::CallLatencies::COMRPC_INBOUND, 0x42, method));
+            method = (method == 10 ? 3 : method + 1);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    static void CallLatencyJsonRpc(benchmark::State& state)
+    {
+        Core::CallLatencies& latencies(Core::CallLatencies::Instance());
+        const string callsign(_T("DeviceInfo"));
+        const string method(_T("systeminfo"));
+
+        for (auto _ : state) {
+            Core::CallLatencies::Measurement measurement(latencies.Histogram(callsign, method));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    static void CallLatencyRecord(benchmark::State& state)
+    {
+        static Core::Histogram histogram;
+        uint64_t value = 0;
+
+        for (auto _ : state) {
+            histogram.Record(value++ & 0xFFFF);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(CallLatencyComRpc)->ThreadRange(1, 4)->UseRealTime();
+    BENCHMARK(CallLatencyJsonRpc)->ThreadRange(1, 4)->UseRealTime();
+    BENCHMARK(CallLatencyRecord)->ThreadRange(1, 4)->UseRealTime();
+
+} // Benchmarks
+} // WPEFramework
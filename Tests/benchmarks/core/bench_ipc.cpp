@@ -0,0 +1,294 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    typedef Core::IPCMessageType<1, Core::IPC::ScalarType<uint32_t>, Core::IPC::ScalarType<uint32_t>> Double;
+    typedef Core::IPCMessageType<2, Core::IPC::ScalarType<string>, Core::IPC::ScalarType<uint32_t>> Attach;
+    typedef Core::IPCMessageType<3, Core::IPC::ScalarType<string>, Core::IPC::ScalarType<uint32_t>> Upload;
+    typedef Core::IPCChannelClientType<Core::Void, false, false> Client;
+
+    static const TCHAR Connector[] = _T("/tmp/benchmark_ipc");
+    static constexpr uint32_t SharedMemorySize = 0x40000;
+    static constexpr uint32_t SharedMemoryThreshold = 2048;
+
+    // The out-of-process side, like a plugin hosted by WPEProcess: the calls are handed to a
+    // pool of workers that each spend some time on it, and report back when done.
+    class Plugin : public Core::IIPCServer {
+    public:
+        Plugin(const Plugin&) = delete;
+        Plugin& operator=(const Plugin&) = delete;
+
+        Plugin(const uint8_t workers)
+            : _lock()
+            , _signal()
+            , _jobs()
+            , _running(true)
+            , _workers()
+        {
+            for (uint8_t index = 0; index < workers; index++) {
+                _workers.emplace_back([this]() { Process(); });
+            }
+        }
+        ~Plugin() override
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _running = false;
+            _signal.notify_all();
+            lock.unlock();
+
+            for (std::thread& worker : _workers) {
+                worker.join();
+            }
+        }
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _jobs.emplace_back(Core::ProxyType<Core::IPCChannel>(source), message);
+            _signal.notify_one();
+        }
+
+    private:
+        void Process()
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+
+            while (_running == true) {
+                if (_jobs.empty() == true) {
+                    _signal.wait(lock);
+                } else {
+                    std::pair<Core::ProxyType<Core::IPCChannel>, Core::ProxyType<Core::IIPC>> job(_jobs.front());
+                    _jobs.pop_front();
+                    lock.unlock();
+
+                    Core::ProxyType<Double> call(Core::proxy_cast<Double>(job.second));
+
+                    // The actual implementation, takes a little while.
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    call->Response() = call->Parameters().Value() * 2;
+                    job.first->ReportResponse(job.second);
+
+                    lock.lock();
+                }
+            }
+        }
+
+    private:
+        std::mutex _lock;
+        std::condition_variable _signal;
+        std::list<std::pair<Core::ProxyType<Core::IPCChannel>, Core::ProxyType<Core::IIPC>>> _jobs;
+        bool _running;
+        std::vector<std::thread> _workers;
+    };
+
+    // Takes the larger parameters, and attaches to the shared memory of a client, like the COMRPC
+    // server does on the announce. Handled right away, only the transport is measured.
+    class Storage : public Core::IIPCServer {
+    public:
+        Storage(const Storage&) = delete;
+        Storage& operator=(const Storage&) = delete;
+
+        Storage() = default;
+        ~Storage() override = default;
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            if (message->Label() == Attach::Id()) {
+                Core::ProxyType<Attach> call(Core::proxy_cast<Attach>(message));
+                Core::ProxyType<Core::IPCSharedMemory> memory(Core::ProxyType<Core::IPCSharedMemory>::Create(call->Parameters().Value()));
+
+                if (memory->IsValid() == true) {
+                    source.Shared(memory, SharedMemoryThreshold);
+                }
+                call->Response() = (memory->IsValid() == true ? 1 : 0);
+                call->Parameters() = string();
+            } else {
+                Core::ProxyType<Upload> call(Core::proxy_cast<Upload>(message));
+
+                call->Response() = static_cast<uint32_t>(call->Parameters().Value().length());
+                call->Parameters() = string();
+            }
+
+            source.ReportResponse(message);
+        }
+    };
+
+    // Forked once, before anything else in this process started framework threads. It lives
+    // till the pipe closes, which is when this process exits.
+    static void Spawn()
+    {
+        static int alive = -1;
+
+        if (alive == -1) {
+            int descriptors[2];
+
+            if (::pipe(descriptors) == 0) {
+                if (::fork() == 0) {
+                    uint8_t dummy;
+
+                    ::close(descriptors[1]);
+
+                    Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> factory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+                    factory->CreateFactory<Double>(8);
+                    factory->CreateFactory<Attach>(1);
+                    factory->CreateFactory<Upload>(1);
+
+                    {
+                        Core::IPCChannelServerType<Core::Void, false> server(Core::NodeId(Connector), 1024, factory);
+
+                        Core::ProxyType<Core::IIPCServer> storage(Core::ProxyType<Storage>::Create());
+
+                        server.Register(Double::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<Plugin>::Create(8)));
+                        server.Register(Attach::Id(), storage);
+                        server.Register(Upload::Id(), storage);
+                        server.Open(Core::infinite);
+
+                        while (::read(descriptors[0], &dummy, sizeof(dummy)) > 0) {
+                        }
+
+                        server.Unregister(Upload::Id());
+                        server.Unregister(Attach::Id());
+                        server.Unregister(Double::Id());
+                        server.Close(Core::infinite);
+                    }
+
+                    factory->DestroyFactories();
+                    Core::Singleton::Dispose();
+
+                    ::_exit(0);
+                }
+
+                ::close(descriptors[0]);
+                alive = descriptors[1];
+            }
+        }
+    }
+
+    static Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> _factory;
+    static Client* _client = nullptr;
+
+    // All benchmark threads share one channel to the plugin, like all proxies to a plugin do.
+    static void IPCConcurrentCalls(benchmark::State& state)
+    {
+        if (state.thread_index() == 0) {
+            Spawn();
+
+            _factory = Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create();
+            _client = new Client(Core::NodeId(Connector), 1024, _factory);
+
+            // The server might still be starting up.
+            for (uint32_t attempt = 0; (attempt < 200) && (_client->Open(100) != Core::ERROR_NONE); attempt++) {
+                SleepMs(10);
+            }
+        }
+
+        Core::ProxyType<Double> message(Core::ProxyType<Double>::Create());
+        uint32_t value = static_cast<uint32_t>(state.thread_index()) << 24;
+
+        for (auto _ : state) {
+            message->Parameters() = ++value;
+
+            if ((_client->Invoke(message, 1000) != Core::ERROR_NONE) || (message->Response().Value() != (value * 2))) {
+                state.SkipWithError("Call failed");
+                break;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0) {
+            _client->Close(Core::infinite);
+            delete _client;
+            _client = nullptr;
+
+            _factory->DestroyFactories();
+            _factory.Release();
+        }
+    }
+
+    BENCHMARK(IPCConcurrentCalls)->ThreadRange(1, 8)->UseRealTime();
+
+    // Calls with a parameter of the given size, through the socket or the shared memory of the channel.
+    template <const bool SHARED>
+    static void IPCLargeParameters(benchmark::State& state)
+    {
+        const uint32_t size = static_cast<uint32_t>(state.range(0));
+
+        Spawn();
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> factory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        {
+            Client client(Core::NodeId(Connector), 1024, factory);
+
+            for (uint32_t attempt = 0; (attempt < 200) && (client.Open(100) != Core::ERROR_NONE); attempt++) {
+                SleepMs(10);
+            }
+
+            Core::ProxyType<Core::IPCSharedMemory> memory;
+
+            if (SHARED == true) {
+                memory = Core::ProxyType<Core::IPCSharedMemory>::Create(string(Connector) + _T(".benchmark"), Core::File::USER_READ | Core::File::USER_WRITE, SharedMemorySize);
+                client.Shared(memory, 0);
+
+                Core::ProxyType<Attach> attach(Core::ProxyType<Attach>::Create());
+                attach->Parameters() = memory->Name();
+
+                if ((client.Invoke(attach, 1000) != Core::ERROR_NONE) || (attach->Response().Value() != 1)) {
+                    state.SkipWithError("No shared memory");
+                }
+                client.Shared(memory, SharedMemoryThreshold);
+            }
+
+            Core::ProxyType<Upload> message(Core::ProxyType<Upload>::Create());
+            message->Parameters() = string(size, 'x');
+
+            for (auto _ : state) {
+                if ((client.Invoke(message, 1000) != Core::ERROR_NONE) || (message->Response().Value() != size)) {
+                    state.SkipWithError("Call failed");
+                    break;
+                }
+            }
+
+            state.SetBytesProcessed(state.iterations() * size);
+            state.SetItemsProcessed(state.iterations());
+
+            client.Close(Core::infinite);
+        }
+
+        factory->DestroyFactories();
+    }
+
+    BENCHMARK_TEMPLATE(IPCLargeParameters, false)->Name("IPCLargeParameters/Socket")->Arg(4096)->Arg(16384)->Arg(60000)->UseRealTime();
+    BENCHMARK_TEMPLATE(IPCLargeParameters, true)->Name("IPCLargeParameters/SharedMemory")->Arg(4096)->Arg(16384)->Arg(60000)->UseRealTime();
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,416 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // Shaped like the Controller status response.
+    class Plugin : public Core::JSON::Container {
+    public:
+        Plugin& operator=(const Plugin&) = delete;
+
+        Plugin()
+            : Core::JSON::Container()
+            , Callsign()
+            , Locator()
+            , ClassName()
+            , State()
+            , AutoStart(false)
+            , Observers(0)
+        {
+            Add(_T("callsign"), &Callsign);
+            Add(_T("locator"), &Locator);
+            Add(_T("classname"), &ClassName);
+            Add(_T("state"), &State);
+            Add(_T("autostart"), &AutoStart);
+            Add(_T("observers"), &Observers);
+        }
+        Plugin(const Plugin& copy)
+            : Core::JSON::Container()
+            , Callsign(copy.Callsign)
+            , Locator(copy.Locator)
+            , ClassName(copy.ClassName)
+            , State(copy.State)
+            , AutoStart(copy.AutoStart)
+            , Observers(copy.Observers)
+        {
+            Add(_T("callsign"), &Callsign);
+            Add(_T("locator"), &Locator);
+            Add(_T("classname"), &ClassName);
+            Add(_T("state"), &State);
+            Add(_T("autostart"), &AutoStart);
+            Add(_T("observers"), &Observers);
+        }
+        ~Plugin() override = default;
+
+    public:
+        Core::JSON::String Callsign;
+        Core::JSON::String Locator;
+        Core::JSON::String ClassName;
+        Core::JSON::String State;
+        Core::JSON::Boolean AutoStart;
+        Core::JSON::DecUInt32 Observers;
+    };
+
+    class Status : public Core::JSON::ArrayType<Plugin> {
+    public:
+        Status(const Status&) = delete;
+        Status& operator=(const Status&) = delete;
+
+        Status()
+        {
+            for (uint32_t index = 0; index < 30; index++) {
+                Plugin& entry(Add());
+                entry.Callsign = _T("Plugin") + Core::NumberType<uint32_t>(index).Text();
+                entry.Locator = _T("libWPEFramework") + entry.Callsign.Value() + _T(".so");
+                entry.ClassName = entry.Callsign.Value();
+                entry.State = _T("activated");
+                entry.AutoStart = ((index & 1) == 0);
+                entry.Observers = index;
+            }
+        }
+    };
+
+    class Counter : public Core::JSON::Reader::IHandler {
+    public:
+        Counter(const Counter&) = delete;
+        Counter& operator=(const Counter&) = delete;
+
+        Counter()
+            : Events(0)
+        {
+        }
+        ~Counter() override = default;
+
+        bool BeginObject() override
+        {
+            Events++;
+            return (true);
+        }
+        bool EndObject() override
+        {
+            Events++;
+            return (true);
+        }
+        bool BeginArray() override
+        {
+            Events++;
+            return (true);
+        }
+        bool EndArray() override
+        {
+            Events++;
+            return (true);
+        }
+        bool Key(const char[], const uint32_t) override
+        {
+            Events++;
+            return (true);
+        }
+        bool Text(const char[], const uint32_t) override
+        {
+            Events++;
+            return (true);
+        }
+        bool Number(const char[], const uint32_t) override
+        {
+            Events++;
+            return (true);
+        }
+        bool Boolean(const bool) override
+        {
+            Events++;
+            return (true);
+        }
+        bool Null() override
+        {
+            Events++;
+            return (true);
+        }
+
+        uint32_t Events;
+    };
+
+    // How IElement::ToString used to do it, a temporary string per 1KiB chunk.
+    static void ChunkedToString(benchmark::State& state)
+    {
+        Status status;
+        string text;
+
+        for (auto _ : state) {
+            char buffer[1024];
+            uint32_t loaded;
+            uint32_t offset = 0;
+
+            text.clear();
+            do {
+                loaded = static_cast<const Core::JSON::IElement&>(status).Serialize(buffer, sizeof(buffer), offset);
+                text += string(buffer, loaded);
+            } while ((offset != 0) && (loaded == sizeof(buffer)));
+
+            benchmark::DoNotOptimize(text.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.length());
+    }
+
+    static void ToString(benchmark::State& state)
+    {
+        Status status;
+        string text;
+
+        for (auto _ : state) {
+            status.ToString(text);
+            benchmark::DoNotOptimize(text.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.length());
+    }
+
+    static void FromString(benchmark::State& state)
+    {
+        Status status;
+        Core::JSON::ArrayType<Plugin> parsed;
+        string text;
+
+        status.ToString(text);
+
+        for (auto _ : state) {
+            parsed.FromString(text);
+            benchmark::DoNotOptimize(parsed.Length());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.length());
+    }
+
+    static void ReaderParse(benchmark::State& state)
+    {
+        Status status;
+        Core::JSON::Reader reader;
+        Counter counter;
+        string text;
+
+        status.ToString(text);
+
+        for (auto _ : state) {
+            reader.Parse(text, counter);
+            benchmark::DoNotOptimize(counter.Events);
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.length());
+    }
+
+    // A JSON-RPC message carrying 1MB of parameters.
+    static void LargeMessage(Core::JSONRPC::Message& message)
+    {
+        string parameters(_T("{\"data\":\""));
+
+        parameters.append(1024 * 1024, 'x');
+        parameters += _T("\"}");
+
+        message.Id = 1;
+        message.Designator = _T("Plugin.1.method");
+        message.Parameters = parameters;
+    }
+
+    static void LargeToString(benchmark::State& state)
+    {
+        Core::JSONRPC::Message message;
+        string text;
+
+        LargeMessage(message);
+
+        for (auto _ : state) {
+            message.ToString(text);
+            benchmark::DoNotOptimize(text.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.length());
+    }
+
+    static void LargeFromString(benchmark::State& state)
+    {
+        Core::JSONRPC::Message message;
+        string text;
+
+        LargeMessage(message);
+        message.ToString(text);
+
+        for (auto _ : state) {
+            message.FromString(text);
+            benchmark::DoNotOptimize(message.Parameters.Value().length());
+        }
+
+        state.SetBytesProcessed(state.iterations() * text.length());
+    }
+
+    // A Controller call from the client side: the request goes out, the server takes it in
+    // and answers with the (JSON text) result of the plugin, the client takes that in.
+    class ActivateParameters : public Core::JSON::Container {
+    public:
+        ActivateParameters(const ActivateParameters&) = delete;
+        ActivateParameters& operator=(const ActivateParameters&) = delete;
+
+        ActivateParameters()
+            : Core::JSON::Container()
+            , Callsign()
+        {
+            Add(_T("callsign"), &Callsign);
+        }
+        ~ActivateParameters() override = default;
+
+    public:
+        Core::JSON::String Callsign;
+    };
+
+    template <typename PARAMETERS, typename RESULT>
+    static void TextRoundTrip(benchmark::State& state, const TCHAR designator[], const string& reply)
+    {
+        Core::JSONRPC::Message request;
+        Core::JSONRPC::Message inbound;
+        Core::JSONRPC::Message response;
+        Core::JSONRPC::Message outbound;
+        PARAMETERS parameters;
+        RESULT result;
+        string frame;
+        string text;
+        uint64_t bytes = 0;
+
+        parameters.Callsign = _T("WebKitBrowser");
+
+        for (auto _ : state) {
+            // Client
+            request.Clear();
+            request.Id = 1;
+            request.Designator = designator;
+            parameters.ToString(text);
+            request.Parameters = text;
+            request.ToString(frame);
+            bytes += frame.length();
+
+            // Server
+            inbound.FromString(frame);
+            response.Clear();
+            response.Id = inbound.Id.Value();
+            if (reply.empty() == false) {
+                response.Result = reply;
+            }
+            response.ToString(frame);
+            bytes += frame.length();
+
+            // Client
+            outbound.FromString(frame);
+            result.FromString(outbound.Result.Value());
+            benchmark::DoNotOptimize(result.IsSet());
+        }
+
+        state.SetBytesProcessed(bytes);
+    }
+
+    template <typename PARAMETERS, typename RESULT>
+    static void PackedRoundTrip(benchmark::State& state, const TCHAR designator[], const string& reply)
+    {
+        Core::JSONRPC::Message request;
+        Core::JSONRPC::Message inbound;
+        Core::JSONRPC::Message response;
+        Core::JSONRPC::Message outbound;
+        PARAMETERS parameters;
+        RESULT result;
+        std::vector<uint8_t> frame;
+        std::vector<uint8_t> packed;
+        string text;
+        string value;
+        uint64_t bytes = 0;
+
+        parameters.Callsign = _T("WebKitBrowser");
+
+        for (auto _ : state) {
+            // Client, see JSONRPC::LinkType<Core::JSON::IMessagePack>
+            request.Clear();
+            request.Id = 1;
+            request.Designator = designator;
+            parameters.ToBuffer(packed);
+            request.Parameters = string(packed.begin(), packed.end());
+            request.ToBuffer(frame);
+            bytes += frame.size();
+
+            // Server, see PluginHost::Channel, the plugins still deal in JSON text
+            inbound.FromBuffer(frame);
+            Core::JSON::MessagePack::ToText(inbound.Parameters.Value(), text);
+            response.Clear();
+            response.Id = inbound.Id.Value();
+            if (reply.empty() == false) {
+                Core::JSON::MessagePack::FromText(reply, value);
+                response.Result = value;
+            }
+            response.ToBuffer(frame);
+            bytes += frame.size();
+
+            // Client
+            outbound.FromBuffer(frame);
+            value = outbound.Result.Value();
+            packed.assign(value.begin(), value.end());
+            result.FromBuffer(packed);
+            benchmark::DoNotOptimize(result.IsSet());
+        }
+
+        state.SetBytesProcessed(bytes);
+    }
+
+    static string StatusReply()
+    {
+        Status status;
+        string text;
+        status.ToString(text);
+        return (text);
+    }
+
+    static void StatusText(benchmark::State& state)
+    {
+        TextRoundTrip<ActivateParameters, Core::JSON::ArrayType<Plugin>>(state, _T("Controller.1.status"), StatusReply());
+    }
+    static void StatusPacked(benchmark::State& state)
+    {
+        PackedRoundTrip<ActivateParameters, Core::JSON::ArrayType<Plugin>>(state, _T("Controller.1.status"), StatusReply());
+    }
+    static void ActivateText(benchmark::State& state)
+    {
+        TextRoundTrip<ActivateParameters, Core::JSON::String>(state, _T("Controller.1.activate"), EMPTY_STRING);
+    }
+    static void ActivatePacked(benchmark::State& state)
+    {
+        PackedRoundTrip<ActivateParameters, Core::JSON::String>(state, _T("Controller.1.activate"), EMPTY_STRING);
+    }
+
+    BENCHMARK(ChunkedToString)->Name("JSONChunkedToString");
+    BENCHMARK(ToString)->Name("JSONToString");
+    BENCHMARK(FromString)->Name("JSONFromString");
+    BENCHMARK(ReaderParse)->Name("JSONReaderParse");
+    BENCHMARK(LargeToString)->Name("JSONRPCMessageToString1MB");
+    BENCHMARK(LargeFromString)->Name("JSONRPCMessageFromString1MB");
+    BENCHMARK(StatusText)->Name("JSONRPCStatusRoundTripText");
+    BENCHMARK(StatusPacked)->Name("JSONRPCStatusRoundTripMessagePack");
+    BENCHMARK(ActivateText)->Name("JSONRPCActivateRoundTripText");
+    BENCHMARK(ActivatePacked)->Name("JSONRPCActivateRoundTripMessagePack");
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,87 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    static constexpr uint32_t Methods = 50;
+
+    static string MethodName(const uint32_t id)
+    {
+        return (_T("someMethodName") + Core::NumberType<uint32_t>(id).Text());
+    }
+
+    static uint32_t Nothing(const string&, const string&, string&)
+    {
+        return (Core::ERROR_NONE);
+    }
+
+    // The way the Handler resolved methods before it had an index of its own:
+    // copy the method out of the designator and look it up in the tree.
+    static void MapLookup(benchmark::State& state)
+    {
+        std::map<const string, Core::JSONRPC::InvokeFunction> handlers;
+        std::vector<string> designators;
+        string response;
+
+        for (uint32_t index = 0; index < Methods; index++) {
+            handlers.emplace(MethodName(index), Nothing);
+            designators.push_back(_T("Plugin.1.") + MethodName(index));
+        }
+
+        uint32_t index = 0;
+        for (auto _ : state) {
+            const string& designator(designators[index++ % Methods]);
+            auto entry = handlers.find(Core::JSONRPC::Message::Method(designator));
+            benchmark::DoNotOptimize(entry->second(designator, designator, response));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // A plugin with 50 methods, calls per second through the Handler.
+    static void HandlerInvoke(benchmark::State& state)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, { 1 });
+        Core::JSONRPC::Connection connection(1, 1);
+        std::vector<string> designators;
+        string response;
+
+        for (uint32_t index = 0; index < Methods; index++) {
+            handler.Register(MethodName(index), Core::JSONRPC::InvokeFunction(Nothing));
+            designators.push_back(_T("Plugin.1.") + MethodName(index));
+        }
+
+        uint32_t index = 0;
+        for (auto _ : state) {
+            const string& designator(designators[index++ % Methods]);
+            benchmark::DoNotOptimize(handler.Invoke(connection, designator, designator, response));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(MapLookup)->Name("JSONRPCMapLookup");
+    BENCHMARK(HandlerInvoke)->Name("JSONRPCHandlerInvoke");
+
+} // Benchmarks
+} // WPEFramework
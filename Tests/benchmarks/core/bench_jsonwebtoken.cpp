@@ -0,0 +1,69 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    static const uint8_t TokenKey[] = { 's', 'e', 'c', 'r', 'e', 't', 'k', 'e', 'y' };
+
+    // Validations per second of a token presented over and over again, as a client does on every
+    // request, with the cache off (0) and on (1). The second argument is the number of different
+    // tokens that take turns.
+    static void Validate(benchmark::State& state)
+    {
+        const bool cached = (state.range(0) != 0);
+        const uint32_t count = static_cast<uint32_t>(state.range(1));
+        Web::JSONWebToken token(Web::JSONWebToken::SHA256, sizeof(TokenKey), TokenKey, (cached == true ? 64 : 0), 60000);
+        std::vector<string> tokens(count);
+        uint8_t payload[512];
+        uint32_t index = 0;
+
+        for (uint32_t teller = 0; teller < count; teller++) {
+            const string data(_T("{\"url\":\"https://www.example.com/app/") + Core::NumberType<uint32_t>(teller).Text() + _T("\",\"user\":\"operator\"}"));
+            token.Encode(tokens[teller], static_cast<uint16_t>(data.length()), reinterpret_cast<const uint8_t*>(data.c_str()));
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(token.Decode(tokens[index], sizeof(payload), payload));
+            index = (index + 1 == count ? 0 : index + 1);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    static void Tokens(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "cached", "tokens" });
+
+        for (const int64_t count : { 1, 16 }) {
+            benchmark->Args({ 0, count });
+            benchmark->Args({ 1, count });
+        }
+    }
+
+    BENCHMARK(Validate)->Apply(Tokens);
+
+} // Benchmarks
+} // WPEFramework
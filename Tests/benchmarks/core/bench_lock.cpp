@@ -0,0 +1,167 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+#include <map>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // What the locks on the hot paths protect: a lookup in a map of some hundred entries, like the
+    // proxies and stubs of the RPC Administrator, or a few fields, like the IPC _serialize lock and
+    // the ResourceMonitor administration.
+    template <typename LOCK>
+    class Administration {
+    public:
+        Administration(const Administration&) = delete;
+        Administration& operator=(const Administration&) = delete;
+
+        Administration()
+            : _lock()
+            , _entries()
+            , _counter(0)
+        {
+            for (uint32_t index = 0; index < 256; index++) {
+                _entries.emplace(index * 64, index);
+            }
+        }
+        ~Administration() = default;
+
+    public:
+        uint32_t Find(const uint32_t key)
+        {
+            uint32_t result = 0;
+
+            _lock.Lock();
+
+            std::map<uint32_t, uint32_t>::const_iterator index(_entries.find(key));
+            if (index != _entries.end()) {
+                result = index->second;
+            }
+
+            _lock.Unlock();
+
+            return (result);
+        }
+        void Count()
+        {
+            _lock.Lock();
+            _counter++;
+            _lock.Unlock();
+        }
+        LOCK& Lock()
+        {
+            return (_lock);
+        }
+
+    private:
+        LOCK _lock;
+        std::map<uint32_t, uint32_t> _entries;
+        uint32_t _counter;
+    };
+
+    template <typename LOCK>
+    static Administration<LOCK>& Instance()
+    {
+        static Administration<LOCK> administration;
+
+        return (administration);
+    }
+
+    template <typename LOCK>
+    static void LockLookup(benchmark::State& state)
+    {
+        Administration<LOCK>& administration(Instance<LOCK>());
+        uint32_t key = state.thread_index() * 64;
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(administration.Find(key));
+            key = (key + 64) & 0x3FFF;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <typename LOCK>
+    static void LockCounter(benchmark::State& state)
+    {
+        Administration<LOCK>& administration(Instance<LOCK>());
+
+        for (auto _ : state) {
+            administration.Count();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // The lookup again, with the share of the acquisitions that found the lock taken, and that slept.
+    static void AdaptiveStatistics(benchmark::State& state)
+    {
+        Core::AdaptiveCriticalSection& lock(Instance<Core::AdaptiveCriticalSection>().Lock());
+
+        if (state.thread_index() == 0) {
+            lock.ResetStatistics();
+        }
+
+        for (auto _ : state) {
+            Instance<Core::AdaptiveCriticalSection>().Find(64);
+        }
+
+        if (state.thread_index() == 0) {
+            state.counters["contended"] = benchmark::Counter(static_cast<double>(lock.Contended()) / static_cast<double>(lock.Acquired() + 1));
+            state.counters["parked"] = benchmark::Counter(static_cast<double>(lock.Parked()) / static_cast<double>(lock.Acquired() + 1));
+        }
+    }
+
+    BENCHMARK_TEMPLATE(LockLookup, Core::CriticalSection)->Name("LockLookup/CriticalSection")->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(LockLookup, Core::AdaptiveCriticalSection)->Name("LockLookup/AdaptiveCriticalSection")->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(LockCounter, Core::CriticalSection)->Name("LockCounter/CriticalSection")->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(LockCounter, Core::AdaptiveCriticalSection)->Name("LockCounter/AdaptiveCriticalSection")->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK(AdaptiveStatistics)->ThreadRange(2, 8)->UseRealTime();
+
+    // Mostly readers, one in 16 writes.
+    template <typename LOCK>
+    static void ReadMostly(benchmark::State& state)
+    {
+        static LOCK lock;
+        static uint32_t value = 0;
+        uint32_t loop = state.thread_index();
+
+        for (auto _ : state) {
+            if ((++loop & 0xF) == 0) {
+                lock.WriteLock();
+                value++;
+                lock.WriteUnlock();
+            } else {
+                lock.ReadLock();
+                benchmark::DoNotOptimize(value);
+                lock.ReadUnlock();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_TEMPLATE(ReadMostly, Core::ReadWriteLock)->Name("ReadMostly/ReadWriteLock")->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(ReadMostly, Core::AdaptiveReadWriteLock)->Name("ReadMostly/AdaptiveReadWriteLock")->ThreadRange(1, 8)->UseRealTime();
+
+} // Benchmarks
+} // WPEFramework
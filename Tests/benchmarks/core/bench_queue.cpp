@@ -0,0 +1,91 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    class Job : public Core::IDispatch {
+    public:
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        Job() = default;
+        ~Job() override = default;
+
+        void Dispatch() override
+        {
+        }
+    };
+
+    // Every benchmark thread posts a job and extracts one, so all threads
+    // are both producer and consumer, like Minions fed by JSON-RPC requests.
+    template <typename QUEUE>
+    class Contention {
+    public:
+        Contention(const Contention<QUEUE>&) = delete;
+        Contention<QUEUE>& operator=(const Contention<QUEUE>&) = delete;
+
+        Contention() = delete;
+
+        static void Setup(const benchmark::State&)
+        {
+            _queue = new QUEUE(64);
+            _job = Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Job>::Create());
+        }
+        static void Teardown(const benchmark::State&)
+        {
+            _job.Release();
+            delete _queue;
+            _queue = nullptr;
+        }
+        static void Run(benchmark::State& state)
+        {
+            Core::ProxyType<Core::IDispatch> job;
+
+            for (auto _ : state) {
+                _queue->Insert(_job, Core::infinite);
+                _queue->Extract(job, Core::infinite);
+            }
+
+            job.Release();
+
+            state.SetItemsProcessed(state.iterations());
+        }
+
+    private:
+        static QUEUE* _queue;
+        static Core::ProxyType<Core::IDispatch> _job;
+    };
+
+    template <typename QUEUE>
+    QUEUE* Contention<QUEUE>::_queue = nullptr;
+    template <typename QUEUE>
+    Core::ProxyType<Core::IDispatch> Contention<QUEUE>::_job;
+
+    typedef Contention<Core::QueueType<Core::ProxyType<Core::IDispatch>>> ListQueue;
+    typedef Contention<Core::RingQueueType<Core::ProxyType<Core::IDispatch>>> RingQueue;
+
+    BENCHMARK(ListQueue::Run)->Name("QueueType")->ThreadRange(1, 16)->UseRealTime()->Setup(ListQueue::Setup)->Teardown(ListQueue::Teardown);
+    BENCHMARK(RingQueue::Run)->Name("RingQueueType")->ThreadRange(1, 16)->UseRealTime()->Setup(RingQueue::Setup)->Teardown(RingQueue::Teardown);
+
+} // Benchmarks
+} // WPEFramework
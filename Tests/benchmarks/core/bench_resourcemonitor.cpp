@@ -0,0 +1,195 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    typedef Core::ResourceMonitorType<Core::IResource, Core::Void> Monitor;
+
+    // A descriptor that is monitored but never becomes ready, like a quiet WebSocket.
+    class Idle : public Core::IResource {
+    public:
+        Idle(const Idle&) = delete;
+        Idle& operator=(const Idle&) = delete;
+
+        Idle()
+            : _descriptor(::eventfd(0, EFD_NONBLOCK))
+        {
+        }
+        ~Idle() override
+        {
+            ::close(_descriptor);
+        }
+
+    public:
+        handle Descriptor() const override
+        {
+            return (_descriptor);
+        }
+        uint16_t Events() override
+        {
+            return (POLLIN);
+        }
+        void Handle(const uint16_t) override
+        {
+        }
+
+    private:
+        int _descriptor;
+    };
+
+    // Echoes a single byte back to the sender, one round trip is one monitor event.
+    class Echo : public Core::IResource {
+    public:
+        Echo(const Echo&) = delete;
+        Echo& operator=(const Echo&) = delete;
+
+        Echo()
+        {
+            ::socketpair(AF_UNIX, SOCK_STREAM, 0, _descriptors);
+            ::fcntl(_descriptors[0], F_SETFL, O_NONBLOCK);
+        }
+        ~Echo() override
+        {
+            ::close(_descriptors[0]);
+            ::close(_descriptors[1]);
+        }
+
+    public:
+        void RoundTrip()
+        {
+            uint8_t value = 0x55;
+            ::write(_descriptors[1], &value, sizeof(value));
+            ::read(_descriptors[1], &value, sizeof(value));
+        }
+
+        handle Descriptor() const override
+        {
+            return (_descriptors[0]);
+        }
+        uint16_t Events() override
+        {
+            return (POLLIN);
+        }
+        void Handle(const uint16_t events) override
+        {
+            if ((events & POLLIN) != 0) {
+                uint8_t value;
+                if (::read(_descriptors[0], &value, sizeof(value)) == sizeof(value)) {
+                    ::write(_descriptors[0], &value, sizeof(value));
+                }
+            }
+        }
+
+    private:
+        int _descriptors[2];
+    };
+
+    static void ResourceMonitorEvent(benchmark::State& state, const Monitor::engine type)
+    {
+        const uint32_t idleCount = static_cast<uint32_t>(state.range(0));
+
+        Monitor monitor(type);
+        std::vector<Idle*> idle;
+        Echo echo;
+
+        for (uint32_t index = 0; index < idleCount; index++) {
+            idle.push_back(new Idle());
+            monitor.Register(*idle.back());
+        }
+        monitor.Register(echo);
+
+        // Settle the registrations before measuring.
+        for (uint32_t index = 0; index < 16; index++) {
+            echo.RoundTrip();
+        }
+
+        for (auto _ : state) {
+            echo.RoundTrip();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        monitor.Unregister(echo);
+        for (Idle* entry : idle) {
+            monitor.Unregister(*entry);
+        }
+        monitor.Break();
+        while (monitor.Count() != 0) {
+            SleepMs(1);
+        }
+        for (Idle* entry : idle) {
+            delete entry;
+        }
+    }
+
+    static void ResourceMonitorPoll(benchmark::State& state)
+    {
+        ResourceMonitorEvent(state, Monitor::POLL);
+    }
+
+    static void ResourceMonitorEpoll(benchmark::State& state)
+    {
+        ResourceMonitorEvent(state, Monitor::EPOLL);
+    }
+
+    BENCHMARK(ResourceMonitorPoll)->Arg(10)->Arg(100)->Arg(1000)->UseRealTime();
+    BENCHMARK(ResourceMonitorEpoll)->Arg(10)->Arg(100)->Arg(1000)->UseRealTime();
+
+    static void ReactorSetup(const benchmark::State& state)
+    {
+        Core::ResourceMonitor::Instance().Reactors(static_cast<uint8_t>(state.range(0)));
+    }
+
+    static void ReactorTeardown(const benchmark::State&)
+    {
+        Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
+
+        monitor.Break();
+        while (monitor.Count() != 0) {
+            SleepMs(1);
+        }
+    }
+
+    // Every benchmark thread is a busy channel, see how the round trips scale with the reactors.
+    static void ResourceMonitorReactors(benchmark::State& state)
+    {
+        Echo echo;
+
+        Core::ResourceMonitor::Instance().Register(echo);
+
+        for (auto _ : state) {
+            echo.RoundTrip();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        Core::ResourceMonitor::Instance().Unregister(echo);
+    }
+
+    BENCHMARK(ResourceMonitorReactors)->Arg(1)->Arg(2)->Arg(4)->Threads(8)->UseRealTime()->Setup(ReactorSetup)->Teardown(ReactorTeardown);
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,119 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+#include <com/Administrator.h>
+#include <com/IUnknown.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    struct ICounter : virtual public Core::IUnknown {
+        enum { ID = 0x0000FF01 };
+
+        virtual uint32_t Value() const = 0;
+    };
+
+    // Never called, the channel it is on is never opened.
+    class CounterProxy : public ProxyStub::UnknownProxyType<ICounter> {
+    public:
+        CounterProxy(const Core::ProxyType<Core::IPCChannel>& channel, const RPC::instance_id& implementation, const bool outbound)
+            : BaseClass(channel, implementation, outbound)
+        {
+        }
+        ~CounterProxy() override
+        {
+        }
+
+    public:
+        uint32_t Value() const override
+        {
+            return (0);
+        }
+    };
+
+    static ProxyStub::MethodHandler CounterStubMethods[] = {
+        nullptr
+    };
+
+    typedef ProxyStub::UnknownStubType<ICounter, CounterStubMethods> CounterStub;
+
+    static constexpr uint32_t Proxies = 256;
+
+    static Core::ProxyType<Core::IPCChannel> _channel;
+    static ProxyStub::UnknownProxy* _proxies[Proxies];
+
+    static RPC::instance_id Implementation(const uint32_t index)
+    {
+        return (static_cast<RPC::instance_id>(0x10000 + (index * 64)));
+    }
+
+    // Threads that all get proxies handed out for interfaces that pass over the same channel, like
+    // the stubs of a busy plugin do on every call with an interface in it.
+    static void RPCProxyInstance(benchmark::State& state)
+    {
+        RPC::Administrator& administrator(RPC::Administrator::Instance());
+
+        if (state.thread_index() == 0) {
+            administrator.Announce<ICounter, CounterProxy, CounterStub>();
+
+            _channel = Core::ProxyType<Core::IPCChannel>(Core::ProxyType<Core::IPCChannelClientType<Core::Void, false, true>>::Create(Core::NodeId(_T("/tmp/benchmark_rpcadministrator")), 1024));
+
+            for (uint32_t index = 0; index < Proxies; index++) {
+                ICounter* counter = nullptr;
+                _proxies[index] = administrator.ProxyInstance(_channel, Implementation(index), false, counter);
+            }
+        }
+
+        uint32_t index = static_cast<uint32_t>(state.thread_index()) * 37;
+
+        for (auto _ : state) {
+            void* counter = nullptr;
+
+            index = (index + 1) % Proxies;
+
+            if (administrator.ProxyInstance(_channel, Implementation(index), true, ICounter::ID, counter) == nullptr) {
+                state.SkipWithError("No proxy");
+                break;
+            }
+
+            static_cast<ICounter*>(counter)->Release();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0) {
+            for (uint32_t index = 0; index < Proxies; index++) {
+                if (_proxies[index] != nullptr) {
+                    _proxies[index]->Parent()->Release();
+                    _proxies[index] = nullptr;
+                }
+            }
+
+            _channel.Release();
+
+            administrator.Recall<ICounter>();
+        }
+    }
+
+    BENCHMARK(RPCProxyInstance)->ThreadRange(1, 8)->UseRealTime();
+
+} // Benchmarks
+} // WPEFramework
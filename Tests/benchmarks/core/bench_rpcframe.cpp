@@ -0,0 +1,78 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+#include <com/Messages.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // A buffer parameter written by the proxy, moved over in the pieces the channel would use, and
+    // read by the stub: inside the frame as it was, or as a stream next to it. The messages are
+    // serialized through the interface, like the channel does.
+    template <const bool STREAM>
+    static void RPCBufferParameter(benchmark::State& state)
+    {
+        const uint32_t size = static_cast<uint32_t>(state.range(0));
+        std::vector<uint8_t> parameter(size, 0x55);
+        uint8_t line[1024];
+
+        for (auto _ : state) {
+            Core::ProxyType<RPC::InvokeMessage> sent(Core::ProxyType<RPC::InvokeMessage>::Create());
+            Core::ProxyType<RPC::InvokeMessage> received(Core::ProxyType<RPC::InvokeMessage>::Create());
+
+            sent->Parameters().Set(1, 2, 3);
+            RPC::Data::Frame::Writer writer(sent->Parameters().Writer());
+
+            if (STREAM == true) {
+                writer.Stream(size, parameter.data());
+            } else {
+                writer.Buffer<uint16_t>(static_cast<uint16_t>(size), parameter.data());
+            }
+
+            Core::ProxyType<Core::IMessage> source(sent->IParameters());
+            Core::ProxyType<Core::IMessage> destination(received->IParameters());
+            uint32_t offset = 0;
+
+            while (offset < source->Length()) {
+                const uint16_t loaded = source->Serialize(line, sizeof(line), offset);
+                destination->Deserialize(line, loaded, offset);
+                offset += loaded;
+            }
+
+            const uint8_t* buffer = nullptr;
+            RPC::Data::Frame::Reader reader(received->Parameters().Reader());
+
+            if (STREAM == true) {
+                benchmark::DoNotOptimize(reader.Stream(buffer));
+            } else {
+                benchmark::DoNotOptimize(reader.LockBuffer<uint16_t>(buffer));
+            }
+            benchmark::DoNotOptimize(buffer);
+        }
+
+        state.SetBytesProcessed(state.iterations() * size);
+    }
+
+    BENCHMARK_TEMPLATE(RPCBufferParameter, false)->Name("RPCBufferParameter/Frame")->Arg(4096)->Arg(16384)->Arg(60000);
+    BENCHMARK_TEMPLATE(RPCBufferParameter, true)->Name("RPCBufferParameter/Stream")->Arg(4096)->Arg(16384)->Arg(60000)->Arg(1 << 20)->Arg(4 << 20);
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,134 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // What the other side does with a sample, like a decrypt: a pass over it, in place.
+    static void Handle(uint8_t data[], const uint32_t length)
+    {
+        uint64_t* words = reinterpret_cast<uint64_t*>(data);
+
+        for (uint32_t index = 0; index < (length / sizeof(uint64_t)); index++) {
+            words[index] ^= 0x5555555555555555ULL;
+        }
+    }
+
+    // A sample is copied in, handled by the other side, and copied out again. One at a time,
+    // like the OCDM DataExchange does it.
+    static void SharedBufferRoundTrip(benchmark::State& state)
+    {
+        const uint32_t length = static_cast<uint32_t>(state.range(0));
+        const string name(_T("/tmp/benchmark_sharedbuffer"));
+        std::vector<uint8_t> sample(length, 0xAA);
+        std::vector<uint8_t> result(length);
+
+        Core::SharedBuffer producer(name.c_str(), Core::File::USER_READ | Core::File::USER_WRITE, length, 0);
+        Core::SharedBuffer consumer(name.c_str());
+        std::atomic<bool> running(true);
+
+        std::thread other([&consumer, &running]() {
+            while (running == true) {
+                if (consumer.RequestConsume(100) == Core::ERROR_NONE) {
+                    Handle(consumer.Buffer(), static_cast<uint32_t>(consumer.Size()));
+                    consumer.Consumed();
+                }
+            }
+        });
+
+        producer.RequestProduce(Core::infinite);
+
+        for (auto _ : state) {
+            ::memcpy(producer.Buffer(), sample.data(), length);
+            producer.Produced();
+
+            producer.RequestProduce(Core::infinite);
+            ::memcpy(result.data(), producer.Buffer(), length);
+        }
+
+        running = false;
+        other.join();
+
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * length);
+    }
+
+    // The same, with a number of samples on their way at the same time.
+    static void SharedSlotBufferPipelined(benchmark::State& state)
+    {
+        const uint32_t length = static_cast<uint32_t>(state.range(0));
+        const uint16_t slots = static_cast<uint16_t>(state.range(1));
+        const string name(_T("/tmp/benchmark_sharedslotbuffer"));
+        std::vector<uint8_t> sample(length, 0xAA);
+        std::vector<uint8_t> result(length);
+
+        Core::SharedSlotBuffer producer(name.c_str(), Core::File::USER_READ | Core::File::USER_WRITE, slots, length, 0);
+        Core::SharedSlotBuffer consumer(name.c_str());
+        std::atomic<bool> running(true);
+
+        std::thread other([&consumer, &running]() {
+            uint16_t slot;
+
+            while (running == true) {
+                if (consumer.RequestConsume(100, slot) == Core::ERROR_NONE) {
+                    Handle(consumer.Buffer(slot), consumer.Length(slot));
+                    consumer.Consumed(slot);
+                }
+            }
+        });
+
+        for (auto _ : state) {
+            uint16_t slot;
+
+            if (producer.Pending() == slots) {
+                producer.RequestResult(Core::infinite, slot);
+                ::memcpy(result.data(), producer.Buffer(slot), producer.Length(slot));
+                producer.Released(slot);
+            }
+
+            producer.RequestProduce(Core::infinite, slot);
+            ::memcpy(producer.Buffer(slot), sample.data(), length);
+            producer.Length(slot, length);
+            producer.Produced(slot);
+        }
+
+        while (producer.Pending() != 0) {
+            uint16_t slot;
+
+            producer.RequestResult(Core::infinite, slot);
+            producer.Released(slot);
+        }
+
+        running = false;
+        other.join();
+
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * length);
+    }
+
+    BENCHMARK(SharedBufferRoundTrip)->Arg(16 * 1024)->Arg(1024 * 1024)->UseRealTime();
+    BENCHMARK(SharedSlotBufferPipelined)->Args({ 16 * 1024, 1 })->Args({ 16 * 1024, 4 })->Args({ 1024 * 1024, 1 })->Args({ 1024 * 1024, 4 })->UseRealTime();
+
+} // Benchmarks
+} // WPEFramework
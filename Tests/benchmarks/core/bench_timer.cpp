@@ -0,0 +1,109 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    // A per connection timeout, like the WorkerPool and JSONRPC link timers.
+    class Timeout {
+    public:
+        Timeout& operator=(const Timeout&) = delete;
+
+        Timeout(const uint32_t id)
+            : _id(id)
+        {
+        }
+        Timeout(const Timeout& copy)
+            : _id(copy._id)
+        {
+        }
+
+    public:
+        bool operator==(const Timeout& rhs) const
+        {
+            return (rhs._id == _id);
+        }
+        bool operator!=(const Timeout& rhs) const
+        {
+            return (!operator==(rhs));
+        }
+        uint64_t Timed(const uint64_t)
+        {
+            return (0);
+        }
+
+    private:
+        uint32_t _id;
+    };
+
+    class IndexedTimeout : public Timeout {
+    public:
+        IndexedTimeout(const uint32_t id)
+            : Timeout(id)
+            , _id(id)
+        {
+        }
+        IndexedTimeout(const IndexedTimeout& copy)
+            : Timeout(copy)
+            , _id(copy._id)
+        {
+        }
+
+    public:
+        uint64_t Hash() const
+        {
+            return (_id);
+        }
+
+    private:
+        uint32_t _id;
+    };
+
+    // Keep the given number of timers pending (an hour from now, spread over
+    // a minute) and measure scheduling and revoking one more in between.
+    template <typename TIMER, typename CONTENT>
+    static void TimerScheduleRevoke(benchmark::State& state)
+    {
+        const uint32_t pending = static_cast<uint32_t>(state.range(0));
+        const uint64_t base = Core::Time::Now().Add(60 * 60 * 1000).Ticks();
+        TIMER timer(Core::Thread::DefaultStackSize(), _T("BenchmarkTimer"));
+
+        for (uint32_t index = 0; index < pending; index++) {
+            timer.Schedule(base + ((index * 7919) % 60000) * Core::Time::TicksPerMillisecond, CONTENT(index));
+        }
+
+        uint32_t id = pending;
+        for (auto _ : state) {
+            timer.Schedule(base + (30000 * Core::Time::TicksPerMillisecond), CONTENT(id));
+            timer.Revoke(CONTENT(id));
+            id++;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_TEMPLATE(TimerScheduleRevoke, Core::TimerType<Timeout, Core::TimerListType>, Timeout)->Name("TimerList")->Arg(100)->Arg(10000);
+    BENCHMARK_TEMPLATE(TimerScheduleRevoke, Core::TimerType<Timeout>, Timeout)->Name("TimerHeap")->Arg(100)->Arg(10000);
+    BENCHMARK_TEMPLATE(TimerScheduleRevoke, Core::TimerType<IndexedTimeout>, IndexedTimeout)->Name("TimerHeapIndexed")->Arg(100)->Arg(10000);
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,125 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <core/core.h>
+#include <tracing/tracing.h>
+
+namespace WPEFramework {
+namespace Benchmarks {
+
+    class Record : public Trace::ITrace {
+    public:
+        Record() = delete;
+        Record(const Record&) = delete;
+        Record& operator=(const Record&) = delete;
+
+        Record(const char data[], const uint16_t length)
+            : _data(data)
+            , _length(length)
+        {
+        }
+        ~Record() = default;
+
+    public:
+        const char* Category() const override
+        {
+            return (_T("Information"));
+        }
+        const char* Module() const override
+        {
+            return (_T("Benchmarks"));
+        }
+        const char* Data() const override
+        {
+            return (_data);
+        }
+        uint16_t Length() const override
+        {
+            return (_length);
+        }
+
+    private:
+        const char* _data;
+        const uint16_t _length;
+    };
+
+    static const TCHAR TraceText[] = _T("Connection 0x1234 on [127.0.0.1:8080] switched to state Active after 12 ms");
+    static const TCHAR TraceFormat[] = _T("Connection %p on [%s:%d] switched to state %s after %u ms");
+    static const TCHAR TracePath[] = _T("/tmp/benchmark_tracing/");
+
+    // Threads tracing into the trace buffer of the process, nobody reading it, so it runs in
+    // overwrite mode, like it does when the TraceControl plugin can not keep up.
+    static void TraceRecords(benchmark::State& state)
+    {
+        if (state.thread_index() == 0) {
+            Core::Directory(TracePath).CreatePath();
+            Trace::TraceUnit::Instance().Open(TracePath);
+        }
+
+        Record record(TraceText, sizeof(TraceText) - 1);
+
+        for (auto _ : state) {
+            Trace::TraceUnit::Instance().Trace(__FILE__, __LINE__, "Benchmarks::TraceRecords", &record);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0) {
+            Trace::TraceUnit::Instance().Close();
+        }
+    }
+
+    BENCHMARK(TraceRecords)->ThreadRange(1, 8)->UseRealTime();
+
+    // What a trace costs at the call site: formatted there, or the arguments as they are.
+    template <const bool BINARY>
+    static void TraceOverhead(benchmark::State& state)
+    {
+        const void* connection = reinterpret_cast<const void*>(0x1234);
+        const string address(_T("127.0.0.1"));
+        uint32_t elapsed = 0;
+
+        Core::Directory(TracePath).CreatePath();
+        Trace::TraceUnit::Instance().Open(TracePath);
+
+        const uint32_t id = Trace::TraceUnit::Instance().Format(TraceFormat);
+
+        for (auto _ : state) {
+            if (BINARY == true) {
+                Trace::Binary data(id, connection, address, 8080, _T("Active"), ++elapsed);
+                Record record(data.Data(), data.Length());
+                Trace::TraceUnit::Instance().Trace(__FILE__, __LINE__, "Benchmarks::TraceOverhead", &record);
+            } else {
+                Trace::Text data(TraceFormat, connection, address.c_str(), 8080, _T("Active"), ++elapsed);
+                Record record(data.Data(), data.Length());
+                Trace::TraceUnit::Instance().Trace(__FILE__, __LINE__, "Benchmarks::TraceOverhead", &record);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        Trace::TraceUnit::Instance().Close();
+    }
+
+    BENCHMARK_TEMPLATE(TraceOverhead, false)->Name("TraceOverhead/Text");
+    BENCHMARK_TEMPLATE(TraceOverhead, true)->Name("TraceOverhead/Binary");
+
+} // Benchmarks
+} // WPEFramework
@@ -0,0 +1,354 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <cryptalgo/cryptalgo.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Known answers of FIPS-197 (appendix C), SP 800-38A (appendix F) and the GCM specification
+    // (McGrew and Viega, appendix B). Every test runs with the tables and, if the CPU has them,
+    // with the AES instructions.
+    static std::vector<uint8_t> Hex(const char text[])
+    {
+        std::vector<uint8_t> result;
+
+        for (uint32_t index = 0; (text[index] != '\0') && (text[index + 1] != '\0'); index += 2) {
+            result.push_back(static_cast<uint8_t>(std::stoul(std::string(&text[index], 2), nullptr, 16)));
+        }
+
+        return (result);
+    }
+
+    static std::vector<Crypto::aesEngine> Engines()
+    {
+        std::vector<Crypto::aesEngine> engines;
+
+        engines.push_back(Crypto::AESEngine(false));
+
+        if (Crypto::AESEngine(true) != Crypto::AES_ENGINE_TABLES) {
+            engines.push_back(Crypto::AESEngine());
+        }
+
+        return (engines);
+    }
+
+    static void Engine(const Crypto::aesEngine engine)
+    {
+        EXPECT_EQ(Crypto::AESEngine(engine != Crypto::AES_ENGINE_TABLES), engine);
+    }
+
+    static const char Plain[] = "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+                                "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+
+    TEST(Cryptalgo_AES, ECB)
+    {
+        const char* keys[] = { "000102030405060708090a0b0c0d0e0f",
+            "000102030405060708090a0b0c0d0e0f1011121314151617",
+            "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f" };
+        const char* ciphers[] = { "69c4e0d86a7b0430d8cdb78070b4c55a",
+            "dda97ca4864cdfe06eaf70a0ec0d7191",
+            "8ea2b7ca516745bfeafc49904b496089" };
+        const std::vector<uint8_t> plain(Hex("00112233445566778899aabbccddeeff"));
+
+        for (const Crypto::aesEngine engine : Engines()) {
+            Engine(engine);
+
+            for (uint8_t test = 0; test < 3; test++) {
+                const std::vector<uint8_t> key(Hex(keys[test]));
+                Crypto::AESEncryption encryption(Crypto::AES_ECB);
+                Crypto::AESDecryption decryption(Crypto::AES_ECB);
+                uint8_t cipher[16];
+                uint8_t result[16];
+
+                EXPECT_EQ(encryption.Key(static_cast<uint8_t>(key.size()), key.data()), Core::ERROR_NONE);
+                EXPECT_EQ(decryption.Key(static_cast<uint8_t>(key.size()), key.data()), Core::ERROR_NONE);
+
+                encryption.Encrypt(sizeof(cipher), plain.data(), cipher);
+                EXPECT_EQ(std::vector<uint8_t>(cipher, cipher + sizeof(cipher)), Hex(ciphers[test])) << "engine " << static_cast<int>(engine) << ", key " << key.size();
+
+                decryption.Decrypt(sizeof(cipher), cipher, result);
+                EXPECT_EQ(std::vector<uint8_t>(result, result + sizeof(result)), plain);
+            }
+        }
+
+        Crypto::AESEngine(true);
+    }
+
+    TEST(Cryptalgo_AES, CBC)
+    {
+        const std::vector<uint8_t> key(Hex("2b7e151628aed2a6abf7158809cf4f3c"));
+        const std::vector<uint8_t> iv(Hex("000102030405060708090a0b0c0d0e0f"));
+        const std::vector<uint8_t> plain(Hex(Plain));
+        const std::vector<uint8_t> expected(Hex("7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2"
+                                                "73bed6b8e3c1743b7116e69e222295163ff1caa1681fac09120eca307586e1a7"));
+
+        for (const Crypto::aesEngine engine : Engines()) {
+            Engine(engine);
+
+            Crypto::AESEncryption encryption(Crypto::AES_CBC);
+            Crypto::AESDecryption decryption(Crypto::AES_CBC);
+            std::vector<uint8_t> cipher(plain.size());
+            std::vector<uint8_t> result(plain.size());
+
+            encryption.Key(static_cast<uint8_t>(key.size()), key.data());
+            encryption.InitialVector(iv.data());
+            encryption.Encrypt(static_cast<uint32_t>(plain.size()), plain.data(), cipher.data());
+            EXPECT_EQ(cipher, expected);
+
+            decryption.Key(static_cast<uint8_t>(key.size()), key.data());
+            decryption.InitialVector(iv.data());
+            decryption.Decrypt(static_cast<uint32_t>(cipher.size()), cipher.data(), result.data());
+            EXPECT_EQ(result, plain);
+
+            // In place, and in two parts: the IV carries the chain.
+            decryption.InitialVector(iv.data());
+            decryption.Decrypt(16, cipher.data(), cipher.data());
+            decryption.Decrypt(48, &(cipher[16]), &(cipher[16]));
+            EXPECT_EQ(cipher, plain);
+        }
+
+        Crypto::AESEngine(true);
+    }
+
+    TEST(Cryptalgo_AES, CTR)
+    {
+        const char* keys[] = { "2b7e151628aed2a6abf7158809cf4f3c",
+            "8e73b0f7da0e6452c810f32b809079e562f8ead2522c6b7b",
+            "603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4" };
+        const char* ciphers[] = { "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+                                  "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee",
+            "1abc932417521ca24f2b0459fe7e6e0b090339ec0aa6faefd5ccc2c6f4ce8e94"
+            "1e36b26bd1ebc670d1bd1d665620abf74f78a7f6d29809585a97daec58c6b050",
+            "601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c5"
+            "2b0930daa23de94ce87017ba2d84988ddfc9c58db67aada613c2dd08457941a6" };
+        const std::vector<uint8_t> counter(Hex("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"));
+        const std::vector<uint8_t> plain(Hex(Plain));
+
+        for (const Crypto::aesEngine engine : Engines()) {
+            Engine(engine);
+
+            for (uint8_t test = 0; test < 3; test++) {
+                const std::vector<uint8_t> key(Hex(keys[test]));
+                const std::vector<uint8_t> expected(Hex(ciphers[test]));
+                Crypto::AESEncryption encryption(Crypto::AES_CTR);
+                Crypto::AESDecryption decryption(Crypto::AES_CTR);
+                std::vector<uint8_t> cipher(plain.size());
+                std::vector<uint8_t> result(plain.size());
+
+                encryption.Key(static_cast<uint8_t>(key.size()), key.data());
+                encryption.InitialVector(counter.data());
+                EXPECT_EQ(encryption.Encrypt(static_cast<uint32_t>(plain.size()), plain.data(), cipher.data()), Core::ERROR_NONE);
+                EXPECT_EQ(cipher, expected);
+
+                // A stream: any split gives the same result.
+                decryption.Key(static_cast<uint8_t>(key.size()), key.data());
+                decryption.InitialVector(counter.data());
+                decryption.Decrypt(5, &(cipher[0]), &(result[0]));
+                decryption.Decrypt(11, &(cipher[5]), &(result[5]));
+                decryption.Decrypt(37, &(cipher[16]), &(result[16]));
+                decryption.Decrypt(11, &(cipher[53]), &(result[53]));
+                EXPECT_EQ(result, plain);
+            }
+        }
+
+        Crypto::AESEngine(true);
+    }
+
+    struct GCMVector {
+        const char* key;
+        const char* iv;
+        const char* aad;
+        const char* plain;
+        const char* cipher;
+        const char* tag;
+    };
+
+    static const char GCMKey[] = "feffe9928665731c6d6a8f9467308308";
+    static const char GCMPlain[] = "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+                                   "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39";
+    static const char GCMAAD[] = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+
+    static const GCMVector GCMVectors[] = {
+        // Test case 1
+        { "00000000000000000000000000000000", "000000000000000000000000", "", "", "",
+            "58e2fccefa7e3061367f1d57a4e7455a" },
+        // Test case 2
+        { "00000000000000000000000000000000", "000000000000000000000000", "",
+            "00000000000000000000000000000000", "0388dace60b6a392f328c2b971b2fe78",
+            "ab6e47d42cec13bdf53a67b21257bddf" },
+        // Test case 3
+        { GCMKey, "cafebabefacedbaddecaf888", "",
+            "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+            "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255",
+            "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+            "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985",
+            "4d5c2af327cd64a62cf35abd2ba6fab4" },
+        // Test case 4
+        { GCMKey, "cafebabefacedbaddecaf888", GCMAAD, GCMPlain,
+            "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+            "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+            "5bc94fbc3221a5db94fae95ae7121a47" },
+        // Test case 5, a short IV
+        { GCMKey, "cafebabefacedbad", GCMAAD, GCMPlain,
+            "61353b4c2806934a777ff51fa22a4755699b2a714fcdc6f83766e5f97b6c7423"
+            "73806900e49f24b22b097544d4896b424989b5e1ebac0f07c23f4598",
+            "3612d2e79e3b0785561be14aaca2fccb" },
+        // Test case 6, a long IV
+        { GCMKey,
+            "9313225df88406e555909c5aff5269aa6a7a9538534f7da1e4c303d2a318a728"
+            "c3c0c95156809539fcf0e2429a6b525416aedbf5a0de6a57a637b39b",
+            GCMAAD, GCMPlain,
+            "8ce24998625615b603a033aca13fb894be9112a5c3a211a8ba262a3cca7e2ca7"
+            "01e4a9a4fba43c90ccdcb281d48c7c6fd62875d2aca417034c34aee5",
+            "619cc5aefffe0bfa462af43c1699d050" },
+        // Test case 13
+        { "0000000000000000000000000000000000000000000000000000000000000000",
+            "000000000000000000000000", "", "", "",
+            "530f8afbc74536b9a963b4f1c4cb738b" },
+        // Test case 14
+        { "0000000000000000000000000000000000000000000000000000000000000000",
+            "000000000000000000000000", "",
+            "00000000000000000000000000000000", "cea7403d4d606b6e074ec5d3baf39d18",
+            "d0d1c8a799996bf0265b98b5d48ab919" },
+        // Test case 16
+        { "feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308",
+            "cafebabefacedbaddecaf888", GCMAAD, GCMPlain,
+            "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+            "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662",
+            "76fc6ece0f4e1768cddf8853bb2d551b" }
+    };
+
+    TEST(Cryptalgo_AES, GCM)
+    {
+        for (const Crypto::aesEngine engine : Engines()) {
+            Engine(engine);
+
+            for (const GCMVector& test : GCMVectors) {
+                const std::vector<uint8_t> key(Hex(test.key));
+                const std::vector<uint8_t> iv(Hex(test.iv));
+                const std::vector<uint8_t> aad(Hex(test.aad));
+                const std::vector<uint8_t> plain(Hex(test.plain));
+                const std::vector<uint8_t> expected(Hex(test.cipher));
+                std::vector<uint8_t> cipher(plain.size() + 1);
+                std::vector<uint8_t> result(plain.size() + 1);
+                uint8_t tag[16];
+                Crypto::AESGCM gcm;
+
+                EXPECT_EQ(gcm.Key(static_cast<uint8_t>(key.size()), key.data()), Core::ERROR_NONE);
+                EXPECT_EQ(gcm.Encrypt(static_cast<uint8_t>(iv.size()), iv.data(), static_cast<uint32_t>(aad.size()), aad.data(),
+                              static_cast<uint32_t>(plain.size()), plain.data(), cipher.data(), tag),
+                    Core::ERROR_NONE);
+                cipher.resize(plain.size());
+                EXPECT_EQ(cipher, expected) << "engine " << static_cast<int>(engine) << ", " << test.cipher;
+                EXPECT_EQ(std::vector<uint8_t>(tag, tag + sizeof(tag)), Hex(test.tag)) << "engine " << static_cast<int>(engine) << ", " << test.tag;
+
+                EXPECT_EQ(gcm.Decrypt(static_cast<uint8_t>(iv.size()), iv.data(), static_cast<uint32_t>(aad.size()), aad.data(),
+                              static_cast<uint32_t>(cipher.size()), cipher.data(), result.data(), tag),
+                    Core::ERROR_NONE);
+                result.resize(plain.size());
+                EXPECT_EQ(result, plain);
+
+                // Any change, in the tag, the data or the additional data, is noticed.
+                tag[15] ^= 0x01;
+                EXPECT_EQ(gcm.Decrypt(static_cast<uint8_t>(iv.size()), iv.data(), static_cast<uint32_t>(aad.size()), aad.data(),
+                              static_cast<uint32_t>(cipher.size()), cipher.data(), result.data(), tag),
+                    Core::ERROR_INVALID_SIGNATURE);
+                EXPECT_EQ(result, std::vector<uint8_t>(plain.size(), 0));
+                tag[15] ^= 0x01;
+
+                if (cipher.empty() == false) {
+                    cipher[0] ^= 0x80;
+                    EXPECT_EQ(gcm.Decrypt(static_cast<uint8_t>(iv.size()), iv.data(), static_cast<uint32_t>(aad.size()), aad.data(),
+                                  static_cast<uint32_t>(cipher.size()), cipher.data(), result.data(), tag),
+                        Core::ERROR_INVALID_SIGNATURE);
+                }
+            }
+        }
+
+        Crypto::AESEngine(true);
+    }
+
+    // The instructions and the tables, on lengths that are no multiple of the block or the batch.
+    TEST(Cryptalgo_AES, Engines)
+    {
+        const std::vector<uint8_t> key(Hex("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4"));
+        const std::vector<uint8_t> iv(Hex("cafebabefacedbaddecaf888"));
+        uint8_t plain[1031];
+
+        for (uint32_t index = 0; index < sizeof(plain); index++) {
+            plain[index] = static_cast<uint8_t>((index * 131) + 7);
+        }
+
+        const std::vector<Crypto::aesEngine> engines(Engines());
+
+        for (const uint32_t length : { 1u, 15u, 16u, 17u, 127u, 128u, 129u, 300u, 1024u, 1031u }) {
+            std::vector<uint8_t> ctr[2], cbc[2], gcm[2];
+
+            for (uint8_t engine = 0; engine < engines.size(); engine++) {
+                Engine(engines[engine]);
+
+                Crypto::AESEncryption counter(Crypto::AES_CTR);
+                Crypto::AESEncryption chain(Crypto::AES_CBC);
+                Crypto::AESDecryption unchain(Crypto::AES_CBC);
+                Crypto::AESGCM authenticated;
+                uint8_t vector[16];
+                uint8_t tag[16];
+                const uint32_t blocks = (length / 16) * 16;
+
+                ::memset(vector, 0xA5, sizeof(vector));
+
+                ctr[engine].resize(length);
+                counter.Key(static_cast<uint8_t>(key.size()), key.data());
+                counter.InitialVector(vector);
+                counter.Encrypt(length, plain, ctr[engine].data());
+
+                cbc[engine].resize(blocks);
+                chain.Key(static_cast<uint8_t>(key.size()), key.data());
+                chain.InitialVector(vector);
+                chain.Encrypt(blocks, plain, cbc[engine].data());
+
+                std::vector<uint8_t> back(blocks);
+                unchain.Key(static_cast<uint8_t>(key.size()), key.data());
+                unchain.InitialVector(vector);
+                unchain.Decrypt(blocks, cbc[engine].data(), back.data());
+                EXPECT_EQ(back, std::vector<uint8_t>(plain, plain + blocks));
+
+                gcm[engine].resize(length);
+                authenticated.Key(static_cast<uint8_t>(key.size()), key.data());
+                authenticated.Encrypt(static_cast<uint8_t>(iv.size()), iv.data(), (length % 37), plain, length, plain, gcm[engine].data(), tag);
+                gcm[engine].insert(gcm[engine].end(), tag, tag + sizeof(tag));
+            }
+
+            if (engines.size() > 1) {
+                EXPECT_EQ(ctr[0], ctr[1]) << length;
+                EXPECT_EQ(cbc[0], cbc[1]) << length;
+                EXPECT_EQ(gcm[0], gcm[1]) << length;
+            }
+        }
+
+        Crypto::AESEngine(true);
+    }
+
+} // Tests
+} // WPEFramework
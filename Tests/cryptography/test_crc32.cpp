@@ -0,0 +1,158 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Every test runs with the table, the slicing tables and, if the CPU has it, carry-less multiply.
+    static std::vector<Core::crcEngine> Engines()
+    {
+        std::vector<Core::crcEngine> engines;
+
+        engines.push_back(Core::CRCEngine(Core::CRC_ENGINE_TABLE));
+        engines.push_back(Core::CRCEngine(Core::CRC_ENGINE_SLICING));
+
+        if (Core::CRCEngine(Core::CRC_ENGINE_CLMUL) == Core::CRC_ENGINE_CLMUL) {
+            engines.push_back(Core::CRC_ENGINE_CLMUL);
+        }
+
+        return (engines);
+    }
+
+    // Bit by bit, straight from the polynomial.
+    static uint32_t Reference(const uint8_t data[], const uint32_t length)
+    {
+        uint32_t crc = Core::CRC32Calculator::Initial;
+
+        for (uint32_t index = 0; index < length; index++) {
+            crc ^= (static_cast<uint32_t>(data[index]) << 24);
+
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                crc = ((crc & 0x80000000) != 0 ? ((crc << 1) ^ 0x04C11DB7) : (crc << 1));
+            }
+        }
+
+        return (crc);
+    }
+
+    static std::vector<uint8_t> Pattern(const uint32_t length)
+    {
+        std::vector<uint8_t> data(length);
+        uint32_t state = 0x12345678;
+
+        for (uint8_t& entry : data) {
+            state = (state * 1103515245) + 12345;
+            entry = static_cast<uint8_t>(state >> 16);
+        }
+
+        return (data);
+    }
+
+    TEST(Core_CRC32, KnownAnswer)
+    {
+        const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+        for (const Core::crcEngine engine : Engines()) {
+            EXPECT_EQ(Core::CRCEngine(engine), engine);
+            EXPECT_EQ(Core::CRC32Calculator::Calculate(Core::CRC32Calculator::Initial, check, sizeof(check)), 0x0376E6E7u);
+            EXPECT_EQ(Core::CRC32Calculator::Calculate(Core::CRC32Calculator::Initial, check, 0), Core::CRC32Calculator::Initial);
+        }
+
+        Core::CRCEngine(Core::CRC_ENGINE_CLMUL);
+    }
+
+    TEST(Core_CRC32, Lengths)
+    {
+        const std::vector<uint8_t> data = Pattern(5000 + 16);
+
+        for (const Core::crcEngine engine : Engines()) {
+            Core::CRCEngine(engine);
+
+            for (uint32_t length = 0; length <= 5000; length += (length < 300 ? 1 : 97)) {
+                // Misaligned starts as well, the wide loads must not care.
+                for (uint8_t offset = 0; offset < 8; offset += 3) {
+                    EXPECT_EQ(Core::CRC32Calculator::Calculate(Core::CRC32Calculator::Initial, &data[offset], length), Reference(&data[offset], length))
+                        << "engine " << static_cast<uint32_t>(engine) << " length " << length << " offset " << static_cast<uint32_t>(offset);
+                }
+            }
+        }
+
+        Core::CRCEngine(Core::CRC_ENGINE_CLMUL);
+    }
+
+    TEST(Core_CRC32, Streaming)
+    {
+        const std::vector<uint8_t> data = Pattern(4096);
+        const uint32_t expected = Reference(data.data(), static_cast<uint32_t>(data.size()));
+
+        for (const Core::crcEngine engine : Engines()) {
+            Core::CRCEngine(engine);
+
+            for (const uint32_t piece : { 1u, 7u, 64u, 188u, 1000u }) {
+                Core::CRC32Calculator calculator;
+
+                for (uint32_t offset = 0; offset < data.size(); offset += piece) {
+                    calculator.Input(&data[offset], std::min(piece, static_cast<uint32_t>(data.size() - offset)));
+                }
+
+                EXPECT_EQ(calculator.Result(), expected) << "engine " << static_cast<uint32_t>(engine) << " piece " << piece;
+
+                calculator.Reset();
+                EXPECT_EQ(calculator.Result(), Core::CRC32Calculator::Initial);
+            }
+        }
+
+        Core::CRCEngine(Core::CRC_ENGINE_CLMUL);
+    }
+
+    TEST(Core_CRC32, DataElement)
+    {
+        // A section with its CRC appended, most significant byte first, checks to 0.
+        std::vector<uint8_t> section = Pattern(1024);
+        section.resize(section.size() + 4);
+
+        for (const Core::crcEngine engine : Engines()) {
+            Core::CRCEngine(engine);
+
+            Core::DataElement element(section.size(), section.data());
+            const uint32_t crc = element.CRC32(0, section.size() - 4);
+
+            EXPECT_EQ(crc, Reference(section.data(), static_cast<uint32_t>(section.size() - 4)));
+
+            section[1024] = static_cast<uint8_t>(crc >> 24);
+            section[1025] = static_cast<uint8_t>(crc >> 16);
+            section[1026] = static_cast<uint8_t>(crc >> 8);
+            section[1027] = static_cast<uint8_t>(crc);
+
+            EXPECT_EQ(element.CRC32(0, section.size()), 0u);
+
+            // Continued over two parts of the element.
+            EXPECT_EQ(element.CRC32(100, section.size() - 100, element.CRC32(0, 100)), 0u);
+        }
+
+        Core::CRCEngine(Core::CRC_ENGINE_CLMUL);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,299 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <cryptalgo/cryptalgo.h>
+
+#include <vector>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Known answers of FIPS 180-2 (appendix B/C), RFC 2202 and RFC 4231. Every test runs with the
+    // portable code and, if the CPU allows it, with the multi-buffer lanes and the SHA instructions.
+    static std::vector<Crypto::hashEngine> Engines()
+    {
+        std::vector<Crypto::hashEngine> engines;
+
+        engines.push_back(Crypto::HashEngine(Crypto::HASH_ENGINE_PORTABLE));
+
+        if (Crypto::HashEngine(Crypto::HASH_ENGINE_MULTIBUFFER) == Crypto::HASH_ENGINE_MULTIBUFFER) {
+            engines.push_back(Crypto::HASH_ENGINE_MULTIBUFFER);
+        }
+
+        const Crypto::hashEngine best = Crypto::HashEngine(Crypto::HASH_ENGINE_ARMV8);
+
+        if (best > Crypto::HASH_ENGINE_MULTIBUFFER) {
+            engines.push_back(best);
+        }
+
+        return (engines);
+    }
+
+    static void Engine(const Crypto::hashEngine engine)
+    {
+        EXPECT_EQ(Crypto::HashEngine(engine), engine);
+    }
+
+    static string Hex(const uint8_t data[], const uint32_t length)
+    {
+        static const char digits[] = "0123456789abcdef";
+        string result;
+
+        for (uint32_t index = 0; index < length; index++) {
+            result += digits[data[index] >> 4];
+            result += digits[data[index] & 0xF];
+        }
+
+        return (result);
+    }
+
+    template <typename HASH>
+    static string Calculate(const string& message)
+    {
+        HASH hash;
+
+        hash.Input(reinterpret_cast<const uint8_t*>(message.data()), message.length());
+
+        return (Hex(hash.Result(), HASH::Length));
+    }
+
+    template <typename HMAC>
+    static string Calculate(const string& key, const string& message)
+    {
+        HMAC hmac(key);
+
+        hmac.Input(reinterpret_cast<const uint8_t*>(message.data()), message.length());
+
+        return (Hex(hmac.Result(), HMAC::Length));
+    }
+
+    static const char Message448[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    static const char Message896[] = "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+    TEST(Cryptalgo_Hash, KnownAnswers)
+    {
+        const string million(1000000, 'a');
+
+        for (const Crypto::hashEngine engine : Engines()) {
+            Engine(engine);
+
+            EXPECT_EQ(Calculate<Crypto::MD5>("abc"), "900150983cd24fb0d6963f7d28e17f72");
+            EXPECT_EQ(Calculate<Crypto::SHA1>("abc"), "a9993e364706816aba3e25717850c26c9cd0d89d");
+            EXPECT_EQ(Calculate<Crypto::SHA224>("abc"), "23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7");
+            EXPECT_EQ(Calculate<Crypto::SHA256>("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+            EXPECT_EQ(Calculate<Crypto::SHA384>("abc"), "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7");
+            EXPECT_EQ(Calculate<Crypto::SHA512>("abc"), "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+
+            EXPECT_EQ(Calculate<Crypto::SHA1>(""), "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+            EXPECT_EQ(Calculate<Crypto::SHA256>(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+            EXPECT_EQ(Calculate<Crypto::SHA1>(Message448), "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+            EXPECT_EQ(Calculate<Crypto::SHA224>(Message448), "75388b16512776cc5dba5da1fd890150b0c6455cb4f58b1952522525");
+            EXPECT_EQ(Calculate<Crypto::SHA256>(Message448), "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+            EXPECT_EQ(Calculate<Crypto::SHA384>(Message896), "09330c33f71147e83d192fc782cd1b4753111b173b3b05d22fa08086e3b0f712fcc7c71a557e2db966c3e9fa91746039");
+            EXPECT_EQ(Calculate<Crypto::SHA512>(Message896), "8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909");
+
+            // Well over the 64K the Input length used to be limited to.
+            EXPECT_EQ(Calculate<Crypto::MD5>(million), "7707d6ae4e027c70eea2a935c2296f21");
+            EXPECT_EQ(Calculate<Crypto::SHA1>(million), "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+            EXPECT_EQ(Calculate<Crypto::SHA256>(million), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+            EXPECT_EQ(Calculate<Crypto::SHA512>(million), "e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973ebde0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b");
+        }
+
+        Crypto::HashEngine(Crypto::HASH_ENGINE_ARMV8);
+    }
+
+    TEST(Cryptalgo_Hash, PiecesAndCopies)
+    {
+        std::vector<uint8_t> message(1000);
+
+        for (uint32_t index = 0; index < message.size(); index++) {
+            message[index] = static_cast<uint8_t>(index * 7);
+        }
+
+        for (const Crypto::hashEngine engine : Engines()) {
+            Engine(engine);
+
+            Crypto::SHA1 sha1(message.data(), message.size());
+            Crypto::SHA256 sha256(message.data(), message.size());
+            const string expected1(Hex(sha1.Result(), Crypto::SHA1::Length));
+            const string expected256(Hex(sha256.Result(), Crypto::SHA256::Length));
+
+            // In pieces that end in the middle of blocks, and on their edges.
+            for (const uint32_t step : { 1u, 13u, 63u, 64u, 65u, 200u }) {
+                Crypto::SHA1 pieces1;
+                Crypto::SHA256 pieces256;
+
+                for (uint32_t offset = 0; offset < message.size(); offset += step) {
+                    const uint32_t size = std::min(step, static_cast<uint32_t>(message.size() - offset));
+
+                    pieces1.Input(&message[offset], size);
+                    pieces256.Input(&message[offset], size);
+                }
+
+                EXPECT_EQ(Hex(pieces1.Result(), Crypto::SHA1::Length), expected1);
+                EXPECT_EQ(Hex(pieces256.Result(), Crypto::SHA256::Length), expected256);
+            }
+
+            // A copy carries on from where the original was.
+            Crypto::SHA1 first1(message.data(), 300);
+            Crypto::SHA256 first256(message.data(), 300);
+            Crypto::SHA1 copy1(first1);
+            Crypto::SHA256 copy256(first256);
+
+            copy1.Input(&message[300], message.size() - 300);
+            copy256.Input(&message[300], message.size() - 300);
+            first1.Input(&message[300], message.size() - 300);
+            first256.Input(&message[300], message.size() - 300);
+
+            EXPECT_EQ(Hex(copy1.Result(), Crypto::SHA1::Length), expected1);
+            EXPECT_EQ(Hex(copy256.Result(), Crypto::SHA256::Length), expected256);
+            EXPECT_EQ(Hex(first1.Result(), Crypto::SHA1::Length), expected1);
+            EXPECT_EQ(Hex(first256.Result(), Crypto::SHA256::Length), expected256);
+        }
+
+        Crypto::HashEngine(Crypto::HASH_ENGINE_ARMV8);
+    }
+
+    TEST(Cryptalgo_Hash, HMAC)
+    {
+        const string keys[] = { string(20, '\x0b'), "Jefe", string(131, '\xaa') };
+        const string messages[] = { "Hi There", "what do ya want for nothing?", "Test Using Larger Than Block-Size Key - Hash Key First" };
+        const char* md5[] = { "5ccec34ea9656392457fa1ac27f08fbc", "750c783e6ab0b503eaa86e310a5db738", "bfecaf4efff90a3a668f3922fec3762d" };
+        const char* sha1[] = { "b617318655057264e28bc0b6fb378c8ef146be00", "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79", "90d0dace1c1bdc957339307803160335bde6df2b" };
+        const char* sha224[] = { "896fb1128abbdf196832107cd49df33f47b4b1169912ba4f53684b22", "a30e01098bc6dbbf45690f3a7e9e6d0f8bbea2a39e6148008fd05e44", "95e9a0db962095adaebe9b2d6f0dbce2d499f112f2d2b7273fa6870e" };
+        const char* sha256[] = { "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7", "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843", "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" };
+        const char* sha384[] = { "afd03944d84895626b0825f4ab46907f15f9dadbe4101ec682aa034c7cebc59cfaea9ea9076ede7f4af152e8b2fa9cb6",
+            "af45d2e376484031617f78d2b58a6b1b9c7ef464f5a01b47e42ec3736322445e8e2240ca5e69e2c78b3239ecfab21649",
+            "4ece084485813e9088d2c63a041bc5b44f9ef1012a2b588f3cd11f05033ac4c60c2ef6ab4030fe8296248df163f44952" };
+        const char* sha512[] = { "87aa7cdea5ef619d4ff0b4241a1d6cb02379f4e2ce4ec2787ad0b30545e17cdedaa833b7d6b8a702038b274eaea3f4e4be9d914eeb61f1702e696c203a126854",
+            "164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea2505549758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737",
+            "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f3526b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598" };
+
+        for (const Crypto::hashEngine engine : Engines()) {
+            Engine(engine);
+
+            for (uint8_t test = 0; test < 3; test++) {
+                EXPECT_EQ(Calculate<Crypto::MD5HMAC>(keys[test], messages[test]), md5[test]);
+                EXPECT_EQ(Calculate<Crypto::SHA1HMAC>(keys[test], messages[test]), sha1[test]);
+                EXPECT_EQ(Calculate<Crypto::SHA224HMAC>(keys[test], messages[test]), sha224[test]);
+                EXPECT_EQ(Calculate<Crypto::SHA256HMAC>(keys[test], messages[test]), sha256[test]);
+                EXPECT_EQ(Calculate<Crypto::SHA384HMAC>(keys[test], messages[test]), sha384[test]);
+                EXPECT_EQ(Calculate<Crypto::SHA512HMAC>(keys[test], messages[test]), sha512[test]);
+            }
+
+            // The key is prepared once, the same object does message after message.
+            Crypto::SHA256HMAC hmac(reinterpret_cast<const uint8_t*>(keys[1].data()), static_cast<uint32_t>(keys[1].length()));
+
+            for (uint8_t round = 0; round < 3; round++) {
+                hmac.Reset();
+                hmac.Input(reinterpret_cast<const uint8_t*>(messages[1].data()), messages[1].length());
+                EXPECT_EQ(Hex(hmac.Result(), Crypto::SHA256HMAC::Length), sha256[1]);
+            }
+        }
+
+        Crypto::HashEngine(Crypto::HASH_ENGINE_ARMV8);
+    }
+
+    template <typename HASH>
+    static void CheckDigest(const HASH& prefix, const std::vector<std::vector<uint8_t>>& messages)
+    {
+        std::vector<const uint8_t*> data;
+        std::vector<uint32_t> lengths;
+        std::vector<uint8_t> digests(messages.size() * HASH::Length);
+
+        for (const std::vector<uint8_t>& message : messages) {
+            data.push_back(message.data());
+            lengths.push_back(static_cast<uint32_t>(message.size()));
+        }
+
+        prefix.Digest(static_cast<uint32_t>(messages.size()), data.data(), lengths.data(), digests.data());
+
+        for (uint32_t index = 0; index < messages.size(); index++) {
+            HASH single(prefix);
+
+            single.Input(messages[index].data(), messages[index].size());
+            EXPECT_EQ(Hex(&digests[index * HASH::Length], HASH::Length), Hex(single.Result(), HASH::Length)) << "message " << index;
+        }
+    }
+
+    TEST(Cryptalgo_Hash, Digest)
+    {
+        std::vector<std::vector<uint8_t>> messages;
+        std::vector<uint8_t> block(64, 0x42);
+        uint32_t seed = 0x12345678;
+
+        // All lengths around the one or two padding blocks, and some longer ones, out of order.
+        for (uint32_t length = 0; length < 140; length++) {
+            seed = (seed * 1103515245) + 12345;
+            messages.emplace_back(((seed >> 8) % 3) == 0 ? (length * 7) : length);
+
+            for (uint32_t index = 0; index < messages.back().size(); index++) {
+                messages.back()[index] = static_cast<uint8_t>(seed >> (index % 24));
+            }
+        }
+
+        for (const Crypto::hashEngine engine : Engines()) {
+            Engine(engine);
+
+            CheckDigest(Crypto::SHA1(), messages);
+            CheckDigest(Crypto::SHA224(), messages);
+            CheckDigest(Crypto::SHA256(), messages);
+            CheckDigest(Crypto::SHA1(block.data(), block.size()), messages);
+            CheckDigest(Crypto::SHA256(block.data(), block.size()), messages);
+
+            // One message only, or just a few.
+            CheckDigest(Crypto::SHA256(), std::vector<std::vector<uint8_t>>(messages.begin() + 100, messages.begin() + 101));
+            CheckDigest(Crypto::SHA1(), std::vector<std::vector<uint8_t>>(messages.begin() + 60, messages.begin() + 63));
+
+            // And the same for HMAC.
+            std::vector<const uint8_t*> data;
+            std::vector<uint32_t> lengths;
+
+            for (const std::vector<uint8_t>& message : messages) {
+                data.push_back(message.data());
+                lengths.push_back(static_cast<uint32_t>(message.size()));
+            }
+
+            Crypto::SHA256HMAC hmac256(_T("secret"));
+            Crypto::SHA1HMAC hmac1(_T("secret"));
+            std::vector<uint8_t> digests256(messages.size() * Crypto::SHA256HMAC::Length);
+            std::vector<uint8_t> digests1(messages.size() * Crypto::SHA1HMAC::Length);
+
+            hmac256.Digest(static_cast<uint32_t>(messages.size()), data.data(), lengths.data(), digests256.data());
+            hmac1.Digest(static_cast<uint32_t>(messages.size()), data.data(), lengths.data(), digests1.data());
+
+            for (uint32_t index = 0; index < messages.size(); index++) {
+                hmac256.Reset();
+                hmac256.Input(data[index], lengths[index]);
+                EXPECT_EQ(Hex(&digests256[index * Crypto::SHA256HMAC::Length], Crypto::SHA256HMAC::Length), Hex(hmac256.Result(), Crypto::SHA256HMAC::Length));
+
+                hmac1.Reset();
+                hmac1.Input(data[index], lengths[index]);
+                EXPECT_EQ(Hex(&digests1[index * Crypto::SHA1HMAC::Length], Crypto::SHA1HMAC::Length), Hex(hmac1.Result(), Crypto::SHA1HMAC::Length));
+            }
+        }
+
+        Crypto::HashEngine(Crypto::HASH_ENGINE_ARMV8);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,195 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    TEST(Core_AdaptiveCriticalSection, Recursive)
+    {
+        Core::AdaptiveCriticalSection lock;
+
+        lock.Lock();
+        lock.Lock();
+        lock.Unlock();
+        lock.Unlock();
+
+        EXPECT_EQ(lock.Acquired(), 2u);
+        EXPECT_EQ(lock.Contended(), 0u);
+
+        lock.ResetStatistics();
+        EXPECT_EQ(lock.Acquired(), 0u);
+    }
+
+    TEST(Core_AdaptiveCriticalSection, MutualExclusion)
+    {
+        Core::AdaptiveCriticalSection lock;
+        std::thread threads[4];
+        uint32_t inside = 0;
+        uint32_t counter = 0;
+        bool overlapped = false;
+
+        for (std::thread& thread : threads) {
+            thread = std::thread([&]() {
+                for (uint32_t index = 0; index < 20000; index++) {
+                    Core::SafeSyncType<Core::AdaptiveCriticalSection> guard(lock);
+
+                    overlapped = overlapped || (++inside != 1);
+                    counter++;
+                    --inside;
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_FALSE(overlapped);
+        EXPECT_EQ(counter, 80000u);
+        EXPECT_EQ(lock.Acquired(), 80000u);
+        EXPECT_EQ(lock.Contended(), lock.Spun() + lock.Parked());
+        EXPECT_LE(lock.Contended(), lock.Acquired());
+    }
+
+    TEST(Core_AdaptiveCriticalSection, Parks)
+    {
+        Core::AdaptiveCriticalSection lock;
+
+        lock.Lock();
+
+        std::thread waiter([&lock]() {
+            lock.Lock();
+            lock.Unlock();
+        });
+
+        // Longer than any spin, so it has to sleep.
+        SleepMs(50);
+        lock.Unlock();
+        waiter.join();
+
+        EXPECT_EQ(lock.Acquired(), 2u);
+        EXPECT_EQ(lock.Contended(), 1u);
+        EXPECT_EQ(lock.Parked(), 1u);
+    }
+
+    TEST(Core_AdaptiveReadWriteLock, Readers)
+    {
+        Core::AdaptiveReadWriteLock lock;
+
+        EXPECT_TRUE(lock.ReadLock());
+        EXPECT_TRUE(lock.ReadLock(0));
+
+        // Not while there are readers.
+        EXPECT_FALSE(lock.WriteLock(10));
+
+        lock.ReadUnlock();
+        lock.ReadUnlock();
+
+        EXPECT_TRUE(lock.WriteLock(0));
+
+        // Nobody else, while there is a writer.
+        EXPECT_FALSE(lock.ReadLock(10));
+        EXPECT_FALSE(lock.WriteLock(0));
+
+        lock.WriteUnlock();
+
+        EXPECT_EQ(lock.ReadAcquired(), 2u);
+        EXPECT_EQ(lock.WriteAcquired(), 1u);
+        EXPECT_EQ(lock.Contended(), 3u);
+    }
+
+    TEST(Core_AdaptiveReadWriteLock, WriterWakesReaders)
+    {
+        Core::AdaptiveReadWriteLock lock;
+        std::thread readers[3];
+        std::atomic<uint32_t> done(0);
+
+        EXPECT_TRUE(lock.WriteLock());
+
+        for (std::thread& reader : readers) {
+            reader = std::thread([&]() {
+                if (lock.ReadLock(Core::infinite) == true) {
+                    done++;
+                    lock.ReadUnlock();
+                }
+            });
+        }
+
+        SleepMs(50);
+        EXPECT_EQ(done.load(), 0u);
+
+        lock.WriteUnlock();
+
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+
+        EXPECT_EQ(done.load(), 3u);
+        EXPECT_EQ(lock.Parked(), 3u);
+    }
+
+    TEST(Core_AdaptiveReadWriteLock, MutualExclusion)
+    {
+        Core::AdaptiveReadWriteLock lock;
+        std::thread threads[4];
+        std::atomic<uint32_t> readers(0);
+        std::atomic<bool> writing(false);
+        std::atomic<bool> violated(false);
+        uint64_t value = 0;
+
+        for (uint8_t index = 0; index < 4; index++) {
+            threads[index] = std::thread([&, index]() {
+                for (uint32_t loop = 0; loop < 20000; loop++) {
+                    if (((loop + index) % 4) == 0) {
+                        lock.WriteLock();
+                        writing = true;
+                        if (readers.load() != 0) {
+                            violated = true;
+                        }
+                        value++;
+                        writing = false;
+                        lock.WriteUnlock();
+                    } else {
+                        lock.ReadLock();
+                        readers++;
+                        if (writing.load() == true) {
+                            violated = true;
+                        }
+                        readers--;
+                        lock.ReadUnlock();
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_FALSE(violated.load());
+        EXPECT_EQ(value, 20000u);
+        EXPECT_EQ(lock.WriteAcquired(), 20000u);
+        EXPECT_EQ(lock.ReadAcquired(), 60000u);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,297 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Records prefixed with their 16 bits size, like the trace buffer has them:
+    // size (2) - writer (1) - sequence (4) - payload.
+    class RecordBuffer : public Core::CyclicBuffer {
+    public:
+        RecordBuffer(const RecordBuffer&) = delete;
+        RecordBuffer& operator=(const RecordBuffer&) = delete;
+
+        RecordBuffer(const string& fileName, const uint32_t size, const bool overwrite)
+            : Core::CyclicBuffer(fileName, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE, size, overwrite)
+            , _signals(0)
+        {
+        }
+        ~RecordBuffer() override = default;
+
+    public:
+        static uint16_t Create(uint8_t record[], const uint8_t writer, const uint32_t sequence)
+        {
+            const uint16_t length = 7 + ((sequence * 13) % 200);
+
+            ::memcpy(&record[0], &length, 2);
+            record[2] = writer;
+            ::memcpy(&record[3], &sequence, 4);
+
+            for (uint16_t index = 7; index < length; index++) {
+                record[index] = static_cast<uint8_t>(writer + sequence + index);
+            }
+
+            return (length);
+        }
+        static bool Check(const uint8_t record[], const uint16_t length, uint8_t& writer, uint32_t& sequence)
+        {
+            uint16_t size;
+            ::memcpy(&size, &record[0], 2);
+            writer = record[2];
+            ::memcpy(&sequence, &record[3], 4);
+
+            uint16_t index = 7;
+            while ((index < length) && (record[index] == static_cast<uint8_t>(writer + sequence + index))) {
+                index++;
+            }
+
+            return ((size == length) && (length == (7 + ((sequence * 13) % 200))) && (index == length));
+        }
+        uint32_t Signals() const
+        {
+            return (_signals);
+        }
+
+    private:
+        uint32_t GetOverwriteSize(Cursor& cursor) override
+        {
+            while (cursor.Offset() < cursor.Size()) {
+                uint16_t chunkSize = 0;
+                cursor.Peek(chunkSize);
+                cursor.Forward(chunkSize);
+            }
+
+            return (cursor.Offset());
+        }
+        uint32_t GetReadSize(Cursor& cursor) override
+        {
+            uint16_t chunkSize = 0;
+            cursor.Peek(chunkSize);
+
+            return (chunkSize);
+        }
+        void DataAvailable() override
+        {
+            _signals++;
+        }
+
+    private:
+        std::atomic<uint32_t> _signals;
+    };
+
+    static void Publish(RecordBuffer& buffer, const uint8_t writers, const uint32_t records)
+    {
+        std::vector<std::thread> threads;
+
+        for (uint8_t writer = 0; writer < writers; writer++) {
+            threads.emplace_back([&buffer, writer, records]() {
+                uint8_t record[256];
+
+                for (uint32_t sequence = 0; sequence < records; sequence++) {
+                    const uint16_t length = RecordBuffer::Create(record, writer, sequence);
+                    buffer.Publish(record, length);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    TEST(Core_CyclicBuffer, PublishConcurrent)
+    {
+        const uint8_t writers = 4;
+        const uint32_t records = 500;
+
+        RecordBuffer buffer(_T("/tmp/testcyclicbuffer.publish"), 0x100000, false);
+        ASSERT_TRUE(buffer.IsValid());
+
+        Publish(buffer, writers, records);
+
+        // Nothing is lost or torn, and each writer its records come in the order they were written.
+        std::vector<uint32_t> expected(writers, 0);
+        uint8_t record[256];
+        uint32_t length;
+
+        while ((length = buffer.Read(record, sizeof(record))) != 0) {
+            uint8_t writer;
+            uint32_t sequence;
+
+            ASSERT_TRUE(RecordBuffer::Check(record, static_cast<uint16_t>(length), writer, sequence));
+            ASSERT_LT(writer, writers);
+            EXPECT_EQ(sequence, expected[writer]);
+            expected[writer] = sequence + 1;
+        }
+
+        for (uint8_t writer = 0; writer < writers; writer++) {
+            EXPECT_EQ(expected[writer], records);
+        }
+        EXPECT_EQ(buffer.Used(), 0u);
+
+        // All went into an empty buffer once, so there was only one to tell.
+        EXPECT_EQ(buffer.Signals(), 1u);
+    }
+
+    TEST(Core_CyclicBuffer, PublishOverwrite)
+    {
+        const uint8_t writers = 4;
+        const uint32_t records = 5000;
+
+        RecordBuffer buffer(_T("/tmp/testcyclicbuffer.overwrite"), 4096, true);
+        ASSERT_TRUE(buffer.IsValid());
+
+        Publish(buffer, writers, records);
+
+        // The oldest records made room for the newer ones, what is left is intact and in order.
+        std::vector<uint32_t> last(writers, 0);
+        std::vector<bool> seen(writers, false);
+        uint8_t record[256];
+        uint32_t length;
+        uint32_t count = 0;
+
+        while ((length = buffer.Read(record, sizeof(record))) != 0) {
+            uint8_t writer;
+            uint32_t sequence;
+
+            ASSERT_TRUE(RecordBuffer::Check(record, static_cast<uint16_t>(length), writer, sequence));
+            ASSERT_LT(writer, writers);
+
+            if (seen[writer] == true) {
+                EXPECT_GT(sequence, last[writer]);
+            }
+            seen[writer] = true;
+            last[writer] = sequence;
+            count++;
+        }
+
+        EXPECT_GT(count, 0u);
+
+        // Too large for the buffer, or for what is not claimed already.
+        uint8_t large[5000];
+        EXPECT_EQ(buffer.Publish(large, sizeof(large)), 0u);
+
+        RecordBuffer full(_T("/tmp/testcyclicbuffer.full"), 512, false);
+        uint32_t written = 0;
+
+        for (uint32_t sequence = 0; sequence < 100; sequence++) {
+            const uint16_t size = RecordBuffer::Create(record, 0, sequence);
+            written += (full.Publish(record, size) == size ? size : 0);
+        }
+        EXPECT_EQ(full.Used(), written);
+        EXPECT_LT(written, 512u);
+    }
+
+    TEST(Core_CyclicBuffer, ClaimAndRecords)
+    {
+        RecordBuffer buffer(_T("/tmp/testcyclicbuffer.records"), 1000, false);
+        ASSERT_TRUE(buffer.IsValid());
+
+        uint32_t written = 0;
+        uint32_t read = 0;
+
+        // Enough rounds to wrap around the end a couple of times, in between records and inside them.
+        for (uint32_t round = 0; round < 50; round++) {
+            uint8_t record[256];
+
+            for (uint32_t index = 0; index < 3; index++, written++) {
+                const uint16_t length = RecordBuffer::Create(record, 1, written);
+                Core::CyclicBuffer::Span span;
+
+                ASSERT_EQ(buffer.Claim(length, span), length);
+                EXPECT_EQ(span.Length(), length);
+                EXPECT_EQ(span.FirstLength() + span.SecondLength(), length);
+
+                // In place, in two goes.
+                span.Write(7, &record[7], length - 7);
+                span.Write(0, record, 7);
+                buffer.Commit(span);
+            }
+
+            Core::CyclicBuffer::Span records;
+            const uint32_t length = buffer.Records(records);
+
+            EXPECT_EQ(length, buffer.Used());
+
+            uint32_t offset = 0;
+            while (offset < length) {
+                uint16_t size;
+                uint8_t writer;
+                uint32_t sequence;
+
+                records.Read(offset, &size, sizeof(size));
+                records.Read(offset, record, size);
+
+                ASSERT_TRUE(RecordBuffer::Check(record, size, writer, sequence));
+                EXPECT_EQ(sequence, read);
+
+                offset += size;
+                read++;
+            }
+
+            EXPECT_TRUE(buffer.Consume(records));
+            EXPECT_EQ(buffer.Used(), 0u);
+        }
+
+        EXPECT_EQ(read, written);
+
+        // Only complete records, and no more than asked for.
+        uint8_t record[256];
+        const uint16_t first = RecordBuffer::Create(record, 1, 0);
+        buffer.Publish(record, first);
+        const uint16_t second = RecordBuffer::Create(record, 1, 1);
+        buffer.Publish(record, second);
+
+        Core::CyclicBuffer::Span records;
+        EXPECT_EQ(buffer.Records(records, first - 1), 0u);
+        EXPECT_EQ(buffer.Records(records, first + second - 1), first);
+        EXPECT_EQ(buffer.Records(records), static_cast<uint32_t>(first + second));
+    }
+
+    TEST(Core_CyclicBuffer, RecordsOverwritten)
+    {
+        RecordBuffer buffer(_T("/tmp/testcyclicbuffer.overwritten"), 512, true);
+        ASSERT_TRUE(buffer.IsValid());
+
+        uint8_t record[256];
+        uint32_t sequence = 0;
+
+        while (buffer.Used() < 256) {
+            buffer.Publish(record, RecordBuffer::Create(record, 2, sequence++));
+        }
+
+        Core::CyclicBuffer::Span records;
+        EXPECT_NE(buffer.Records(records), 0u);
+
+        // The writers drop what is being looked at, the reader is told so.
+        for (uint32_t index = 0; index < 10; index++) {
+            buffer.Publish(record, RecordBuffer::Create(record, 2, sequence++));
+        }
+
+        EXPECT_FALSE(buffer.Consume(records));
+        EXPECT_NE(buffer.Used(), 0u);
+    }
+
+} // Tests
+} // WPEFramework
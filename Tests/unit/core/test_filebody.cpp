@@ -0,0 +1,385 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static const TCHAR FileName[] = _T("/tmp/wpeframework_test_filebody.bin");
+    static const uint32_t FileSize = 300000;
+
+    static uint8_t Pattern(const uint32_t index)
+    {
+        return (static_cast<uint8_t>((index * 7) + (index >> 10)));
+    }
+
+    // Counts the bytes that go through the copy path.
+    class CountingFileBody : public Web::FileBody {
+    public:
+        CountingFileBody()
+            : Web::FileBody()
+            , _copies(0)
+        {
+        }
+        ~CountingFileBody() override = default;
+
+    public:
+        using Web::FileBody::operator=;
+
+        uint32_t Copies() const
+        {
+            return (_copies);
+        }
+
+    protected:
+        using Web::FileBody::Serialize;
+
+        void Serialize(uint8_t stream[], const uint16_t maxLength) const override
+        {
+            _copies += maxLength;
+            Web::FileBody::Serialize(stream, maxLength);
+        }
+
+    private:
+        mutable uint32_t _copies;
+    };
+
+    // Answers every request with the file, or the given range of it.
+    class FileServer : public Web::WebLinkType<Core::SocketStream, Web::Request, Web::Response, Core::ProxyPoolType<Web::Request>> {
+    private:
+        typedef Web::WebLinkType<Core::SocketStream, Web::Request, Web::Response, Core::ProxyPoolType<Web::Request>> BaseClass;
+
+    public:
+        FileServer(const SOCKET connector, const Core::NodeId& remote, const uint32_t offset, const uint32_t length)
+            : BaseClass(2, false, connector, remote, 1024, 1024)
+            , _offset(offset)
+            , _length(length)
+            , _body(Core::ProxyType<CountingFileBody>::Create())
+        {
+        }
+        ~FileServer() override
+        {
+            BaseClass::Close(Core::infinite);
+        }
+
+    public:
+        uint32_t Copies() const
+        {
+            return (_body->Copies());
+        }
+
+    private:
+        void LinkBody(Core::ProxyType<Web::Request>&) override
+        {
+        }
+        void Received(Core::ProxyType<Web::Request>&) override
+        {
+            Core::ProxyType<Web::Response> response(Core::ProxyType<Web::Response>::Create());
+
+            *_body = string(FileName);
+
+            if (_length != static_cast<uint32_t>(~0)) {
+                _body->Range(_offset, _length);
+                response->ErrorCode = Web::STATUS_PARTIAL_CONTENT;
+            }
+
+            response->Body<CountingFileBody>(_body);
+            Submit(response);
+        }
+        void Send(const Core::ProxyType<Web::Response>&) override
+        {
+        }
+        void StateChange() override
+        {
+        }
+
+    private:
+        const uint32_t _offset;
+        const uint32_t _length;
+        Core::ProxyType<CountingFileBody> _body;
+    };
+
+    class FileBodyTest : public ::testing::Test {
+    protected:
+        void SetUp() override
+        {
+            Core::File file((string(FileName)));
+            uint8_t buffer[1024];
+
+            ASSERT_TRUE(file.Create());
+
+            for (uint32_t index = 0; index < FileSize; index += sizeof(buffer)) {
+                const uint32_t size = std::min(static_cast<uint32_t>(sizeof(buffer)), FileSize - index);
+
+                for (uint32_t teller = 0; teller < size; teller++) {
+                    buffer[teller] = Pattern(index + teller);
+                }
+
+                file.Write(buffer, size);
+            }
+
+            file.Close();
+        }
+        void TearDown() override
+        {
+            Core::File((string(FileName))).Destroy();
+        }
+
+        static bool Expected(const string& body, const uint32_t offset)
+        {
+            uint32_t index = 0;
+
+            while ((index < body.length()) && (static_cast<uint8_t>(body[index]) == Pattern(offset + index))) {
+                index++;
+            }
+
+            return (index == body.length());
+        }
+
+        // Fetches the file over a loopback TCP connection, returns the headers and the body.
+        static void Fetch(const uint32_t offset, const uint32_t length, string& headers, string& body, uint32_t& copies)
+        {
+            struct sockaddr_in address;
+            socklen_t size = sizeof(address);
+
+            ::memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+            const SOCKET listener = ::socket(AF_INET, SOCK_STREAM, 0);
+            ASSERT_EQ(::bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)), 0);
+            ASSERT_EQ(::listen(listener, 1), 0);
+            ASSERT_EQ(::getsockname(listener, reinterpret_cast<struct sockaddr*>(&address), &size), 0);
+
+            const SOCKET client = ::socket(AF_INET, SOCK_STREAM, 0);
+            ASSERT_EQ(::connect(client, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)), 0);
+
+            struct timeval timeout = { 5, 0 };
+            ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+            const SOCKET connector = ::accept(listener, nullptr, nullptr);
+            ASSERT_NE(connector, INVALID_SOCKET);
+
+            {
+                FileServer server(connector, Core::NodeId(_T("127.0.0.1"), ntohs(address.sin_port)), offset, length);
+                const string request(_T("GET /file HTTP/1.1\r\nHost: localhost\r\n\r\n"));
+                string response;
+                size_t end = string::npos;
+                uint32_t contentLength = 0;
+                char buffer[4096];
+                ssize_t loaded = 1;
+
+                ASSERT_EQ(server.Open(0), Core::ERROR_NONE);
+                ASSERT_EQ(::send(client, request.c_str(), request.length(), 0), static_cast<ssize_t>(request.length()));
+
+                while ((loaded > 0) && ((end == string::npos) || (response.length() < (end + 4 + contentLength)))) {
+                    loaded = ::recv(client, buffer, sizeof(buffer), 0);
+
+                    if (loaded > 0) {
+                        response.append(buffer, loaded);
+
+                        if ((end == string::npos) && ((end = response.find(_T("\r\n\r\n"))) != string::npos)) {
+                            const size_t index = response.find(_T("Content-Length: "));
+
+                            ASSERT_NE(index, string::npos);
+                            contentLength = ::atoi(&(response[index + 16]));
+                        }
+                    }
+                }
+
+                ASSERT_NE(end, string::npos);
+
+                headers = response.substr(0, end + 4);
+                body = response.substr(end + 4);
+                copies = server.Copies();
+            }
+
+            ::close(client);
+            ::close(listener);
+
+            // Do not leave the ResourceMonitor threads running for the next test.
+            Core::Singleton::Dispose();
+        }
+    };
+
+    TEST_F(FileBodyTest, SentFromFile)
+    {
+        string headers;
+        string body;
+        uint32_t copies = ~0;
+
+        Fetch(0, ~0, headers, body, copies);
+
+        EXPECT_EQ(headers.compare(0, 15, _T("HTTP/1.1 200 OK")), 0);
+        EXPECT_NE(headers.find(_T("Content-Length: 300000\r\n")), string::npos);
+        ASSERT_EQ(body.length(), FileSize);
+        EXPECT_TRUE(Expected(body, 0));
+#ifdef __LINUX__
+        // A plain socket takes the file as it is, nothing is copied through the send buffer.
+        EXPECT_EQ(copies, 0u);
+#endif
+    }
+
+    TEST_F(FileBodyTest, RangeSentFromFile)
+    {
+        string headers;
+        string body;
+        uint32_t copies = ~0;
+
+        Fetch(1000, 70001, headers, body, copies);
+
+        EXPECT_EQ(headers.compare(0, 12, _T("HTTP/1.1 206")), 0);
+        EXPECT_NE(headers.find(_T("Content-Length: 70001\r\n")), string::npos);
+        ASSERT_EQ(body.length(), 70001u);
+        EXPECT_TRUE(Expected(body, 1000));
+#ifdef __LINUX__
+        EXPECT_EQ(copies, 0u);
+#endif
+
+        // The range is cut off at the end of the file.
+        Fetch(FileSize - 10, 100, headers, body, copies);
+
+        ASSERT_EQ(body.length(), 10u);
+        EXPECT_TRUE(Expected(body, FileSize - 10));
+    }
+
+    TEST_F(FileBodyTest, RangeCopied)
+    {
+        // Serialized without a socket underneath, the body has to be copied.
+        Core::ProxyType<CountingFileBody> body(Core::ProxyType<CountingFileBody>::Create());
+        Web::Response response;
+        string text;
+
+        *body = string(FileName);
+        body->Range(4096, 5000);
+
+        response.ErrorCode = Web::STATUS_PARTIAL_CONTENT;
+        response.AcceptRange = _T("bytes");
+        response.ContentRange = _T("bytes 4096-9095/300000");
+        response.Body<CountingFileBody>(body);
+        response.ToString(text);
+
+        const size_t end = text.find(_T("\r\n\r\n"));
+
+        ASSERT_NE(end, string::npos);
+        EXPECT_NE(text.find(_T("Accept-Ranges: bytes\r\n")), string::npos);
+        EXPECT_NE(text.find(_T("Content-Range: bytes 4096-9095/300000\r\n")), string::npos);
+        EXPECT_NE(text.find(_T("Content-Length: 5000\r\n")), string::npos);
+        ASSERT_EQ(text.length() - (end + 4), 5000u);
+        EXPECT_TRUE(Expected(text.substr(end + 4), 4096));
+        EXPECT_EQ(body->Copies(), 5000u);
+
+        // The same body, now as a whole file.
+        *body = string(FileName);
+        response.ContentRange.Clear();
+        text.clear();
+        response.ToString(text);
+
+        EXPECT_NE(text.find(_T("Content-Length: 300000\r\n")), string::npos);
+        EXPECT_TRUE(Expected(text.substr(text.find(_T("\r\n\r\n")) + 4), 0));
+    }
+
+    TEST(Web_Range, Headers)
+    {
+        Web::Request request;
+        Web::Request parsedRequest;
+        Web::Response response;
+        Web::Response parsedResponse;
+        string text;
+
+        request.Verb = Web::Request::HTTP_GET;
+        request.Path = _T("/file");
+        request.Range = _T("bytes=100-199");
+        request.ToString(text);
+
+        EXPECT_NE(text.find(_T("Range: bytes=100-199\r\n")), string::npos);
+
+        parsedRequest.FromString(text);
+        ASSERT_TRUE(parsedRequest.Range.IsSet());
+        EXPECT_EQ(parsedRequest.Range.Value(), _T("bytes=100-199"));
+
+        response.ErrorCode = Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE;
+        response.ContentRange = _T("bytes */300000");
+        text.clear();
+        response.ToString(text);
+
+        parsedResponse.FromString(text);
+        EXPECT_EQ(parsedResponse.ErrorCode, Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE);
+        ASSERT_TRUE(parsedResponse.ContentRange.IsSet());
+        EXPECT_EQ(parsedResponse.ContentRange.Value(), _T("bytes */300000"));
+    }
+
+    TEST(Web_Range, ByteRange)
+    {
+        uint64_t first = ~0;
+        uint64_t last = ~0;
+
+        // first-last, cut off at the end of the file.
+        EXPECT_EQ(Web::ByteRange(_T("bytes=100-199"), FileSize, first, last), Web::STATUS_PARTIAL_CONTENT);
+        EXPECT_EQ(first, 100u);
+        EXPECT_EQ(last, 199u);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=299990-400000"), FileSize, first, last), Web::STATUS_PARTIAL_CONTENT);
+        EXPECT_EQ(first, 299990u);
+        EXPECT_EQ(last, FileSize - 1);
+
+        // Open ended.
+        EXPECT_EQ(Web::ByteRange(_T("bytes=1000-"), FileSize, first, last), Web::STATUS_PARTIAL_CONTENT);
+        EXPECT_EQ(first, 1000u);
+        EXPECT_EQ(last, FileSize - 1);
+
+        // Suffix, a suffix longer than the file is the whole file.
+        EXPECT_EQ(Web::ByteRange(_T("bytes=-500"), FileSize, first, last), Web::STATUS_PARTIAL_CONTENT);
+        EXPECT_EQ(first, FileSize - 500);
+        EXPECT_EQ(last, FileSize - 1);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=-400000"), FileSize, first, last), Web::STATUS_PARTIAL_CONTENT);
+        EXPECT_EQ(first, 0u);
+        EXPECT_EQ(last, FileSize - 1);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=-0"), FileSize, first, last), Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE);
+
+        // Past the end.
+        EXPECT_EQ(Web::ByteRange(_T("bytes=300000-"), FileSize, first, last), Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=300000-300010"), FileSize, first, last), Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE);
+
+        // Reversed, multiple ranges and malformed ones are ignored, the whole file is served.
+        EXPECT_EQ(Web::ByteRange(_T("bytes=200-100"), FileSize, first, last), Web::STATUS_OK);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=0-10,20-30"), FileSize, first, last), Web::STATUS_OK);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=a-10"), FileSize, first, last), Web::STATUS_OK);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=-"), FileSize, first, last), Web::STATUS_OK);
+        EXPECT_EQ(Web::ByteRange(_T("items=0-10"), FileSize, first, last), Web::STATUS_OK);
+
+        // Numbers that do not fit in 64 bits are not wrapped around.
+        EXPECT_EQ(Web::ByteRange(_T("bytes=18446744073709551615-"), FileSize, first, last), Web::STATUS_REQUEST_RANGE_NOT_SATISFIABLE);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=18446744073709551616-"), FileSize, first, last), Web::STATUS_OK);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=0-99999999999999999999"), FileSize, first, last), Web::STATUS_OK);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=-18446744073709551616"), FileSize, first, last), Web::STATUS_OK);
+
+        // A file body can not address beyond 31 bits, the range of a larger file is ignored.
+        EXPECT_EQ(Web::ByteRange(_T("bytes=0-99"), 0x80000000ULL, first, last), Web::STATUS_OK);
+        EXPECT_EQ(Web::ByteRange(_T("bytes=0-99"), 0x7FFFFFFFULL, first, last), Web::STATUS_PARTIAL_CONTENT);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,172 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    TEST(Core_Histogram, Buckets)
+    {
+        // Small values have a bucket of their own.
+        for (uint64_t value = 0; value < Core::Histogram::SubBuckets; value++) {
+            EXPECT_EQ(Core::Histogram::Index(value), value);
+            EXPECT_EQ(Core::Histogram::Highest(Core::Histogram::Index(value)), value);
+        }
+
+        // Larger ones end up in a bucket at most 1/16th of the value wide, that holds them.
+        uint32_t previous = Core::Histogram::Index(Core::Histogram::SubBuckets - 1);
+        for (uint64_t value = Core::Histogram::SubBuckets; value < (1 << 20); value += 7) {
+            const uint32_t index = Core::Histogram::Index(value);
+            const uint64_t highest = Core::Histogram::Highest(index);
+
+            EXPECT_GE(index, previous);
+            EXPECT_GE(highest, value);
+            EXPECT_LE(highest - value, value / Core::Histogram::SubBuckets);
+            previous = index;
+        }
+
+        EXPECT_EQ(Core::Histogram::Index(static_cast<uint64_t>(1) << 40), Core::Histogram::Buckets - 1);
+        EXPECT_EQ(Core::Histogram::Index((static_cast<uint64_t>(1) << 32) - 1), Core::Histogram::Buckets - 1);
+    }
+
+    TEST(Core_Histogram, Percentiles)
+    {
+        Core::Histogram histogram;
+
+        EXPECT_EQ(histogram.Count(), 0u);
+        EXPECT_EQ(histogram.Min(), 0u);
+        EXPECT_EQ(histogram.Percentile(50), 0u);
+
+        for (uint64_t value = 1; value <= 1000; value++) {
+            histogram.Record(value);
+        }
+
+        EXPECT_EQ(histogram.Count(), 1000u);
+        EXPECT_EQ(histogram.Min(), 1u);
+        EXPECT_EQ(histogram.Max(), 1000u);
+        EXPECT_EQ(histogram.Average(), 500u);
+
+        const uint64_t p50 = histogram.Percentile(50);
+        const uint64_t p90 = histogram.Percentile(90);
+        const uint64_t p99 = histogram.Percentile(99);
+
+        EXPECT_GE(p50, 500u);
+        EXPECT_LE(p50, 500u + (500u / Core::Histogram::SubBuckets));
+        EXPECT_GE(p90, 900u);
+        EXPECT_LE(p90, 900u + (900u / Core::Histogram::SubBuckets));
+        EXPECT_GE(p99, 990u);
+        EXPECT_LE(p99, 1000u);
+        EXPECT_EQ(histogram.Percentile(100), 1000u);
+
+        histogram.Reset();
+        EXPECT_EQ(histogram.Count(), 0u);
+        EXPECT_EQ(histogram.Max(), 0u);
+    }
+
+    TEST(Core_Histogram, ConcurrentRecord)
+    {
+        Core::Histogram histogram;
+        std::thread threads[4];
+
+        for (std::thread& thread : threads) {
+            thread = std::thread([&histogram]() {
+                for (uint64_t value = 1; value <= 10000; value++) {
+                    histogram.Record(value % 100);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(histogram.Count(), 40000u);
+        EXPECT_EQ(histogram.Min(), 0u);
+        EXPECT_EQ(histogram.Max(), 99u);
+    }
+
+    TEST(Core_CallLatencies, Registry)
+    {
+        Core::CallLatencies& latencies(Core::CallLatencies::Instance());
+
+        latencies.Reset();
+
+        Core::Histogram* inbound = latencies.Histogram(Core::CallLatencies::COMRPC_INBOUND, 0x42, 3);
+        Core::Histogram* outbound = latencies.Histogram(Core::CallLatencies::COMRPC_OUTBOUND, 0x42, 3);
+        Core::Histogram* jsonrpc = latencies.Histogram(_T("DeviceInfo"), _T("systeminfo"));
+
+        ASSERT_NE(inbound, nullptr);
+        ASSERT_NE(outbound, nullptr);
+        ASSERT_NE(jsonrpc, nullptr);
+        EXPECT_NE(inbound, outbound);
+
+        // The same method, the same histogram.
+        EXPECT_EQ(latencies.Histogram(Core::CallLatencies::COMRPC_INBOUND, 0x42, 3), inbound);
+        EXPECT_EQ(latencies.Histogram(_T("DeviceInfo"), _T("systeminfo")), jsonrpc);
+        EXPECT_NE(latencies.Histogram(_T("DeviceInfo"), _T("addresses")), jsonrpc);
+
+        {
+            Core::CallLatencies::Measurement measurement(jsonrpc);
+            SleepMs(2);
+        }
+        inbound->Record(10);
+        inbound->Record(20);
+
+        uint32_t found = 0;
+        latencies.Visit([&found](const Core::CallLatencies::Entry& entry) {
+            if ((entry.Origin() == Core::CallLatencies::JSONRPC) && (entry.Callsign() == _T("DeviceInfo")) && (entry.Method() == _T("systeminfo"))) {
+                EXPECT_EQ(entry.Histogram().Count(), 1u);
+                EXPECT_GE(entry.Histogram().Min(), 2000u);
+                found++;
+            } else if ((entry.Origin() == Core::CallLatencies::COMRPC_INBOUND) && (entry.InterfaceId() == 0x42) && (entry.MethodId() == 3)) {
+                EXPECT_EQ(entry.Histogram().Count(), 2u);
+                EXPECT_EQ(entry.Histogram().Average(), 15u);
+                found++;
+            }
+        });
+        EXPECT_EQ(found, 2u);
+
+        // Disabled, nothing is handed out, so nothing is measured.
+        latencies.Enable(false);
+        EXPECT_EQ(latencies.Histogram(Core::CallLatencies::COMRPC_INBOUND, 0x42, 3), nullptr);
+        latencies.Enable(true);
+
+        latencies.Reset();
+        EXPECT_EQ(inbound->Count(), 0u);
+        EXPECT_EQ(jsonrpc->Count(), 0u);
+
+        // Once full, new methods are not recorded, the ones in there still are.
+        uint32_t method = 100;
+        while (latencies.Histogram(Core::CallLatencies::COMRPC_OUTBOUND, 0x43, method) != nullptr) {
+            method++;
+            ASSERT_LT(method, 100 + Core::CallLatencies::Capacity);
+        }
+        EXPECT_EQ(latencies.Histogram(Core::CallLatencies::COMRPC_OUTBOUND, 0x43, method + 1), nullptr);
+        EXPECT_EQ(latencies.Histogram(_T("DeviceInfo"), _T("unknown")), nullptr);
+        EXPECT_EQ(latencies.Histogram(Core::CallLatencies::COMRPC_INBOUND, 0x42, 3), inbound);
+        EXPECT_EQ(latencies.Histogram(_T("DeviceInfo"), _T("systeminfo")), jsonrpc);
+
+        Core::Singleton::Dispose();
+    }
+
+} // Tests
+} // WPEFramework
@@ -22,11 +22,54 @@
 #include <gtest/gtest.h>
 #include <core/core.h>
 
+#include <thread>
+
 namespace WPEFramework {
 namespace Tests {
 
     string g_connector = _T("/tmp/testserver");
 
+    static constexpr uint32_t Callers = 4;
+
+    typedef Core::IPCMessageType<1, Core::IPC::ScalarType<uint32_t>, Core::IPC::ScalarType<uint32_t>> Double;
+
+    // Holds on to the calls till a batch of them is pending, and answers them in reverse order.
+    class Reverser : public Core::IIPCServer {
+    public:
+        Reverser() = delete;
+        Reverser(const Reverser&) = delete;
+        Reverser& operator=(const Reverser&) = delete;
+
+        Reverser(const uint32_t batch)
+            : _batch(batch)
+            , _pending()
+        {
+        }
+        ~Reverser() override
+        {
+        }
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            _pending.push_back(message);
+
+            if (_pending.size() == _batch) {
+                while (_pending.empty() == false) {
+                    Core::ProxyType<Double> call(Core::proxy_cast<Double>(_pending.back()));
+
+                    call->Response() = call->Parameters().Value() * 2;
+                    source.ReportResponse(_pending.back());
+                    _pending.pop_back();
+                }
+            }
+        }
+
+    private:
+        uint32_t _batch;
+        std::vector<Core::ProxyType<Core::IIPC>> _pending;
+    };
+
     TEST(Core_IPC, IPCClientConnection)
     {
         IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator & testAdmin) {
@@ -34,7 +77,10 @@ namespace Tests {
             uint32_t error;
 
             Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t> > factory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t> >::Create());
+            factory->CreateFactory<Double>(Callers);
+
             Core::IPCChannelServerType<Core::Void, false> serverChannel(serverNode, 512, factory);
+            serverChannel.Register(Double::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<Reverser>::Create(Callers)));
             error = serverChannel.Open(1000); // Wait for 1 Second.
             EXPECT_EQ(error, Core::ERROR_NONE);
 
@@ -42,6 +88,7 @@ namespace Tests {
             testAdmin.Sync("setup client");
             testAdmin.Sync("done testing");
 
+            serverChannel.Unregister(Double::Id());
             error = serverChannel.Close(1000); // Wait for 1 Second.
             EXPECT_EQ(error, Core::ERROR_NONE);
 
@@ -60,6 +107,26 @@ namespace Tests {
             EXPECT_EQ(error, Core::ERROR_NONE);
             testAdmin.Sync("setup client");
 
+            // None of the calls is answered before all of them are sent, so they must be in flight together.
+            std::vector<std::thread> callers;
+            uint32_t results[Callers];
+
+            for (uint32_t index = 0; index < Callers; index++) {
+                callers.emplace_back([&clientChannel, &results, index]() {
+                    Core::ProxyType<Double> message(Core::ProxyType<Double>::Create());
+                    message->Parameters() = index + 1;
+
+                    results[index] = (clientChannel.Invoke(message, 2000) == Core::ERROR_NONE ? message->Response().Value() : 0);
+                });
+            }
+            for (std::thread& caller : callers) {
+                caller.join();
+            }
+            for (uint32_t index = 0; index < Callers; index++) {
+                EXPECT_EQ(results[index], (index + 1) * 2);
+            }
+            EXPECT_FALSE(clientChannel.InProgress());
+
             error = clientChannel.Close(1000);
             EXPECT_EQ(error, Core::ERROR_NONE);
             factory->DestroyFactories();
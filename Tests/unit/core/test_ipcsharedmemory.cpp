@@ -0,0 +1,179 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    typedef Core::IPCMessageType<1, Core::IPC::ScalarType<string>, Core::IPC::ScalarType<uint32_t>> Attach;
+    typedef Core::IPCMessageType<2, Core::IPC::ScalarType<string>, Core::IPC::ScalarType<string>> Reverse;
+
+    // Attaches the channel to the memory the client created, like the COMRPC announce does.
+    class Peer : public Core::IIPCServer {
+    public:
+        Peer(const Peer&) = delete;
+        Peer& operator=(const Peer&) = delete;
+
+        Peer() = default;
+        ~Peer() override = default;
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            if (message->Label() == Attach::Id()) {
+                Core::ProxyType<Attach> call(Core::proxy_cast<Attach>(message));
+                Core::ProxyType<Core::IPCSharedMemory> memory(Core::ProxyType<Core::IPCSharedMemory>::Create(call->Parameters().Value()));
+
+                if (memory->IsValid() == true) {
+                    source.Shared(memory, 1024);
+                }
+                call->Response() = (memory->IsValid() == true ? 1 : 0);
+            } else {
+                Core::ProxyType<Reverse> call(Core::proxy_cast<Reverse>(message));
+                const string& value(call->Parameters().Value());
+
+                call->Response() = string(value.rbegin(), value.rend());
+
+                // The message is recycled by the factory, and a string is appended to.
+                call->Parameters() = string();
+            }
+
+            source.ReportResponse(message);
+        }
+    };
+
+    TEST(Core_IPCSharedMemory, Ring)
+    {
+        const string fileName(_T("/tmp/testsharedmemory.ring"));
+        uint32_t offset = ~0;
+
+        {
+            Core::IPCSharedMemory creator(fileName, Core::File::USER_READ | Core::File::USER_WRITE, 100);
+            Core::IPCSharedMemory opener(fileName);
+
+            ASSERT_TRUE(creator.IsValid());
+            ASSERT_TRUE(opener.IsValid());
+            EXPECT_EQ(creator.Size(), 128u);
+            EXPECT_EQ(opener.Size(), 128u);
+
+            EXPECT_TRUE(creator.Reserve(100, offset));
+            EXPECT_EQ(offset, 0u);
+            ::memset(creator.Outbound(offset), 'a', 100);
+
+            // Not released yet, there is no room for more.
+            EXPECT_FALSE(creator.Reserve(40, offset));
+            EXPECT_FALSE(creator.Reserve(129, offset));
+
+            const uint8_t* data = opener.Inbound(0, 100);
+            ASSERT_NE(data, nullptr);
+            EXPECT_EQ(data[0], 'a');
+            EXPECT_EQ(data[99], 'a');
+            EXPECT_EQ(opener.Inbound(100, 40), nullptr);
+            opener.Release(0, 100);
+
+            // Does not fit before the end, so it starts at the beginning again.
+            EXPECT_TRUE(creator.Reserve(40, offset));
+            EXPECT_EQ(offset, 128u);
+            EXPECT_EQ(creator.Outbound(offset), creator.Outbound(0));
+            EXPECT_FALSE(creator.Reserve(61, offset));
+            EXPECT_TRUE(creator.Reserve(60, offset));
+            EXPECT_EQ(offset, 168u);
+
+            // The other direction is a ring of its own.
+            EXPECT_TRUE(opener.Reserve(128, offset));
+            EXPECT_EQ(offset, 0u);
+            ::memset(opener.Outbound(offset), 'b', 128);
+            ASSERT_NE(creator.Inbound(0, 128), nullptr);
+            EXPECT_EQ(creator.Inbound(0, 128)[127], 'b');
+        }
+
+        // The creator cleans up, what is not there can not be opened.
+        EXPECT_FALSE(Core::File(fileName).Exists());
+        EXPECT_FALSE(Core::IPCSharedMemory(fileName).IsValid());
+    }
+
+    TEST(Core_IPCSharedMemory, Channel)
+    {
+        const Core::NodeId node(_T("/tmp/testsharedmemory"));
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> serverFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        serverFactory->CreateFactory<Attach>(1);
+        serverFactory->CreateFactory<Reverse>(2);
+
+        Core::IPCChannelServerType<Core::Void, false> server(node, 512, serverFactory);
+        Core::ProxyType<Core::IIPCServer> peer(Core::ProxyType<Peer>::Create());
+        server.Register(Attach::Id(), peer);
+        server.Register(Reverse::Id(), peer);
+        ASSERT_EQ(server.Open(1000), Core::ERROR_NONE);
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> clientFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        {
+            Core::IPCChannelClientType<Core::Void, false, false> client(node, 512, clientFactory);
+            ASSERT_EQ(client.Source().Open(1000), Core::ERROR_NONE);
+
+            // Receive through it before the other side knows about it, send once it is attached.
+            Core::ProxyType<Core::IPCSharedMemory> memory(Core::ProxyType<Core::IPCSharedMemory>::Create(_T("/tmp/testsharedmemory.channel"), Core::File::USER_READ | Core::File::USER_WRITE, 0x8000));
+            ASSERT_TRUE(memory->IsValid());
+            client.Shared(memory, 0);
+
+            Core::ProxyType<Attach> attach(Core::ProxyType<Attach>::Create());
+            attach->Parameters() = memory->Name();
+            EXPECT_EQ(client.Invoke(attach, 2000), Core::ERROR_NONE);
+            EXPECT_EQ(attach->Response().Value(), 1u);
+            client.Shared(memory, 1024);
+
+            // Small ones stay inline, the larger ones wrap the ring a couple of times. One does not
+            // fit in the ring at all, and takes the socket instead.
+            const uint32_t sizes[] = { 10, 1023, 1024, 20000, 30000, 5000, 40000, 100, 25000, 25000, 25000, 12000, 12000, 12000 };
+
+            for (uint32_t size : sizes) {
+                Core::ProxyType<Reverse> message(Core::ProxyType<Reverse>::Create());
+                string value;
+
+                for (uint32_t index = 0; index < size; index++) {
+                    value += static_cast<TCHAR>('a' + ((index * 7) % 26));
+                }
+                message->Parameters() = value;
+
+                EXPECT_EQ(client.Invoke(message, 2000), Core::ERROR_NONE);
+                EXPECT_EQ(message->Response().Value(), string(value.rbegin(), value.rend()));
+            }
+
+            EXPECT_EQ(client.Close(1000), Core::ERROR_NONE);
+        }
+
+        // The server drops the channel once it noticed the client is gone.
+        for (uint32_t attempt = 0; (attempt < 100) && (server[0].IsValid() == true); attempt++) {
+            SleepMs(10);
+            server.Cleanup();
+        }
+
+        server.Unregister(Reverse::Id());
+        server.Unregister(Attach::Id());
+        EXPECT_EQ(server.Close(1000), Core::ERROR_NONE);
+
+        clientFactory->DestroyFactories();
+        serverFactory->DestroyFactories();
+        Core::Singleton::Dispose();
+    }
+
+} // Tests
+} // WPEFramework
@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include "JSON.h"
+#include "JSONRPC.h"
 
 #define QUIRKS_MODE
 
@@ -768,6 +769,81 @@ namespace Tests {
         ExecutePrimitiveJsonTest<Core::JSON::EnumType<JSONTestEnum>>(data, false, nullptr);
     }
 
+    // Payloads beyond 64KB, in one go and streamed in small chunks.
+    class LargePayload : public Core::JSON::Container {
+    public:
+        LargePayload(const LargePayload&) = delete;
+        LargePayload& operator=(const LargePayload&) = delete;
+
+        LargePayload()
+            : Core::JSON::Container()
+            , Blob()
+            , List()
+        {
+            Add(_T("blob"), &Blob);
+            Add(_T("list"), &List);
+        }
+        ~LargePayload() override = default;
+
+    public:
+        Core::JSON::String Blob;
+        Core::JSON::ArrayType<Core::JSON::DecUInt32> List;
+    };
+
+    TEST(JSONParser, LargePayload)
+    {
+        LargePayload source;
+        string blob;
+
+        for (uint32_t index = 0; index < (200 * 1024); index++) {
+            blob += static_cast<char>('a' + (index % 26));
+        }
+        source.Blob = blob;
+        for (uint32_t index = 0; index < 20000; index++) {
+            source.List.Add() = index;
+        }
+
+        string text;
+        EXPECT_TRUE(source.ToString(text));
+        EXPECT_GT(text.length(), 256u * 1024u);
+
+        LargePayload inMemory;
+        EXPECT_TRUE(inMemory.FromString(text));
+        EXPECT_EQ(inMemory.Blob.Value(), blob);
+        EXPECT_EQ(inMemory.List.Length(), 20000u);
+        EXPECT_EQ(inMemory.List[19999].Value(), 19999u);
+
+        Core::JSON::Tester<1024, LargePayload> tester;
+        Core::ProxyType<LargePayload> streamed(Core::ProxyType<LargePayload>::Create());
+        string restreamed;
+
+        EXPECT_TRUE(tester.FromString(text, streamed));
+        EXPECT_EQ(streamed->Blob.Value(), blob);
+        EXPECT_TRUE(tester.ToString(streamed, restreamed));
+        EXPECT_EQ(restreamed, text);
+    }
+
+    TEST(JSONParser, LargeMessage)
+    {
+        Core::JSONRPC::Message source;
+        string parameters(_T("{\"data\":\""));
+
+        parameters.append(1024 * 1024, 'x');
+        parameters += _T("\"}");
+
+        source.Id = 1;
+        source.Designator = _T("Plugin.1.method");
+        source.Parameters = parameters;
+
+        string text;
+        EXPECT_TRUE(source.ToString(text));
+
+        Core::JSONRPC::Message message;
+        EXPECT_TRUE(message.FromString(text));
+        EXPECT_EQ(message.Parameters.Value(), parameters);
+        EXPECT_EQ(message.Designator.Value(), _T("Plugin.1.method"));
+    }
+
 } // Tests
 
 ENUM_CONVERSION_BEGIN(Tests::JSONTestEnum){ WPEFramework::Tests::JSONTestEnum::ONE, _TXT("one") },
@@ -0,0 +1,180 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Writes every event down, so it is easy to compare what was seen.
+    class Recorder : public Core::JSON::Reader::IHandler {
+    public:
+        Recorder(const Recorder&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+
+        Recorder(const uint32_t stopAfter = ~0)
+            : _events()
+            , _count(0)
+            , _stopAfter(stopAfter)
+        {
+        }
+        ~Recorder() override = default;
+
+    public:
+        const string& Events() const
+        {
+            return (_events);
+        }
+        bool BeginObject() override
+        {
+            return (Record(_T("{")));
+        }
+        bool EndObject() override
+        {
+            return (Record(_T("}")));
+        }
+        bool BeginArray() override
+        {
+            return (Record(_T("[")));
+        }
+        bool EndArray() override
+        {
+            return (Record(_T("]")));
+        }
+        bool Key(const char text[], const uint32_t length) override
+        {
+            return (Record(_T("K:") + string(text, length)));
+        }
+        bool Text(const char text[], const uint32_t length) override
+        {
+            return (Record(_T("S:") + string(text, length)));
+        }
+        bool Number(const char text[], const uint32_t length) override
+        {
+            return (Record(_T("N:") + string(text, length)));
+        }
+        bool Boolean(const bool value) override
+        {
+            return (Record(value == true ? _T("true") : _T("false")));
+        }
+        bool Null() override
+        {
+            return (Record(_T("null")));
+        }
+
+    private:
+        bool Record(const string& event)
+        {
+            if (_events.empty() == false) {
+                _events += ' ';
+            }
+            _events += event;
+            return (++_count < _stopAfter);
+        }
+
+    private:
+        string _events;
+        uint32_t _count;
+        const uint32_t _stopAfter;
+    };
+
+    TEST(Core_JSONReader, Events)
+    {
+        Core::JSON::Reader reader;
+        Recorder recorder;
+
+        EXPECT_TRUE(reader.Parse(_T("{ \"a\": 1, \"b\" : [true, false, null, -1.5e3], \"c\": {\"d\":\"text\"}, \"e\": [] }"), recorder));
+        EXPECT_EQ(recorder.Events(), _T("{ K:a N:1 K:b [ true false null N:-1.5e3 ] K:c { K:d S:text } K:e [ ] }"));
+    }
+
+    TEST(Core_JSONReader, Escapes)
+    {
+        Core::JSON::Reader reader;
+        Recorder recorder;
+
+        EXPECT_TRUE(reader.Parse(_T("[\"plain\", \"tab\\tquote\\\"slash\\/\", \"\\u0041\"]"), recorder));
+        EXPECT_EQ(recorder.Events(), _T("[ S:plain S:tab\tquote\"slash/ S:\\u0041 ]"));
+    }
+
+    TEST(Core_JSONReader, Malformed)
+    {
+        Core::JSON::Reader reader;
+        Core::OptionalType<Core::JSON::Error> error;
+
+        Recorder unclosed;
+        EXPECT_FALSE(reader.Parse(_T("{\"a\": [1, 2}"), unclosed, error));
+        EXPECT_TRUE(error.IsSet());
+
+        error.Clear();
+        Recorder comma;
+        EXPECT_FALSE(reader.Parse(_T("[1,,2]"), comma, error));
+        EXPECT_EQ(error.Value().Position(), 3u);
+
+        error.Clear();
+        Recorder escape;
+        EXPECT_FALSE(reader.Parse(_T("[\"\\x\"]"), escape, error));
+
+        error.Clear();
+        Recorder missing;
+        EXPECT_FALSE(reader.Parse(_T("{\"a\": 1"), missing, error));
+        EXPECT_EQ(missing.Events(), _T("{ K:a N:1"));
+    }
+
+    TEST(Core_JSONReader, StopEarly)
+    {
+        Core::JSON::Reader reader;
+        Core::OptionalType<Core::JSON::Error> error;
+        Recorder recorder(3);
+        const string text(_T("{\"id\": 42, \"method\": \"Controller.1.status\", \"params\": {}}"));
+
+        uint32_t consumed = reader.Parse(text.c_str(), static_cast<uint32_t>(text.length()), recorder, error);
+
+        EXPECT_FALSE(error.IsSet());
+        EXPECT_EQ(recorder.Events(), _T("{ K:id N:42"));
+        EXPECT_EQ(consumed, 9u);
+    }
+
+    TEST(Core_JSONReader, ToStringLarge)
+    {
+        Core::JSON::ArrayType<Core::JSON::String> list;
+        Core::JSON::ArrayType<Core::JSON::String> copy;
+        string text;
+
+        for (uint32_t index = 0; index < 500; index++) {
+            list.Add() = _T("entry") + Core::NumberType<uint32_t>(index).Text();
+        }
+
+        // Reuse the text with room to spare, it should be cut to size.
+        text.assign(16 * 1024, 'x');
+
+        EXPECT_TRUE(list.ToString(text));
+        EXPECT_EQ(text.front(), '[');
+        EXPECT_EQ(text.back(), ']');
+        EXPECT_TRUE(copy.FromString(text));
+        EXPECT_EQ(copy.Length(), 500u);
+        EXPECT_EQ(copy[499].Value(), _T("entry499"));
+
+        Core::JSON::Reader reader;
+        Recorder recorder;
+        EXPECT_TRUE(reader.Parse(text, recorder));
+    }
+
+} // Tests
+} // WPEFramework
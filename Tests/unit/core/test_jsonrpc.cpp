@@ -0,0 +1,102 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static Core::JSONRPC::InvokeFunction Echo(const uint32_t id)
+    {
+        return ([id](const string&, const string&, string& response) -> uint32_t {
+            response = Core::NumberType<uint32_t>(id).Text();
+            return (Core::ERROR_NONE);
+        });
+    }
+
+    static string Method(const uint32_t id)
+    {
+        return (_T("method") + Core::NumberType<uint32_t>(id).Text());
+    }
+
+    TEST(Core_JSONRPC, DesignatorParts)
+    {
+        size_t length;
+
+        EXPECT_EQ(Core::JSONRPC::Message::CallsignLength(_T("Plugin.1.method@index")), 6u);
+        EXPECT_EQ(Core::JSONRPC::Message::CallsignLength(_T("Plugin.method")), 6u);
+        EXPECT_EQ(Core::JSONRPC::Message::CallsignLength(_T("1.method")), 0u);
+        EXPECT_EQ(Core::JSONRPC::Message::CallsignLength(_T("method")), 0u);
+
+        EXPECT_EQ(Core::JSONRPC::Message::MethodPosition(_T("Plugin.1.method@index"), length), 9u);
+        EXPECT_EQ(length, 6u);
+        EXPECT_EQ(Core::JSONRPC::Message::MethodPosition(_T("method"), length), 0u);
+        EXPECT_EQ(length, 6u);
+
+        EXPECT_EQ(Core::JSONRPC::Message::Callsign(_T("Plugin.1.method@index")), _T("Plugin"));
+        EXPECT_EQ(Core::JSONRPC::Message::Method(_T("Plugin.1.method@index")), _T("method"));
+        EXPECT_EQ(Core::JSONRPC::Message::Method(_T("Plugin.method")), _T("method"));
+        EXPECT_EQ(Core::JSONRPC::Message::Version(_T("Plugin.12.method")), 12u);
+        EXPECT_EQ(Core::JSONRPC::Message::Version(_T("2.method")), 2u);
+        EXPECT_EQ(Core::JSONRPC::Message::Version(_T("method")), static_cast<uint8_t>(~0));
+    }
+
+    TEST(Core_JSONRPC, HandlerLookup)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, { 1 });
+        Core::JSONRPC::Connection connection(1, 1);
+        string response;
+
+        // Enough of them to grow the index a couple of times.
+        for (uint32_t index = 0; index < 50; index++) {
+            handler.Register(Method(index), Echo(index));
+        }
+
+        for (uint32_t index = 0; index < 50; index++) {
+            EXPECT_EQ(handler.Invoke(connection, _T("Plugin.1.") + Method(index), _T(""), response), Core::ERROR_NONE);
+            EXPECT_EQ(response, Core::NumberType<uint32_t>(index).Text());
+        }
+
+        EXPECT_EQ(handler.Invoke(connection, Method(7) + _T("@index"), _T(""), response), Core::ERROR_NONE);
+        EXPECT_EQ(response, _T("7"));
+        EXPECT_EQ(handler.Invoke(connection, _T("Plugin.1.method"), _T(""), response), Core::ERROR_UNKNOWN_KEY);
+        EXPECT_EQ(handler.Invoke(connection, _T("Plugin.1.method500"), _T(""), response), Core::ERROR_UNKNOWN_KEY);
+        EXPECT_EQ(handler.Exists(_T("method12345"), 8), Core::ERROR_NONE);
+
+        // Overwrite one, drop another, the rest should not notice.
+        handler.Register(Method(3), Echo(300));
+        handler.Unregister(Method(4));
+
+        EXPECT_EQ(handler.Invoke(connection, Method(3), _T(""), response), Core::ERROR_NONE);
+        EXPECT_EQ(response, _T("300"));
+        EXPECT_EQ(handler.Exists(Method(4)), Core::ERROR_UNKNOWN_KEY);
+        EXPECT_EQ(handler.Invoke(connection, Method(5), _T(""), response), Core::ERROR_NONE);
+        EXPECT_EQ(response, _T("5"));
+
+        // A copy gets an index of its own.
+        Core::JSONRPC::Handler copy([](const uint32_t, const string&, const string&) {}, { 2 }, handler);
+
+        EXPECT_EQ(copy.Invoke(connection, Method(49), _T(""), response), Core::ERROR_NONE);
+        EXPECT_EQ(response, _T("49"));
+        EXPECT_EQ(copy.Exists(Method(4)), Core::ERROR_UNKNOWN_KEY);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,212 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    template <typename NUMBER, typename TYPE>
+    static void NumberRoundTrip(const TYPE value, const uint8_t header)
+    {
+        NUMBER number;
+        NUMBER result;
+        std::vector<uint8_t> buffer;
+
+        number = value;
+
+        EXPECT_TRUE(number.ToBuffer(buffer));
+        ASSERT_FALSE(buffer.empty());
+        EXPECT_EQ(buffer[0], header);
+
+        EXPECT_TRUE(result.FromBuffer(buffer));
+        EXPECT_TRUE(result.IsSet());
+        EXPECT_EQ(result.Value(), value);
+    }
+
+    // Moves the element through the MessagePack interface, a few bytes at the time.
+    template <typename ELEMENT>
+    static void Chunked(const ELEMENT& source, ELEMENT& destination, const uint16_t chunk)
+    {
+        std::vector<uint8_t> stream;
+        uint8_t buffer[64];
+        uint16_t offset = 0;
+        uint16_t loaded;
+
+        ASSERT_LE(chunk, sizeof(buffer));
+
+        do {
+            loaded = static_cast<const Core::JSON::IMessagePack&>(source).Serialize(buffer, chunk, offset);
+            stream.insert(stream.end(), buffer, buffer + loaded);
+        } while ((offset != 0) && (loaded == chunk));
+
+        EXPECT_EQ(offset, 0u);
+
+        uint32_t position = 0;
+        destination.Clear();
+
+        do {
+            const uint16_t size = static_cast<uint16_t>(std::min(static_cast<size_t>(chunk), stream.size() - position));
+            loaded = static_cast<Core::JSON::IMessagePack&>(destination).Deserialize(&(stream[position]), size, offset);
+            position += loaded;
+        } while ((offset != 0) && (position < stream.size()));
+
+        EXPECT_EQ(offset, 0u);
+        EXPECT_EQ(position, stream.size());
+    }
+
+    TEST(Core_MessagePack, Numbers)
+    {
+        NumberRoundTrip<Core::JSON::DecUInt32>(0u, 0x00);
+        NumberRoundTrip<Core::JSON::DecUInt32>(127u, 0x7F);
+        NumberRoundTrip<Core::JSON::DecUInt32>(128u, 0xCC);
+        NumberRoundTrip<Core::JSON::DecUInt32>(255u, 0xCC);
+        NumberRoundTrip<Core::JSON::DecUInt32>(256u, 0xCD);
+        NumberRoundTrip<Core::JSON::DecUInt32>(65536u, 0xCE);
+        NumberRoundTrip<Core::JSON::DecUInt32>(~0u, 0xCE);
+        NumberRoundTrip<Core::JSON::DecUInt64>(0x100000000ull, 0xCF);
+
+        NumberRoundTrip<Core::JSON::DecSInt32>(0, 0x00);
+        NumberRoundTrip<Core::JSON::DecSInt32>(5, 0x05);
+        NumberRoundTrip<Core::JSON::DecSInt32>(-1, 0xFF);
+        NumberRoundTrip<Core::JSON::DecSInt32>(-32, 0xE0);
+        NumberRoundTrip<Core::JSON::DecSInt32>(-33, 0xD0);
+        NumberRoundTrip<Core::JSON::DecSInt32>(-200, 0xD1);
+        NumberRoundTrip<Core::JSON::DecSInt32>(-32601, 0xD1);
+        NumberRoundTrip<Core::JSON::DecSInt32>(-100000, 0xD2);
+        NumberRoundTrip<Core::JSON::DecSInt32>(100000, 0xCE);
+        NumberRoundTrip<Core::JSON::DecSInt64>(-0x100000000ll, 0xD3);
+    }
+
+    TEST(Core_MessagePack, TextRoundTrip)
+    {
+        const string documents[] = {
+            _T("{\"callsign\":\"WebKitBrowser\",\"state\":\"activated\",\"observers\":42,\"delta\":-7,\"load\":3.25,\"autostart\":true,\"precondition\":null,\"list\":[1,2,[],{}]}"),
+            _T("[\"quote\\\"d\",\"back\\\\slash\",\"new\\nline\",\"\\u0001\"]"),
+            _T("\"just a string\""),
+            _T("-32768"),
+            _T("18446744073709551615"),
+            _T("false"),
+        };
+
+        for (const string& document : documents) {
+            string packed;
+            string text;
+
+            EXPECT_TRUE(Core::JSON::MessagePack::FromText(document, packed));
+            EXPECT_TRUE(Core::JSON::MessagePack::ToText(packed, text));
+            EXPECT_EQ(text, document);
+        }
+    }
+
+    TEST(Core_MessagePack, TextFormats)
+    {
+        string packed;
+        string text;
+
+        EXPECT_TRUE(Core::JSON::MessagePack::FromText(_T("{ \"a\" : [ 1, -1, 200, -200 ], \"b\": \"\\u00e9\" }"), packed));
+
+        const uint8_t expected[] = { 0x82, 0xA1, 'a', 0x94, 0x01, 0xFF, 0xCC, 0xC8, 0xD1, 0xFF, 0x38, 0xA1, 'b', 0xA2, 0xC3, 0xA9 };
+        EXPECT_EQ(packed, string(reinterpret_cast<const char*>(expected), sizeof(expected)));
+
+        // More than 15 entries widen the header.
+        string document(_T("["));
+        for (uint32_t index = 0; index < 300; index++) {
+            document += (index == 0 ? _T("") : _T(",")) + Core::NumberType<uint32_t>(index).Text();
+        }
+        document += ']';
+
+        EXPECT_TRUE(Core::JSON::MessagePack::FromText(document, packed));
+        EXPECT_EQ(static_cast<uint8_t>(packed[0]), 0xDC);
+        EXPECT_EQ(static_cast<uint8_t>(packed[1]), 0x01);
+        EXPECT_EQ(static_cast<uint8_t>(packed[2]), 0x2C);
+        EXPECT_TRUE(Core::JSON::MessagePack::ToText(packed, text));
+        EXPECT_EQ(text, document);
+
+        // Malformed input, or trailing data, is rejected.
+        EXPECT_FALSE(Core::JSON::MessagePack::FromText(_T("{\"a\":"), packed));
+        EXPECT_TRUE(packed.empty());
+        EXPECT_FALSE(Core::JSON::MessagePack::ToText(string(_T("\x92\x01")), text));
+        EXPECT_FALSE(Core::JSON::MessagePack::ToText(string(_T("\x01\x02")), text));
+    }
+
+    TEST(Core_MessagePack, Message)
+    {
+        Core::JSONRPC::Message request;
+        Core::JSONRPC::Message received;
+        string packed;
+        string text;
+
+        request.Id = 7;
+        request.Designator = _T("Controller.1.activate");
+        EXPECT_TRUE(Core::JSON::MessagePack::FromText(_T("{\"callsign\":\"WebKitBrowser\",\"index\":0}"), packed));
+        request.Parameters = packed;
+
+        for (uint16_t chunk = 1; chunk <= 64; chunk *= 2) {
+            Chunked(request, received, chunk);
+
+            EXPECT_EQ(received.Id.Value(), 7u);
+            EXPECT_EQ(received.Designator.Value(), _T("Controller.1.activate"));
+            EXPECT_EQ(received.Parameters.Value(), packed);
+            EXPECT_FALSE(received.Result.IsSet());
+            EXPECT_TRUE(Core::JSON::MessagePack::ToText(received.Parameters.Value(), text));
+            EXPECT_EQ(text, _T("{\"callsign\":\"WebKitBrowser\",\"index\":0}"));
+        }
+
+        Core::JSONRPC::Message response;
+        response.Id = 7;
+        response.Error.SetError(Core::ERROR_UNKNOWN_KEY);
+        response.Error.Text = _T("Unknown callsign");
+
+        Chunked(response, received, 5);
+
+        EXPECT_TRUE(received.Error.IsSet());
+        EXPECT_EQ(received.Error.Code.Value(), response.Error.Code.Value());
+        EXPECT_EQ(received.Error.Text.Value(), _T("Unknown callsign"));
+    }
+
+    TEST(Core_MessagePack, LargeResult)
+    {
+        Core::JSONRPC::Message response;
+        Core::JSONRPC::Message received;
+        string document(_T("{\"data\":["));
+        string packed;
+
+        for (uint32_t index = 0; index < 20000; index++) {
+            document += (index == 0 ? _T("\"") : _T(",\"")) + Core::NumberType<uint32_t>(index).Text() + _T("\"");
+        }
+        document += _T("]}");
+
+        EXPECT_TRUE(Core::JSON::MessagePack::FromText(document, packed));
+        EXPECT_GT(packed.length(), 0x10000u);
+
+        response.Id = 1;
+        response.Result = packed;
+
+        Chunked(response, received, 64);
+
+        string text;
+        EXPECT_EQ(received.Result.Value(), packed);
+        EXPECT_TRUE(Core::JSON::MessagePack::ToText(received.Result.Value(), text));
+        EXPECT_EQ(text, document);
+    }
+
+} // Tests
+} // WPEFramework
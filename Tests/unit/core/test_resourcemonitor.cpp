@@ -0,0 +1,253 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <set>
+#include <sys/socket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    typedef Core::ResourceMonitorType<Core::IResource, Core::Void> TestMonitor;
+
+    class SocketPair : public Core::IResource {
+    public:
+        SocketPair(const SocketPair&) = delete;
+        SocketPair& operator=(const SocketPair&) = delete;
+
+        SocketPair()
+            : _received(0)
+            , _handled(0)
+            , _thread(0)
+            , _signal(false, true)
+        {
+            ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, _descriptors);
+        }
+        ~SocketPair() override
+        {
+            ::close(_descriptors[0]);
+            ::close(_descriptors[1]);
+        }
+
+    public:
+        void Send(const uint8_t value)
+        {
+            ::write(_descriptors[1], &value, sizeof(value));
+        }
+        bool Wait(const uint32_t received, const uint32_t waitTime)
+        {
+            while ((_received < received) && (_signal.Lock(waitTime) == Core::ERROR_NONE)) {
+                _signal.ResetEvent();
+            }
+            return (_received >= received);
+        }
+        uint32_t Received() const
+        {
+            return (_received);
+        }
+        uint32_t Handled() const
+        {
+            return (_handled);
+        }
+        ::ThreadId Thread() const
+        {
+            return (_thread);
+        }
+
+        handle Descriptor() const override
+        {
+            return (_descriptors[0]);
+        }
+        uint16_t Events() override
+        {
+            return (POLLIN);
+        }
+        void Handle(const uint16_t events) override
+        {
+            _handled++;
+            _thread = Core::Thread::ThreadId();
+
+            if ((events & POLLIN) != 0) {
+                uint8_t buffer[16];
+                int loaded;
+
+                while ((loaded = ::read(_descriptors[0], buffer, sizeof(buffer))) > 0) {
+                    _received += loaded;
+                }
+                _signal.SetEvent();
+            }
+        }
+
+    private:
+        int _descriptors[2];
+        std::atomic<uint32_t> _received;
+        std::atomic<uint32_t> _handled;
+        std::atomic<::ThreadId> _thread;
+        Core::Event _signal;
+    };
+
+    static void Drain(TestMonitor& monitor)
+    {
+        // Give the monitor a chance to clean up the unregistered resources.
+        uint32_t waiting = 2000;
+
+        monitor.Break();
+
+        while ((monitor.Count() != 0) && (waiting != 0)) {
+            SleepMs(10);
+            waiting -= 10;
+        }
+        EXPECT_EQ(monitor.Count(), 0u);
+    }
+
+    static void DispatchReadyDescriptor(const TestMonitor::engine type)
+    {
+        TestMonitor monitor(type);
+        SocketPair channels[8];
+
+        for (SocketPair& channel : channels) {
+            monitor.Register(channel);
+        }
+
+        channels[3].Send(1);
+        EXPECT_TRUE(channels[3].Wait(1, 2000));
+
+        channels[3].Send(2);
+        channels[3].Send(3);
+        channels[6].Send(4);
+        EXPECT_TRUE(channels[3].Wait(3, 2000));
+        EXPECT_TRUE(channels[6].Wait(1, 2000));
+
+        EXPECT_EQ(channels[0].Received(), 0u);
+        EXPECT_EQ(channels[7].Received(), 0u);
+
+        for (SocketPair& channel : channels) {
+            monitor.Unregister(channel);
+        }
+
+        Drain(monitor);
+    }
+
+    TEST(Core_ResourceMonitor, PollDispatch)
+    {
+        DispatchReadyDescriptor(TestMonitor::POLL);
+    }
+
+    TEST(Core_ResourceMonitor, EpollDispatch)
+    {
+        DispatchReadyDescriptor(TestMonitor::EPOLL);
+    }
+
+    TEST(Core_ResourceMonitor, EpollOnlyHandlesReadyDescriptors)
+    {
+        TestMonitor monitor(TestMonitor::EPOLL);
+        SocketPair channels[16];
+
+        for (SocketPair& channel : channels) {
+            monitor.Register(channel);
+        }
+
+        // Let the registrations settle, every resource gets a Handle() on a Break().
+        channels[0].Send(1);
+        EXPECT_TRUE(channels[0].Wait(1, 2000));
+
+        uint32_t waiting = 2000;
+        while ((channels[15].Handled() == 0) && (waiting != 0)) {
+            SleepMs(10);
+            waiting -= 10;
+        }
+        SleepMs(50);
+
+        uint32_t idle = channels[15].Handled();
+
+        for (uint8_t index = 0; index < 32; index++) {
+            channels[0].Send(index);
+            EXPECT_TRUE(channels[0].Wait(index + 2, 2000));
+        }
+
+        if (monitor.Engine() == TestMonitor::EPOLL) {
+            EXPECT_EQ(channels[15].Handled(), idle);
+        }
+
+        for (SocketPair& channel : channels) {
+            monitor.Unregister(channel);
+        }
+
+        Drain(monitor);
+    }
+
+    TEST(Core_ResourceMonitor, Reactors)
+    {
+        Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
+
+        // One reactor, unless configured otherwise.
+        EXPECT_EQ(monitor.Reactors(), 1);
+        EXPECT_EQ(monitor.Reactors(3), Core::ERROR_NONE);
+        EXPECT_EQ(monitor.Reactors(), 3);
+
+        {
+            SocketPair channels[16];
+            std::set<::ThreadId> threads;
+
+            for (SocketPair& channel : channels) {
+                monitor.Register(channel);
+            }
+
+            // Resources are bound to their reactors now.
+            EXPECT_EQ(monitor.Reactors(2), Core::ERROR_ILLEGAL_STATE);
+
+            for (SocketPair& channel : channels) {
+                channel.Send(1);
+            }
+            for (SocketPair& channel : channels) {
+                EXPECT_TRUE(channel.Wait(1, 2000));
+                threads.insert(channel.Thread());
+            }
+
+            // The channels are spread, not all of them are handled by the same reactor thread.
+            EXPECT_GT(threads.size(), 1u);
+            EXPECT_LE(threads.size(), 3u);
+            EXPECT_EQ(threads.count(Core::Thread::ThreadId()), 0u);
+            EXPECT_FALSE(monitor.IsMonitor(Core::Thread::ThreadId()));
+
+            for (SocketPair& channel : channels) {
+                monitor.Unregister(channel);
+            }
+
+            monitor.Break();
+
+            uint32_t waiting = 2000;
+            while ((monitor.Count() != 0) && (waiting != 0)) {
+                SleepMs(10);
+                waiting -= 10;
+            }
+            EXPECT_EQ(monitor.Count(), 0u);
+
+            // Even without resources, the reactors are in use without a lock, they stay.
+            EXPECT_EQ(monitor.Reactors(2), Core::ERROR_ILLEGAL_STATE);
+            EXPECT_EQ(monitor.Reactors(), 3);
+        }
+
+        Core::Singleton::Dispose();
+    }
+
+} // Tests
+} // WPEFramework
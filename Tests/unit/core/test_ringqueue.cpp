@@ -0,0 +1,184 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    typedef Core::RingQueueType<uint32_t> TestQueue;
+
+    TEST(Core_RingQueue, PostExtractInOrder)
+    {
+        TestQueue queue(4);
+        uint32_t value = 0;
+
+        EXPECT_TRUE(queue.IsEmpty());
+        EXPECT_FALSE(queue.Extract(value, 0));
+
+        for (uint32_t index = 1; index <= 4; index++) {
+            EXPECT_TRUE(queue.Post(index));
+        }
+        EXPECT_TRUE(queue.IsFull());
+        EXPECT_EQ(queue.Length(), 4u);
+
+        // The high-water mark is respected by an Insert, not by a Post.
+        EXPECT_FALSE(queue.Insert(5, 10));
+        EXPECT_TRUE(queue.Post(5));
+
+        for (uint32_t index = 1; index <= 5; index++) {
+            EXPECT_TRUE(queue.Extract(value, 0));
+            EXPECT_EQ(value, index);
+        }
+        EXPECT_TRUE(queue.IsEmpty());
+    }
+
+    TEST(Core_RingQueue, PostBeyondTheRing)
+    {
+        // A high-water mark of 2 gives a ring of 4 slots, Posts do not stop there.
+        TestQueue queue(2);
+        uint32_t value = 0;
+
+        for (uint32_t index = 1; index <= 10; index++) {
+            EXPECT_TRUE(queue.Post(index));
+        }
+        EXPECT_EQ(queue.Length(), 10u);
+
+        EXPECT_TRUE(queue.Remove(7));
+
+        for (uint32_t index = 1; index <= 10; index++) {
+            if (index != 7) {
+                EXPECT_TRUE(queue.Extract(value, 0));
+                EXPECT_EQ(value, index);
+            }
+        }
+        EXPECT_FALSE(queue.Extract(value, 0));
+        EXPECT_TRUE(queue.IsEmpty());
+
+        // Once drained, the ring is used again.
+        EXPECT_TRUE(queue.Insert(11, 0));
+        EXPECT_TRUE(queue.Extract(value, 0));
+        EXPECT_EQ(value, 11u);
+    }
+
+    TEST(Core_RingQueue, RemoveIsSkipped)
+    {
+        TestQueue queue(8);
+        uint32_t value = 0;
+
+        for (uint32_t index = 1; index <= 4; index++) {
+            EXPECT_TRUE(queue.Insert(index, 0));
+        }
+
+        EXPECT_TRUE(queue.Remove(2));
+        EXPECT_FALSE(queue.Remove(2));
+        EXPECT_EQ(queue.Length(), 3u);
+
+        EXPECT_TRUE(queue.Extract(value, 0));
+        EXPECT_EQ(value, 1u);
+        EXPECT_TRUE(queue.Extract(value, 0));
+        EXPECT_EQ(value, 3u);
+        EXPECT_TRUE(queue.Extract(value, 0));
+        EXPECT_EQ(value, 4u);
+        EXPECT_FALSE(queue.Extract(value, 0));
+    }
+
+    TEST(Core_RingQueue, DisableReleasesWaiters)
+    {
+        TestQueue queue(1);
+        bool extracted = true;
+        bool inserted = true;
+
+        std::thread consumer([&]() {
+            uint32_t value;
+            extracted = queue.Extract(value, Core::infinite);
+        });
+
+        SleepMs(50);
+        queue.Disable();
+        consumer.join();
+
+        EXPECT_FALSE(extracted);
+
+        queue.Enable();
+        EXPECT_TRUE(queue.Insert(1, 0));
+
+        std::thread producer([&]() {
+            inserted = queue.Insert(2, Core::infinite);
+        });
+
+        SleepMs(50);
+        queue.Disable();
+        producer.join();
+
+        EXPECT_FALSE(inserted);
+
+        queue.Flush();
+        EXPECT_TRUE(queue.IsEmpty());
+    }
+
+    TEST(Core_RingQueue, MultipleProducersConsumers)
+    {
+        static constexpr uint32_t Producers = 4;
+        static constexpr uint32_t Consumers = 4;
+        static constexpr uint32_t Entries = 10000;
+
+        TestQueue queue(16);
+        std::atomic<uint64_t> sum(0);
+        std::atomic<uint32_t> count(0);
+        std::vector<std::thread> threads;
+
+        for (uint32_t index = 0; index < Consumers; index++) {
+            threads.emplace_back([&]() {
+                uint32_t value;
+                while (queue.Extract(value, Core::infinite) == true) {
+                    sum += value;
+                    count++;
+                }
+            });
+        }
+        for (uint32_t index = 0; index < Producers; index++) {
+            threads.emplace_back([&]() {
+                for (uint32_t value = 1; value <= Entries; value++) {
+                    EXPECT_TRUE(queue.Insert(value, Core::infinite));
+                }
+            });
+        }
+
+        uint32_t waiting = 5000;
+        while ((count < (Producers * Entries)) && (waiting != 0)) {
+            SleepMs(10);
+            waiting -= 10;
+        }
+
+        queue.Disable();
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(count.load(), Producers * Entries);
+        EXPECT_EQ(sum.load(), static_cast<uint64_t>(Producers) * Entries * (Entries + 1) / 2);
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,281 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <com/Administrator.h>
+#include <com/IUnknown.h>
+#include <atomic>
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    struct ICounter : virtual public Core::IUnknown {
+        enum { ID = 0x0000FF02 };
+
+        virtual uint32_t Value() const = 0;
+    };
+
+    static std::atomic<uint32_t> _constructed(0);
+    static std::atomic<uint32_t> _alive(0);
+
+    class CounterProxy : public ProxyStub::UnknownProxyType<ICounter> {
+    public:
+        CounterProxy(const Core::ProxyType<Core::IPCChannel>& channel, const RPC::instance_id& implementation, const bool outbound)
+            : BaseClass(channel, implementation, outbound)
+        {
+            _constructed++;
+            _alive++;
+        }
+        ~CounterProxy() override
+        {
+            _alive--;
+        }
+
+    public:
+        uint32_t Value() const override
+        {
+            return (0);
+        }
+    };
+
+    static ProxyStub::MethodHandler CounterStubMethods[] = {
+        nullptr
+    };
+
+    typedef ProxyStub::UnknownStubType<ICounter, CounterStubMethods> CounterStub;
+
+    // Holds the first remote release it gets till it is told to go on, so the proxy
+    // being released stays listed with nothing left to hand out.
+    class Releaser : public Core::IIPCServer {
+    public:
+        Releaser(const Releaser&) = delete;
+        Releaser& operator=(const Releaser&) = delete;
+
+        Releaser()
+            : _entered(false, true)
+            , _proceed(false, true)
+            , _calls(0)
+        {
+        }
+        ~Releaser() override = default;
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            Core::ProxyType<RPC::InvokeMessage> call(Core::proxy_cast<RPC::InvokeMessage>(message));
+
+            _calls++;
+            _entered.SetEvent();
+            _proceed.Lock(Core::infinite);
+
+            call->Response().Writer().Number<uint32_t>(Core::ERROR_NONE);
+
+            source.ReportResponse(message);
+        }
+        bool Entered(const uint32_t waitTime)
+        {
+            return (_entered.Lock(waitTime) == Core::ERROR_NONE);
+        }
+        void Proceed()
+        {
+            _proceed.SetEvent();
+        }
+        uint32_t Calls() const
+        {
+            return (_calls);
+        }
+
+    private:
+        Core::Event _entered;
+        Core::Event _proceed;
+        std::atomic<uint32_t> _calls;
+    };
+
+    static RPC::instance_id Implementation(const uint32_t index)
+    {
+        return (static_cast<RPC::instance_id>(0x10000 + (index * 64)));
+    }
+
+    static Core::ProxyType<Core::IPCChannel> Unopened(const TCHAR name[])
+    {
+        return (Core::ProxyType<Core::IPCChannel>(Core::ProxyType<Core::IPCChannelClientType<Core::Void, false, true>>::Create(Core::NodeId(name), 1024)));
+    }
+
+    TEST(Core_RPCAdministrator, Shards)
+    {
+        static constexpr uint32_t Proxies = 64;
+
+        RPC::Administrator& administrator(RPC::Administrator::Instance());
+        administrator.Announce<ICounter, CounterProxy, CounterStub>();
+
+        _alive = 0;
+
+        Core::ProxyType<Core::IPCChannel> channels[2] = { Unopened(_T("/tmp/testrpcadministrator0")), Unopened(_T("/tmp/testrpcadministrator1")) };
+        ProxyStub::UnknownProxy* proxies[2][Proxies];
+
+        // The same implementations on two channels, their keys spread over all shards.
+        for (uint8_t channel = 0; channel < 2; channel++) {
+            for (uint32_t index = 0; index < Proxies; index++) {
+                void* interface = nullptr;
+                proxies[channel][index] = administrator.ProxyInstance(channels[channel], Implementation(index), false, ICounter::ID, interface);
+                ASSERT_NE(proxies[channel][index], nullptr);
+                ASSERT_NE(interface, nullptr);
+            }
+        }
+        EXPECT_EQ(_alive.load(), 2 * Proxies);
+
+        for (uint8_t channel = 0; channel < 2; channel++) {
+            for (uint32_t index = 0; index < Proxies; index++) {
+                void* interface = nullptr;
+                EXPECT_EQ(administrator.ProxyFind(channels[channel], Implementation(index), ICounter::ID, interface), proxies[channel][index]);
+                ASSERT_NE(interface, nullptr);
+                static_cast<ICounter*>(interface)->Release();
+
+                // A live proxy is handed out again, not created next to it.
+                interface = nullptr;
+                EXPECT_EQ(administrator.ProxyInstance(channels[channel], Implementation(index), false, ICounter::ID, interface), proxies[channel][index]);
+                ASSERT_NE(interface, nullptr);
+                static_cast<ICounter*>(interface)->Release();
+            }
+        }
+        EXPECT_EQ(_alive.load(), 2 * Proxies);
+
+        void* interface = nullptr;
+        EXPECT_EQ(administrator.ProxyFind(channels[0], Implementation(Proxies), ICounter::ID, interface), nullptr);
+        EXPECT_EQ(interface, nullptr);
+
+        // Only the proxies of the deleted channel are reported, from whatever shard they are in.
+        std::list<ProxyStub::UnknownProxy*> pending;
+        administrator.DeleteChannel(channels[0], pending);
+        EXPECT_EQ(pending.size(), Proxies);
+
+        for (ProxyStub::UnknownProxy* proxy : pending) {
+            EXPECT_EQ(proxy->Channel().operator->(), channels[0].operator->());
+            proxy->Parent()->Release();
+        }
+
+        // The last release unregisters, and destroys, the proxy.
+        for (uint32_t index = 0; index < Proxies; index++) {
+            proxies[0][index]->Parent()->Release();
+            EXPECT_EQ(administrator.ProxyFind(channels[0], Implementation(index), ICounter::ID, interface), nullptr);
+
+            EXPECT_NE(administrator.ProxyFind(channels[1], Implementation(index), ICounter::ID, interface), nullptr);
+            static_cast<ICounter*>(interface)->Release();
+        }
+        EXPECT_EQ(_alive.load(), Proxies);
+
+        for (uint32_t index = 0; index < Proxies; index++) {
+            proxies[1][index]->Parent()->Release();
+            EXPECT_EQ(administrator.ProxyFind(channels[1], Implementation(index), ICounter::ID, interface), nullptr);
+        }
+        EXPECT_EQ(_alive.load(), 0u);
+
+        administrator.Recall<ICounter>();
+        Core::Singleton::Dispose();
+    }
+
+    TEST(Core_RPCAdministrator, Released)
+    {
+        const Core::NodeId node(_T("/tmp/testrpcadministrator"));
+
+        RPC::Administrator& administrator(RPC::Administrator::Instance());
+        administrator.Announce<ICounter, CounterProxy, CounterStub>();
+
+        _constructed = 0;
+        _alive = 0;
+
+        Core::ProxyType<Releaser> releaser(Core::ProxyType<Releaser>::Create());
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> serverFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        serverFactory->CreateFactory<RPC::InvokeMessage>(2);
+
+        Core::IPCChannelServerType<Core::Void, false> server(node, 512, serverFactory);
+        server.Register(RPC::InvokeMessage::Id(), Core::ProxyType<Core::IIPCServer>(releaser));
+        ASSERT_EQ(server.Open(1000), Core::ERROR_NONE);
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> clientFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        {
+            Core::ProxyType<Core::IPCChannelClientType<Core::Void, false, false>> client(Core::ProxyType<Core::IPCChannelClientType<Core::Void, false, false>>::Create(node, 512, clientFactory));
+            ASSERT_EQ(client->Source().Open(1000), Core::ERROR_NONE);
+
+            Core::ProxyType<Core::IPCChannel> channel(client);
+
+            void* interface = nullptr;
+            ProxyStub::UnknownProxy* first = administrator.ProxyInstance(channel, Implementation(0), true, ICounter::ID, interface);
+            ASSERT_NE(first, nullptr);
+            ASSERT_NE(interface, nullptr);
+
+            // The last release of an outbound proxy goes to the other side, it is listed with
+            // nothing left to hand out till that returns and it unregisters.
+            ICounter* counter = static_cast<ICounter*>(interface);
+            std::thread releasing([counter]() { counter->Release(); });
+
+            ASSERT_TRUE(releaser->Entered(5000));
+
+            ProxyStub::UnknownProxy* second = nullptr;
+            void* replacement = nullptr;
+            std::thread instancing([&]() { second = administrator.ProxyInstance(channel, Implementation(0), true, ICounter::ID, replacement); });
+
+            // Let the lookup reach the proxy being released before it is let go.
+            SleepMs(100);
+            releaser->Proceed();
+
+            releasing.join();
+            instancing.join();
+
+            // The released proxy was skipped for a new one, and unregistering it left the new one listed.
+            ASSERT_NE(second, nullptr);
+            ASSERT_NE(replacement, nullptr);
+            EXPECT_EQ(_constructed.load(), 2u);
+            EXPECT_EQ(_alive.load(), 1u);
+
+            interface = nullptr;
+            EXPECT_EQ(administrator.ProxyFind(channel, Implementation(0), ICounter::ID, interface), second);
+            ASSERT_NE(interface, nullptr);
+            static_cast<ICounter*>(interface)->Release();
+
+            static_cast<ICounter*>(replacement)->Release();
+            EXPECT_EQ(releaser->Calls(), 2u);
+            EXPECT_EQ(_alive.load(), 0u);
+
+            interface = nullptr;
+            EXPECT_EQ(administrator.ProxyFind(channel, Implementation(0), ICounter::ID, interface), nullptr);
+
+            EXPECT_EQ(client->Close(1000), Core::ERROR_NONE);
+        }
+
+        for (uint32_t attempt = 0; (attempt < 100) && (server[0].IsValid() == true); attempt++) {
+            SleepMs(10);
+            server.Cleanup();
+        }
+
+        server.Unregister(RPC::InvokeMessage::Id());
+        EXPECT_EQ(server.Close(1000), Core::ERROR_NONE);
+
+        clientFactory->DestroyFactories();
+        serverFactory->DestroyFactories();
+
+        administrator.Recall<ICounter>();
+        Core::Singleton::Dispose();
+    }
+
+} // Tests
+} // WPEFramework
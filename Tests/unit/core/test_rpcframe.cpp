@@ -0,0 +1,344 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <com/Messages.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static void Fill(uint8_t buffer[], const uint32_t length, const uint8_t seed)
+    {
+        for (uint32_t index = 0; index < length; index++) {
+            buffer[index] = static_cast<uint8_t>((index * 7) + seed);
+        }
+    }
+
+    static bool Check(const uint8_t buffer[], const uint32_t length, const uint8_t seed)
+    {
+        uint32_t index = 0;
+
+        while ((index < length) && (buffer[index] == static_cast<uint8_t>((index * 7) + seed))) {
+            index++;
+        }
+
+        return (index == length);
+    }
+
+    // Moves the message over in pieces of the given size, like the channel does.
+    template <typename MESSAGE>
+    static void Transfer(const MESSAGE& source, MESSAGE& destination, const uint16_t chunk)
+    {
+        uint8_t buffer[0x10000];
+        uint32_t offset = 0;
+
+        destination.Expect(source.Length());
+
+        while (offset < source.Length()) {
+            const uint16_t loaded = source.Serialize(buffer, chunk, offset);
+            uint16_t handled = 0;
+
+            ASSERT_NE(loaded, 0);
+
+            while (handled < loaded) {
+                handled += destination.Deserialize(&buffer[handled], loaded - handled, offset + handled);
+            }
+            offset += loaded;
+        }
+    }
+
+    typedef Core::IPCMessageType<2, RPC::Data::Input, RPC::Data::Output> Invoke;
+
+    // Sends every stream it gets back in reverse, written in place like a stub does for an output buffer.
+    class Mirror : public Core::IIPCServer {
+    public:
+        Mirror(const Mirror&) = delete;
+        Mirror& operator=(const Mirror&) = delete;
+
+        Mirror() = default;
+        ~Mirror() override = default;
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            Core::ProxyType<Invoke> call(Core::proxy_cast<Invoke>(message));
+            RPC::Data::Frame::Reader reader(call->Parameters().Reader());
+            const uint8_t count = reader.Number<uint8_t>();
+
+            std::vector<std::pair<const uint8_t*, uint32_t>> streams;
+
+            for (uint8_t index = 0; index < count; index++) {
+                const uint8_t* buffer = nullptr;
+                const uint32_t length = reader.Stream(buffer);
+                streams.emplace_back(buffer, length);
+            }
+
+            RPC::Data::Frame::Writer writer(call->Response().Writer());
+            writer.Number<uint8_t>(count);
+
+            for (const std::pair<const uint8_t*, uint32_t>& stream : streams) {
+                uint8_t* buffer = call->Response().Allocate(stream.second);
+
+                for (uint32_t index = 0; index < stream.second; index++) {
+                    buffer[index] = stream.first[stream.second - 1 - index];
+                }
+                writer.Stream(stream.second, buffer);
+            }
+
+            source.ReportResponse(message);
+        }
+    };
+
+    TEST(Core_RPCFrame, Streams)
+    {
+        const uint32_t sizes[] = { 1, 0, 0x20000, 4000, 0x10000 };
+        std::vector<std::vector<uint8_t>> buffers;
+
+        RPC::Data::Input input;
+        input.Set(0x1234, 0x5678, 9);
+
+        RPC::Data::Frame::Writer writer(input.Writer());
+        writer.Text(_T("streams"));
+
+        for (uint8_t index = 0; index < (sizeof(sizes) / sizeof(sizes[0])); index++) {
+            buffers.emplace_back(sizes[index]);
+            Fill(buffers.back().data(), sizes[index], index);
+            writer.Stream(sizes[index], buffers.back().data());
+            writer.Number<uint32_t>(sizes[index]);
+        }
+
+        // The caller may reuse its buffers right away, the frame holds a copy.
+        for (std::vector<uint8_t>& buffer : buffers) {
+            std::fill(buffer.begin(), buffer.end(), 0);
+        }
+
+        const uint16_t chunks[] = { 1, 5, 1000, 0xFFFF };
+
+        for (uint16_t chunk : chunks) {
+            RPC::Data::Input received;
+
+            Transfer(input, received, chunk);
+
+            EXPECT_EQ(received.Length(), input.Length());
+            EXPECT_EQ(received.Implementation(), 0x1234u);
+            EXPECT_EQ(received.InterfaceId(), 0x5678u);
+            EXPECT_EQ(received.MethodId(), 9);
+
+            RPC::Data::Frame::Reader reader(received.Reader());
+            EXPECT_EQ(reader.Text(), _T("streams"));
+
+            for (uint8_t index = 0; index < (sizeof(sizes) / sizeof(sizes[0])); index++) {
+                const uint8_t* buffer = nullptr;
+
+                EXPECT_EQ(reader.Stream(buffer), sizes[index]);
+                EXPECT_EQ(reader.Number<uint32_t>(), sizes[index]);
+
+                if (sizes[index] != 0) {
+                    ASSERT_NE(buffer, nullptr);
+                    EXPECT_TRUE(Check(buffer, sizes[index], index));
+                }
+            }
+            EXPECT_FALSE(reader.HasData());
+
+            // Cleared, it is a frame like any other.
+            received.Clear();
+            EXPECT_EQ(received.Length(), 6u);
+        }
+    }
+
+    TEST(Core_RPCFrame, Allocate)
+    {
+        RPC::Data::Output output;
+        RPC::Data::Frame::Writer writer(output.Writer());
+
+        uint8_t* buffer = output.Allocate(5000);
+        Fill(buffer, 4000, 3);
+
+        // Less than allocated can go out, what is allocated but not written does not.
+        writer.Stream(4000, buffer);
+        output.Allocate(100);
+        writer.Boolean(true);
+
+        RPC::Data::Output received;
+        Transfer(output, received, 300);
+        EXPECT_EQ(received.Length(), output.Length());
+
+        RPC::Data::Frame::Reader reader(received.Reader());
+        uint8_t copy[6000];
+
+        EXPECT_EQ(reader.Stream(sizeof(copy), copy), 4000u);
+        EXPECT_TRUE(Check(copy, 4000, 3));
+        EXPECT_TRUE(reader.Boolean());
+
+        // A stream that is announced but not there, does not read outside of the frame.
+        RPC::Data::Output broken;
+        RPC::Data::Frame::Writer liar(broken.Writer());
+        liar.Number<uint32_t>(1000);
+
+        RPC::Data::Output lied;
+        Transfer(broken, lied, 100);
+
+        const uint8_t* nothing = nullptr;
+        EXPECT_EQ(lied.Reader().Stream(nothing), 0u);
+        EXPECT_EQ(nothing, nullptr);
+    }
+
+    TEST(Core_RPCFrame, Oversized)
+    {
+        // A header of an empty frame, announcing ~4GB of streams.
+        const uint8_t header[] = { 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x01, 0x02 };
+        RPC::Data::Output received;
+
+        received.Expect(sizeof(header));
+        received.Deserialize(header, sizeof(header), 0);
+        EXPECT_EQ(received.Length(), 6u);
+
+        // Without an announced length, still not more than the cap.
+        RPC::Data::Input unannounced;
+        unannounced.Deserialize(header, sizeof(header), 0);
+        EXPECT_EQ(unannounced.Length(), 6u);
+
+        // Announcing more streams than the message holds is just as bad.
+        const uint8_t more[] = { 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x02 };
+        RPC::Data::Output truncated;
+
+        truncated.Expect(sizeof(more));
+        truncated.Deserialize(more, sizeof(more), 0);
+        EXPECT_EQ(truncated.Length(), 6u);
+    }
+
+    TEST(Core_RPCFrame, Protocol)
+    {
+        Core::ProxyType<RPC::AnnounceMessage> sent(Core::ProxyType<RPC::AnnounceMessage>::Create());
+        Core::ProxyType<RPC::AnnounceMessage> received(Core::ProxyType<RPC::AnnounceMessage>::Create());
+
+        sent->Parameters().Set(Core::ProcessInfo().Id(), _T("Example"), 0x1234, 1);
+        Transfer(*sent->IParameters(), *received->IParameters(), 100);
+        EXPECT_TRUE(received->Parameters().IsCompatible());
+        EXPECT_EQ(received->Parameters().ClassName(), _T("Example"));
+
+        sent->Response().Set(0, 1, _T("/proxystubs"), _T("[]"), true);
+        Transfer(*sent->IResponse(), *received->IResponse(), 100);
+        EXPECT_TRUE(received->Response().IsCompatible());
+        EXPECT_TRUE(received->Response().SharedMemory());
+
+        // An Init of a peer without the protocol word, it starts with the process id.
+        struct {
+            uint32_t id;
+            RPC::instance_id implementation;
+            uint32_t interfaceId;
+            uint32_t exchangeId;
+            uint32_t versionId;
+            char className[64];
+        } previous;
+
+        ::memset(&previous, 0, sizeof(previous));
+        previous.id = Core::ProcessInfo().Id();
+
+        received->IParameters()->Expect(sizeof(previous));
+        received->IParameters()->Deserialize(reinterpret_cast<const uint8_t*>(&previous), sizeof(previous), 0);
+        EXPECT_FALSE(received->Parameters().IsCompatible());
+
+        // A setup of a peer without the protocol word, no shared memory and no protocol.
+        Core::FrameType<64> frame;
+        uint8_t buffer[64];
+
+        frame.SetNumber<RPC::instance_id>(0, 0);
+        frame.SetNumber<uint32_t>(sizeof(RPC::instance_id), 1);
+        const uint16_t length = frame.SetText(sizeof(RPC::instance_id) + sizeof(uint32_t), _T("/proxystubs"));
+        frame.SetText(sizeof(RPC::instance_id) + sizeof(uint32_t) + length, _T("[]"));
+
+        const uint16_t loaded = static_cast<uint16_t>(frame.Size());
+        ::memcpy(buffer, &(frame[0]), loaded);
+
+        received->Response().Clear();
+        received->IResponse()->Expect(loaded);
+        received->IResponse()->Deserialize(buffer, loaded, 0);
+        EXPECT_TRUE(received->Response().IsSet());
+        EXPECT_FALSE(received->Response().IsCompatible());
+    }
+
+    TEST(Core_RPCFrame, Channel)
+    {
+        const Core::NodeId node(_T("/tmp/testrpcframe"));
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> serverFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        serverFactory->CreateFactory<Invoke>(2);
+
+        Core::IPCChannelServerType<Core::Void, false> server(node, 512, serverFactory);
+        server.Register(Invoke::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<Mirror>::Create()));
+        ASSERT_EQ(server.Open(1000), Core::ERROR_NONE);
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> clientFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create());
+        {
+            Core::IPCChannelClientType<Core::Void, false, false> client(node, 512, clientFactory);
+            ASSERT_EQ(client.Source().Open(1000), Core::ERROR_NONE);
+
+            // Well over the 64K a frame can hold, there and back.
+            const uint32_t sizes[] = { 0x300000, 10, 0x12345 };
+
+            Core::ProxyType<Invoke> message(Core::ProxyType<Invoke>::Create());
+            std::vector<uint8_t> buffer;
+
+            RPC::Data::Frame::Writer writer(message->Parameters().Writer());
+            writer.Number<uint8_t>(sizeof(sizes) / sizeof(sizes[0]));
+
+            for (uint32_t size : sizes) {
+                buffer.resize(size);
+                Fill(buffer.data(), size, static_cast<uint8_t>(size));
+                writer.Stream(size, buffer.data());
+            }
+
+            EXPECT_EQ(client.Invoke(message, 5000), Core::ERROR_NONE);
+
+            RPC::Data::Frame::Reader reader(message->Response().Reader());
+            EXPECT_EQ(reader.Number<uint8_t>(), sizeof(sizes) / sizeof(sizes[0]));
+
+            for (uint32_t size : sizes) {
+                const uint8_t* result = nullptr;
+
+                ASSERT_EQ(reader.Stream(result), size);
+                ASSERT_NE(result, nullptr);
+
+                buffer.resize(size);
+                for (uint32_t index = 0; index < size; index++) {
+                    buffer[index] = result[size - 1 - index];
+                }
+                EXPECT_TRUE(Check(buffer.data(), size, static_cast<uint8_t>(size)));
+            }
+
+            EXPECT_EQ(client.Close(1000), Core::ERROR_NONE);
+        }
+
+        for (uint32_t attempt = 0; (attempt < 100) && (server[0].IsValid() == true); attempt++) {
+            SleepMs(10);
+            server.Cleanup();
+        }
+
+        server.Unregister(Invoke::Id());
+        EXPECT_EQ(server.Close(1000), Core::ERROR_NONE);
+
+        clientFactory->DestroyFactories();
+        serverFactory->DestroyFactories();
+        Core::Singleton::Dispose();
+    }
+
+} // Tests
+} // WPEFramework
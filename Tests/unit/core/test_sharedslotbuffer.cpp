@@ -0,0 +1,187 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static const TCHAR SlotBufferName[] = _T("/tmp/testslotbuffer01");
+    static constexpr uint16_t Slots = 4;
+    static constexpr uint32_t SlotSize = 4096;
+    static constexpr uint32_t Samples = 100;
+
+    TEST(Core_SharedSlotBuffer, Pipelined)
+    {
+        IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator& testAdmin) {
+            Core::SharedSlotBuffer buffer(SlotBufferName, Core::File::USER_READ | Core::File::USER_WRITE, Slots, SlotSize, sizeof(uint32_t));
+
+            EXPECT_EQ(buffer.Slots(), Slots);
+            EXPECT_EQ(buffer.SlotSize(), SlotSize);
+
+            testAdmin.Sync("setup producer");
+            testAdmin.Sync("setup consumer");
+
+            uint32_t sent = 0;
+            uint32_t received = 0;
+
+            // Keep all slots busy, the answers come back in the order the requests went out.
+            while (received < Samples) {
+                uint16_t slot;
+
+                if ((sent < Samples) && (buffer.RequestProduce(0, slot) == Core::ERROR_NONE)) {
+                    const uint32_t length = 1 + ((sent * 37) % SlotSize);
+
+                    ::memcpy(buffer.AdministrationBuffer(slot), &sent, sizeof(sent));
+                    ::memset(buffer.Buffer(slot), static_cast<uint8_t>(sent), length);
+                    buffer.Length(slot, length);
+                    buffer.Produced(slot);
+                    sent++;
+                } else {
+                    ASSERT_EQ(buffer.RequestResult(Core::infinite, slot), Core::ERROR_NONE);
+
+                    uint32_t sequence;
+                    ::memcpy(&sequence, buffer.AdministrationBuffer(slot), sizeof(sequence));
+                    EXPECT_EQ(sequence, received);
+                    EXPECT_EQ(buffer.Length(slot), 1 + ((received * 37) % SlotSize));
+                    EXPECT_EQ(buffer.Buffer(slot)[0], static_cast<uint8_t>(received + 1));
+                    EXPECT_EQ(buffer.Buffer(slot)[buffer.Length(slot) - 1], static_cast<uint8_t>(received + 1));
+
+                    buffer.Released(slot);
+                    received++;
+                }
+            }
+
+            EXPECT_EQ(buffer.Pending(), 0);
+
+            testAdmin.Sync("producer done");
+        };
+
+        IPTestAdministrator testAdmin(otherSide);
+
+        {
+            testAdmin.Sync("setup producer");
+
+            Core::SharedSlotBuffer buffer(SlotBufferName);
+            EXPECT_EQ(buffer.Slots(), Slots);
+
+            testAdmin.Sync("setup consumer");
+
+            for (uint32_t index = 0; index < Samples; index++) {
+                uint16_t slot;
+
+                ASSERT_EQ(buffer.RequestConsume(Core::infinite, slot), Core::ERROR_NONE);
+
+                // Handled in place.
+                uint8_t* data = buffer.Buffer(slot);
+                for (uint32_t position = 0; position < buffer.Length(slot); position++) {
+                    data[position]++;
+                }
+
+                buffer.Consumed(slot);
+            }
+        }
+
+        testAdmin.Sync("producer done");
+
+        Core::Singleton::Dispose();
+    }
+
+    TEST(Core_SharedSlotBuffer, Timeouts)
+    {
+        Core::SharedSlotBuffer buffer(_T("/tmp/testslotbuffer02"), Core::File::USER_READ | Core::File::USER_WRITE, 2, 64, 0);
+        uint16_t slot;
+
+        EXPECT_EQ(buffer.RequestConsume(0, slot), Core::ERROR_TIMEDOUT);
+        EXPECT_EQ(buffer.RequestResult(10, slot), Core::ERROR_TIMEDOUT);
+
+        for (uint16_t index = 0; index < 2; index++) {
+            ASSERT_EQ(buffer.RequestProduce(0, slot), Core::ERROR_NONE);
+            EXPECT_EQ(slot, index);
+            buffer.Produced(slot);
+        }
+
+        // All slots in use.
+        EXPECT_EQ(buffer.RequestProduce(10, slot), Core::ERROR_TIMEDOUT);
+        EXPECT_EQ(buffer.Pending(), 2);
+
+        ASSERT_EQ(buffer.RequestConsume(0, slot), Core::ERROR_NONE);
+        EXPECT_EQ(slot, 0);
+        buffer.Consumed(slot);
+
+        // Consumed is not yet free, the answer has to be taken out first.
+        EXPECT_EQ(buffer.RequestProduce(0, slot), Core::ERROR_TIMEDOUT);
+        ASSERT_EQ(buffer.RequestResult(0, slot), Core::ERROR_NONE);
+        EXPECT_EQ(slot, 0);
+        buffer.Released(slot);
+
+        ASSERT_EQ(buffer.RequestProduce(0, slot), Core::ERROR_NONE);
+        EXPECT_EQ(slot, 0);
+    }
+
+    TEST(Core_SharedSlotBuffer, Validation)
+    {
+        static const TCHAR name[] = _T("/tmp/testslotbuffer03");
+
+        Core::SharedSlotBuffer producer(name, Core::File::USER_READ | Core::File::USER_WRITE, Slots, 64, 0);
+        ASSERT_TRUE(producer.IsValid());
+
+        {
+            Core::SharedSlotBuffer consumer(name);
+            EXPECT_TRUE(consumer.IsValid());
+            EXPECT_EQ(consumer.Slots(), Slots);
+        }
+
+        // Tamper with the header as the producer wrote it: slots, slot size and stride.
+        Core::DataElementFile file(name, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE, 0);
+        ASSERT_TRUE(file.IsValid());
+
+        uint32_t* header = reinterpret_cast<uint32_t*>(file.Buffer());
+        const uint32_t original[] = { header[0], header[1], header[3] };
+
+        const uint32_t corrupted[][3] = {
+            { 0, original[1], original[2] },
+            { 3, original[1], original[2] },
+            { Slots * 2, original[1], original[2] },
+            { original[0], original[1] + 4096, original[2] },
+            { original[0], original[1], original[2] * 2 }
+        };
+
+        for (const uint32_t(&entry)[3] : corrupted) {
+            header[0] = entry[0];
+            header[1] = entry[1];
+            header[3] = entry[2];
+
+            Core::SharedSlotBuffer consumer(name);
+            EXPECT_FALSE(consumer.IsValid());
+        }
+
+        header[0] = original[0];
+        header[1] = original[1];
+        header[3] = original[2];
+
+        Core::SharedSlotBuffer consumer(name);
+        EXPECT_TRUE(consumer.IsValid());
+    }
+
+} // Tests
+} // WPEFramework
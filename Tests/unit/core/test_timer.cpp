@@ -0,0 +1,248 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+#include <mutex>
+
+namespace WPEFramework {
+namespace Tests {
+
+    class Journal {
+    public:
+        Journal(const Journal&) = delete;
+        Journal& operator=(const Journal&) = delete;
+
+        Journal()
+            : _lock()
+            , _fired()
+        {
+        }
+
+    public:
+        void Fired(const uint32_t id)
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _fired.push_back(id);
+        }
+        std::vector<uint32_t> Fired() const
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            return (_fired);
+        }
+        bool Wait(const uint32_t count, const uint32_t waitTime) const
+        {
+            uint32_t waiting = waitTime;
+            while ((Fired().size() < count) && (waiting != 0)) {
+                SleepMs(5);
+                waiting -= 5;
+            }
+            return (Fired().size() >= count);
+        }
+
+    private:
+        mutable std::mutex _lock;
+        std::vector<uint32_t> _fired;
+    };
+
+    class Hashed {
+    public:
+        Hashed& operator=(const Hashed&) = delete;
+
+        Hashed(Journal& journal, const uint32_t id, const uint32_t repeat = 0)
+            : _journal(&journal)
+            , _id(id)
+            , _repeat(repeat)
+        {
+        }
+        Hashed(const Hashed& copy)
+            : _journal(copy._journal)
+            , _id(copy._id)
+            , _repeat(copy._repeat)
+        {
+        }
+
+    public:
+        bool operator==(const Hashed& rhs) const
+        {
+            return (rhs._id == _id);
+        }
+        bool operator!=(const Hashed& rhs) const
+        {
+            return (!operator==(rhs));
+        }
+        uint64_t Hash() const
+        {
+            return (_id);
+        }
+        uint64_t Timed(const uint64_t scheduledTime)
+        {
+            _journal->Fired(_id);
+
+            // Fire again, 10ms after the previous schedule, till we are done.
+            return (_repeat-- > 0 ? scheduledTime + (10 * Core::Time::TicksPerMillisecond) : 0);
+        }
+
+    private:
+        Journal* _journal;
+        uint32_t _id;
+        uint32_t _repeat;
+    };
+
+    // Same as the Hashed one, but without a Hash(), so it is not indexed.
+    class Plain {
+    public:
+        Plain& operator=(const Plain&) = delete;
+
+        Plain(Journal& journal, const uint32_t id, const uint32_t repeat = 0)
+            : _journal(&journal)
+            , _id(id)
+            , _repeat(repeat)
+        {
+        }
+        Plain(const Plain& copy)
+            : _journal(copy._journal)
+            , _id(copy._id)
+            , _repeat(copy._repeat)
+        {
+        }
+
+    public:
+        bool operator==(const Plain& rhs) const
+        {
+            return (rhs._id == _id);
+        }
+        bool operator!=(const Plain& rhs) const
+        {
+            return (!operator==(rhs));
+        }
+        uint64_t Timed(const uint64_t scheduledTime)
+        {
+            _journal->Fired(_id);
+
+            return (_repeat-- > 0 ? scheduledTime + (10 * Core::Time::TicksPerMillisecond) : 0);
+        }
+
+    private:
+        Journal* _journal;
+        uint32_t _id;
+        uint32_t _repeat;
+    };
+
+    template <typename TIMER, typename CONTENT>
+    static void FiresInOrder()
+    {
+        Journal journal;
+        TIMER timer(Core::Thread::DefaultStackSize(), _T("TestTimer"));
+        const uint64_t now = Core::Time::Now().Ticks();
+        const uint64_t step = 20 * Core::Time::TicksPerMillisecond;
+
+        // Scheduled out of order, 2 and 5 share the same time and should keep their order.
+        timer.Schedule(now + (4 * step), CONTENT(journal, 4));
+        timer.Schedule(now + (2 * step), CONTENT(journal, 2));
+        timer.Schedule(now + (1 * step), CONTENT(journal, 1));
+        timer.Schedule(now + (3 * step), CONTENT(journal, 3));
+        timer.Schedule(now + (2 * step), CONTENT(journal, 5));
+        timer.Schedule(now + (6 * step), CONTENT(journal, 6));
+
+        EXPECT_EQ(timer.Pending(), 6u);
+
+        // Revoke something in the middle and move the last one up front.
+        EXPECT_TRUE(timer.Revoke(CONTENT(journal, 3)));
+        EXPECT_FALSE(timer.Revoke(CONTENT(journal, 3)));
+        timer.Trigger(now, CONTENT(journal, 6));
+
+        EXPECT_EQ(timer.Pending(), 5u);
+        EXPECT_TRUE(journal.Wait(5, 2000));
+
+        std::vector<uint32_t> expected = { 6, 1, 2, 5, 4 };
+        EXPECT_EQ(journal.Fired(), expected);
+        EXPECT_EQ(timer.Pending(), 0u);
+    }
+
+    template <typename TIMER, typename CONTENT>
+    static void Reschedules()
+    {
+        Journal journal;
+        TIMER timer(Core::Thread::DefaultStackSize(), _T("TestTimer"));
+
+        timer.Schedule(Core::Time::Now().Add(10), CONTENT(journal, 7, 3));
+
+        EXPECT_TRUE(journal.Wait(4, 2000));
+        SleepMs(50);
+
+        EXPECT_EQ(journal.Fired().size(), 4u);
+        EXPECT_EQ(timer.Pending(), 0u);
+    }
+
+    TEST(Core_Timer, ListFiresInOrder)
+    {
+        FiresInOrder<Core::TimerType<Plain, Core::TimerListType>, Plain>();
+    }
+
+    TEST(Core_Timer, HeapFiresInOrder)
+    {
+        FiresInOrder<Core::TimerType<Plain>, Plain>();
+    }
+
+    TEST(Core_Timer, HeapIndexedFiresInOrder)
+    {
+        FiresInOrder<Core::TimerType<Hashed>, Hashed>();
+    }
+
+    TEST(Core_Timer, ListReschedules)
+    {
+        Reschedules<Core::TimerType<Plain, Core::TimerListType>, Plain>();
+    }
+
+    TEST(Core_Timer, HeapReschedules)
+    {
+        Reschedules<Core::TimerType<Hashed>, Hashed>();
+    }
+
+    TEST(Core_Timer, HeapManyEntries)
+    {
+        Journal journal;
+        Core::TimerType<Hashed> timer(Core::Thread::DefaultStackSize(), _T("TestTimer"));
+        const uint64_t now = Core::Time::Now().Ticks();
+
+        // Pseudo random times, revoke every third one.
+        for (uint32_t index = 0; index < 300; index++) {
+            timer.Schedule(now + ((((index * 7919) % 300) + 10) * 100), Hashed(journal, index));
+        }
+        for (uint32_t index = 0; index < 300; index += 3) {
+            EXPECT_TRUE(timer.Revoke(Hashed(journal, index)));
+        }
+
+        EXPECT_TRUE(journal.Wait(200, 2000));
+
+        std::vector<uint32_t> fired = journal.Fired();
+        ASSERT_EQ(fired.size(), 200u);
+
+        for (uint32_t index = 0; index < fired.size(); index++) {
+            EXPECT_NE(fired[index] % 3, 0u);
+            if (index > 0) {
+                EXPECT_LT((fired[index - 1] * 7919) % 300, (fired[index] * 7919) % 300);
+            }
+        }
+    }
+
+} // Tests
+} // WPEFramework
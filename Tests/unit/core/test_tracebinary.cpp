@@ -0,0 +1,165 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <tracing/tracing.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // A definition as the TraceUnit puts it in the trace buffer: [0][DEFINITION][id][format].
+    static string Definition(const uint32_t id, const string& format)
+    {
+        string result(Trace::Binary::HeaderSize, '\0');
+
+        result[1] = Trace::Binary::DEFINITION;
+        ::memcpy(&result[2], &id, sizeof(id));
+
+        return (result + format);
+    }
+
+    static string Decode(Trace::Decoder& decoder, const Trace::Binary& data)
+    {
+        string text;
+
+        EXPECT_TRUE(decoder.Decode(data.Data(), data.Length(), text));
+
+        return (text);
+    }
+
+    TEST(Trace_Binary, Decode)
+    {
+        Trace::Decoder decoder;
+        const string definition(Definition(1, _T("%d %u %lld %llu %i|%5.2f|%s|%-6s|%x %c %% done")));
+        string text;
+
+        EXPECT_FALSE(decoder.Decode(definition.c_str(), static_cast<uint16_t>(definition.length()), text));
+        EXPECT_EQ(decoder.Formats(), 1u);
+
+        const string name(_T("name"));
+        Trace::Binary data(1, -42, 42u, static_cast<int64_t>(-1) << 40, static_cast<uint64_t>(1) << 63, static_cast<int16_t>(-7), 3.14159, name, _T("abc"), -1, 'z');
+
+        EXPECT_TRUE(Trace::Binary::IsBinary(data.Data(), data.Length()));
+        EXPECT_EQ(Decode(decoder, data), _T("-42 42 -1099511627776 9223372036854775808 -7| 3.14|name|abc   |ffffffff z % done"));
+    }
+
+    TEST(Trace_Binary, DecodeWidthAndPointers)
+    {
+        Trace::Decoder decoder;
+        const string definition(Definition(0x1234, _T("[%*d] [%-*s] %p %p")));
+        string text;
+
+        EXPECT_FALSE(decoder.Decode(definition.c_str(), static_cast<uint16_t>(definition.length()), text));
+
+        const void* pointer = reinterpret_cast<const void*>(0xABCD);
+        const char* none = nullptr;
+        Trace::Binary data(0x1234, 4, 7, 5, _T("ab"), pointer, none);
+
+        char expected[64];
+        ::snprintf(expected, sizeof(expected), "[   7] [ab   ] %p %p", pointer, static_cast<const void*>(nullptr));
+        EXPECT_EQ(Decode(decoder, data), string(expected));
+
+        // More conversions than arguments.
+        Trace::Binary missing(0x1234, 4, 7);
+        EXPECT_EQ(Decode(decoder, missing).substr(0, 16), _T("[   7] [<?>] <?>"));
+
+        // A width from a corrupt record, or format, is capped to what a record can hold.
+        Trace::Binary wide(0x1234, 2000000000, 7, -2000000000, _T("ab"), pointer, none);
+        EXPECT_LE(Decode(decoder, wide).length(), 2u * 0xFFFF + 64);
+
+        const string huge(Definition(0x4321, _T("[%999999999999s]")));
+        EXPECT_FALSE(decoder.Decode(huge.c_str(), static_cast<uint16_t>(huge.length()), text));
+        Trace::Binary padded(0x4321, _T("ab"));
+        EXPECT_EQ(Decode(decoder, padded).length(), 0xFFFFu + 2);
+    }
+
+    TEST(Trace_Binary, DecodeUnknown)
+    {
+        Trace::Decoder decoder;
+
+        // Text traces pass as they are.
+        const char plain[] = "Just text";
+        string text;
+        EXPECT_TRUE(decoder.Decode(plain, sizeof(plain) - 1, text));
+        EXPECT_EQ(text, _T("Just text"));
+
+        // Without its definition, the raw arguments are shown.
+        Trace::Binary data(0xCAFE, 12, _T("text"), 0.5);
+        EXPECT_EQ(Decode(decoder, data), _T("<format 0x0000CAFE> 12 \"text\" 0.5"));
+
+        // A new definition for the same id replaces the old one.
+        const string first(Definition(0xCAFE, _T("first %d")));
+        const string second(Definition(0xCAFE, _T("second %d %s %g")));
+        EXPECT_FALSE(decoder.Decode(first.c_str(), static_cast<uint16_t>(first.length()), text));
+        EXPECT_FALSE(decoder.Decode(second.c_str(), static_cast<uint16_t>(second.length()), text));
+        EXPECT_EQ(decoder.Formats(), 1u);
+        EXPECT_EQ(Decode(decoder, data), _T("second 12 text 0.5"));
+
+        decoder.Clear();
+        EXPECT_EQ(decoder.Formats(), 0u);
+    }
+
+    TEST(Trace_Binary, Truncated)
+    {
+        Trace::Decoder decoder;
+        const string definition(Definition(7, _T("%s|%d")));
+        const string large(Trace::TRACINGBUFFERSIZE * 2, 'x');
+        string text;
+
+        EXPECT_FALSE(decoder.Decode(definition.c_str(), static_cast<uint16_t>(definition.length()), text));
+
+        // What does not fit is cut off, the record stays readable.
+        Trace::Binary data(7, large, 12);
+        EXPECT_LE(data.Length(), Trace::TRACINGBUFFERSIZE);
+
+        text = Decode(decoder, data);
+        EXPECT_EQ(text.length(), static_cast<size_t>(data.Length() - Trace::Binary::HeaderSize - 3 + 4));
+        EXPECT_EQ(text.substr(text.length() - 4), _T("|<?>"));
+
+        // A record cut short does not read beyond its end.
+        Trace::Binary number(7, _T("ab"), 12);
+        EXPECT_TRUE(decoder.Decode(number.Data(), number.Length() - 2, text));
+        EXPECT_EQ(text, _T("ab|<?>"));
+    }
+
+    TEST(Trace_Binary, FormatRegistration)
+    {
+        Trace::Decoder decoder;
+        Trace::TraceUnit& unit(Trace::TraceUnit::Instance());
+
+        const uint32_t first = unit.Format(_T("Registered %d"));
+        const uint32_t second = unit.Format(_T("Registered %s"));
+
+        // The same format always gets the same id, different formats a different one.
+        EXPECT_EQ(unit.Format(_T("Registered %d")), first);
+        EXPECT_NE(first, second);
+
+        const string definition(Definition(second, _T("Registered %s")));
+        string text;
+        EXPECT_FALSE(decoder.Decode(definition.c_str(), static_cast<uint16_t>(definition.length()), text));
+
+        Trace::Binary data(second, _T("again"));
+        EXPECT_EQ(Decode(decoder, data), _T("Registered again"));
+
+        Core::Singleton::Dispose();
+    }
+
+} // Tests
+} // WPEFramework
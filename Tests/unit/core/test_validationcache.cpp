@@ -0,0 +1,221 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    static const uint8_t Key[] = { 's', 'e', 'c', 'r', 'e', 't' };
+    // A multiple of 3 bytes, so the base64 text of the payload needs no padding.
+    static const string Payload(_T("{\"url\":\"https://www.example.com\",\"user\":\"operator\"}"));
+
+    TEST(Core_ValidationCache, HitMissExpire)
+    {
+        Core::ValidationCacheType<uint32_t> cache(4, 20);
+        uint32_t value = 0;
+
+        EXPECT_FALSE(cache.Find(_T("one"), value));
+
+        cache.Add(_T("one"), 1);
+        EXPECT_TRUE(cache.Find(_T("one"), value));
+        EXPECT_EQ(value, 1u);
+
+        // The full token has to match.
+        EXPECT_FALSE(cache.Find(_T("on"), value));
+        EXPECT_FALSE(cache.Find(_T("one "), value));
+
+        SleepMs(40);
+        EXPECT_FALSE(cache.Find(_T("one"), value));
+
+        const Core::ValidationCacheType<uint32_t>::Statistics counters(cache.Counters());
+        EXPECT_EQ(counters.Hits, 1u);
+        EXPECT_EQ(counters.Misses, 4u);
+        EXPECT_EQ(counters.Expired, 1u);
+        EXPECT_EQ(counters.Entries, 0u);
+    }
+
+    TEST(Core_ValidationCache, Bounded)
+    {
+        Core::ValidationCacheType<uint32_t> cache(3, 60000);
+        uint32_t value = 0;
+
+        for (uint32_t index = 0; index < 10; index++) {
+            cache.Add(Core::NumberType<uint32_t>(index).Text(), index);
+            SleepMs(2);
+        }
+
+        const Core::ValidationCacheType<uint32_t>::Statistics counters(cache.Counters());
+        EXPECT_EQ(counters.Entries, 3u);
+        EXPECT_EQ(counters.Evicted, 7u);
+
+        // The ones closest to expiring made room, the last ones are still there.
+        EXPECT_FALSE(cache.Find(_T("0"), value));
+        EXPECT_TRUE(cache.Find(_T("9"), value));
+        EXPECT_EQ(value, 9u);
+
+        cache.Clear();
+        EXPECT_FALSE(cache.Find(_T("9"), value));
+    }
+
+    TEST(Core_ValidationCache, Disabled)
+    {
+        Core::ValidationCacheType<uint32_t> cache(0, 60000);
+        uint32_t value = 0;
+
+        EXPECT_FALSE(cache.IsEnabled());
+
+        cache.Add(_T("one"), 1);
+        EXPECT_FALSE(cache.Find(_T("one"), value));
+        EXPECT_EQ(cache.Counters().Entries, 0u);
+    }
+
+    TEST(Core_ValidationCache, TokenLifetime)
+    {
+        Core::ValidationCacheType<uint32_t> cache(4, 60000);
+        uint32_t value = 0;
+
+        // Expired already, never added.
+        cache.Add(_T("one"), 1, 0);
+        EXPECT_FALSE(cache.Find(_T("one"), value));
+        EXPECT_EQ(cache.Counters().Entries, 0u);
+
+        // The token expires before the cache lifetime is over.
+        cache.Add(_T("two"), 2, 20);
+        EXPECT_TRUE(cache.Find(_T("two"), value));
+        SleepMs(40);
+        EXPECT_FALSE(cache.Find(_T("two"), value));
+
+        // Presented again once expired, it goes.
+        cache.Add(_T("three"), 3);
+        EXPECT_TRUE(cache.Find(_T("three"), value));
+        cache.Add(_T("three"), 3, 0);
+        EXPECT_FALSE(cache.Find(_T("three"), value));
+    }
+
+    static string Claims(const string& claims)
+    {
+        // A multiple of 3 bytes, so the base64 text of the payload needs no padding.
+        string result(_T("{") + claims);
+
+        while (((result.length() + 1) % 3) != 0) {
+            result += ' ';
+        }
+
+        return (result + _T("}"));
+    }
+
+    TEST(Web_JSONWebToken, Expiry)
+    {
+        Web::JSONWebToken encoder(Web::JSONWebToken::SHA256, sizeof(Key), Key);
+        Core::ValidationCacheType<uint32_t> cache(4, 60000);
+        const uint64_t now = static_cast<uint64_t>(::time(nullptr));
+        string token;
+        uint32_t value = 0;
+
+        const string expired(Claims(_T("\"user\":\"operator\",\"exp\":") + Core::NumberType<uint64_t>(now - 10).Text()));
+        encoder.Encode(token, static_cast<uint16_t>(expired.length()), reinterpret_cast<const uint8_t*>(expired.c_str()));
+        EXPECT_EQ(Web::JSONWebToken::Lifetime(token), 0u);
+
+        // An expired token misses the cache, even though its cache lifetime is not over.
+        cache.Add(token, 1, Web::JSONWebToken::Lifetime(token));
+        EXPECT_FALSE(cache.Find(token, value));
+
+        const string valid(Claims(_T("\"exp\":") + Core::NumberType<uint64_t>(now + 3600).Text()));
+        encoder.Encode(token, static_cast<uint16_t>(valid.length()), reinterpret_cast<const uint8_t*>(valid.c_str()));
+        EXPECT_GT(Web::JSONWebToken::Lifetime(token), 3500u * 1000u);
+        EXPECT_LE(Web::JSONWebToken::Lifetime(token), 3601u * 1000u);
+
+        cache.Add(token, 2, Web::JSONWebToken::Lifetime(token));
+        EXPECT_TRUE(cache.Find(token, value));
+
+        // No claim, no limit.
+        encoder.Encode(token, static_cast<uint16_t>(Payload.length()), reinterpret_cast<const uint8_t*>(Payload.c_str()));
+        EXPECT_EQ(Web::JSONWebToken::Lifetime(token), static_cast<uint32_t>(~0));
+        EXPECT_EQ(Web::JSONWebToken::Lifetime(_T("session")), static_cast<uint32_t>(~0));
+    }
+
+    TEST(Web_JSONWebToken, CachedDecode)
+    {
+        Web::JSONWebToken encoder(Web::JSONWebToken::SHA256, sizeof(Key), Key);
+        Web::JSONWebToken decoder(Web::JSONWebToken::SHA256, sizeof(Key), Key);
+        string token;
+        uint8_t payload[256];
+
+        encoder.Encode(token, static_cast<uint16_t>(Payload.length()), reinterpret_cast<const uint8_t*>(Payload.c_str()));
+
+        for (uint8_t round = 0; round < 3; round++) {
+            ::memset(payload, 0, sizeof(payload));
+
+            const uint16_t length = decoder.Decode(token, sizeof(payload), payload);
+
+            ASSERT_EQ(length, Payload.length());
+            EXPECT_EQ(string(reinterpret_cast<const char*>(payload), length), Payload);
+        }
+
+        Web::JSONWebToken::Statistics counters(decoder.CacheCounters());
+        EXPECT_EQ(counters.Misses, 1u);
+        EXPECT_EQ(counters.Hits, 2u);
+        EXPECT_EQ(counters.Entries, 1u);
+
+        // A buffer too small for the cached payload takes the long way.
+        EXPECT_NE(decoder.Decode(token, 4, payload), Payload.length());
+    }
+
+    TEST(Web_JSONWebToken, Rejected)
+    {
+        Web::JSONWebToken encoder(Web::JSONWebToken::SHA256, sizeof(Key), Key);
+        const uint8_t other[] = { 'o', 't', 'h', 'e', 'r' };
+        Web::JSONWebToken decoder(Web::JSONWebToken::SHA256, sizeof(other), other);
+        string token;
+        uint8_t payload[256];
+
+        encoder.Encode(token, static_cast<uint16_t>(Payload.length()), reinterpret_cast<const uint8_t*>(Payload.c_str()));
+
+        // Signed with another key: rejected every time, and never remembered.
+        EXPECT_EQ(decoder.Decode(token, sizeof(payload), payload), static_cast<uint16_t>(~0));
+        EXPECT_EQ(decoder.Decode(token, sizeof(payload), payload), static_cast<uint16_t>(~0));
+        EXPECT_EQ(decoder.CacheCounters().Entries, 0u);
+
+        // A token that was accepted does not make a tampered one acceptable.
+        ASSERT_EQ(encoder.Decode(token, sizeof(payload), payload), Payload.length());
+
+        string tampered(token);
+        tampered[tampered.length() - 2] = (tampered[tampered.length() - 2] == 'A' ? 'B' : 'A');
+        EXPECT_EQ(encoder.Decode(tampered, sizeof(payload), payload), static_cast<uint16_t>(~0));
+    }
+
+    TEST(Web_JSONWebToken, Uncached)
+    {
+        Web::JSONWebToken token(Web::JSONWebToken::SHA256, sizeof(Key), Key, 0, 0);
+        string encoded;
+        uint8_t payload[256];
+
+        token.Encode(encoded, static_cast<uint16_t>(Payload.length()), reinterpret_cast<const uint8_t*>(Payload.c_str()));
+
+        EXPECT_EQ(token.Decode(encoded, sizeof(payload), payload), Payload.length());
+        EXPECT_EQ(token.Decode(encoded, sizeof(payload), payload), Payload.length());
+        EXPECT_EQ(token.CacheCounters().Hits, 0u);
+        EXPECT_EQ(token.CacheCounters().Entries, 0u);
+    }
+
+} // Tests
+} // WPEFramework
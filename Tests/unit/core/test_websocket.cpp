@@ -0,0 +1,371 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+#include <list>
+#include <vector>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Stands in for the socket, the test moves the bytes between the two ends.
+    class Loopback {
+    public:
+        Loopback(const Loopback&) = delete;
+        Loopback& operator=(const Loopback&) = delete;
+
+        Loopback(const string& name)
+            : _name(name)
+        {
+        }
+        virtual ~Loopback() = default;
+
+    public:
+        bool IsOpen() const
+        {
+            return (true);
+        }
+        bool IsSuspended() const
+        {
+            return (false);
+        }
+        bool IsClosed() const
+        {
+            return (false);
+        }
+        string LocalId() const
+        {
+            return (_name);
+        }
+        string RemoteId() const
+        {
+            return (_name);
+        }
+        void Trigger()
+        {
+        }
+        uint32_t Close(const uint32_t)
+        {
+            return (Core::ERROR_NONE);
+        }
+
+        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
+        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        virtual void StateChange() = 0;
+
+    private:
+        string _name;
+    };
+
+    // Sends the queued messages and collects what comes in.
+    class Messages {
+    public:
+        Messages(const Messages&) = delete;
+        Messages& operator=(const Messages&) = delete;
+
+        Messages()
+            : _outbound()
+            , _offset(0)
+            , _inbound()
+        {
+        }
+
+    public:
+        void Queue(const string& message)
+        {
+            _outbound.push_back(message);
+        }
+        const string& Inbound() const
+        {
+            return (_inbound);
+        }
+        uint16_t Send(uint8_t* dataFrame, const uint16_t maxSendSize)
+        {
+            uint16_t result = 0;
+
+            if (_outbound.empty() == false) {
+                const string& message = _outbound.front();
+
+                result = static_cast<uint16_t>(std::min(static_cast<size_t>(maxSendSize), message.length() - _offset));
+                ::memcpy(dataFrame, &(message[_offset]), result);
+                _offset += result;
+
+                // A completely filled frame means there is more, so a message that ends on
+                // the boundary is only done once we returned less.
+                if ((_offset == message.length()) && (result < maxSendSize)) {
+                    _outbound.pop_front();
+                    _offset = 0;
+                }
+            }
+
+            return (result);
+        }
+        uint16_t Receive(uint8_t* dataFrame, const uint16_t receivedSize)
+        {
+            _inbound.append(reinterpret_cast<const char*>(dataFrame), receivedSize);
+
+            return (receivedSize);
+        }
+
+    private:
+        std::list<string> _outbound;
+        uint32_t _offset;
+        string _inbound;
+    };
+
+    class Client : public Web::WebSocketClientType<Loopback>, public Messages {
+    public:
+        Client()
+            : Web::WebSocketClientType<Loopback>(_T("/jsonrpc"), _T("notification"), _T(""), _T(""), false, true, _T("client"))
+            , Messages()
+        {
+        }
+
+        bool IsIdle() const override
+        {
+            return (true);
+        }
+        void StateChange() override
+        {
+        }
+        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        {
+            return (Send(dataFrame, maxSendSize));
+        }
+        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+        {
+            return (Receive(dataFrame, receivedSize));
+        }
+    };
+
+    class Server : public Web::WebSocketServerType<Loopback>, public Messages {
+    public:
+        Server()
+            : Web::WebSocketServerType<Loopback>(false, false, _T("server"))
+            , Messages()
+        {
+        }
+
+        bool IsIdle() const override
+        {
+            return (true);
+        }
+        void StateChange() override
+        {
+        }
+        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        {
+            return (Send(dataFrame, maxSendSize));
+        }
+        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+        {
+            return (Receive(dataFrame, receivedSize));
+        }
+    };
+
+    // Moves everything one side has to send to the other side, in pieces of the given size.
+    // Like the SocketPort, bytes that are not consumed are offered again with the next read.
+    template <typename FROM, typename TO>
+    static uint32_t Pump(FROM& from, TO& to, const uint16_t chunk)
+    {
+        uint8_t buffer[2048];
+        std::vector<uint8_t> received;
+        uint32_t total = 0;
+        uint16_t loaded;
+
+        EXPECT_LE(chunk, sizeof(buffer));
+
+        while ((loaded = from.Link().SendData(buffer, chunk)) > 0) {
+            uint16_t offset = 0;
+
+            // Hand it over in two parts, so frames end up split over reads.
+            while (offset < loaded) {
+                const uint16_t size = std::min(static_cast<uint16_t>(loaded - offset), static_cast<uint16_t>((loaded / 2) + 1));
+                received.insert(received.end(), &(buffer[offset]), &(buffer[offset + size]));
+                const uint16_t handled = to.Link().ReceiveData(received.data(), static_cast<uint16_t>(received.size()));
+                received.erase(received.begin(), received.begin() + handled);
+                offset += size;
+            }
+            total += loaded;
+        }
+
+        EXPECT_TRUE(received.empty());
+
+        return (total);
+    }
+
+    static void Connect(Client& client, Server& server)
+    {
+        client.Link().StateChange();
+
+        Pump(client, server, 1024);
+        Pump(server, client, 1024);
+
+        EXPECT_TRUE(client.IsWebSocket());
+        EXPECT_TRUE(server.IsWebSocket());
+    }
+
+    static string Event(const uint32_t index)
+    {
+        return (_T("{\"jsonrpc\":\"2.0\",\"method\":\"client.events.1.statechange\",\"params\":{\"callsign\":\"WebKitBrowser\",\"state\":\"activated\",\"index\":") + Core::NumberType<uint32_t>(index).Text() + _T("}}"));
+    }
+
+    TEST(Core_WebSocket, DeflateNegotiation)
+    {
+        Web::WebSocket::Deflate client;
+        Web::WebSocket::Deflate server;
+        string response;
+
+        client.Configure(Web::WebSocket::Deflate::ENABLED | Web::WebSocket::Deflate::NO_CONTEXT_TAKEOVER, 0, 15);
+        server.Configure(Web::WebSocket::Deflate::ENABLED, 0, 12);
+
+        EXPECT_TRUE(server.Accept(client.Offer(), response));
+        EXPECT_EQ(response, _T("permessage-deflate; server_no_context_takeover; client_no_context_takeover"));
+        EXPECT_TRUE(client.Agreed(response));
+        EXPECT_TRUE(client.IsActive());
+        EXPECT_TRUE(server.IsActive());
+
+        // An 8 bit window can not be honoured, the next offer is taken.
+        EXPECT_TRUE(server.Accept(_T("x-webkit-deflate-frame, permessage-deflate; server_max_window_bits=8, permessage-deflate; server_max_window_bits=10; client_max_window_bits"), response));
+        EXPECT_EQ(response, _T("permessage-deflate; server_max_window_bits=10"));
+
+        EXPECT_FALSE(server.Accept(_T("permessage-deflate; unknown_parameter"), response));
+        EXPECT_FALSE(server.IsActive());
+
+        EXPECT_FALSE(client.Agreed(_T("permessage-deflate; client_max_window_bits=8")));
+        EXPECT_FALSE(client.Agreed(_T("permessage-deflate, x-something")));
+        EXPECT_FALSE(client.IsActive());
+    }
+
+    TEST(Core_WebSocket, DeflateMessages)
+    {
+        Client client;
+        Server server;
+
+        client.Compression(Web::WebSocket::Deflate::ENABLED, 64, 15);
+        server.Compression(Web::WebSocket::Deflate::ENABLED, 64, 15);
+
+        Connect(client, server);
+
+        EXPECT_TRUE(client.IsCompressed());
+        EXPECT_TRUE(server.IsCompressed());
+
+        string expected;
+        for (uint32_t index = 0; index < 100; index++) {
+            expected += Event(index);
+            server.Queue(Event(index));
+        }
+
+        // A small one that is sent as is, and some that need more than one frame.
+        expected += _T("{}");
+        server.Queue(_T("{}"));
+
+        string large;
+        for (uint32_t index = 0; index < 200; index++) {
+            large += Event(index);
+        }
+        expected += large;
+        server.Queue(large);
+
+        string exact(1020, 'x');
+        expected += exact;
+        server.Queue(exact);
+
+        const uint32_t sent = Pump(server, client, 1024);
+
+        EXPECT_EQ(client.Inbound(), expected);
+        EXPECT_LT(sent, expected.length() / 4);
+
+        // And the other way around, masked by the client.
+        client.Queue(large);
+        client.Queue(_T("[]"));
+        Pump(client, server, 512);
+
+        EXPECT_EQ(server.Inbound(), large + _T("[]"));
+    }
+
+    TEST(Core_WebSocket, DeflateNoContextTakeover)
+    {
+        Client client;
+        Server server;
+
+        client.Compression(Web::WebSocket::Deflate::ENABLED | Web::WebSocket::Deflate::NO_CONTEXT_TAKEOVER, 0, 10);
+        server.Compression(Web::WebSocket::Deflate::ENABLED, 0, 15);
+
+        Connect(client, server);
+
+        EXPECT_TRUE(client.IsCompressed());
+
+        string expected;
+        for (uint32_t index = 0; index < 50; index++) {
+            expected += Event(index);
+            server.Queue(Event(index));
+            client.Queue(Event(index));
+        }
+
+        Pump(server, client, 1024);
+        Pump(client, server, 1024);
+
+        EXPECT_EQ(client.Inbound(), expected);
+        EXPECT_EQ(server.Inbound(), expected);
+    }
+
+    TEST(Core_WebSocket, DeflateConfiguredMode)
+    {
+        // As the PluginHost reads it from its "compression" config.
+        Core::JSON::EnumType<Web::WebSocket::Deflate::mode> mode;
+        mode.FromString(_T("\"nocontexttakeover\""));
+
+        EXPECT_EQ(mode.Value(), Web::WebSocket::Deflate::ENABLED | Web::WebSocket::Deflate::NO_CONTEXT_TAKEOVER);
+
+        Client client;
+        Server server;
+
+        client.Compression(Web::WebSocket::Deflate::ENABLED, 0, 15);
+        server.Compression(mode.Value(), 0, 15);
+
+        Connect(client, server);
+
+        EXPECT_TRUE(client.IsCompressed());
+        EXPECT_TRUE(server.IsCompressed());
+    }
+
+    TEST(Core_WebSocket, DeflateNotOffered)
+    {
+        Client client;
+        Server server;
+
+        server.Compression(Web::WebSocket::Deflate::ENABLED, 0, 15);
+
+        Connect(client, server);
+
+        EXPECT_FALSE(client.IsCompressed());
+        EXPECT_FALSE(server.IsCompressed());
+
+        server.Queue(Event(1));
+        Pump(server, client, 1024);
+
+        EXPECT_EQ(client.Inbound(), Event(1));
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,253 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    class Counter : public Core::IDispatch {
+    public:
+        Counter(const Counter&) = delete;
+        Counter& operator=(const Counter&) = delete;
+
+        Counter(std::atomic<uint32_t>& count)
+            : _count(count)
+        {
+        }
+        ~Counter() override = default;
+
+        void Dispatch() override
+        {
+            SleepMs(1);
+            _count++;
+        }
+
+    private:
+        std::atomic<uint32_t>& _count;
+    };
+
+    // Submits its children from the worker thread, they end up on the local queue.
+    class Fanout : public Core::IDispatch {
+    public:
+        Fanout(const Fanout&) = delete;
+        Fanout& operator=(const Fanout&) = delete;
+
+        Fanout(Core::WorkerPool& pool, const uint32_t children, std::atomic<uint32_t>& count, uint32_t& peak)
+            : _pool(pool)
+            , _children(children)
+            , _count(count)
+            , _peak(peak)
+        {
+        }
+        ~Fanout() override = default;
+
+        void Dispatch() override
+        {
+            for (uint32_t index = 0; index < _children; index++) {
+                _pool.Submit(Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Counter>::Create(_count)));
+
+                const uint32_t pending = _pool.Snapshot().Pending;
+                if (pending > _peak) {
+                    _peak = pending;
+                }
+            }
+        }
+
+    private:
+        Core::WorkerPool& _pool;
+        const uint32_t _children;
+        std::atomic<uint32_t>& _count;
+        uint32_t& _peak;
+    };
+
+    static void RunFanout(const bool stealing, const uint32_t children)
+    {
+        Core::WorkerPool pool(4, 0, 16, stealing);
+        std::atomic<uint32_t> count(0);
+        uint32_t peak = 0;
+
+        pool.Submit(Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Fanout>::Create(pool, children, count, peak)));
+
+        uint32_t waiting = 5000;
+        while ((count < children) && (waiting != 0)) {
+            SleepMs(10);
+            waiting -= 10;
+        }
+
+        EXPECT_EQ(count.load(), children);
+
+        const Core::WorkerPool::Metadata& snapshot = pool.Snapshot();
+        uint32_t runs = 0;
+        uint32_t local = 0;
+        uint32_t stolen = 0;
+
+        for (uint8_t index = 0; index < snapshot.Slots; index++) {
+            runs += snapshot.Slot[index];
+            local += snapshot.Local[index];
+            stolen += snapshot.Stolen[index];
+        }
+
+        EXPECT_EQ(snapshot.Pending, 0u);
+        EXPECT_EQ(runs, children + 1);
+
+        // The fan out is held back by the high-water mark, locally and on the shared queue (plus a nudge).
+        EXPECT_LE(peak, (2 * 16) + 1u);
+
+        if (stealing == true) {
+            // What did not fit locally went through the shared queue.
+            EXPECT_GT(local + stolen, 0u);
+            EXPECT_LE(local + stolen, children);
+        } else {
+            EXPECT_EQ(local, 0u);
+            EXPECT_EQ(stolen, 0u);
+        }
+
+        pool.Stop();
+    }
+
+    TEST(Core_WorkerPool, SharedQueue)
+    {
+        RunFanout(false, 64);
+    }
+
+    TEST(Core_WorkerPool, WorkStealing)
+    {
+        RunFanout(true, 64);
+    }
+
+    // Runs the job on a pool thread, not on the one that joined the pool, it hops on till it gets there.
+    class Hop : public Core::IDispatch {
+    public:
+        Hop(const Hop&) = delete;
+        Hop& operator=(const Hop&) = delete;
+
+        Hop(Core::WorkerPool& pool, const Core::ProxyType<Core::IDispatch>& job)
+            : _pool(pool)
+            , _job(job)
+        {
+        }
+        ~Hop() override = default;
+
+        void Dispatch() override
+        {
+            if (_pool.Id(1) == Core::Thread::ThreadId()) {
+                _pool.Submit(Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Hop>::Create(_pool, _job)));
+            } else {
+                _job->Dispatch();
+            }
+        }
+
+    private:
+        Core::WorkerPool& _pool;
+        Core::ProxyType<Core::IDispatch> _job;
+    };
+
+    TEST(Core_WorkerPool, WorkStealingJoined)
+    {
+        // One pool thread, so only the joined thread can steal from it.
+        Core::WorkerPool pool(1, 0, 16, true);
+        std::atomic<uint32_t> count(0);
+        uint32_t peak = 0;
+
+        std::thread joined([&pool]() { pool.Join(); });
+
+        uint32_t waiting = 2000;
+        while ((pool.Id(1) == 0) && (waiting != 0)) {
+            SleepMs(10);
+            waiting -= 10;
+        }
+        ASSERT_NE(pool.Id(1), static_cast<::ThreadId>(0));
+
+        // All children fit on the local queue of the pool thread. The first burst hands the nudge
+        // to the joined thread, the second must still be stolen.
+        for (uint8_t burst = 1; burst <= 2; burst++) {
+            const uint32_t stolen = pool.Snapshot().Stolen[0];
+
+            Core::ProxyType<Core::IDispatch> fanout(Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Fanout>::Create(pool, 16, count, peak)));
+            pool.Submit(Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Hop>::Create(pool, fanout)));
+
+            waiting = 5000;
+            while ((count < (burst * 16u)) && (waiting != 0)) {
+                SleepMs(10);
+                waiting -= 10;
+            }
+
+            EXPECT_EQ(count.load(), burst * 16u);
+            EXPECT_GT(pool.Snapshot().Stolen[0], stolen);
+        }
+
+        pool.Stop();
+        joined.join();
+    }
+
+    TEST(Core_WorkerPool, WorkStealingRevoke)
+    {
+        Core::WorkerPool pool(1, 0, 16, true);
+        std::atomic<uint32_t> count(0);
+        Core::Event started(false, true);
+        Core::Event release(false, true);
+        Core::ProxyType<Core::IDispatch> child(Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Counter>::Create(count)));
+
+        // The one and only worker submits a child and blocks, the child sits on its local queue.
+        class Blocker : public Core::IDispatch {
+        public:
+            Blocker(Core::WorkerPool& pool, Core::ProxyType<Core::IDispatch>& child, Core::Event& started, Core::Event& release)
+                : _pool(pool)
+                , _child(child)
+                , _started(started)
+                , _release(release)
+            {
+            }
+            ~Blocker() override = default;
+
+            void Dispatch() override
+            {
+                _pool.Submit(_child);
+                _started.SetEvent();
+                _release.Lock(Core::infinite);
+            }
+
+        private:
+            Core::WorkerPool& _pool;
+            Core::ProxyType<Core::IDispatch>& _child;
+            Core::Event& _started;
+            Core::Event& _release;
+        };
+
+        pool.Submit(Core::proxy_cast<Core::IDispatch>(Core::ProxyType<Blocker>::Create(pool, child, started, release)));
+
+        EXPECT_EQ(started.Lock(2000), Core::ERROR_NONE);
+        EXPECT_EQ(pool.Snapshot().Pending, 1u);
+
+        EXPECT_EQ(pool.Revoke(child, 0), Core::ERROR_NONE);
+        EXPECT_EQ(pool.Snapshot().Pending, 0u);
+
+        release.SetEvent();
+        SleepMs(50);
+
+        EXPECT_EQ(count.load(), 0u);
+
+        pool.Stop();
+    }
+
+} // Tests
+} // WPEFramework
@@ -81,6 +81,7 @@ class Metadata:
         self.length = None
         self.maxlength = None
         self.interface = None
+        self.stream = False
         self.param = OrderedDict()
         self.retval = OrderedDict()
 
@@ -263,6 +264,11 @@ class Identifier():
                         raise ParserError("maxlength tag not allowed on return value")
                     skip = 1
                     continue
+                elif token[1:] == "STREAM":
+                    if tags_allowed:
+                        self.meta.stream = True
+                    else:
+                        raise ParserError("stream tag not allowed on return value")
                 elif token[1:] == "INTERFACE":
                     self.meta.interface = string[i + 1]
                     skip = 1
@@ -1277,6 +1283,8 @@ def __Tokenize(contents):
                     tagtokens.append(__ParseLength(token, "@length"))
                 if _find("@maxlength", token):
                     tagtokens.append(__ParseLength(token, "@maxlength"))
+                if _find("@stream", token):
+                    tagtokens.append("@STREAM")
                 if _find("@interface", token):
                     tagtokens.append(__ParseLength(token, "@interface"))
 
@@ -30,7 +30,7 @@ import copy
 import CppParser
 from collections import OrderedDict
 
-VERSION = "1.6.4"
+VERSION = "1.6.5"
 NAME = "ProxyStubGenerator"
 
 # runtime changeable configuration
@@ -335,6 +335,7 @@ def GenerateStubs(output_file, source_file, defaults="", scan_only=False):
                     length = meta.length
                     maxlength = meta.maxlength
                     interface = meta.interface
+                    stream = meta.stream
                     origname = type_.name
                     self.ocv = cv
                     self.oclass = type_
@@ -367,6 +368,7 @@ def GenerateStubs(output_file, source_file, defaults="", scan_only=False):
                     self.ptr_length = length
                     self.ptr_maxlength = maxlength
                     self.ptr_interface = self.interface
+                    self.is_stream = stream
                     self.proxy = self.is_interface and (not self.is_ref or self.is_input)
                     self.origname = origname
                     self.length_constant = False
@@ -383,6 +385,10 @@ def GenerateStubs(output_file, source_file, defaults="", scan_only=False):
                     self.str_nocv = TypeStr(self.type).replace("const ", "").replace("volatile ", "")
                     self.str_cv = type.CVString()
 
+                    if self.is_stream and (not self.is_ptr or self.is_ref or self.is_interface):
+                        raise TypenameError(
+                            type_, "unable to serialise '%s %s': only a buffer can be a stream" %
+                            (self.CppType(), self.origname))
                     if not self.obj and self.is_nonconstptr and not self.is_inputptr and not self.is_outputptr and not interface:
                         raise TypenameError(
                             type_, "unable to serialise '%s %s': a non-const pointer requires an in/out tag" %
@@ -428,6 +434,8 @@ def GenerateStubs(output_file, source_file, defaults="", scan_only=False):
                     if self.is_ptr:
                         if self.is_interface:
                             return "Number<RPC::instance_id>"
+                        elif self.is_stream:
+                            return "Stream"
                         else:
                             return "Buffer<%s>" % self.length_type
                     elif isinstance(self.expanded_typename, CppParser.Enum):
@@ -705,7 +713,14 @@ def GenerateStubs(output_file, source_file, defaults="", scan_only=False):
                                 if p.is_ptr and not p.obj and not p.is_ref and p.length_type == "void":
                                     emit.Line("%s %s = %s; // storage" % (p.str_typename, p.name, NULLPTR))
                                 elif p.is_ptr and not p.obj and not p.is_ref:
-                                    if p.is_input:
+                                    if p.is_input and p.is_stream:
+                                        emit.Line("const %s %s = %s;" % (p.str_nocvref, p.name, NULLPTR))
+                                        if p.length_type == "uint32_t":
+                                            emit.Line("%s %s_length = reader.Stream(%s);" % (p.length_type, p.name, p.name))
+                                        else:
+                                            emit.Line("%s %s_length = static_cast<%s>(reader.Stream(%s));" %
+                                                      (p.length_type, p.name, p.length_type, p.name))
+                                    elif p.is_input:
                                         emit.Line("const %s %s = %s;" % (p.str_nocvref, p.name, NULLPTR))
                                         emit.Line("%s %s_length = reader.Lock%s(%s);" %
                                                   (p.length_type, p.name, p.RpcTypeNoCV(), p.name))
@@ -750,13 +765,17 @@ def GenerateStubs(output_file, source_file, defaults="", scan_only=False):
                                                 emit.Line("%s = const_cast<%s>(%s);" % (p.name, p.str_nocvref, oldname))
                                                 emit.Line("if (%s > %s) {" % (p.maxlength_var, p.length_var))
                                                 emit.IndentInc()
-                                                if p.length_type not in [
-                                                        "char", "short", "int8_t", "uint8_t", "int16_t", "uint16_t"
-                                                ]:
-                                                    emit.Line("ASSERT((%s < 0x10000) && \"Buffer too large\");" %
-                                                              length_var)
-                                                emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
-                                                          (p.name, p.str_nocvref, length_var))
+                                                if p.is_stream:
+                                                    emit.Line("%s = static_cast<%s>(message->Response().Allocate(%s));" %
+                                                              (p.name, p.str_nocvref, length_var))
+                                                else:
+                                                    if p.length_type not in [
+                                                            "char", "short", "int8_t", "uint8_t", "int16_t", "uint16_t"
+                                                    ]:
+                                                        emit.Line("ASSERT((%s < 0x10000) && \"Buffer too large\");" %
+                                                                  length_var)
+                                                    emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
+                                                              (p.name, p.str_nocvref, length_var))
                                                 emit.Line("ASSERT(%s != nullptr);" % p.name)
                                             else:
                                                 # is input/output but maxlength not defined
@@ -767,13 +786,18 @@ def GenerateStubs(output_file, source_file, defaults="", scan_only=False):
                                             if not p.length_constant:
                                                 emit.Line("if (%s != 0) {" % p.length_var)
                                                 emit.IndentInc()
-                                            if p.length_type not in [
-                                                    "char", "short", "int8_t", "uint8_t", "int16_t", "uint16_t"
-                                            ]:
-                                                emit.Line("ASSERT((%s < 0x10000) && \"Buffer length too big\");" %
-                                                          length_var)
-                                            emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
-                                                      (p.name, p.str_nocvref, length_var))
+                                            if p.is_stream:
+                                                # filled in where it goes out, no copy on return
+                                                emit.Line("%s = static_cast<%s>(message->Response().Allocate(%s));" %
+                                                          (p.name, p.str_nocvref, length_var))
+                                            else:
+                                                if p.length_type not in [
+                                                        "char", "short", "int8_t", "uint8_t", "int16_t", "uint16_t"
+                                                ]:
+                                                    emit.Line("ASSERT((%s < 0x10000) && \"Buffer length too big\");" %
+                                                              length_var)
+                                                emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
+                                                          (p.name, p.str_nocvref, length_var))
                                             emit.Line("ASSERT(%s != nullptr);" % p.name)
                                             if not p.length_constant:
                                                 emit.IndentDec()
@@ -1343,6 +1367,8 @@ if __name__ == "__main__":
         print("   @maxlength:<expr>   - specifies a maximum buffer length value (a constant, a parameter name or a math expression),")
         print("                         if not specified @length is used as maximum length, use round parenthesis for expressions",)
         print("                         e.g.: @length:bufferSize @length:(width*height*4)")
+        print("   @stream             - passes a (large) buffer next to the message frame instead of inside it,")
+        print("                         it is not copied on the receiving side and is not limited to 64K")
         print("")
         print("The tags shall be placed inside comments.")
         sys.exit()